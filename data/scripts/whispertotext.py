@@ -4,6 +4,8 @@
 
 import codecs
 import datetime
+import math
+import multiprocessing
 import os
 import re
 import subprocess
@@ -23,6 +25,13 @@ import whisper
 # 7. out point
 # 8. tmp file name to extract a clip's part
 
+SAMPLE_RATE = 16000
+# Long sources are cut in chunks so results can be streamed while the rest is
+# still being processed; chunks overlap so no word is lost at a cut point and
+# each segment is attributed to a single chunk by its midpoint
+CHUNK_SECONDS = 60
+OVERLAP_SECONDS = 5
+
 def avoid_fp16(device):
     """fp16 doesn't work on some GPUs, such as Nvidia GTX 16xx. See bug 467573."""
     if device == "cpu": # fp16 option doesn't matter for CPU
@@ -49,9 +58,7 @@ def extract_zone(source, outfile, in_point, out_point):
                             stdout=subprocess.PIPE)
 
 
-def run_whisper(source, model, device="cpu", task="transcribe", extraparams=""):
-    model = whisper.load_model(model, device)
-
+def build_transcribe_kwargs(device, task="transcribe", extraparams=""):
     transcribe_kwargs = {
         "task": task,
         "verbose": False,
@@ -74,9 +81,53 @@ def run_whisper(source, model, device="cpu", task="transcribe", extraparams=""):
     elif avoid_fp16(device):
         transcribe_kwargs["fp16"] = False
 
+    return transcribe_kwargs
+
+
+def run_whisper(source, model, device="cpu", task="transcribe", extraparams=""):
+    transcribe_kwargs = build_transcribe_kwargs(device, task, extraparams)
+    model = whisper.load_model(model, device)
     return model.transcribe(source, **transcribe_kwargs)
 
 
+_worker_model = None
+_worker_kwargs = None
+
+def init_worker(model_name, device, transcribe_kwargs):
+    global _worker_model, _worker_kwargs
+    _worker_model = whisper.load_model(model_name, device)
+    _worker_kwargs = transcribe_kwargs
+
+def transcribe_chunk(chunk):
+    index, offset, samples = chunk
+    result = _worker_model.transcribe(samples, **_worker_kwargs)
+    return index, offset, result["segments"]
+
+def worker_count(device, chunks):
+    if device != "cpu":
+        # CUDA serializes the decoding anyway and a model per process would
+        # exhaust GPU memory, chunking still gives incremental results
+        return 1
+    # torch already runs multithreaded per transcription, so keep the pool small
+    return max(1, min(2, (os.cpu_count() or 1) // 4, chunks))
+
+def emit_segments(segments, offset, keep_from, keep_to):
+    res = ''
+    for segment in segments:
+        start_time = segment["start"] + offset
+        end_time = segment["end"] + offset
+        midpoint = (start_time + end_time) / 2
+        if midpoint < keep_from or midpoint >= keep_to:
+            # belongs to the overlap owned by the neighbouring chunk
+            continue
+        res += '[' + str(start_time) + '>' + str(end_time) + ']' + '\n'
+        for j in segment["words"]:
+            res += '[' + str(j["start"] + offset) + '>' + str(j["end"] + offset) + ']' + j["word"] + '\n'
+    if res:
+        sys.stdout.buffer.write(res.encode('utf-8'))
+        sys.stdout.flush()
+
+
 def main():
     source=sys.argv[1]
     if len(sys.argv) > 8 and (float(sys.argv[6])>0 or float(sys.argv[7])>0):
@@ -88,20 +139,35 @@ def main():
     device = sys.argv[3]
     task = sys.argv[4]
     language = sys.argv[5]
-    result = run_whisper(source, model, device, task, language)
-
-    for i in result["segments"]:
-        start_time = i["start"]
-        end_time = i["end"]
-        duration = end_time - start_time
-        timestamp = f"{start_time:.3f} - {end_time:.3f}"
-        text = i["text"]
-        words = i["words"]
-        res = '[' + str(start_time) + '>' + str(end_time) + ']' + '\n'
-        for j in words:
-            res += '[' + str(j["start"]) + '>' + str(j["end"]) + ']' + j["word"] + '\n'
-        sys.stdout.buffer.write(res.encode('utf-8'))
-    sys.stdout.flush()
+
+    audio = whisper.load_audio(source)
+    total_seconds = len(audio) / SAMPLE_RATE
+    chunks = max(1, int(math.ceil(total_seconds / CHUNK_SECONDS)))
+    if chunks == 1:
+        result = run_whisper(source, model, device, task, language)
+        emit_segments(result["segments"], 0., 0., total_seconds + 1.)
+        return 0
+
+    transcribe_kwargs = build_transcribe_kwargs(device, task, language)
+    # a per chunk progress bar would garble the aggregated progress we report
+    transcribe_kwargs["verbose"] = None
+    tasks = []
+    for k in range(chunks):
+        lo = max(0., k * CHUNK_SECONDS - OVERLAP_SECONDS)
+        hi = min(total_seconds, (k + 1) * CHUNK_SECONDS + OVERLAP_SECONDS)
+        tasks.append((k, lo, audio[int(lo * SAMPLE_RATE):int(hi * SAMPLE_RATE)]))
+
+    context = multiprocessing.get_context('spawn')
+    with context.Pool(worker_count(device, chunks), initializer=init_worker,
+                      initargs=(model, device, transcribe_kwargs)) as pool:
+        # imap preserves chunk order so the text streams out chronologically
+        # while later chunks are still decoding
+        for k, offset, segments in pool.imap(transcribe_chunk, tasks):
+            keep_from = k * CHUNK_SECONDS if k > 0 else 0.
+            keep_to = (k + 1) * CHUNK_SECONDS if k < chunks - 1 else total_seconds + 1.
+            emit_segments(segments, offset, keep_from, keep_to)
+            sys.stderr.write('%d%%|\n' % int(100 * (k + 1) / chunks))
+            sys.stderr.flush()
     return 0
 
 
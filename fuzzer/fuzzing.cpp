@@ -10,6 +10,7 @@
 #include "doc/docundostack.hpp"
 #include "fakeit_standalone.hpp"
 #include "logger.hpp"
+#include <chrono>
 #include <mlt++/MltFactory.h>
 #include <mlt++/MltProducer.h>
 #include <mlt++/MltProfile.h>
@@ -109,7 +110,7 @@ bool isIthParamARef(const rttr::method &method, size_t i)
 } // namespace
 } // namespace
 
-void fuzz(const std::string &input)
+void fuzz(const std::string &input, OperationTimings *timings)
 {
     Logger::init();
     Logger::clear();
@@ -246,15 +247,21 @@ void fuzz(const std::string &input)
     std::string c;
 
     while (ss >> c) {
+        // Only the operation itself is timed, not the consistency checks below
+        const auto opStart = std::chrono::steady_clock::now();
+        std::string opName;
         if (c == "u") {
             std::cout << "UNDOING" << std::endl;
             undoStack->undo();
+            opName = "undo";
         } else if (c == "r") {
             std::cout << "REDOING" << std::endl;
             undoStack->redo();
+            opName = "redo";
         } else if (Logger::back_translation_table.count(c) > 0) {
             // std::cout << "found=" << c;
             c = Logger::back_translation_table[c];
+            opName = c;
             // std::cout << " translated=" << c << std::endl;
             if (c == "constr_TimelineModel") {
                 all_timelines.emplace_back(TimelineItemModel::construct(&profile, guideModel, undoStack));
@@ -472,6 +479,9 @@ void fuzz(const std::string &input)
                 }
             }
         }
+        if (timings && !opName.empty()) {
+            (*timings)[opName].push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - opStart).count());
+        }
         update_elems();
         for (const auto &t : all_timelines) {
             assert(t->checkConsistency());
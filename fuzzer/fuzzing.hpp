@@ -7,6 +7,13 @@
 
 #pragma once
 
+#include <map>
 #include <string>
+#include <vector>
 
-void fuzz(const std::string &input);
+/** Durations (in microseconds) of every executed operation, keyed by the operation
+    name from the log. Filled by fuzz() when a non-null pointer is passed, so the
+    benchmark runner can build per-operation timing distributions. */
+using OperationTimings = std::map<std::string, std::vector<double>>;
+
+void fuzz(const std::string &input, OperationTimings *timings = nullptr);
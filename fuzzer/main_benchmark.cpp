@@ -0,0 +1,156 @@
+/*
+    SPDX-FileCopyrightText: 2026 Jean-Baptiste Mardelle <jb@kdenlive.org>
+    This file is part of Kdenlive. See www.kdenlive.org.
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "core.h"
+#include "fuzzing.hpp"
+#include <QApplication>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <mlt++/MltFactory.h>
+#include <mlt++/MltRepository.h>
+#include <sstream>
+
+/* Replay-benchmark mode of the fuzzer: replays a captured operation log (same format
+   as fuzz / fuzz_reproduce, i.e. the translated traces produced by src/logger.hpp)
+   several times and reports per-operation timing distributions. With --baseline the
+   measured medians are compared against a stored baseline and the run fails when an
+   operation regressed beyond the tolerance, so real session logs can gate performance
+   changes in CI:
+
+   fuzz_benchmark oplog.txt --update-baseline baseline.txt   # record reference timings
+   fuzz_benchmark oplog.txt --baseline baseline.txt          # fail on >20% regression
+*/
+
+namespace {
+
+double percentile(std::vector<double> values, double pct)
+{
+    std::sort(values.begin(), values.end());
+    size_t ix = size_t(pct * double(values.size() - 1) / 100.);
+    return values[ix];
+}
+
+std::map<std::string, double> readBaseline(const std::string &path)
+{
+    std::map<std::string, double> baseline;
+    std::ifstream in(path);
+    std::string op;
+    double median = 0.;
+    while (in >> op >> median) {
+        baseline[op] = median;
+    }
+    return baseline;
+}
+
+void usage(const char *name)
+{
+    std::cout << "Usage: " << name << " <operation log file or - for stdin> [options]\n"
+              << "Options:\n"
+              << "  --runs <n>              number of replays (default 5)\n"
+              << "  --tolerance <percent>   allowed median slowdown before failing (default 20)\n"
+              << "  --baseline <file>       compare against stored baseline, exit 1 on regression\n"
+              << "  --update-baseline <file> write the measured medians as new baseline\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    QApplication app(argc, argv);
+    std::unique_ptr<Mlt::Repository> repo(Mlt::Factory::init(nullptr));
+    qputenv("MLT_TESTS", QByteArray("1"));
+
+    std::string logFile, baselineFile, updateFile;
+    int runs = 5;
+    double tolerance = 20.;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) {
+            runs = std::max(1, atoi(argv[++i]));
+        } else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerance = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            baselineFile = argv[++i];
+        } else if (strcmp(argv[i], "--update-baseline") == 0 && i + 1 < argc) {
+            updateFile = argv[++i];
+        } else if (logFile.empty()) {
+            logFile = argv[i];
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (logFile.empty()) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    std::stringstream ss;
+    if (logFile == "-") {
+        ss << std::cin.rdbuf();
+    } else {
+        std::ifstream in(logFile);
+        if (!in.is_open()) {
+            std::cerr << "Cannot open operation log " << logFile << std::endl;
+            return 2;
+        }
+        ss << in.rdbuf();
+    }
+    const std::string input = ss.str();
+
+    OperationTimings timings;
+    for (int i = 0; i < runs; ++i) {
+        // fuzz() tears the core down after each replay, rebuild it
+        Core::build(LinuxPackageType::Unknown, true);
+        fuzz(input, &timings);
+    }
+
+    std::map<std::string, double> medians;
+    std::cout << "\n== Per-operation timings over " << runs << " runs (microseconds) ==\n";
+    for (const auto &op : timings) {
+        const double median = percentile(op.second, 50.);
+        const double p90 = percentile(op.second, 90.);
+        medians[op.first] = median;
+        std::cout << op.first << " count=" << op.second.size() << " median=" << median << " p90=" << p90 << "\n";
+    }
+
+    if (!updateFile.empty()) {
+        std::ofstream out(updateFile);
+        if (!out.is_open()) {
+            std::cerr << "Cannot write baseline " << updateFile << std::endl;
+            return 2;
+        }
+        for (const auto &op : medians) {
+            out << op.first << " " << op.second << "\n";
+        }
+        std::cout << "Baseline written to " << updateFile << std::endl;
+        return 0;
+    }
+
+    if (!baselineFile.empty()) {
+        const std::map<std::string, double> baseline = readBaseline(baselineFile);
+        bool regressed = false;
+        for (const auto &op : medians) {
+            auto ref = baseline.find(op.first);
+            if (ref == baseline.end() || ref->second <= 0.) {
+                // New operations have no reference yet, skip silently
+                continue;
+            }
+            const double slowdown = 100. * (op.second - ref->second) / ref->second;
+            if (slowdown > tolerance) {
+                std::cout << "REGRESSION: " << op.first << " median " << op.second << " vs baseline " << ref->second << " (" << slowdown << "% slower)\n";
+                regressed = true;
+            }
+        }
+        if (regressed) {
+            return 1;
+        }
+        std::cout << "No regression against " << baselineFile << std::endl;
+    }
+    return 0;
+}
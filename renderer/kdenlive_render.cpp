@@ -12,9 +12,21 @@
 #include <QCommandLineParser>
 #include <QDebug>
 #include <QDir>
+#include <QAtomicInt>
 #include <QDomDocument>
+#include <QElapsedTimer>
 #include <QTemporaryFile>
+#include <QThread>
 #include <QtGlobal>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <vector>
+
+#ifdef Q_OS_LINUX
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 int main(int argc, char **argv)
 {
@@ -31,7 +43,7 @@ int main(int argc, char **argv)
     parser.addHelpOption();
     parser.addVersionOption();
 
-    parser.addPositionalArgument("mode", "Render mode. Either \"delivery\" or \"preview-chunks\".");
+    parser.addPositionalArgument("mode", "Render mode. Either \"delivery\", \"preview-chunks\" or \"benchmark\".");
     parser.parse(QCoreApplication::arguments());
     QStringList args = parser.positionalArguments();
     const QString mode = args.isEmpty() ? QString() : args.first();
@@ -47,6 +59,7 @@ int main(int argc, char **argv)
         parser.addPositionalArgument("profile_path", "Path to profile.");
         parser.addPositionalArgument("file_extension", "Rendered file extension.");
         parser.addPositionalArgument("args", "Space separated libavformat arguments.", "[arg1 arg2 ...]");
+        parser.addPositionalArgument("concurrency", "Number of chunks to render concurrently (optional, default 1).", "[concurrency]");
 
         parser.process(app);
         args = parser.positionalArguments();
@@ -71,12 +84,15 @@ int main(int argc, char **argv)
         // chunk size in frames
         int chunkSize = args.takeFirst().toInt();
         // path to profile
-        Mlt::Profile profile(args.takeFirst().toUtf8().constData());
+        const QString profilePath = args.takeFirst();
         // rendered file extension
         QString extension = args.takeFirst();
         // avformat consumer params
         QStringList consumerParams = args.takeFirst().split(QLatin1Char(' '), Qt::SkipEmptyParts);
+        // optional number of chunks to render concurrently
+        int concurrency = args.isEmpty() ? 1 : qBound(1, args.takeFirst().toInt(), QThread::idealThreadCount());
 
+        Mlt::Profile profile(profilePath.toUtf8().constData());
         profile.set_explicit(1);
         Mlt::Producer prod(profile, nullptr, playlist.toUtf8().constData());
         if (!prod.is_valid()) {
@@ -86,67 +102,289 @@ int main(int argc, char **argv)
         const char *localename = prod.get_lcnumeric();
         QLocale::setDefault(QLocale(localename));
 
-        int currentFrame = 0;
-        int rangeStart = 0;
-        int rangeEnd = 0;
-        QString frame;
-        while (!chunks.isEmpty()) {
-            if (rangeEnd == 0) {
-                // We are not processing a range
-                frame = chunks.first();
-            }
-            if (rangeEnd > 0) {
-                // We are processing a range
-                currentFrame += chunkSize + 1;
-                frame = QString::number(currentFrame);
-                if (currentFrame >= rangeEnd) {
-                    // End of range
-                    rangeStart = 0;
-                    rangeEnd = 0;
-                    // Range is processed, remove from stack
-                    chunks.removeFirst();
+        // Expand the compressed chunk list ("0-500,525,575") into the start frame of every chunk
+        QList<int> chunkFrames;
+        for (const QString &chunk : qAsConst(chunks)) {
+            if (chunk.contains(QLatin1Char('-'))) {
+                int rangeStart = chunk.section(QLatin1Char('-'), 0, 0).toInt();
+                int rangeEnd = chunk.section(QLatin1Char('-'), 1, 1).toInt();
+                for (int f = rangeStart; f <= rangeEnd; f += chunkSize + 1) {
+                    chunkFrames << f;
                 }
-            } else if (frame.contains(QLatin1Char('-'))) {
-                rangeStart = frame.section(QLatin1Char('-'), 0, 0).toInt();
-                rangeEnd = frame.section(QLatin1Char('-'), 1, 1).toInt();
-                currentFrame = rangeStart;
-                frame = QString::number(currentFrame);
             } else {
-                // Frame will be processed, remove from stack
-                chunks.removeFirst();
-            }
-            fprintf(stderr, "START:%d \n", frame.toInt());
-            QString fileName = QStringLiteral("%1.%2").arg(frame, extension);
-            if (baseFolder.exists(fileName)) {
-                // Don't overwrite an existing file
-                fprintf(stderr, "DONE:%d \n", frame.toInt());
-                continue;
-            }
-            QScopedPointer<Mlt::Producer> playlst(prod.cut(frame.toInt(), frame.toInt() + chunkSize));
-            QScopedPointer<Mlt::Consumer> cons(
-                new Mlt::Consumer(profile, QString("avformat:%1").arg(baseFolder.absoluteFilePath(fileName)).toUtf8().constData()));
-            for (const QString &param : qAsConst(consumerParams)) {
-                if (param.contains(QLatin1Char('='))) {
-                    cons->set(param.section(QLatin1Char('='), 0, 0).toUtf8().constData(), param.section(QLatin1Char('='), 1).toUtf8().constData());
+                chunkFrames << chunk.toInt();
+            }
+        }
+        if (consumerParams.contains(QLatin1String("glsl.=1"))) {
+            // The GPU pipeline cannot be driven from several consumers at once
+            concurrency = 1;
+        }
+        concurrency = qMin(concurrency, chunkFrames.count());
+
+        QAtomicInt nextChunk(0);
+        QAtomicInt chunkError(0);
+        // Each worker owns its producer and consumer; the chunks are independent so
+        // they can be encoded concurrently, the workers just pull the next start
+        // frame from a shared counter
+        auto renderChunks = [&]() {
+            Mlt::Profile chunkProfile(profilePath.toUtf8().constData());
+            chunkProfile.set_explicit(1);
+            Mlt::Producer chunkProd(chunkProfile, nullptr, playlist.toUtf8().constData());
+            if (!chunkProd.is_valid()) {
+                fprintf(stderr, "INVALID playlist: %s \n", playlist.toUtf8().constData());
+                chunkError.storeRelease(1);
+                return;
+            }
+            while (chunkError.loadAcquire() == 0) {
+                int ix = nextChunk.fetchAndAddOrdered(1);
+                if (ix >= chunkFrames.count()) {
+                    break;
+                }
+                int frame = chunkFrames.at(ix);
+                fprintf(stderr, "START:%d \n", frame);
+                QString fileName = QStringLiteral("%1.%2").arg(frame).arg(extension);
+                if (baseFolder.exists(fileName)) {
+                    // Don't overwrite an existing file
+                    fprintf(stderr, "DONE:%d \n", frame);
+                    continue;
+                }
+                QScopedPointer<Mlt::Producer> playlst(chunkProd.cut(frame, frame + chunkSize));
+                QScopedPointer<Mlt::Consumer> cons(
+                    new Mlt::Consumer(chunkProfile, QString("avformat:%1").arg(baseFolder.absoluteFilePath(fileName)).toUtf8().constData()));
+                for (const QString &param : qAsConst(consumerParams)) {
+                    if (param.contains(QLatin1Char('='))) {
+                        cons->set(param.section(QLatin1Char('='), 0, 0).toUtf8().constData(), param.section(QLatin1Char('='), 1).toUtf8().constData());
+                    }
+                }
+                if (!cons->is_valid()) {
+                    fprintf(stderr, " = =  = INVALID CONSUMER\n\n");
+                    chunkError.storeRelease(1);
+                    return;
                 }
+                cons->set("terminate_on_pause", 1);
+                cons->connect(*playlst);
+                playlst.reset();
+                cons->run();
+                cons->stop();
+                cons->purge();
+                fprintf(stderr, "DONE:%d \n", frame);
+            }
+        };
+        if (concurrency < 2) {
+            renderChunks();
+        } else {
+            QList<QThread *> workers;
+            for (int i = 0; i < concurrency; i++) {
+                workers << QThread::create(renderChunks);
             }
-            if (!cons->is_valid()) {
-                fprintf(stderr, " = =  = INVALID CONSUMER\n\n");
-                return 1;
+            for (QThread *worker : qAsConst(workers)) {
+                worker->start();
             }
-            cons->set("terminate_on_pause", 1);
-            cons->connect(*playlst);
-            playlst.reset();
-            cons->run();
-            cons->stop();
-            cons->purge();
-            fprintf(stderr, "DONE:%d \n", frame.toInt());
+            for (QThread *worker : qAsConst(workers)) {
+                worker->wait();
+                delete worker;
+            }
+        }
+        if (chunkError.loadAcquire() != 0) {
+            return 1;
         }
         // Mlt::Factory::close();
         fprintf(stderr, "+ + + RENDERING FINISHED + + + \n");
         return 0;
     }
 
+    if (mode == "benchmark") {
+
+        parser.clearPositionalArguments();
+        parser.addPositionalArgument("benchmark", "Mode: Measure the render cost of a project without encoding anything.");
+        parser.addPositionalArgument("source", "Source file (usually MLT XML).");
+
+        QCommandLineOption samplesOption("samples", "Number of frames sampled for the per-track and per-effect breakdown.", "count", QString::number(100));
+        parser.addOption(samplesOption);
+
+        QCommandLineOption noFullPassOption("no-full-pass", "Skip the full null consumer pass measuring the overall throughput.");
+        parser.addOption(noFullPassOption);
+
+        parser.process(app);
+        args = parser.positionalArguments();
+        if (args.count() != 2) {
+            qCritical() << "Error: wrong number of arguments specified\n";
+            parser.showHelp(1);
+            // the command above will quit the app with return 1;
+        }
+
+        Mlt::Factory::init();
+        LocaleHandling::resetAllLocale();
+
+        // mode
+        args.removeFirst();
+        // Source playlist path
+        QString playlist = args.takeFirst();
+        int samples = qMax(2, parser.value(samplesOption).toInt());
+
+        Mlt::Profile profile;
+        Mlt::Producer prod(profile, "xml", playlist.toUtf8().constData());
+        if (!prod.is_valid()) {
+            fprintf(stderr, "INVALID playlist: %s \n", playlist.toUtf8().constData());
+            return 1;
+        }
+        profile.from_producer(prod);
+        profile.set_explicit(1);
+        const char *localename = prod.get_lcnumeric();
+        QLocale::setDefault(QLocale(localename));
+        int duration = prod.get_playtime();
+        if (duration < 2) {
+            fprintf(stderr, "EMPTY playlist: %s \n", playlist.toUtf8().constData());
+            return 1;
+        }
+
+        // Full speed pass through a null consumer: decodes and applies every effect
+        // like a real export but discards the frames, giving the overall throughput
+        if (!parser.isSet(noFullPassOption)) {
+            fprintf(stderr, "Running full null consumer pass over %d frames...\n", duration);
+            Mlt::Consumer nullCons(profile, "null");
+            nullCons.set("terminate_on_pause", 1);
+            nullCons.connect(prod);
+            QElapsedTimer fullPassTimer;
+            fullPassTimer.start();
+            nullCons.run();
+            nullCons.stop();
+            double elapsedMs = double(fullPassTimer.elapsed());
+            printf("Full pass: %d frames in %.1fs, %.1f fps (%.2f ms/frame), estimated export pipeline time for this project: %.1f minutes\n\n", duration,
+                   elapsedMs / 1000., duration * 1000. / elapsedMs, elapsedMs / duration, elapsedMs / 60000.);
+            prod.seek(0);
+        }
+
+        // The breakdown below renders a sample of frames single threaded, then re-renders
+        // them with one effect (or track) disabled at a time: the difference to the
+        // baseline is the cost of that effect on the sampled frames
+        struct BenchItem
+        {
+            std::shared_ptr<Mlt::Filter> filter;
+            std::shared_ptr<Mlt::Producer> track;
+            QString label;
+            QString effectId;
+            double costMs = 0.;
+        };
+        std::vector<BenchItem> items;
+        // Keep the track and clip wrappers alive while we toggle their properties
+        std::vector<std::shared_ptr<Mlt::Producer>> owners;
+
+        auto collectFilters = [&items](Mlt::Service &service, const QString &where) {
+            for (int i = 0; i < service.filter_count(); i++) {
+                std::shared_ptr<Mlt::Filter> filter(service.filter(i));
+                if (filter == nullptr || !filter->is_valid() || filter->get_int("internal_added") > 0) {
+                    // Kdenlive service filters (audio levels, mixer...), not user effects
+                    continue;
+                }
+                BenchItem item;
+                item.effectId = filter->property_exists("kdenlive_id") ? filter->get("kdenlive_id") : filter->get("mlt_service");
+                item.label = QString("%1 %2").arg(where, item.effectId);
+                item.filter = filter;
+                items.push_back(item);
+            }
+        };
+
+        Mlt::Service rootService(prod.get_service());
+        if (rootService.type() == mlt_service_tractor_type) {
+            Mlt::Tractor tractor(rootService);
+            collectFilters(rootService, QStringLiteral("timeline master:"));
+            for (int t = 0; t < tractor.count(); t++) {
+                std::shared_ptr<Mlt::Producer> trackProd(tractor.track(t));
+                if (trackProd == nullptr || !trackProd->is_valid()) {
+                    continue;
+                }
+                owners.push_back(trackProd);
+                QString trackName = trackProd->property_exists("kdenlive:track_name") ? trackProd->get("kdenlive:track_name") : QString::number(t);
+                if (trackProd->get_int("hide") != 3) {
+                    // Whole track ablation, covers compositing plus everything on the track
+                    BenchItem item;
+                    item.label = QString("track %1 (total)").arg(trackName);
+                    item.track = trackProd;
+                    items.push_back(item);
+                }
+                collectFilters(*trackProd, QString("track %1:").arg(trackName));
+                if (trackProd->type() == mlt_service_playlist_type) {
+                    Mlt::Playlist trackPlaylist(*trackProd);
+                    for (int c = 0; c < trackPlaylist.count(); c++) {
+                        if (trackPlaylist.is_blank(c)) {
+                            continue;
+                        }
+                        std::shared_ptr<Mlt::Producer> clip(trackPlaylist.get_clip(c));
+                        if (clip == nullptr || !clip->is_valid()) {
+                            continue;
+                        }
+                        owners.push_back(clip);
+                        collectFilters(*clip, QString("track %1 clip %2:").arg(trackName).arg(c));
+                    }
+                }
+            }
+        }
+
+        auto measure = [&prod, &profile, duration, samples]() {
+            qint64 totalNs = 0;
+            QElapsedTimer frameTimer;
+            for (int s = 0; s < samples; s++) {
+                prod.seek(s * (duration - 1) / (samples - 1));
+                frameTimer.start();
+                std::unique_ptr<Mlt::Frame> frame(prod.get_frame());
+                if (frame && frame->is_valid()) {
+                    mlt_image_format format = mlt_image_yuv422;
+                    int width = profile.width();
+                    int height = profile.height();
+                    frame->get_image(format, width, height);
+                    mlt_audio_format audioFormat = mlt_audio_s16;
+                    int frequency = 48000;
+                    int channels = 2;
+                    int audioSamples = 0;
+                    frame->get_audio(audioFormat, frequency, channels, audioSamples);
+                }
+                totalNs += frameTimer.nsecsElapsed();
+            }
+            return double(totalNs) / 1e6 / samples;
+        };
+
+        fprintf(stderr, "Sampling %d frames for the breakdown (%zu effects and tracks)...\n", samples, items.size());
+        // Warm the decoder and disk caches so they don't inflate the baseline
+        measure();
+        double baselineMs = measure();
+        for (auto &item : items) {
+            int previous;
+            if (item.filter) {
+                previous = item.filter->get_int("disable");
+                item.filter->set("disable", 1);
+            } else {
+                previous = item.track->get_int("hide");
+                item.track->set("hide", 3);
+            }
+            item.costMs = baselineMs - measure();
+            if (item.filter) {
+                item.filter->set("disable", previous);
+            } else {
+                item.track->set("hide", previous);
+            }
+        }
+
+        std::sort(items.begin(), items.end(), [](const BenchItem &a, const BenchItem &b) { return a.costMs > b.costMs; });
+        printf("Baseline: %.2f ms/frame single threaded over %d sampled frames\nCost breakdown (slowest first):\n", baselineMs, samples);
+        std::map<QString, std::pair<int, double>> perEffect;
+        for (const auto &item : items) {
+            printf("  %7.2f ms/frame  %s\n", item.costMs, item.label.toUtf8().constData());
+            if (item.filter) {
+                perEffect[item.effectId].first++;
+                perEffect[item.effectId].second += item.costMs;
+            }
+        }
+        if (!perEffect.empty()) {
+            printf("Aggregated by effect type:\n");
+            for (const auto &effect : perEffect) {
+                printf("  %7.2f ms/frame  %s (%d instance%s)\n", effect.second.second, effect.first.toUtf8().constData(), effect.second.first,
+                       effect.second.first > 1 ? "s" : "");
+            }
+        }
+        return 0;
+    }
+
     if (mode == "delivery") {
         parser.clearPositionalArguments();
         parser.addPositionalArgument("delivery", "Mode: Render to a final output file.");
@@ -165,6 +403,22 @@ int main(int argc, char **argv)
         QCommandLineOption subtitleOption("subtitle", "Subtitle file.", "file");
         parser.addOption(subtitleOption);
 
+        QCommandLineOption chunksOption("chunks", "Split the render into this many timeline segments processed by concurrent render processes.", "count",
+                                        QString::number(1));
+        parser.addOption(chunksOption);
+
+        QCommandLineOption loudnessOption("loudness", "Normalize the audio loudness to EBU R128 using a fast audio only analysis pass before the encode.");
+        parser.addOption(loudnessOption);
+
+        QCommandLineOption numaOption("numa", "Pin each render process to a single NUMA node, alternating nodes for segment renders (Linux only).");
+        parser.addOption(numaOption);
+
+        QCommandLineOption stemOption("stem",
+                                      "Additional scene list encoded concurrently with the main one, its consumer carries its own target. Can be "
+                                      "specified multiple times.",
+                                      "file");
+        parser.addOption(stemOption);
+
         parser.process(app);
         args = parser.positionalArguments();
 
@@ -180,6 +434,8 @@ int main(int argc, char **argv)
         QString render = args.takeFirst();
         // Source playlist path
         QString playlist = args.takeFirst();
+        // Scene lists handed over a memory-backed file descriptor of the main Kdenlive process
+        const bool memoryScenelist = playlist.startsWith(QLatin1String("/proc/"));
 
         LocaleHandling::resetAllLocale();
         QFile f(playlist);
@@ -204,7 +460,11 @@ int main(int argc, char **argv)
             out = consumer.attribute(QStringLiteral("out"), QString::number(-1)).toInt();
             target = consumer.attribute(QStringLiteral("target"));
             QString output = parser.value(outputOption);
-            if (!output.isEmpty()) {
+            if (!output.isEmpty() && memoryScenelist) {
+                // The memory copy made below carries the modified target, no temporary file needed
+                consumer.setAttribute(QStringLiteral("target"), output);
+                target = output;
+            } else if (!output.isEmpty()) {
                 // A custom output target was set.
                 // To apply it we store a copy of the source file with the modified target
                 // in a temporary file and use this file instead of the original source file.
@@ -232,16 +492,80 @@ int main(int argc, char **argv)
                 tmp.close();
             }
         }
+#ifdef Q_OS_LINUX
+        if (memoryScenelist) {
+            // The handed over path dies with the main Kdenlive process; copy the scene
+            // list into our own memory-backed file so the render keeps going if Kdenlive
+            // quits, and so the loudness pass can rewrite it without touching the disk
+            int fd = memfd_create("kdenlive-scenelist", 0);
+            if (fd >= 0) {
+                const QByteArray content = doc.toString().toUtf8();
+                qint64 done = 0;
+                while (done < content.size()) {
+                    ssize_t count = write(fd, content.constData() + done, size_t(content.size() - done));
+                    if (count < 0) {
+                        break;
+                    }
+                    done += count;
+                }
+                if (done == content.size()) {
+                    // The descriptor intentionally stays open for the lifetime of this process
+                    playlist = QStringLiteral("/proc/%1/fd/%2").arg(QCoreApplication::applicationPid()).arg(fd);
+                } else {
+                    close(fd);
+                }
+            }
+        }
+#endif
         int pid = parser.value(pidOption).toInt();
         QString subtitleFile = parser.value(subtitleOption);
+        int chunks = qMax(1, parser.value(chunksOption).toInt());
+        bool normalizeLoudness = parser.isSet(loudnessOption);
+        bool numaPin = parser.isSet(numaOption);
+
+        const QStringList stemPlaylists = parser.values(stemOption);
 
-        auto *rJob = new RenderJob(render, playlist, target, pid, in, out, subtitleFile, &app);
-        QObject::connect(rJob, &RenderJob::renderingFinished, rJob, [&]() {
+        // The main delivery and every stem must finish before the process quits
+        int pendingJobs = 1 + stemPlaylists.count();
+        auto jobFinished = [&app, &pendingJobs]() {
+            if (--pendingJobs == 0) {
+                app.quit();
+            }
+        };
+
+        auto *rJob = new RenderJob(render, playlist, target, pid, in, out, subtitleFile, chunks, normalizeLoudness, numaPin, &app);
+        QObject::connect(rJob, &RenderJob::renderingFinished, rJob, [rJob, jobFinished]() {
             rJob->deleteLater();
-            app.quit();
+            jobFinished();
         });
         // app.setQuitOnLastWindowClosed(false);
         QMetaObject::invokeMethod(rJob, "start", Qt::QueuedConnection);
+
+        for (const QString &stemPlaylist : stemPlaylists) {
+            // Stem scene lists mute all but one audio track and carry their own
+            // consumer target; encoding them alongside the main delivery makes a
+            // multi stem export cost one render session instead of one per stem
+            int stemIn = -1;
+            int stemOut = -1;
+            QString stemTarget;
+            QFile stemFile(stemPlaylist);
+            QDomDocument stemDoc;
+            if (stemFile.open(QIODevice::ReadOnly) && stemDoc.setContent(&stemFile, false)) {
+                QDomElement stemConsumer = stemDoc.documentElement().firstChildElement(QStringLiteral("consumer"));
+                if (!stemConsumer.isNull()) {
+                    stemIn = stemConsumer.attribute(QStringLiteral("in"), QString::number(-1)).toInt();
+                    stemOut = stemConsumer.attribute(QStringLiteral("out"), QString::number(-1)).toInt();
+                    stemTarget = stemConsumer.attribute(QStringLiteral("target"));
+                }
+            }
+            stemFile.close();
+            auto *stemJob = new RenderJob(render, stemPlaylist, stemTarget, -1, stemIn, stemOut, QString(), 1, false, false, &app);
+            QObject::connect(stemJob, &RenderJob::renderingFinished, stemJob, [stemJob, jobFinished]() {
+                stemJob->deleteLater();
+                jobFinished();
+            });
+            QMetaObject::invokeMethod(stemJob, "start", Qt::QueuedConnection);
+        }
         return app.exec();
     }
 
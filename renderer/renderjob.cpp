@@ -16,9 +16,17 @@
 #endif
 #include <QDebug>
 #include <QDir>
+#include <QDomDocument>
 #include <QElapsedTimer>
+#include <QFileInfo>
 #include <QStandardPaths>
+#include <QTemporaryFile>
+#include <mlt++/Mlt.h>
 #include <utility>
+
+#ifdef Q_OS_LINUX
+#include <sched.h>
+#endif
 // Can't believe I need to do this to sleep.
 class SleepThread : QThread
 {
@@ -27,8 +35,8 @@ public:
     static void msleep(unsigned long msecs) { QThread::msleep(msecs); }
 };
 
-RenderJob::RenderJob(const QString &render, const QString &scenelist, const QString &target, int pid, int in, int out, const QString &subtitleFile,
-                     QObject *parent)
+RenderJob::RenderJob(const QString &render, const QString &scenelist, const QString &target, int pid, int in, int out, const QString &subtitleFile, int chunks,
+                     bool normalizeLoudness, bool numaPin, QObject *parent)
     : QObject(parent)
     , m_scenelist(scenelist)
     , m_dest(target)
@@ -49,6 +57,13 @@ RenderJob::RenderJob(const QString &render, const QString &scenelist, const QStr
     , m_pid(pid)
     , m_dualpass(false)
     , m_subtitleFile(subtitleFile)
+    , m_chunks(chunks)
+    , m_normalizeLoudness(normalizeLoudness)
+    , m_numaPin(numaPin)
+    , m_finishedSegments(0)
+    , m_segmentError(false)
+    , m_audioStripThread(nullptr)
+    , m_abortStrip(false)
 {
     m_renderProcess = new QProcess(&m_looper);
     m_renderProcess->setReadChannel(QProcess::StandardError);
@@ -68,6 +83,7 @@ RenderJob::RenderJob(const QString &render, const QString &scenelist, const QStr
 
 RenderJob::~RenderJob()
 {
+    stopAudioStripScan();
 #ifndef NODBUS
     delete m_jobUiserver;
     delete m_kdenliveinterface;
@@ -119,6 +135,15 @@ void RenderJob::sendFinish(int status, const QString &error)
 void RenderJob::slotAbort()
 {
     m_renderProcess->kill();
+    if (!m_segmentProcesses.isEmpty()) {
+        m_segmentError = true;
+        for (QProcess *proc : qAsConst(m_segmentProcesses)) {
+            if (proc->state() != QProcess::NotRunning) {
+                proc->kill();
+            }
+        }
+        cleanupSegments();
+    }
     sendFinish(-3, QString());
     if (m_erase) {
         QFile(m_scenelist).remove();
@@ -271,14 +296,442 @@ void RenderJob::start()
     }
 #endif
 
+    if (m_normalizeLoudness && !analyseLoudness()) {
+        m_logstream << "Loudness analysis failed, rendering without normalization\n";
+    }
+
+    // Scan the program audio in parallel with the encode and stream a compact peak strip to
+    // the application, so dead air or missing channels show in the render queue while the
+    // encode is still running. The second pass of a two pass encode reuses the pass 1 strip
+    if (!m_args.contains(QStringLiteral("pass=2"))) {
+        m_audioStripThread = QThread::create([this] { scanAudioStrip(); });
+        m_audioStripThread->start(QThread::LowPriority);
+        connect(&m_audioStripTimer, &QTimer::timeout, this, &RenderJob::sendAudioStrip);
+        m_audioStripTimer.start(3000);
+    }
+
+    if (m_chunks > 1 && startSegmentedRender()) {
+        m_looper.exec();
+        return;
+    }
+
     // Because of the logging, we connect to stderr in all cases.
     connect(m_renderProcess, &QProcess::readyReadStandardError, this, &RenderJob::receivedStderr);
+    applyNumaPin(m_renderProcess, 0);
     m_renderProcess->start(m_prog, m_args);
     m_logstream << "Started render process: " << m_prog << ' ' << m_args.join(QLatin1Char(' ')) << "\n";
     m_logstream.flush();
     m_looper.exec();
 }
 
+// static
+QList<QList<int>> RenderJob::numaNodeCpus()
+{
+    QList<QList<int>> nodes;
+#ifdef Q_OS_LINUX
+    QDir nodeDir(QStringLiteral("/sys/devices/system/node"));
+    const QStringList entries = nodeDir.entryList({QStringLiteral("node*")}, QDir::Dirs, QDir::Name);
+    for (const QString &entry : entries) {
+        QFile cpuList(nodeDir.absoluteFilePath(entry + QStringLiteral("/cpulist")));
+        if (!cpuList.open(QIODevice::ReadOnly)) {
+            continue;
+        }
+        // The list is of the form "0-15,32-47"
+        QList<int> cpus;
+        const QStringList ranges = QString::fromLatin1(cpuList.readAll()).simplified().split(QLatin1Char(','), Qt::SkipEmptyParts);
+        for (const QString &range : ranges) {
+            int first = range.section(QLatin1Char('-'), 0, 0).toInt();
+            int last = range.contains(QLatin1Char('-')) ? range.section(QLatin1Char('-'), 1, 1).toInt() : first;
+            for (int cpu = first; cpu <= last; cpu++) {
+                cpus << cpu;
+            }
+        }
+        if (!cpus.isEmpty()) {
+            nodes << cpus;
+        }
+    }
+#endif
+    return nodes;
+}
+
+void RenderJob::applyNumaPin(QProcess *process, int jobIndex)
+{
+#if defined(Q_OS_LINUX) && QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    if (!m_numaPin) {
+        return;
+    }
+    if (m_numaNodes.isEmpty()) {
+        m_numaNodes = numaNodeCpus();
+    }
+    if (m_numaNodes.size() < 2) {
+        // Single node machine, nothing to gain from pinning
+        return;
+    }
+    const QList<int> cpus = m_numaNodes.at(jobIndex % m_numaNodes.size());
+    // The modifier runs in the child between fork and exec, so all threads melt spawns
+    // inherit the affinity and the whole job stays on one node
+    process->setChildProcessModifier([cpus]() {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : cpus) {
+            CPU_SET(cpu, &set);
+        }
+        sched_setaffinity(0, sizeof(set), &set);
+    });
+    m_logstream << "Pinning render process " << jobIndex << " to NUMA node " << jobIndex % m_numaNodes.size() << "\n";
+#else
+    Q_UNUSED(process)
+    Q_UNUSED(jobIndex)
+#endif
+}
+
+bool RenderJob::analyseLoudness()
+{
+    // Scan the program audio in process with a null consumer. Only the audio is
+    // decoded, so this pass is much faster than the encode it replaces
+    Mlt::Factory::init();
+    Mlt::Profile profile;
+    Mlt::Producer producer(profile, "xml", m_scenelist.toUtf8().constData());
+    if (!producer.is_valid()) {
+        m_logstream << "Invalid playlist for loudness analysis: " << m_scenelist << "\n";
+        return false;
+    }
+    Mlt::Filter filter(profile, "loudness");
+    if (!filter.is_valid()) {
+        m_logstream << "MLT loudness filter not found\n";
+        return false;
+    }
+    producer.attach(filter);
+    Mlt::Consumer consumer(profile, "null");
+    if (!consumer.is_valid()) {
+        return false;
+    }
+    consumer.set("real_time", -1);
+    consumer.set("video_off", 1);
+    consumer.set("terminate_on_pause", 1);
+    consumer.connect(producer);
+    consumer.run();
+    consumer.stop();
+    const QString results = QString::fromUtf8(filter.get("results"));
+    if (results.isEmpty()) {
+        return false;
+    }
+    // Inject a loudness filter carrying the measured results into the scenelist, so
+    // the encode applies the matching gain without a second analysis
+    QFile f(m_scenelist);
+    QDomDocument doc;
+    if (!f.open(QIODevice::ReadOnly) || !doc.setContent(&f, false)) {
+        return false;
+    }
+    f.close();
+    QDomElement tractor = doc.documentElement().lastChildElement(QStringLiteral("tractor"));
+    if (tractor.isNull()) {
+        return false;
+    }
+    QDomElement loudness = doc.createElement(QStringLiteral("filter"));
+    auto addProperty = [&doc, &loudness](const QString &name, const QString &value) {
+        QDomElement prop = doc.createElement(QStringLiteral("property"));
+        prop.setAttribute(QStringLiteral("name"), name);
+        prop.appendChild(doc.createTextNode(value));
+        loudness.appendChild(prop);
+    };
+    addProperty(QStringLiteral("mlt_service"), QStringLiteral("loudness"));
+    addProperty(QStringLiteral("results"), results);
+    tractor.appendChild(loudness);
+    if (!f.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    QTextStream stream(&f);
+    doc.save(stream, 1);
+    f.close();
+    m_logstream << "Loudness analysis results: " << results << "\n";
+    return true;
+}
+
+// Width of the audio peak strip shown in the render queue
+static const int audioStripWidth = 200;
+
+void RenderJob::scanAudioStrip()
+{
+    Mlt::Factory::init();
+    Mlt::Profile profile;
+    Mlt::Producer producer(profile, "xml", m_scenelist.toUtf8().constData());
+    if (!producer.is_valid()) {
+        return;
+    }
+    Mlt::Filter level(profile, "audiolevel");
+    if (!level.is_valid()) {
+        return;
+    }
+    producer.attach(level);
+    const int in = qMax(0, m_framein);
+    const int out = m_frameout > in ? qMin(m_frameout, producer.get_playtime() - 1) : producer.get_playtime() - 1;
+    const int total = out - in + 1;
+    if (total <= 0) {
+        return;
+    }
+    if (in > 0) {
+        producer.seek(in);
+    }
+    const int buckets = qMin(total, audioStripWidth);
+    QByteArray strip(buckets, '\0');
+    mlt_audio_format format = mlt_audio_s16;
+    const double fps = producer.get_fps();
+    for (int pos = in; pos <= out && !m_abortStrip; ++pos) {
+        QScopedPointer<Mlt::Frame> frame(producer.get_frame());
+        if (frame == nullptr || !frame->is_valid()) {
+            break;
+        }
+        if (frame->get_int("test_audio") == 0) {
+            // Only the audio is decoded, the video chain stays untouched
+            int frequency = 48000;
+            int channels = 2;
+            int samples = mlt_audio_calculate_frame_samples(float(fps), frequency, pos);
+            frame->get_audio(format, frequency, channels, samples);
+            const double peak = qMax(frame->get_double("meta.media.audio_level.0"), frame->get_double("meta.media.audio_level.1"));
+            const uchar value = uchar(255 * qMin(peak, 1.0));
+            const int bucket = int(qint64(pos - in) * buckets / total);
+            if (value > uchar(strip.at(bucket))) {
+                strip[bucket] = char(value);
+            }
+        }
+        if ((pos & 63) == 0) {
+            QMutexLocker lock(&m_audioStripMutex);
+            m_audioStrip = strip;
+        }
+    }
+    QMutexLocker lock(&m_audioStripMutex);
+    m_audioStrip = strip;
+}
+
+void RenderJob::sendAudioStrip()
+{
+    QByteArray strip;
+    {
+        QMutexLocker lock(&m_audioStripMutex);
+        strip = m_audioStrip;
+    }
+    if (strip.isEmpty() || strip == m_lastSentStrip) {
+        return;
+    }
+    m_lastSentStrip = strip;
+#ifndef NODBUS
+    if ((m_kdenliveinterface != nullptr) && m_kdenliveinterface->isValid()) {
+        m_kdenliveinterface->callWithArgumentList(QDBus::NoBlock, QStringLiteral("setRenderingAudioLevels"), {m_dest, strip});
+    }
+#else
+    if (m_kdenlivesocket->state() == QLocalSocket::ConnectedState) {
+        QJsonObject method, args;
+        args["url"] = m_dest;
+        args["levels"] = QString::fromLatin1(strip.toBase64());
+        method["setRenderingAudioLevels"] = args;
+        m_kdenlivesocket->write(QJsonDocument(method).toJson());
+        m_kdenlivesocket->flush();
+    }
+#endif
+}
+
+void RenderJob::stopAudioStripScan()
+{
+    m_audioStripTimer.stop();
+    if (m_audioStripThread) {
+        m_abortStrip = true;
+        m_audioStripThread->wait();
+        delete m_audioStripThread;
+        m_audioStripThread = nullptr;
+        // Push out whatever part of the strip was scanned
+        sendAudioStrip();
+    }
+}
+
+bool RenderJob::startSegmentedRender()
+{
+    if (m_framein < 0 || m_frameout <= m_framein) {
+        return false;
+    }
+    // We need ffmpeg to join the rendered segments
+    const QString ffmpegExe = QStandardPaths::findExecutable(QStringLiteral("ffmpeg"));
+    if (ffmpegExe.isEmpty()) {
+        m_logstream << "No ffmpeg found, cannot use segmented rendering\n";
+        return false;
+    }
+    QFile f(m_scenelist);
+    QDomDocument doc;
+    if (!f.open(QIODevice::ReadOnly) || !doc.setContent(&f, false)) {
+        return false;
+    }
+    f.close();
+    QDomElement consumer = doc.documentElement().firstChildElement(QStringLiteral("consumer"));
+    if (consumer.isNull() || !consumer.attribute(QStringLiteral("pass")).isEmpty()) {
+        // Two pass encoding needs a shared analysis log, keep it on one process
+        return false;
+    }
+    const int totalFrames = m_frameout - m_framein + 1;
+    // Don't spawn a process for ridiculously small segments
+    const int segments = qMin(m_chunks, qMax(1, totalFrames / 25));
+    if (segments < 2) {
+        return false;
+    }
+    const QFileInfo destInfo(m_dest);
+    const int segmentLength = totalFrames / segments;
+    for (int i = 0; i < segments; i++) {
+        int segmentIn = m_framein + i * segmentLength;
+        // The segments are cut on exact frame boundaries, so they can be
+        // butt-joined without overlap or audio crossfade
+        int segmentOut = i == segments - 1 ? m_frameout : segmentIn + segmentLength - 1;
+        const QString segmentDest =
+            QDir::temp().absoluteFilePath(QStringLiteral("%1-seg%2.%3").arg(destInfo.completeBaseName()).arg(i).arg(destInfo.suffix()));
+        consumer.setAttribute(QStringLiteral("in"), segmentIn);
+        consumer.setAttribute(QStringLiteral("out"), segmentOut);
+        consumer.setAttribute(QStringLiteral("target"), segmentDest);
+        QTemporaryFile tmp(QDir::temp().absoluteFilePath(QStringLiteral("kdenlive-seg-XXXXXX.mlt")));
+        tmp.setAutoRemove(false);
+        if (!tmp.open()) {
+            cleanupSegments();
+            return false;
+        }
+        QTextStream stream(&tmp);
+        doc.save(stream, 1);
+        tmp.close();
+        m_segmentPlaylists << tmp.fileName();
+        m_segmentFiles << segmentDest;
+        QFile::remove(segmentDest);
+    }
+    m_segmentProgress.fill(0, segments);
+    for (int i = 0; i < segments; i++) {
+        auto *proc = new QProcess(&m_looper);
+        proc->setReadChannel(QProcess::StandardError);
+        connect(proc, &QProcess::readyReadStandardError, this, [this, i]() { receivedSegmentStderr(i); });
+        connect(proc, static_cast<void (QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished), this,
+                [this, i](int exitCode, QProcess::ExitStatus status) { slotSegmentFinished(i, exitCode, status); });
+        m_segmentProcesses << proc;
+    }
+    for (int i = 0; i < segments; i++) {
+        applyNumaPin(m_segmentProcesses.at(i), i);
+        m_segmentProcesses.at(i)->start(m_prog, {QStringLiteral("-progress"), m_segmentPlaylists.at(i)});
+        m_logstream << "Started segment render process: " << m_prog << " -progress " << m_segmentPlaylists.at(i) << "\n";
+    }
+    m_logstream.flush();
+    return true;
+}
+
+void RenderJob::receivedSegmentStderr(int ix)
+{
+    QString result = QString::fromLocal8Bit(m_segmentProcesses.at(ix)->readAllStandardError()).simplified();
+    if (!result.startsWith(QLatin1String("Current Frame"))) {
+        m_errorMessage.append(result + QStringLiteral("<br>"));
+        m_logstream << result;
+        return;
+    }
+    int progress = result.section(QLatin1Char(' '), -1).toInt();
+    if (progress <= m_segmentProgress.at(ix) || progress <= 0 || progress > 100) {
+        return;
+    }
+    m_segmentProgress[ix] = progress;
+    int totalProgress = 0;
+    for (int p : qAsConst(m_segmentProgress)) {
+        totalProgress += p;
+    }
+    totalProgress /= m_segmentProgress.count();
+    if (totalProgress <= m_progress) {
+        return;
+    }
+    m_progress = totalProgress;
+    qint64 elapsedTime = m_startTime.secsTo(QDateTime::currentDateTime());
+    if (elapsedTime == m_seconds) {
+        return;
+    }
+    int lastFrame = m_frame;
+    m_frame = m_framein + (m_frameout - m_framein) * m_progress / 100;
+    int speed = (m_frame - lastFrame) / (elapsedTime - m_seconds);
+    m_seconds = elapsedTime;
+    updateProgress(speed);
+}
+
+void RenderJob::slotSegmentFinished(int ix, int exitCode, QProcess::ExitStatus status)
+{
+    if (m_segmentError) {
+        // Another segment already failed, we are only collecting the killed processes
+        return;
+    }
+    if (status == QProcess::CrashExit || exitCode != 0) {
+        m_segmentError = true;
+        for (QProcess *proc : qAsConst(m_segmentProcesses)) {
+            if (proc->state() != QProcess::NotRunning) {
+                proc->kill();
+            }
+        }
+        cleanupSegments();
+        if (m_erase) {
+            QFile(m_scenelist).remove();
+        }
+        sendFinish(-2, m_errorMessage);
+        QString error = tr("Rendering of %1 aborted, resulting video will probably be corrupted.").arg(m_dest);
+        m_logstream << error << "\n";
+        QProcess::startDetached(QStringLiteral("kdialog"), {QStringLiteral("--error"), error});
+        Q_EMIT renderingFinished();
+        m_looper.quit();
+        return;
+    }
+    m_finishedSegments++;
+    if (m_finishedSegments == m_segmentProcesses.count()) {
+        concatenateSegments();
+    }
+}
+
+void RenderJob::concatenateSegments()
+{
+    const QString ffmpegExe = QStandardPaths::findExecutable(QStringLiteral("ffmpeg"));
+    const QString listFile = QDir::temp().absoluteFilePath(QFileInfo(m_dest).completeBaseName() + QStringLiteral("-segments.txt"));
+    QFile list(listFile);
+    if (ffmpegExe.isEmpty() || !list.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        cleanupSegments();
+        sendFinish(-2, tr("Cannot join rendered segments for %1.").arg(m_dest));
+        Q_EMIT renderingFinished();
+        m_looper.quit();
+        return;
+    }
+    QTextStream listStream(&list);
+    for (const QString &segment : qAsConst(m_segmentFiles)) {
+        listStream << QStringLiteral("file '%1'\n").arg(segment);
+    }
+    list.close();
+    // The segments share the same codec settings and are cut on frame
+    // boundaries, so a stream copy concatenation is lossless
+    QProcess concatProcess;
+    concatProcess.start(ffmpegExe,
+                        {QStringLiteral("-y"), QStringLiteral("-v"), QStringLiteral("quiet"), QStringLiteral("-f"), QStringLiteral("concat"),
+                         QStringLiteral("-safe"), QStringLiteral("0"), QStringLiteral("-i"), listFile, QStringLiteral("-c"), QStringLiteral("copy"), m_dest});
+    concatProcess.waitForStarted(-1);
+    concatProcess.waitForFinished(-1);
+    bool success = concatProcess.exitStatus() == QProcess::NormalExit && concatProcess.exitCode() == 0 && QFile::exists(m_dest);
+    cleanupSegments();
+    QFile::remove(listFile);
+    if (!success) {
+        QString error = tr("Cannot join rendered segments for %1.").arg(m_dest);
+        m_errorMessage.append(error);
+        sendFinish(-2, m_errorMessage);
+        m_logstream << error << "\n";
+        QProcess::startDetached(QStringLiteral("kdialog"), {QStringLiteral("--error"), error});
+        Q_EMIT renderingFinished();
+        m_looper.quit();
+        return;
+    }
+    // Let the normal end of job code path handle scenelist cleanup and subtitles.
+    // m_renderProcess was never started, so it reports a normal exit.
+    slotIsOver(QProcess::NormalExit);
+}
+
+void RenderJob::cleanupSegments()
+{
+    for (const QString &playlist : qAsConst(m_segmentPlaylists)) {
+        QFile::remove(playlist);
+    }
+    for (const QString &segment : qAsConst(m_segmentFiles)) {
+        QFile::remove(segment);
+    }
+}
+
 #ifndef NODBUS
 void RenderJob::initKdenliveDbusInterface()
 {
@@ -318,6 +771,7 @@ void RenderJob::slotCheckProcess(QProcess::ProcessState state)
 
 void RenderJob::slotIsOver(QProcess::ExitStatus status, bool isWritable)
 {
+    stopAudioStripScan();
     if (!isWritable) {
         QString error = tr("Cannot write to %1, check permissions.").arg(m_dest);
         sendFinish(-2, error);
@@ -14,18 +14,22 @@
 #include <QDateTime>
 #include <QEventLoop>
 #include <QFile>
+#include <QMutex>
 #include <QObject>
 #include <QProcess>
+#include <QTimer>
 // Testing
 #include <QTextStream>
 
+#include <atomic>
+
 class RenderJob : public QObject
 {
     Q_OBJECT
 
 public:
     RenderJob(const QString &render, const QString &scenelist, const QString &target, int pid = -1, int in = -1, int out = -1,
-              const QString &subtitleFile = QString(), QObject *parent = nullptr);
+              const QString &subtitleFile = QString(), int chunks = 1, bool normalizeLoudness = false, bool numaPin = false, QObject *parent = nullptr);
     ~RenderJob() override;
 
 public Q_SLOTS:
@@ -39,6 +43,8 @@ private Q_SLOTS:
     void slotCheckProcess(QProcess::ProcessState state);
     void slotCheckSubtitleProcess(int exitCode, QProcess::ExitStatus exitStatus);
     void receivedSubtitleProgress();
+    /** @brief Send the current audio peak strip to the application if it changed. */
+    void sendAudioStrip();
 
 private:
     QString m_scenelist;
@@ -63,6 +69,34 @@ private:
     bool m_dualpass;
     QString m_subtitleFile;
     QString m_temporaryRenderFile;
+    /** @brief Number of timeline segments rendered by concurrent processes (1 = normal render). */
+    int m_chunks;
+    /** @brief Normalize the audio loudness to EBU R128 during the encode. */
+    bool m_normalizeLoudness;
+    /** @brief Pin each render process to a single NUMA node (Linux only). */
+    bool m_numaPin;
+    /** @brief CPU ids of each NUMA node, filled lazily when pinning is enabled. */
+    QList<QList<int>> m_numaNodes;
+    /** @brief One render process per segment when chunked rendering is active. */
+    QList<QProcess *> m_segmentProcesses;
+    /** @brief Temporary scenelist written for each segment. */
+    QStringList m_segmentPlaylists;
+    /** @brief Temporary output file rendered by each segment. */
+    QStringList m_segmentFiles;
+    /** @brief Progress (in %) of each segment render. */
+    QVector<int> m_segmentProgress;
+    int m_finishedSegments;
+    bool m_segmentError;
+    /** @brief Compact per-bucket peak levels of the program audio, filled by the scan thread. */
+    QByteArray m_audioStrip;
+    /** @brief Protects m_audioStrip between the scan thread and the sender. */
+    QMutex m_audioStripMutex;
+    /** @brief Last strip sent to the application, to skip duplicate updates. */
+    QByteArray m_lastSentStrip;
+    /** @brief Worker thread running the audio strip scan alongside the encode. */
+    QThread *m_audioStripThread;
+    std::atomic<bool> m_abortStrip;
+    QTimer m_audioStripTimer;
     QProcess *m_renderProcess;
     QProcess *m_subsProcess;
     QEventLoop m_looper;
@@ -80,6 +114,33 @@ private:
     void sendFinish(int status, const QString &error);
     void updateProgress(int speed = -1);
     void sendProgress();
+    /** @brief Measure the program loudness with an audio only scan and inject the
+     *  results into the scenelist, so the encode applies the matching gain. Returns
+     *  false if the analysis failed, in which case the render proceeds unnormalized. */
+    bool analyseLoudness();
+    /** @brief Scan the program audio in a worker thread, filling m_audioStrip with compact
+     *  peak levels streamed to the application's render queue. Audio only, so it runs much
+     *  faster than the encode and problems like dead air show up within minutes. */
+    void scanAudioStrip();
+    /** @brief Stop the audio strip scan and send the final strip. */
+    void stopAudioStripScan();
+    /** @brief Split the render into concurrent segment renders. Returns false if
+     *  chunked rendering cannot be used, in which case the caller falls back to a
+     *  single render process. */
+    bool startSegmentedRender();
+    /** @brief Parse progress output of one segment render process. */
+    void receivedSegmentStderr(int ix);
+    void slotSegmentFinished(int ix, int exitCode, QProcess::ExitStatus status);
+    /** @brief CPU id lists of the machine NUMA nodes, parsed from sysfs (Linux only). */
+    static QList<QList<int>> numaNodeCpus();
+    /** @brief Restrict the given render process to one NUMA node, chosen round robin
+     *  by job index so concurrent segment renders spread over the nodes. Must be
+     *  called before the process is started. */
+    void applyNumaPin(QProcess *process, int jobIndex);
+    /** @brief Losslessly join the rendered segments into the destination file. */
+    void concatenateSegments();
+    /** @brief Delete the temporary segment playlists and output files. */
+    void cleanupSegments();
 
 Q_SIGNALS:
     void renderingFinished();
@@ -142,6 +142,10 @@ QModelIndex AbstractTreeModel::getIndexFromId(int id) const
 
 void AbstractTreeModel::notifyRowAboutToAppend(const std::shared_ptr<TreeItem> &item)
 {
+    if (m_batchAppending) {
+        // The whole batch is covered by one beginInsertRows
+        return;
+    }
     auto index = getIndexFromItem(item);
     beginInsertRows(index, item->childCount(), item->childCount());
 }
@@ -149,6 +153,23 @@ void AbstractTreeModel::notifyRowAboutToAppend(const std::shared_ptr<TreeItem> &
 void AbstractTreeModel::notifyRowAppended(const std::shared_ptr<TreeItem> &row)
 {
     Q_UNUSED(row);
+    if (m_batchAppending) {
+        return;
+    }
+    endInsertRows();
+}
+
+void AbstractTreeModel::beginAppendRows(const std::shared_ptr<TreeItem> &item, int count)
+{
+    Q_ASSERT(!m_batchAppending);
+    auto index = getIndexFromItem(item);
+    beginInsertRows(index, item->childCount(), item->childCount() + count - 1);
+    m_batchAppending = true;
+}
+
+void AbstractTreeModel::endAppendRows()
+{
+    m_batchAppending = false;
     endInsertRows();
 }
 
@@ -85,6 +85,17 @@ protected:
     */
     void notifyRowAppended(const std::shared_ptr<TreeItem> &row);
 
+    /** @brief Open a batch insertion of several rows under the same parent, covered by a single
+       beginInsertRows. While the batch is open, the per-row notifications emitted when appending
+       children are suppressed, so the view processes the whole batch as one insertion
+       @param item is the parent item to which the rows will be appended
+       @param count is the number of rows that will be appended
+    */
+    void beginAppendRows(const std::shared_ptr<TreeItem> &item, int count);
+
+    /** @brief Close a batch insertion started with beginAppendRows */
+    void endAppendRows();
+
     /** @brief Send the appropriate notification related to a row that we are deleting
        @param item is the parent of the row being deleted
        @param row is the index of the row being deleted
@@ -104,5 +115,8 @@ protected:
 
     std::unordered_map<int, std::weak_ptr<TreeItem>> m_allItems;
 
+    /** @brief True while a batch insertion opened by beginAppendRows is in progress */
+    bool m_batchAppending{false};
+
     static int currentTreeId;
 };
@@ -101,6 +101,23 @@ protected:
     /** @brief Returns the path to the assets' preferred list*/
     virtual QString assetPreferredListPath() const = 0;
 
+    /** @brief Returns the path of the on-disk parsed asset cache*/
+    virtual QString assetCachePath() const = 0;
+
+    /** @brief Returns a key identifying the current asset environment (locale, MLT version and the
+       modification times of the asset files); the on-disk cache is discarded when it changes
+     */
+    QString assetCacheKey() const;
+
+    /** @brief Load the parsed assets from the on-disk cache, skipping the expensive metadata and
+       XML parsing of each asset on startup.
+       @return false if the cache is missing or stale
+     */
+    bool loadAssetCache(const QString &cacheKey);
+
+    /** @brief Persist the parsed assets so the next startup can load them from disk*/
+    void saveAssetCache(const QString &cacheKey) const;
+
     std::unordered_map<QString, Info> m_assets;
 
     QSet<QString> m_excludedList;
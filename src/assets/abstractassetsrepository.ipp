@@ -7,8 +7,12 @@
 #include "kdenlivesettings.h"
 #include "core.h"
 
+#include <QDataStream>
+#include <QDateTime>
 #include <QDir>
 #include <QFile>
+#include <QFileInfo>
+#include <QLocale>
 #include <QStandardPaths>
 #include <QString>
 #include <QTextStream>
@@ -30,6 +34,13 @@ template <typename AssetType> void AbstractAssetsRepository<AssetType>::init()
     // Parse preferred list
     parseAssetList({assetPreferredListPath()}, m_preferred_list);
 
+    // If the asset environment is unchanged, load the parsed assets from disk instead of
+    // querying the metadata of every MLT service and reparsing every custom XML file
+    const QString cacheKey = assetCacheKey();
+    if (loadAssetCache(cacheKey)) {
+        return;
+    }
+
     // Retrieve the list of MLT's available assets.
     QScopedPointer<Mlt::Properties> assets(retrieveListFromMlt());
     QStringList emptyMetaAssets;
@@ -45,10 +56,10 @@ template <typename AssetType> void AbstractAssetsRepository<AssetType>::init()
         }
         if (!m_excludedList.contains(name)) {
             if (parseInfoFromMlt(name, info)) {
-                m_assets[name] = info;
                 if (m_includedList.contains(name)) {
                     info.included = true;
                 }
+                m_assets[name] = info;
                 if (info.xml.isNull()) {
                     // Metadata was invalid
                     emptyMetaAssets << name;
@@ -83,6 +94,10 @@ template <typename AssetType> void AbstractAssetsRepository<AssetType>::init()
 
     // We add the custom assets
     QStringList missingDependency;
+    // Names of MLT's filters and transitions, filled on the first dependency check so
+    // validating each dependency is a hash lookup instead of a scan of every MLT service
+    QSet<QString> mltServiceNames;
+    bool mltServiceNamesBuilt = false;
     for (const auto &custom : customAssets) {
         // Custom assets should override default ones
         if (emptyMetaAssets.contains(custom.second.mltId)) {
@@ -93,26 +108,19 @@ template <typename AssetType> void AbstractAssetsRepository<AssetType>::init()
 
         QString dependency = custom.second.xml.attribute(QStringLiteral("dependency"), QString());
         if(!dependency.isEmpty()) {
-            bool found = false;
-            QScopedPointer<Mlt::Properties> effects(pCore->getMltRepository()->filters());
-            for(int i = 0; i < effects->count(); ++i) {
-                if(effects->get_name(i) == dependency) {
-                    found = true;
-                    break;
+            if (!mltServiceNamesBuilt) {
+                QScopedPointer<Mlt::Properties> effects(pCore->getMltRepository()->filters());
+                for (int i = 0; i < effects->count(); ++i) {
+                    mltServiceNames.insert(QString::fromLatin1(effects->get_name(i)));
                 }
-            }
-
-            if(!found) {
                 QScopedPointer<Mlt::Properties> transitions(pCore->getMltRepository()->transitions());
-                for(int i = 0; i < transitions->count(); ++i) {
-                    if(transitions->get_name(i) == dependency) {
-                        found = true;
-                        break;
-                    }
+                for (int i = 0; i < transitions->count(); ++i) {
+                    mltServiceNames.insert(QString::fromLatin1(transitions->get_name(i)));
                 }
+                mltServiceNamesBuilt = true;
             }
 
-            if(!found) {
+            if(!mltServiceNames.contains(dependency)) {
                 // asset depends on another asset that is invalid so remove this asset too
                 missingDependency << custom.first;
                 qDebug() << "Asset" << custom.first << "has invalid dependency" << dependency << "and is going to be removed";
@@ -126,6 +134,115 @@ template <typename AssetType> void AbstractAssetsRepository<AssetType>::init()
     for (const auto &invalid : qAsConst(emptyMetaAssets)) {
         m_assets.erase(invalid);
     }
+    saveAssetCache(cacheKey);
+}
+
+template <typename AssetType> QString AbstractAssetsRepository<AssetType>::assetCacheKey() const
+{
+    // Cache format version, locale (asset names are translated when parsed) and MLT version
+    QStringList key{QStringLiteral("1"), QLocale().name(), QString::fromUtf8(mlt_version_get_string())};
+    QStringList watchedFiles = assetIncludedPath();
+    watchedFiles << assetExcludedPath() << assetPreferredListPath();
+    // Directory mtimes only catch added / removed files, so track each asset file individually
+    const QStringList dirs = assetDirs();
+    for (const QString &dir : dirs) {
+        QDir current_dir(dir);
+        const QStringList fileList = current_dir.entryList({QStringLiteral("*.xml")}, QDir::Files);
+        for (const QString &file : fileList) {
+            watchedFiles << current_dir.absoluteFilePath(file);
+        }
+    }
+    for (const QString &path : qAsConst(watchedFiles)) {
+        if (path.isEmpty()) {
+            continue;
+        }
+        const QDateTime modified = QFileInfo(path).lastModified();
+        key << QStringLiteral("%1:%2").arg(path).arg(modified.isValid() ? modified.toSecsSinceEpoch() : 0);
+    }
+    return key.join(QLatin1Char('|'));
+}
+
+template <typename AssetType> bool AbstractAssetsRepository<AssetType>::loadAssetCache(const QString &cacheKey)
+{
+    QFile file(assetCachePath());
+    if (cacheKey.isEmpty() || !file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_15);
+    QString storedKey;
+    in >> storedKey;
+    if (storedKey != cacheKey) {
+        return false;
+    }
+    quint32 count = 0;
+    in >> count;
+    std::vector<std::pair<QString, Info>> assets;
+    std::vector<bool> hasXml;
+    assets.reserve(count);
+    hasXml.reserve(count);
+    for (quint32 i = 0; i < count; ++i) {
+        QString key;
+        Info info;
+        qint32 version = 0;
+        qint32 type = 0;
+        bool xmlPresent = false;
+        in >> key >> info.id >> info.mltId >> info.name >> info.description >> info.author >> info.version_str >> version >> info.included >> type >> xmlPresent;
+        info.version = version;
+        info.type = AssetType(type);
+        assets.emplace_back(key, info);
+        hasXml.push_back(xmlPresent);
+    }
+    // All parameter descriptions are stored as one document so they are parsed in a single pass
+    QString xmlData;
+    in >> xmlData;
+    QDomDocument doc;
+    if (in.status() != QDataStream::Ok || !doc.setContent(xmlData)) {
+        return false;
+    }
+    QDomElement currentXml = doc.documentElement().firstChildElement();
+    for (quint32 i = 0; i < count; ++i) {
+        if (hasXml[i]) {
+            if (currentXml.isNull()) {
+                // Corrupted cache
+                m_assets.clear();
+                return false;
+            }
+            assets[i].second.xml = currentXml;
+            currentXml = currentXml.nextSiblingElement();
+        }
+        m_assets[assets[i].first] = assets[i].second;
+    }
+    return !m_assets.empty();
+}
+
+template <typename AssetType> void AbstractAssetsRepository<AssetType>::saveAssetCache(const QString &cacheKey) const
+{
+    const QString path = assetCachePath();
+    if (path.isEmpty() || cacheKey.isEmpty()) {
+        return;
+    }
+    QDir().mkpath(QFileInfo(path).absolutePath());
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return;
+    }
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_15);
+    out << cacheKey;
+    out << quint32(m_assets.size());
+    QDomDocument doc;
+    QDomElement root = doc.createElement(QStringLiteral("assets"));
+    doc.appendChild(root);
+    for (const auto &asset : m_assets) {
+        const Info &info = asset.second;
+        out << asset.first << info.id << info.mltId << info.name << info.description << info.author << info.version_str << qint32(info.version) << info.included
+            << qint32(info.type) << !info.xml.isNull();
+        if (!info.xml.isNull()) {
+            root.appendChild(info.xml.cloneNode());
+        }
+    }
+    out << doc.toString();
 }
 
 template <typename AssetType> void AbstractAssetsRepository<AssetType>::parseAssetList(const QStringList &filePaths, QSet<QString> &destination)
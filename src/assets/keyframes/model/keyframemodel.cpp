@@ -149,6 +149,45 @@ bool KeyframeModel::addKeyframe(GenTime pos, KeyframeType type, QVariant value)
     return res;
 }
 
+bool KeyframeModel::loadKeyframes(const std::map<GenTime, std::pair<KeyframeType, QVariant>> &keyframes, bool replace, Fun &undo, Fun &redo)
+{
+    QWriteLocker locker(&m_lock);
+    if (keyframes.empty()) {
+        return true;
+    }
+    // Validate the whole set before touching the model
+    for (const auto &keyframe : keyframes) {
+        if (!keyframe.second.second.isValid() || keyframe.first.frames(pCore->getCurrentFps()) < 0) {
+            return false;
+        }
+    }
+    std::map<GenTime, std::pair<KeyframeType, QVariant>> newList;
+    if (!replace) {
+        newList = m_keyframeList;
+    }
+    for (const auto &keyframe : keyframes) {
+        newList[keyframe.first] = keyframe.second;
+    }
+    const std::map<GenTime, std::pair<KeyframeType, QVariant>> oldList = m_keyframeList;
+    Fun local_redo = [this, newList]() {
+        beginResetModel();
+        m_keyframeList = newList;
+        endResetModel();
+        return true;
+    };
+    Fun local_undo = [this, oldList]() {
+        beginResetModel();
+        m_keyframeList = oldList;
+        endResetModel();
+        return true;
+    };
+    if (local_redo()) {
+        UPDATE_UNDO_REDO(local_redo, local_undo, undo, redo);
+        return true;
+    }
+    return false;
+}
+
 bool KeyframeModel::removeKeyframe(GenTime pos, Fun &undo, Fun &redo, bool notify, bool updateSelection, bool allowedToFail)
 {
     qDebug() << "Going to remove keyframe at " << pos.frames(pCore->getCurrentFps()) << " NOTIFY: " << notify;
@@ -1019,6 +1058,7 @@ void KeyframeModel::parseAnimProperty(const QString &prop, int in, int out)
         }
         addKeyframe(GenTime(frame, pCore->getCurrentFps()), convertFromMltType(type), value, true, undo, redo);
     }
+    m_lastSentKeyframes = m_keyframeList;
     connect(this, &KeyframeModel::modelChanged, this, &KeyframeModel::sendModification);
 }
 
@@ -1092,6 +1132,7 @@ void KeyframeModel::resetAnimProperty(const QString &prop)
         return true;
     };
     update_local();
+    m_lastSentKeyframes = m_keyframeList;
     PUSH_LAMBDA(update_local, undo);
     PUSH_LAMBDA(update_local, redo);
     PUSH_UNDO(undo, redo, i18n("Reset %1", effectName));
@@ -1162,6 +1203,22 @@ QVariant KeyframeModel::getNormalizedValue(double newVal) const
     return QVariant();
 }
 
+Mlt::Properties *KeyframeModel::cachedAnimation(const QString &animData, int out) const
+{
+    if (!m_cachedAnim || animData != m_cachedAnimData || out != m_cachedAnimOut) {
+        m_cachedAnim.reset(new Mlt::Properties());
+        if (auto ptr = m_model.lock()) {
+            ptr->passProperties(*m_cachedAnim.get());
+        }
+        m_cachedAnim->set("key", animData.toUtf8().constData());
+        // This is a fake query to force the animation to be parsed
+        (void)m_cachedAnim->anim_get_double("key", 0, out);
+        m_cachedAnimData = animData;
+        m_cachedAnimOut = out;
+    }
+    return m_cachedAnim.get();
+}
+
 QVariant KeyframeModel::getInterpolatedValue(const GenTime &pos) const
 {
     if (m_keyframeList.count(pos) > 0) {
@@ -1170,28 +1227,22 @@ QVariant KeyframeModel::getInterpolatedValue(const GenTime &pos) const
     if (m_keyframeList.size() == 0) {
         return QVariant();
     }
-    Mlt::Properties mlt_prop;
     QString animData;
     int out = 0;
     bool useOpacity = false;
     if (auto ptr = m_model.lock()) {
-        ptr->passProperties(mlt_prop);
         out = ptr->data(m_index, AssetParameterModel::ParentDurationRole).toInt();
         useOpacity = ptr->data(m_index, AssetParameterModel::OpacityRole).toBool();
         animData = ptr->data(m_index, AssetParameterModel::ValueRole).toString();
     }
 
     if (!animData.isEmpty() && (m_paramType == ParamType::KeyframeParam || m_paramType == ParamType::ColorWheel)) {
-        mlt_prop.set("key", animData.toUtf8().constData());
-        // This is a fake query to force the animation to be parsed
-        (void)mlt_prop.anim_get_double("key", 0, out);
-        return QVariant(mlt_prop.anim_get_double("key", pos.frames(pCore->getCurrentFps())));
+        Mlt::Properties *prop = cachedAnimation(animData, out);
+        return QVariant(prop->anim_get_double("key", pos.frames(pCore->getCurrentFps())));
     }
     if (!animData.isEmpty() && m_paramType == ParamType::AnimatedRect) {
-        mlt_prop.set("key", animData.toUtf8().constData());
-        // This is a fake query to force the animation to be parsed
-        (void)mlt_prop.anim_get_double("key", 0, out);
-        mlt_rect rect = mlt_prop.anim_get_rect("key", pos.frames(pCore->getCurrentFps()));
+        Mlt::Properties *prop = cachedAnimation(animData, out);
+        mlt_rect rect = prop->anim_get_rect("key", pos.frames(pCore->getCurrentFps()));
         QString res = QStringLiteral("%1 %2 %3 %4").arg(int(rect.x)).arg(int(rect.y)).arg(int(rect.w)).arg(int(rect.h));
         if (useOpacity) {
             res.append(QStringLiteral(" %1").arg(QString::number(rect.o, 'f')));
@@ -1199,10 +1250,8 @@ QVariant KeyframeModel::getInterpolatedValue(const GenTime &pos) const
         return QVariant(res);
     }
     if (!animData.isEmpty() && m_paramType == ParamType::Color) {
-        mlt_prop.set("key", animData.toUtf8().constData());
-        // This is a fake query to force the animation to be parsed
-        (void)mlt_prop.anim_get_double("key", 0, out);
-        mlt_color mltColor = mlt_prop.anim_get_color("key", pos.frames(pCore->getCurrentFps()));
+        Mlt::Properties *prop = cachedAnimation(animData, out);
+        mlt_color mltColor = prop->anim_get_color("key", pos.frames(pCore->getCurrentFps()));
         QColor color(mltColor.r, mltColor.g, mltColor.b, mltColor.a);
         return QVariant(QColorUtils::colorToString(color, true));
     }
@@ -1250,20 +1299,103 @@ QVariant KeyframeModel::getInterpolatedValue(const GenTime &pos) const
     return QVariant();
 }
 
+void KeyframeModel::startUpdateGrouping()
+{
+    m_groupedUpdate = true;
+}
+
+void KeyframeModel::endUpdateGrouping()
+{
+    m_groupedUpdate = false;
+    if (m_pendingModification) {
+        m_pendingModification = false;
+        sendModification();
+    }
+}
+
 void KeyframeModel::sendModification()
 {
+    if (m_groupedUpdate) {
+        // A grouped operation is in progress, commit only once when it ends
+        m_pendingModification = true;
+        return;
+    }
     if (auto ptr = m_model.lock()) {
         Q_ASSERT(m_index.isValid());
         QString name = ptr->data(m_index, AssetParameterModel::NameRole).toString();
         if (AssetParameterModel::isAnimated(m_paramType)) {
+            registerInvalidationRange(ptr);
             m_lastData = getAnimProperty();
             ptr->setParameter(name, m_lastData, false, m_index);
+            m_lastSentKeyframes = m_keyframeList;
         } else {
             Q_ASSERT(false); // Not implemented, TODO
         }
     }
 }
 
+void KeyframeModel::registerInvalidationRange(const std::shared_ptr<AssetParameterModel> &model)
+{
+    if (m_lastSentKeyframes.empty() || m_keyframeList.empty()) {
+        // No previous state to compare with, the full item will be invalidated
+        return;
+    }
+    // Collect the keyframe positions that were added, removed or changed
+    bool found = false;
+    GenTime firstDiff;
+    GenTime lastDiff;
+    auto mark = [&](const GenTime &pos) {
+        if (!found || pos < firstDiff) {
+            firstDiff = pos;
+        }
+        if (!found || pos > lastDiff) {
+            lastDiff = pos;
+        }
+        found = true;
+    };
+    for (const auto &keyframe : m_keyframeList) {
+        auto old = m_lastSentKeyframes.find(keyframe.first);
+        if (old == m_lastSentKeyframes.end() || old->second != keyframe.second) {
+            mark(keyframe.first);
+        }
+    }
+    for (const auto &keyframe : m_lastSentKeyframes) {
+        if (m_keyframeList.count(keyframe.first) == 0) {
+            mark(keyframe.first);
+        }
+    }
+    if (!found) {
+        return;
+    }
+    // A change reaches from the keyframe before the first modified position to the keyframe
+    // after the last one; when there is no such neighbour the held value extends to the
+    // item's start / end
+    double fps = pCore->getCurrentFps();
+    int parentIn = model->data(m_index, AssetParameterModel::ParentInRole).toInt();
+    auto frameBefore = [fps](const std::map<GenTime, std::pair<KeyframeType, QVariant>> &list, const GenTime &pos) {
+        auto it = list.lower_bound(pos);
+        if (it == list.begin()) {
+            return -1;
+        }
+        --it;
+        return it->first.frames(fps);
+    };
+    auto frameAfter = [fps](const std::map<GenTime, std::pair<KeyframeType, QVariant>> &list, const GenTime &pos) {
+        auto it = list.upper_bound(pos);
+        if (it == list.end()) {
+            return -1;
+        }
+        return it->first.frames(fps);
+    };
+    int prevCurrent = frameBefore(m_keyframeList, firstDiff);
+    int prevSent = frameBefore(m_lastSentKeyframes, firstDiff);
+    int startFrame = (prevCurrent < 0 || prevSent < 0) ? parentIn : qMin(prevCurrent, prevSent);
+    int nextCurrent = frameAfter(m_keyframeList, lastDiff);
+    int nextSent = frameAfter(m_lastSentKeyframes, lastDiff);
+    int endFrame = (nextCurrent < 0 || nextSent < 0) ? -1 : qMax(nextCurrent, nextSent);
+    model->setInvalidationRange(qMax(0, startFrame - parentIn), endFrame < 0 ? -1 : endFrame - parentIn);
+}
+
 QString KeyframeModel::realValue(double normalizedValue) const
 {
     double value = getNormalizedValue(normalizedValue).toDouble();
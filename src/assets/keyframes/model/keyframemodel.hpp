@@ -88,6 +88,13 @@ protected:
        @param notify: if true, send a signal to model
      */
     bool addKeyframe(GenTime pos, KeyframeType type, QVariant value, bool notify, Fun &undo, Fun &redo);
+    /** @brief Inserts a whole set of keyframes in one pass, with a single model reset and a single
+       undo entry, much faster than adding them one by one on large imports.
+       The whole set is validated before the model is touched.
+       @param keyframes the keyframes to insert, replacing any existing keyframe at the same position
+       @param replace if true, all previous keyframes are dropped first
+     */
+    bool loadKeyframes(const std::map<GenTime, std::pair<KeyframeType, QVariant>> &keyframes, bool replace, Fun &undo, Fun &redo);
 
     /** @brief Removes the keyframe at the given position. */
     bool removeKeyframe(int frame);
@@ -208,6 +215,17 @@ protected:
     /** @brief Commit the modification to the model */
     void sendModification();
 
+    /** @brief Hold back sendModification() while an operation spanning several keyframe changes
+     *  is in progress, so that only one modification is committed when the group ends */
+    void startUpdateGrouping();
+    /** @brief End a grouped operation, committing the pending modification if there is one */
+    void endUpdateGrouping();
+
+    /** @brief Diff the current keyframes against the state of the last commit and register the
+     *  affected temporal interval with the asset model, so that a keyframe edit only invalidates
+     *  the timeline preview chunks it can actually change */
+    void registerInvalidationRange(const std::shared_ptr<AssetParameterModel> &model);
+
     /** @brief returns the keyframes as a Mlt Anim Property string.
         It is defined as pairs of frame and value, separated by ;
         Example : "0|=50; 50|=100; 100=200; 200~=60;"
@@ -217,6 +235,12 @@ protected:
     QString getAnimProperty() const;
     QString getRotoProperty() const;
 
+    /** @brief Returns a pre-parsed animation for the given serialized animation string, so that
+     *  repeated interpolation queries (one per frame and parameter while scrubbing with keyframed
+     *  effects) only sample the animation instead of reparsing the whole string each time.
+     *  The cache is rebuilt whenever the animation string or the parent duration changes. */
+    Mlt::Properties *cachedAnimation(const QString &animData, int out) const;
+
     /** @brief this function clears all existing keyframes, and reloads its data from the string passed */
     void resetAnimProperty(const QString &prop);
     /** @brief this function does the opposite of getAnimProperty: given a MLT representation of an animation, build the corresponding model */
@@ -233,6 +257,17 @@ private:
     mutable QReadWriteLock m_lock;
 
     std::map<GenTime, std::pair<KeyframeType, QVariant>> m_keyframeList;
+    /** @brief Parsed animation kept between interpolation queries, see cachedAnimation() */
+    mutable std::shared_ptr<Mlt::Properties> m_cachedAnim;
+    mutable QString m_cachedAnimData;
+    mutable int m_cachedAnimOut{-1};
+    /** @brief Snapshot of the keyframes at the time of the last commit to the asset model,
+     *  used by registerInvalidationRange() to find the interval affected by an edit */
+    std::map<GenTime, std::pair<KeyframeType, QVariant>> m_lastSentKeyframes;
+    /** @brief True while a grouped operation is in progress, see startUpdateGrouping() */
+    bool m_groupedUpdate{false};
+    /** @brief True when a modification was held back during a grouped operation */
+    bool m_pendingModification{false};
     bool moveOneKeyframe(GenTime oldPos, GenTime pos, QVariant newVal, Fun &undo, Fun &redo, bool updateView = true, bool allowedToFail = false);
 
 Q_SIGNALS:
@@ -110,14 +110,22 @@ bool KeyframeModelList::applyOperation(const std::function<bool(std::shared_ptr<
     Q_ASSERT(m_parameters.size() > 0);
 
     bool res = true;
+    // Hold back per-parameter modifications so that an operation on an effect with many animated
+    // parameters commits one update per parameter instead of one per keyframe change
+    for (const auto &param : m_parameters) {
+        param.second->startUpdateGrouping();
+    }
     for (const auto &param : m_parameters) {
         res = op(param.second, false, undo, redo);
         if (!res) {
             bool undone = undo();
             Q_ASSERT(undone);
-            return res;
+            break;
         }
     }
+    for (const auto &param : m_parameters) {
+        param.second->endUpdateGrouping();
+    }
     return res;
 }
 
@@ -732,22 +732,28 @@ void KeyframeView::wheelEvent(QWheelEvent *event)
     event->setAccepted(true);
 }
 
-void KeyframeView::paintEvent(QPaintEvent *event)
+void KeyframeView::changeEvent(QEvent *event)
 {
-    Q_UNUSED(event)
+    QWidget::changeEvent(event);
+    if (event->type() == QEvent::PaletteChange || event->type() == QEvent::StyleChange) {
+        // Palette colors are baked in the ruler cache
+        m_rulerCacheSize = QSize();
+        update();
+    }
+}
 
-    QStylePainter p(this);
+void KeyframeView::drawRulerCache()
+{
+    m_rulerCacheSize = size();
+    m_rulerCacheZoom = m_zoomHandle;
+    m_rulerCacheDuration = m_duration;
+    const qreal dpr = devicePixelRatioF();
+    m_rulerCache = QPixmap(size() * dpr);
+    m_rulerCache.setDevicePixelRatio(dpr);
+    m_rulerCache.fill(Qt::transparent);
+    QPainter p(&m_rulerCache);
     int maxWidth = width() - 2 * m_offset;
-    if (m_duration > 1) {
-        m_scale = maxWidth / double(m_duration - 1);
-    } else {
-        m_scale = maxWidth;
-    }
     int headOffset = m_lineHeight / 2;
-    int offset = pCore->getItemIn(m_model->getOwnerId());
-    m_zoomStart = m_zoomHandle.x() * maxWidth;
-    m_zoomFactor = maxWidth / (m_zoomHandle.y() * maxWidth - m_zoomStart);
-    int zoomEnd = qCeil(m_zoomHandle.y() * maxWidth);
     /* ticks */
     double fps = pCore->getCurrentFps();
     int displayedLength = int(m_duration / m_zoomFactor / fps);
@@ -786,6 +792,7 @@ void KeyframeView::paintEvent(QPaintEvent *event)
     int base = int(tickOffset / frameSize);
     tickOffset = frameSize - (tickOffset - (base * frameSize));
     // Draw frame ticks
+    p.setPen(palette().windowText().color());
     for (int i = 0; i < maxWidth / frameSize; i++) {
         int scaledTick = int(m_offset + (i * frameSize) + tickOffset);
         if (scaledTick >= maxWidth + m_offset) {
@@ -794,6 +801,47 @@ void KeyframeView::paintEvent(QPaintEvent *event)
         p.drawLine(QPointF(scaledTick, m_lineHeight + 1), QPointF(scaledTick, m_lineHeight - 3));
     }
 
+    /*
+     * Time-"line"
+     */
+    p.setPen(m_colKeyframe);
+    p.drawLine(m_offset, m_lineHeight, width() - m_offset, m_lineHeight);
+    p.drawLine(m_offset, m_lineHeight - headOffset / 2, m_offset, m_lineHeight + headOffset / 2);
+    p.drawLine(width() - m_offset, m_lineHeight - headOffset / 2, width() - m_offset, m_lineHeight + headOffset / 2);
+
+    // Zoom bar
+    p.setPen(Qt::NoPen);
+    p.setBrush(palette().mid());
+    p.drawRoundedRect(m_offset, m_zoomHeight + 3, width() - 2 * m_offset, m_size - m_zoomHeight - 3, m_lineHeight / 5, m_lineHeight / 5);
+    p.setBrush(palette().highlight());
+    p.drawRoundedRect(int(m_offset + (width() - m_offset) * m_zoomHandle.x()), m_zoomHeight + 3,
+                      int((width() - 2 * m_offset) * (m_zoomHandle.y() - m_zoomHandle.x())), m_size - m_zoomHeight - 3, m_lineHeight / 5, m_lineHeight / 5);
+}
+
+void KeyframeView::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event)
+
+    QStylePainter p(this);
+    int maxWidth = width() - 2 * m_offset;
+    if (m_duration > 1) {
+        m_scale = maxWidth / double(m_duration - 1);
+    } else {
+        m_scale = maxWidth;
+    }
+    int headOffset = m_lineHeight / 2;
+    int offset = pCore->getItemIn(m_model->getOwnerId());
+    m_zoomStart = m_zoomHandle.x() * maxWidth;
+    m_zoomFactor = maxWidth / (m_zoomHandle.y() * maxWidth - m_zoomStart);
+    int zoomEnd = qCeil(m_zoomHandle.y() * maxWidth);
+    double fps = pCore->getCurrentFps();
+    // The ticks, time line and zoom bar only depend on the size, zoom and duration, so they
+    // are rasterized once and replayed on the frequent seek / hover repaints
+    if (m_rulerCacheSize != size() || m_rulerCacheZoom != m_zoomHandle || m_rulerCacheDuration != m_duration) {
+        drawRulerCache();
+    }
+    p.drawPixmap(0, 0, m_rulerCache);
+
     /*
      * keyframes
      */
@@ -838,15 +886,7 @@ void KeyframeView::paintEvent(QPaintEvent *event)
         kfrIx++;
     }
 
-    p.setPen(palette().dark().color());
-
-    /*
-     * Time-"line"
-     */
     p.setPen(m_colKeyframe);
-    p.drawLine(m_offset, m_lineHeight, width() - m_offset, m_lineHeight);
-    p.drawLine(m_offset, m_lineHeight - headOffset / 2, m_offset, m_lineHeight + headOffset / 2);
-    p.drawLine(width() - m_offset, m_lineHeight - headOffset / 2, width() - m_offset, m_lineHeight + headOffset / 2);
 
     /*
      * current position cursor
@@ -874,14 +914,6 @@ void KeyframeView::paintEvent(QPaintEvent *event)
         p.fillRect(QRect(min, 0, max - min, m_lineHeight), palette().highlight());
         p.setOpacity(1);
     }
-
-    // Zoom bar
-    p.setPen(Qt::NoPen);
-    p.setBrush(palette().mid());
-    p.drawRoundedRect(m_offset, m_zoomHeight + 3, width() - 2 * m_offset, m_size - m_zoomHeight - 3, m_lineHeight / 5, m_lineHeight / 5);
-    p.setBrush(palette().highlight());
-    p.drawRoundedRect(int(m_offset + (width() - m_offset) * m_zoomHandle.x()), m_zoomHeight + 3,
-                      int((width() - 2 * m_offset) * (m_zoomHandle.y() - m_zoomHandle.x())), m_size - m_zoomHeight - 3, m_lineHeight / 5, m_lineHeight / 5);
 }
 
 void KeyframeView::copyCurrentValue(const QModelIndex &ix, const QString &paramName)
@@ -8,6 +8,7 @@
 
 #include "assets/keyframes/model/keyframemodel.hpp"
 #include "assets/keyframes/model/keyframemodellist.hpp"
+#include <QPixmap>
 #include <QWidget>
 #include <memory>
 
@@ -56,6 +57,7 @@ public Q_SLOTS:
     void slotCenterKeyframe();
 
 protected:
+    void changeEvent(QEvent *event) override;
     void paintEvent(QPaintEvent *event) override;
     void mousePressEvent(QMouseEvent *event) override;
     void mouseReleaseEvent(QMouseEvent *event) override;
@@ -64,6 +66,8 @@ protected:
     void wheelEvent(QWheelEvent *event) override;
 
 private:
+    /** @brief Rasterize the static layer into m_rulerCache at the current size and zoom */
+    void drawRulerCache();
     std::shared_ptr<KeyframeModelList> m_model;
     int m_duration;
     int m_position;
@@ -97,6 +101,13 @@ private:
     QColor m_colKeyframe;
     QColor m_colKeyframeBg;
     QMetaObject::Connection m_centerConnection;
+    /** @brief Cached rendering of the static layer (frame ticks, time line and zoom bar),
+        regenerated only when the size, zoom or duration changes so paint events triggered
+        by seeking or hovering only draw the cheap dynamic overlays */
+    QPixmap m_rulerCache;
+    QSize m_rulerCacheSize;
+    QPointF m_rulerCacheZoom{-1, -1};
+    int m_rulerCacheDuration{-1};
 
 Q_SIGNALS:
     void seekToPos(int pos);
@@ -13,12 +13,21 @@
 #include <QDebug>
 #include <QDir>
 #include <QDirIterator>
+#include <QHash>
 #include <QJsonArray>
 #include <QJsonObject>
+#include <QMutex>
 #include <QRegularExpression>
 #include <QString>
 #define DEBUG_LOCALE false
 
+namespace {
+// Parameter titles are resolved through gettext; template heavy projects instantiate the
+// same asset over and over, so each title is only translated on the first instantiation
+QMutex titleCacheMutex;
+QHash<QString, QHash<QString, QString>> translatedTitles;
+} // namespace
+
 AssetParameterModel::AssetParameterModel(std::unique_ptr<Mlt::Properties> asset, const QDomElement &assetXml, const QString &assetId, ObjectId ownerId,
                                          const QString &originalDecimalPoint, QObject *parent)
     : QAbstractListModel(parent)
@@ -30,8 +39,11 @@ AssetParameterModel::AssetParameterModel(std::unique_ptr<Mlt::Properties> asset,
     , m_keyframes(nullptr)
     , m_activeKeyframe(-1)
     , m_filterProgress(0)
+    , m_invalidateRange(-1, -1)
 {
     Q_ASSERT(m_asset->is_valid());
+    m_refreshTimer.setSingleShot(true);
+    connect(&m_refreshTimer, &QTimer::timeout, this, &AssetParameterModel::refreshOwner);
     QDomNodeList parameterNodes = assetXml.elementsByTagName(QStringLiteral("parameter"));
     m_hideKeyframesByDefault = assetXml.hasAttribute(QStringLiteral("hideKeyframes"));
     m_requiresInOut = assetXml.hasAttribute(QStringLiteral("requires_in_out"));
@@ -136,12 +148,17 @@ AssetParameterModel::AssetParameterModel(std::unique_ptr<Mlt::Properties> asset,
             case ParamType::KeyframeParam:
             case ParamType::Position:
                 // Fix values like <position>=1,5
-                value.replace(QRegularExpression(R"((=\d+),(\d+))"), "\\1.\\2");
+            {
+                static const QRegularExpression posSeparator(R"((=\d+),(\d+))");
+                value.replace(posSeparator, "\\1.\\2");
                 break;
-            case ParamType::AnimatedRect:
+            }
+            case ParamType::AnimatedRect: {
                 // Fix values like <position>=50 20 1920 1080 0,75
-                value.replace(QRegularExpression(R"((=\d+ \d+ \d+ \d+ \d+),(\d+))"), "\\1.\\2");
+                static const QRegularExpression rectSeparator(R"((=\d+ \d+ \d+ \d+ \d+),(\d+))");
+                value.replace(rectSeparator, "\\1.\\2");
                 break;
+            }
             case ParamType::ColorWheel:
                 // Color wheel has 3 separate properties: prop_r, prop_g and prop_b, always numbers
             case ParamType::Double:
@@ -192,9 +209,18 @@ AssetParameterModel::AssetParameterModel(std::unique_ptr<Mlt::Properties> asset,
 
         if (!isFixed) {
             currentRow.value = value;
-            QString title = i18n(currentParameter.firstChildElement(QStringLiteral("name")).text().toUtf8().data());
-            if (title.isEmpty() || title == QStringLiteral("(I18N_EMPTY_MESSAGE)")) {
-                title = name;
+            QString title;
+            {
+                QMutexLocker lock(&titleCacheMutex);
+                title = translatedTitles.value(m_assetId).value(name);
+            }
+            if (title.isEmpty()) {
+                title = i18n(currentParameter.firstChildElement(QStringLiteral("name")).text().toUtf8().data());
+                if (title.isEmpty() || title == QStringLiteral("(I18N_EMPTY_MESSAGE)")) {
+                    title = name;
+                }
+                QMutexLocker lock(&titleCacheMutex);
+                translatedTitles[m_assetId][name] = title;
             }
             currentRow.name = title;
             m_params[name] = currentRow;
@@ -287,14 +313,57 @@ void AssetParameterModel::setParameter(const QString &name, int value, bool upda
     if (update) {
         Q_EMIT modelChanged();
         Q_EMIT dataChanged(index(0, 0), index(m_rows.count() - 1, 0), {});
+        requestOwnerRefresh(name);
+    }
+}
+
+void AssetParameterModel::setInvalidationRange(int in, int out)
+{
+    m_invalidateRange = {in, out};
+}
+
+void AssetParameterModel::invalidateOwnerPreview()
+{
+    if (m_invalidateRange.first > -1) {
+        pCore->invalidateItemRange(m_ownerId, m_invalidateRange.first, m_invalidateRange.second);
+        m_invalidateRange = {-1, -1};
+    } else {
+        pCore->invalidateItem(m_ownerId);
+    }
+}
+
+void AssetParameterModel::requestOwnerRefresh(const QString &name)
+{
+    if (!m_pendingRefreshParams.contains(name)) {
+        m_pendingRefreshParams << name;
+    }
+    // Rate-limit the expensive refresh work to the monitor's display rate; the parameter value
+    // was already applied above so the deferred refresh always picks up the latest state
+    const int frameDuration = qRound(1000. / pCore->getCurrentFps());
+    if (m_refreshStamp.isValid() && m_refreshStamp.elapsed() < frameDuration) {
+        if (!m_refreshTimer.isActive()) {
+            m_refreshTimer.start(int(frameDuration - m_refreshStamp.elapsed()));
+        }
+        return;
+    }
+    refreshOwner();
+}
+
+void AssetParameterModel::refreshOwner()
+{
+    m_refreshTimer.stop();
+    m_refreshStamp.start();
+    const QStringList params = m_pendingRefreshParams;
+    m_pendingRefreshParams.clear();
+    for (const QString &name : params) {
         // Update fades in timeline
         pCore->updateItemModel(m_ownerId, m_assetId, name);
-        if (!m_isAudio) {
-            // Trigger monitor refresh
-            pCore->refreshProjectItem(m_ownerId);
-            // Invalidate timeline preview
-            pCore->invalidateItem(m_ownerId);
-        }
+    }
+    if (!m_isAudio) {
+        // Trigger monitor refresh
+        pCore->refreshProjectItem(m_ownerId);
+        // Invalidate timeline preview
+        invalidateOwnerPreview();
     }
 }
 
@@ -472,14 +541,7 @@ void AssetParameterModel::setParameter(const QString &name, const QString &param
         // Used for generator clips
         if (!update) Q_EMIT modelChanged();
     } else {
-        // Update fades in timeline
-        pCore->updateItemModel(m_ownerId, m_assetId, name);
-        if (!m_isAudio) {
-            // Trigger monitor refresh
-            pCore->refreshProjectItem(m_ownerId);
-            // Invalidate timeline preview
-            pCore->invalidateItem(m_ownerId);
-        }
+        requestOwnerRefresh(name);
     }
 }
 
@@ -762,6 +824,13 @@ bool AssetParameterModel::isAnimated(ParamType type)
            type == ParamType::Color;
 }
 
+// static
+void AssetParameterModel::invalidateTitleCache(const QString &assetId)
+{
+    QMutexLocker lock(&titleCacheMutex);
+    translatedTitles.remove(assetId);
+}
+
 // static
 QString AssetParameterModel::getDefaultKeyframes(int start, const QString &defaultValue, bool linearOnly)
 {
@@ -9,7 +9,9 @@
 #include "klocalizedstring.h"
 #include <QAbstractListModel>
 #include <QDomElement>
+#include <QElapsedTimer>
 #include <QJsonDocument>
+#include <QTimer>
 #include <unordered_map>
 
 #include <memory>
@@ -137,6 +139,10 @@ public:
     /** @brief Returns true if @param type is animated */
     static bool isAnimated(ParamType type);
 
+    /** @brief Drop the memoized translated parameter titles of an asset, called when a
+        custom effect is edited or deleted so the next instantiation re-reads its xml */
+    static void invalidateTitleCache(const QString &assetId);
+
     /** @brief Returns the id of the asset represented by this object */
     QString getAssetId() const;
     const QString getAssetMltId();
@@ -212,6 +218,10 @@ public Q_SLOTS:
     void setParametersFromTask(const paramVector &params);
     /** @brief Set a filter job's progress */
     void setProgress(int progress);
+    /** @brief Restrict the preview invalidation caused by the next parameter change to the given
+     *  interval, expressed in frame offsets relative to the owner item's position. Used by the
+     *  keyframe model so that a keyframe edit only invalidates the chunks it can actually affect. */
+    void setInvalidationRange(int in, int out);
 
 protected:
     /** @brief Helper function to retrieve the type of a parameter given the string corresponding to it*/
@@ -265,6 +275,28 @@ protected:
     bool m_isAudio;
     /** @brief Store a filter's job progress */
     int m_filterProgress;
+    /** @brief Interval (relative to the owner item) to invalidate on the next parameter change,
+     *  {-1, -1} when the full item must be invalidated */
+    QPair<int, int> m_invalidateRange;
+    /** @brief Parameters whose owner update (fades, monitor refresh, preview invalidation) is still pending */
+    QStringList m_pendingRefreshParams;
+    /** @brief Time of the last owner refresh, used to rate-limit refreshes while dragging a slider */
+    QElapsedTimer m_refreshStamp;
+    /** @brief Fires the deferred owner refresh at the next frame boundary */
+    QTimer m_refreshTimer;
+
+    /** @brief Invalidate the timeline preview for the owner item, restricted to
+     *  m_invalidateRange when one was registered */
+    void invalidateOwnerPreview();
+
+    /** @brief Schedule the owner updates triggered by a change of the given parameter (fades in timeline,
+     *  monitor refresh, timeline preview invalidation), rate-limited to one refresh per displayed frame.
+     *  Dragging a slider or a color wheel emits far more changes per second than the monitor can display,
+     *  so intermediate refreshes are coalesced; the parameter value itself is always applied synchronously
+     *  and a trailing refresh guarantees the final value of a drag ends up on screen */
+    void requestOwnerRefresh(const QString &name);
+    /** @brief Flush the pending owner updates, see requestOwnerRefresh() */
+    void refreshOwner();
 
     /** @brief Set the parameter with given name to the given value. This should be called when first
      *  building an effect in the constructor, so that we don't call shared_from_this
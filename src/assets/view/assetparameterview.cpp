@@ -36,9 +36,26 @@ AssetParameterView::AssetParameterView(QWidget *parent)
 
 void AssetParameterView::setModel(const std::shared_ptr<AssetParameterModel> &model, QSize frameSize, bool addSpacer)
 {
+    if (addSpacer == m_addedSpacer && canSwapModel(model)) {
+        // The selection moved to another instance of the same asset: keep the widget tree
+        // and only rebind the widgets to the new model instead of rebuilding the full view
+        QMutexLocker lock(&m_lock);
+        disconnect(m_model.get(), &AssetParameterModel::dataChanged, this, &AssetParameterView::refresh);
+        m_model = model;
+        for (auto w : m_widgets) {
+            w->swapModel(model);
+        }
+        connect(m_model.get(), &AssetParameterModel::dataChanged, this, &AssetParameterView::refresh);
+        Q_EMIT updatePresets();
+        // Ensure effect parameters are adjusted to current position
+        Monitor *monitor = pCore->getMonitor(m_model->monitorId);
+        Q_EMIT monitor->seekPosition(monitor->position());
+        return;
+    }
     unsetModel();
     QMutexLocker lock(&m_lock);
     m_model = model;
+    m_addedSpacer = addSpacer;
     setSizePolicy(QSizePolicy::Preferred, addSpacer ? QSizePolicy::Preferred : QSizePolicy::Fixed);
     const QString paramTag = model->getAssetId();
     QDir dir(QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + QStringLiteral("/effects/presets/"));
@@ -122,6 +139,24 @@ void AssetParameterView::setModel(const std::shared_ptr<AssetParameterModel> &mo
     Q_EMIT monitor->seekPosition(monitor->position());
 }
 
+bool AssetParameterView::canSwapModel(const std::shared_ptr<AssetParameterModel> &model) const
+{
+    if (!supportsModelSwap() || m_model == nullptr || m_mainKeyframeWidget != nullptr || model->getAssetId() != m_model->getAssetId()) {
+        return false;
+    }
+    // Without a keyframe widget each model row built exactly one widget, so a size
+    // mismatch means the parameter layout changed and the tree must be rebuilt
+    if (m_widgets.size() != size_t(model->rowCount())) {
+        return false;
+    }
+    for (auto w : m_widgets) {
+        if (!w->canSwapModel()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 QVector<QPair<QString, QVariant>> AssetParameterView::getDefaultValues() const
 {
     QVector<QPair<QString, QVariant>> values;
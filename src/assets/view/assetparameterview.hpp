@@ -66,6 +66,11 @@ protected:
         It basically instructs the widgets in the given range to be refreshed */
     void refresh(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles);
 
+    /** @brief Whether setModel() may rebind the existing widget tree to another instance of
+        the same asset. Subclasses that append extra widgets after the base build must return
+        false so their additions are rebuilt along with the rest of the view */
+    virtual bool supportsModelSwap() const { return true; }
+
     QVBoxLayout *m_lay;
     /** @brief Protect from concurrent operations
      **/
@@ -78,6 +83,12 @@ protected:
 
 private:
     QVector<QPair<QString, QVariant>> getDefaultValues() const;
+    /** @brief Returns true if the current widget tree can be retargeted to the given model
+        (same asset, no keyframe widget and every parameter widget supports swapModel()) */
+    bool canSwapModel(const std::shared_ptr<AssetParameterModel> &model) const;
+    /** @brief Remember whether the last full build added a stretch item, so a rebind is
+        only attempted when the layout would come out identical */
+    bool m_addedSpacer{false};
 
 private Q_SLOTS:
     /** @brief Apply a change of parameter sent by the view
@@ -60,6 +60,15 @@ AbstractParamWidget::AbstractParamWidget(std::shared_ptr<AssetParameterModel> mo
 {
 }
 
+void AbstractParamWidget::swapModel(const std::shared_ptr<AssetParameterModel> &model)
+{
+    Q_ASSERT(canSwapModel());
+    int row = m_index.row();
+    m_model = model;
+    m_index = QPersistentModelIndex(model->index(row, 0));
+    slotRefresh();
+}
+
 AbstractParamWidget *AbstractParamWidget::construct(const std::shared_ptr<AssetParameterModel> &model, const QModelIndex &index, QSize frameSize,
                                                     QWidget *parent)
 {
@@ -30,6 +30,17 @@ public:
     */
     static AbstractParamWidget *construct(const std::shared_ptr<AssetParameterModel> &model, const QModelIndex &index, QSize frameSize, QWidget *parent);
 
+    /** @brief Returns true if this widget can be retargeted to another instance of the
+        same asset through swapModel() instead of being destroyed and rebuilt.
+        Defaults to false; only widgets that keep no model-derived sub-objects opt in.
+    */
+    virtual bool canSwapModel() const { return false; }
+
+    /** @brief Retarget the widget to another instance of the same asset: swap the model
+        and index, then refresh the displayed values. Only valid when canSwapModel() is true.
+    */
+    void swapModel(const std::shared_ptr<AssetParameterModel> &model);
+
 Q_SIGNALS:
     /** @brief Signal sent when the parameters hold by the widgets are modified
         The index corresponds which parameter is changed
@@ -28,6 +28,11 @@ public:
      */
     bool getValue();
 
+    /** @brief This widget only displays model values, it can be retargeted to another
+        instance of the same asset without being rebuilt
+    */
+    bool canSwapModel() const override { return true; }
+
 public Q_SLOTS:
     /** @brief Toggle the comments on or off
      */
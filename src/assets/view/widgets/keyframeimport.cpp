@@ -873,6 +873,9 @@ void KeyframeImport::importSelectedData()
     for (const auto &ix : qAsConst(m_indexes)) {
         // update keyframes in other indexes
         KeyframeModel *km = kfrModel->getKeyModel(ix);
+        // Collect all keyframes and apply them in one pass at the end, inserting them one by one
+        // is far too slow on large imports
+        std::map<GenTime, std::pair<KeyframeType, QVariant>> newKeyframes;
         qDebug() << "== " << ix << " = " << m_targetCombo->currentData().toModelIndex();
         if (ix == m_targetCombo->currentData().toModelIndex() || fakeRect) {
             // Import our keyframes
@@ -884,9 +887,10 @@ void KeyframeImport::importSelectedData()
                     if (frame > m_outPoint->getPosition()) {
                         break;
                     }
-                    km->addKeyframe(GenTime(frame - m_inPoint->getPosition() + m_offsetPoint->getPosition(), pCore->getCurrentFps()), KeyframeType::Linear,
-                                    json.value(json.keys().at(i)), true, undo, redo);
+                    newKeyframes[GenTime(frame - m_inPoint->getPosition() + m_offsetPoint->getPosition(), pCore->getCurrentFps())] = {KeyframeType::Linear,
+                                                                                                                                    json.value(json.keys().at(i))};
                 }
+                km->loadKeyframes(newKeyframes, false, undo, redo);
                 continue;
             }
             mlt_keyframe_type type;
@@ -903,8 +907,7 @@ void KeyframeImport::importSelectedData()
                 QVariant current = km->getInterpolatedValue(frame);
                 if (convertMode == ImportRoles::SimpleValue) {
                     double dval = animData->anim_get_double("key", frame);
-                    km->addKeyframe(GenTime(frame - m_inPoint->getPosition() + m_offsetPoint->getPosition(), pCore->getCurrentFps()), KeyframeType(type), dval,
-                                    true, undo, redo);
+                    newKeyframes[GenTime(frame - m_inPoint->getPosition() + m_offsetPoint->getPosition(), pCore->getCurrentFps())] = {KeyframeType(type), dval};
                     continue;
                 }
                 QStringList kfrData = current.toString().split(QLatin1Char(' '));
@@ -1089,9 +1092,9 @@ void KeyframeImport::importSelectedData()
                 } else {
                     current = kfrData.join(QLatin1Char(' '));
                 }
-                km->addKeyframe(GenTime(frame - m_inPoint->getPosition() + m_offsetPoint->getPosition(), pCore->getCurrentFps()), KeyframeType(type), current,
-                                true, undo, redo);
+                newKeyframes[GenTime(frame - m_inPoint->getPosition() + m_offsetPoint->getPosition(), pCore->getCurrentFps())] = {KeyframeType(type), current};
             }
+            km->loadKeyframes(newKeyframes, false, undo, redo);
         } else {
             int frame = 0;
             mlt_keyframe_type type;
@@ -1105,9 +1108,9 @@ void KeyframeImport::importSelectedData()
                 }
                 // frame += (m_inPoint->getPosition() - m_offsetPoint->getPosition());
                 QVariant current = km->getInterpolatedValue(frame);
-                km->addKeyframe(GenTime(frame - m_inPoint->getPosition() + m_offsetPoint->getPosition(), pCore->getCurrentFps()), KeyframeType(type), current,
-                                true, undo, redo);
+                newKeyframes[GenTime(frame - m_inPoint->getPosition() + m_offsetPoint->getPosition(), pCore->getCurrentFps())] = {KeyframeType(type), current};
             }
+            km->loadKeyframes(newKeyframes, false, undo, redo);
         }
     }
     pCore->pushUndo(undo, redo, i18n("Import keyframes from clipboard"));
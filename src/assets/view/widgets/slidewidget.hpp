@@ -38,6 +38,11 @@ private:
     wipeInfo getWipeInfo(QString value);
     const QString getWipeString(wipeInfo info);
 
+    /** @brief This widget only displays model values, it can be retargeted to another
+        instance of the same asset without being rebuilt
+    */
+    bool canSwapModel() const override { return true; }
+
 public Q_SLOTS:
     /** @brief Toggle the comments on or off
      */
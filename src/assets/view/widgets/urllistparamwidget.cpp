@@ -14,6 +14,8 @@
 #include <QFileDialog>
 #include <QtConcurrent>
 
+QHash<QString, QPair<qint64, bool>> UrlListParamWidget::m_lutValidationCache;
+
 UrlListParamWidget::UrlListParamWidget(std::shared_ptr<AssetParameterModel> model, QModelIndex index, QWidget *parent)
     : AbstractParamWidget(std::move(model), index, parent)
     , m_isLumaList(false)
@@ -280,20 +282,29 @@ void UrlListParamWidget::updateItemThumb(const QString &path)
 
 bool UrlListParamWidget::isValidCubeFile(const QString &path)
 {
+    const QDateTime lastModified = QFileInfo(path).lastModified();
+    const qint64 modified = lastModified.isValid() ? lastModified.toSecsSinceEpoch() : 0;
+    auto cached = m_lutValidationCache.constFind(path);
+    if (cached != m_lutValidationCache.constEnd() && cached->first == modified) {
+        return cached->second;
+    }
+    bool valid = false;
     QFile f(path);
     if (f.open(QFile::ReadOnly | QFile::Text)) {
         int lineCt = 0;
         QTextStream in(&f);
         while (!in.atEnd() && lineCt < 30) {
             QString line = in.readLine();
+            lineCt++;
             if (line.contains(QStringLiteral("LUT_3D_SIZE"))) {
-                f.close();
-                return true;
+                valid = true;
+                break;
             }
         }
         f.close();
     }
-    return false;
+    m_lutValidationCache.insert(path, {modified, valid});
+    return valid;
 }
 
 void UrlListParamWidget::openFile()
@@ -68,6 +68,11 @@ private:
     QFutureWatcher<void> m_watcher;
     QFuture<void> m_thumbJob;
     bool m_abortJobs{false};
+    /** @brief Process-wide cache of .cube LUT validation results, keyed by path and storing
+        the file's modification time, so that many effect instances sharing the same LUT
+        only open and parse the file once
+     */
+    static QHash<QString, QPair<qint64, bool>> m_lutValidationCache;
 
     /** @brief Reads the first 30 lines of a .cube LUT file and check for validity
      */
@@ -200,19 +200,38 @@ void AudioLevelWidget::drawBackground(int channels)
 // cppcheck-suppress unusedFunction
 void AudioLevelWidget::setAudioValues(const QVector<double> &values)
 {
-    m_values = values;
-    if (m_peaks.size() != m_values.size()) {
+    if (m_peaks.size() != values.size()) {
+        m_values = values;
         m_peaks = values;
         drawBackground(values.size());
-    } else {
-        for (int i = 0; i < m_values.size(); i++) {
-            m_peaks[i] -= .2;
-            if (m_values.at(i) > m_peaks.at(i)) {
-                m_peaks[i] = m_values.at(i);
-            }
+        update();
+        return;
+    }
+    const QVector<double> oldValues = m_values;
+    const QVector<double> oldPeaks = m_peaks;
+    m_values = values;
+    for (int i = 0; i < m_values.size(); i++) {
+        m_peaks[i] -= .2;
+        if (m_values.at(i) > m_peaks.at(i)) {
+            m_peaks[i] = m_values.at(i);
         }
     }
-    update();
+    // Only repaint the vertical span where the bars or peak lines moved, the gradient background
+    // pixmap is untouched
+    int levelsHeight = height() - 4;
+    int minY = height();
+    int maxY = 0;
+    for (int i = 0; i < m_values.size(); i++) {
+        const QVector<double> levels = {oldValues.at(i), m_values.at(i), oldPeaks.at(i), m_peaks.at(i)};
+        for (double level : levels) {
+            int y = qBound(0, 2 + levelsHeight - qRound(IEC_ScaleMax(level, m_maxDb) * levelsHeight), height());
+            minY = qMin(minY, y);
+            maxY = qMax(maxY, y);
+        }
+    }
+    if (maxY >= minY) {
+        update(QRect(0, minY - 1, width(), maxY - minY + 3));
+    }
 }
 
 void AudioLevelWidget::setVisibility(bool enable)
@@ -11,7 +11,7 @@
 //----------------------------------------------------------------------------
 // IEC standard dB scaling -- as borrowed from meterbridge (c) Steve Harris
 
-static inline double IEC_Scale(double dB)
+static constexpr double IEC_Scale(double dB)
 {
     double fScale = 1.0f;
 
@@ -27,13 +27,13 @@ static inline double IEC_Scale(double dB)
         fScale = (dB + 40.0f) * 0.015f + 0.15f;
     else if (dB < -20.0f)
         fScale = (dB + 30.0f) * 0.02f + 0.3f;
-    else if (dB < -0.001f || dB > 0.001f)  /* if (dB < 0.0f) */
+    else if (dB < -0.001f || dB > 0.001f) /* if (dB < 0.0f) */
         fScale = (dB + 20.0f) * 0.025f + 0.5f;
 
     return fScale;
 }
 
-static inline double IEC_ScaleMax(double dB, double max)
+static constexpr double IEC_ScaleMax(double dB, double max)
 {
     return IEC_Scale(dB) / IEC_Scale(max);
 }
@@ -50,5 +50,77 @@ static inline double fromDB(double level)
     return value;
 }
 
-#endif // IECSCALE_H
+//----------------------------------------------------------------------------
+// Linear amplitude ratio to dB conversion through a compile time generated
+// lookup table, so the audio meters don't run a log10 per channel on every
+// frame. The table is indexed by sqrt(ratio) so the resolution stays below
+// one dB near the -70 dB meter floor and gets finer towards 0 dB.
+
+namespace IEC_Detail {
+// std::log is not constexpr, so the table generator brings its own natural
+// log: range reduction by powers of two plus the atanh series, accurate far
+// beyond the table granularity
+constexpr double constLn(double x)
+{
+    int k = 0;
+    while (x > 1.125) {
+        x *= 0.5;
+        ++k;
+    }
+    while (x < 0.5625) {
+        x *= 2.0;
+        --k;
+    }
+    const double u = (x - 1.0) / (x + 1.0);
+    const double u2 = u * u;
+    double term = u;
+    double sum = 0.0;
+    for (int n = 1; n < 31; n += 2) {
+        sum += term / n;
+        term *= u2;
+    }
+    return 2.0 * sum + k * 0.6931471805599453;
+}
+
+constexpr int linearToDBTableSize = 1024;
+
+struct LinearToDBTable
+{
+    double dB[linearToDBTableSize + 1];
+    constexpr LinearToDBTable()
+        : dB()
+    {
+        dB[0] = -100.0;
+        for (int i = 1; i <= linearToDBTableSize; ++i) {
+            // entry i covers ratio = (i / size)^2, so dB = 40 * log10(i / size)
+            const double value = 40.0 * constLn(double(i) / linearToDBTableSize) / 2.302585092994046;
+            dB[i] = value < -100.0 ? -100.0 : value;
+        }
+    }
+};
+
+static constexpr LinearToDBTable linearToDBTable;
+} // namespace IEC_Detail
+
+/** @brief Returns 20 * log10(ratio) by table lookup with linear interpolation, clamped to -100 dB for silence */
+static inline double IEC_LinearToDB(double ratio)
+{
+    if (ratio <= 0.0) {
+        return -100.0;
+    }
+    double sign = 1.0;
+    if (ratio > 1.0) {
+        // log10(1 / x) == -log10(x), so ratios above unity reuse the same table
+        ratio = 1.0 / ratio;
+        sign = -1.0;
+    }
+    const double x = sqrt(ratio) * IEC_Detail::linearToDBTableSize;
+    const int ix = int(x);
+    if (ix >= IEC_Detail::linearToDBTableSize) {
+        return 0.0;
+    }
+    const double frac = x - ix;
+    return sign * (IEC_Detail::linearToDBTable.dB[ix] + frac * (IEC_Detail::linearToDBTable.dB[ix + 1] - IEC_Detail::linearToDBTable.dB[ix]));
+}
 
+#endif // IECSCALE_H
@@ -74,6 +74,17 @@ MixerManager::MixerManager(QWidget *parent)
     setLayout(m_box);
     MySlider slider;
     m_sliderHandle = slider.getHandleHeight();
+    // Deliver the latest level to all strips at most at display refresh rate, frames arriving
+    // faster than that only update the stored position
+    m_levelRefreshTimer.setSingleShot(true);
+    m_levelRefreshTimer.setInterval(1000 / 60);
+    connect(&m_levelRefreshTimer, &QTimer::timeout, this, [this]() { Q_EMIT updateLevels(m_lastLevelPos); });
+    connect(pCore.get(), &Core::updateMixerLevels, this, [this](int pos) {
+        m_lastLevelPos = pos;
+        if (!m_levelRefreshTimer.isActive()) {
+            m_levelRefreshTimer.start();
+        }
+    });
 }
 
 void MixerManager::checkAudioLevelVersion()
@@ -124,7 +135,7 @@ void MixerManager::registerTrack(int tid, Mlt::Tractor *service, const QString &
     if (m_visibleMixerManager) {
         mixer->connectMixer(!KdenliveSettings::mixerCollapse());
     }
-    connect(pCore.get(), &Core::updateMixerLevels, mixer.get(), &MixerWidget::updateAudioLevel);
+    connect(this, &MixerManager::updateLevels, mixer.get(), &MixerWidget::updateAudioLevel);
     connect(this, &MixerManager::clearMixers, mixer.get(), &MixerWidget::clear);
     connect(mixer.get(), &MixerWidget::toggleSolo, this, [&](int trid, bool solo) {
         if (!solo) {
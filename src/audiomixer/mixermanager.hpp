@@ -10,6 +10,7 @@
 #include <unordered_map>
 
 #include <QSlider>
+#include <QTimer>
 #include <QWidget>
 
 namespace Mlt {
@@ -88,4 +89,7 @@ private:
     int m_monitorTrack;
     bool m_filterIsV2;
     int m_sliderHandle;
+    /** @brief Coalesces level updates so the mixer strips repaint at most at display refresh rate */
+    QTimer m_levelRefreshTimer;
+    int m_lastLevelPos{-1};
 };
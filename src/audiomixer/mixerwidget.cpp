@@ -36,17 +36,18 @@ void MixerWidget::property_changed(mlt_service, MixerWidget *widget, mlt_event_d
     if (widget && !strcmp(Mlt::EventData(data).to_string(), "_position")) {
         mlt_properties filter_props = MLT_FILTER_PROPERTIES(widget->m_monitorFilter->get_filter());
         int pos = mlt_properties_get_int(filter_props, "_position");
-        if (!widget->m_levels.contains(pos)) {
-            QVector<double> levels;
-            for (int i = 0; i < widget->m_channels; i++) {
-                // NOTE: this is an approximation. To get the real peak level, we need version 2 of audiolevel MLT filter, see property_changedV2
-                levels << log10(mlt_properties_get_double(filter_props, QString("_audio_level.%1").arg(i).toUtf8().constData()) / 1.18) * 20;
-            }
-            widget->m_levels[pos] = std::move(levels);
-            if (widget->m_levels.size() > widget->m_maxLevels) {
-                widget->m_levels.erase(widget->m_levels.begin());
-            }
+        LevelSlot &slot = widget->m_levelRing[pos % LevelRingSize];
+        if (slot.pos.loadAcquire() == pos) {
+            // Levels for this frame are already stored
+            return;
         }
+        slot.pos.storeRelease(-1);
+        int channels = qMin(widget->m_channels, int(MaxLevelChannels));
+        for (int i = 0; i < channels; i++) {
+            // NOTE: this is an approximation. To get the real peak level, we need version 2 of audiolevel MLT filter, see property_changedV2
+            slot.levels[i] = IEC_LinearToDB(mlt_properties_get_double(filter_props, QString("_audio_level.%1").arg(i).toUtf8().constData()) / 1.18);
+        }
+        slot.pos.storeRelease(pos);
     }
 }
 
@@ -55,16 +56,17 @@ void MixerWidget::property_changedV2(mlt_service, MixerWidget *widget, mlt_event
     if (widget && !strcmp(Mlt::EventData(data).to_string(), "_position")) {
         mlt_properties filter_props = MLT_FILTER_PROPERTIES(widget->m_monitorFilter->get_filter());
         int pos = mlt_properties_get_int(filter_props, "_position");
-        if (!widget->m_levels.contains(pos)) {
-            QVector<double> levels;
-            for (int i = 0; i < widget->m_channels; i++) {
-                levels << mlt_properties_get_double(filter_props, QString("_audio_level.%1").arg(i).toUtf8().constData());
-            }
-            widget->m_levels[pos] = std::move(levels);
-            if (widget->m_levels.size() > widget->m_maxLevels) {
-                widget->m_levels.erase(widget->m_levels.begin());
-            }
+        LevelSlot &slot = widget->m_levelRing[pos % LevelRingSize];
+        if (slot.pos.loadAcquire() == pos) {
+            // Levels for this frame are already stored
+            return;
+        }
+        slot.pos.storeRelease(-1);
+        int channels = qMin(widget->m_channels, int(MaxLevelChannels));
+        for (int i = 0; i < channels; i++) {
+            slot.levels[i] = mlt_properties_get_double(filter_props, QString("_audio_level.%1").arg(i).toUtf8().constData());
         }
+        slot.pos.storeRelease(pos);
     }
 }
 
@@ -78,7 +80,6 @@ MixerWidget::MixerWidget(int tid, Mlt::Tractor *service, QString trackTag, const
     , m_channels(pCore->audioChannels())
     , m_balanceSpin(nullptr)
     , m_balanceSlider(nullptr)
-    , m_maxLevels(qMax(30, int(service->get_fps() * 1.5)))
     , m_solo(nullptr)
     , m_collapse(nullptr)
     , m_monitor(nullptr)
@@ -323,7 +324,7 @@ void MixerWidget::buildUI(Mlt::Tractor *service, const QString &trackName)
             m_volumeSpin->setValue(dbValue);
             m_levelFilter->set("level", dbValue);
             m_levelFilter->set("disable", value == 60 ? 1 : 0);
-            m_levels.clear();
+            clearLevels();
             Q_EMIT m_manager->purgeCache();
             pCore->setDocumentModified();
         }
@@ -335,7 +336,7 @@ void MixerWidget::buildUI(Mlt::Tractor *service, const QString &trackName)
             if (m_balanceFilter != nullptr) {
                 m_balanceFilter->set("start", (value + 50) / 100.);
                 m_balanceFilter->set("disable", value == 0 ? 1 : 0);
-                m_levels.clear();
+                clearLevels();
                 Q_EMIT m_manager->purgeCache();
                 pCore->setDocumentModified();
             }
@@ -447,26 +448,38 @@ void MixerWidget::updateLabel()
 
 void MixerWidget::updateAudioLevel(int pos)
 {
-    QMutexLocker lk(&m_storeMutex);
-    if (m_levels.contains(pos)) {
-        m_audioMeterWidget->setAudioValues(m_levels.value(pos));
-        // m_levels.remove(pos);
-    } else {
-        m_audioMeterWidget->setAudioValues(m_audioData);
+    LevelSlot &slot = m_levelRing[pos % LevelRingSize];
+    if (slot.pos.loadAcquire() == pos) {
+        int channels = qMin(m_channels, int(MaxLevelChannels));
+        QVector<double> levels(channels);
+        for (int i = 0; i < channels; i++) {
+            levels[i] = slot.levels[i];
+        }
+        // The audio thread may have recycled the slot while we copied, re-check the position
+        if (slot.pos.loadAcquire() == pos) {
+            m_audioMeterWidget->setAudioValues(levels);
+            return;
+        }
+    }
+    m_audioMeterWidget->setAudioValues(m_audioData);
+}
+
+void MixerWidget::clearLevels()
+{
+    for (int i = 0; i < int(LevelRingSize); i++) {
+        m_levelRing[i].pos.storeRelease(-1);
     }
 }
 
 void MixerWidget::reset()
 {
-    QMutexLocker lk(&m_storeMutex);
-    m_levels.clear();
+    clearLevels();
     m_audioMeterWidget->setAudioValues(m_audioData);
 }
 
 void MixerWidget::clear()
 {
-    QMutexLocker lk(&m_storeMutex);
-    m_levels.clear();
+    clearLevels();
 }
 
 bool MixerWidget::isMute() const
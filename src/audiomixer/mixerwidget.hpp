@@ -8,7 +8,7 @@
 #include "definitions.h"
 #include "mlt++/MltService.h"
 
-#include <QMutex>
+#include <QAtomicInt>
 #include <QWidget>
 #include <memory>
 #include <unordered_map>
@@ -76,13 +76,23 @@ protected:
     std::shared_ptr<Mlt::Filter> m_levelFilter;
     std::shared_ptr<Mlt::Filter> m_monitorFilter;
     std::shared_ptr<Mlt::Filter> m_balanceFilter;
-    QMap<int, QVector<double>> m_levels;
+    enum { LevelRingSize = 64, MaxLevelChannels = 8 };
+    /** @brief One slot of the lock-free level store. The MLT audio thread writes the levels
+     *  computed for a frame and publishes the position last; the gui reads the slot matching
+     *  the displayed frame and re-checks the position to detect a concurrent rewrite. */
+    struct LevelSlot
+    {
+        QAtomicInt pos{-1};
+        double levels[MaxLevelChannels];
+    };
+    LevelSlot m_levelRing[LevelRingSize];
     int m_channels;
     KDualAction *m_muteAction;
     QSpinBox *m_balanceSpin;
     QSlider *m_balanceSlider;
     QDoubleSpinBox *m_volumeSpin;
-    int m_maxLevels;
+    /** @brief Invalidates all ring slots, used when a gain change makes the stored levels stale */
+    void clearLevels();
 
 private:
     std::shared_ptr<AudioLevelWidget> m_audioMeterWidget;
@@ -91,7 +101,6 @@ private:
     QToolButton *m_collapse;
     QToolButton *m_monitor;
     KSqueezedTextLabel *m_trackLabel;
-    QMutex m_storeMutex;
     double m_lastVolume;
     QVector<double> m_audioData;
     Mlt::Event *m_listener;
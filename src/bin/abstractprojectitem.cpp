@@ -238,6 +238,25 @@ const QVariant AbstractProjectItem::getData(DataType type) const
     return data;
 }
 
+const QCollatorSortKey &AbstractProjectItem::nameSortKey(const QCollator &collator) const
+{
+    // The source string is implicitly shared, so the comparison is a pointer check while the name is unchanged
+    if (!m_nameSortKey || m_nameSortSource != m_name) {
+        m_nameSortKey = std::make_unique<QCollatorSortKey>(collator.sortKey(m_name));
+        m_nameSortSource = m_name;
+    }
+    return *m_nameSortKey;
+}
+
+qint64 AbstractProjectItem::dateSortKey() const
+{
+    if (m_dateSortSource != m_date) {
+        m_dateSortKey = m_date.isValid() ? m_date.toMSecsSinceEpoch() : 0;
+        m_dateSortSource = m_date;
+    }
+    return m_dateSortKey;
+}
+
 int AbstractProjectItem::supportedDataCount() const
 {
     return 9;
@@ -11,6 +11,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include "abstractmodel/treeitem.hpp"
 #include "undohelper.hpp"
 
+#include <QCollator>
 #include <QDateTime>
 #include <QIcon>
 #include <QObject>
@@ -144,6 +145,14 @@ public:
      * This function is necessary for interaction with ProjectItemModel.
      */
     virtual const QVariant getData(DataType type) const;
+
+    /** @brief Collated key of the item name, used by the bin's sort proxy so resorting does not
+     *  re-collate the strings on every comparison. Recomputed when the name changes */
+    const QCollatorSortKey &nameSortKey(const QCollator &collator) const;
+
+    /** @brief Creation date as milliseconds since epoch, cached for the bin's sort proxy */
+    qint64 dateSortKey() const;
+
     /**
      * @brief Returns the item icon.
      */
@@ -228,4 +237,11 @@ protected:
 
 private:
     bool m_isCurrent;
+
+    /** @brief Cached sort keys, along with the values they were computed from so a change is
+     *  detected on access (the name and date are mutated from many places) */
+    mutable std::unique_ptr<QCollatorSortKey> m_nameSortKey;
+    mutable QString m_nameSortSource;
+    mutable qint64 m_dateSortKey{0};
+    mutable QDateTime m_dateSortSource;
 };
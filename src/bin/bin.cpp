@@ -50,6 +50,10 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include "projectsortproxymodel.h"
 #include "projectsubclip.h"
 #include "tagwidget.hpp"
+#include "timeline2/model/timelineitemmodel.hpp"
+#include "timeline2/view/previewmanager.h"
+#include "timeline2/view/timelinewidget.h"
+#include "titler/titledocument.h"
 #include "titler/titlewidget.h"
 #include "ui_newtimeline_ui.h"
 #include "ui_qtextclip_ui.h"
@@ -654,6 +658,10 @@ MyListView::MyListView(QWidget *parent)
     setViewMode(QListView::IconMode);
     setMovement(QListView::Static);
     setResizeMode(QListView::Adjust);
+    // Lay out the grid incrementally so switching to icon view on huge projects shows
+    // the first screen immediately instead of measuring every item up front
+    setLayoutMode(QListView::Batched);
+    setBatchSize(256);
     setWordWrap(true);
     setDragDropMode(QAbstractItemView::DragDrop);
     setUniformItemSizes(true);
@@ -1472,13 +1480,18 @@ Bin::Bin(std::shared_ptr<ProjectItemModel> model, QWidget *parent, bool isMainBi
             // TODO: implement pending only deletion
             pCore->taskManager.slotCancelJobs();
         });
-        connect(this, &Bin::requestUpdateSequences, [this](QMap<QUuid, int> sequences) {
-            QMapIterator<QUuid, int> s(sequences);
-            while (s.hasNext()) {
-                s.next();
-                updateSequenceClip(s.key(), s.value(), -1, true);
-            }
-        });
+        // Queued so that a reloaded sequence updates its parent sequences on the next event loop
+        // cycle instead of recursing synchronously through all nesting levels
+        connect(
+            this, &Bin::requestUpdateSequences, this,
+            [this](QMap<QUuid, int> sequences) {
+                QMapIterator<QUuid, int> s(sequences);
+                while (s.hasNext()) {
+                    s.next();
+                    updateSequenceClip(s.key(), s.value(), -1, true);
+                }
+            },
+            Qt::QueuedConnection);
     }
     // Hack, create toolbar spacer
     QWidget *spacer = new QWidget();
@@ -2943,36 +2956,40 @@ void Bin::slotInitView(QAction *action)
     m_blankThumb.addPixmap(pix);
     m_itemView->addAction(m_renameAction);
     m_renameAction->setShortcutContext(Qt::WidgetWithChildrenShortcut);
-    m_proxyModel = std::make_unique<ProjectSortProxyModel>(this);
-    // Connect models
-    m_proxyModel->setSourceModel(m_itemModel.get());
-    connect(m_itemModel.get(), &QAbstractItemModel::dataChanged, m_proxyModel.get(), &ProjectSortProxyModel::slotDataChanged);
-    connect(m_proxyModel.get(), &ProjectSortProxyModel::updateRating, this, [&](const QModelIndex &ix, uint rating) {
-        const QModelIndex index = m_proxyModel->mapToSource(ix);
-        std::shared_ptr<AbstractProjectItem> item = m_itemModel->getBinItemByIndex(index);
-        if (item) {
-            uint previousRating = item->rating();
-            Fun undo = [this, item, index, previousRating]() {
-                item->setRating(previousRating);
-                Q_EMIT m_itemModel->dataChanged(index, index, {AbstractProjectItem::DataRating});
-                return true;
-            };
-            Fun redo = [this, item, index, rating]() {
-                item->setRating(rating);
-                Q_EMIT m_itemModel->dataChanged(index, index, {AbstractProjectItem::DataRating});
-                return true;
-            };
-            redo();
-            pCore->pushUndo(undo, redo, i18n("Edit rating"));
-        } else {
-            Q_EMIT displayBinMessage(i18n("Cannot set rating on this item"), KMessageWidget::Information);
-        }
-    });
-    connect(m_proxyModel.get(), &ProjectSortProxyModel::selectModel, this, &Bin::selectProxyModel);
-    connect(m_proxyModel.get(), &QAbstractItemModel::layoutAboutToBeChanged, this, &Bin::slotSetSorting);
+    // The proxy model is kept across view switches so the sorted / filtered rows don't
+    // have to be rebuilt when only the view type changes
+    if (m_proxyModel == nullptr) {
+        m_proxyModel = std::make_unique<ProjectSortProxyModel>(this);
+        // Connect models
+        m_proxyModel->setSourceModel(m_itemModel.get());
+        connect(m_itemModel.get(), &QAbstractItemModel::dataChanged, m_proxyModel.get(), &ProjectSortProxyModel::slotDataChanged);
+        connect(m_proxyModel.get(), &ProjectSortProxyModel::updateRating, this, [&](const QModelIndex &ix, uint rating) {
+            const QModelIndex index = m_proxyModel->mapToSource(ix);
+            std::shared_ptr<AbstractProjectItem> item = m_itemModel->getBinItemByIndex(index);
+            if (item) {
+                uint previousRating = item->rating();
+                Fun undo = [this, item, index, previousRating]() {
+                    item->setRating(previousRating);
+                    Q_EMIT m_itemModel->dataChanged(index, index, {AbstractProjectItem::DataRating});
+                    return true;
+                };
+                Fun redo = [this, item, index, rating]() {
+                    item->setRating(rating);
+                    Q_EMIT m_itemModel->dataChanged(index, index, {AbstractProjectItem::DataRating});
+                    return true;
+                };
+                redo();
+                pCore->pushUndo(undo, redo, i18n("Edit rating"));
+            } else {
+                Q_EMIT displayBinMessage(i18n("Cannot set rating on this item"), KMessageWidget::Information);
+            }
+        });
+        connect(m_proxyModel.get(), &ProjectSortProxyModel::selectModel, this, &Bin::selectProxyModel);
+        connect(m_proxyModel.get(), &QAbstractItemModel::layoutAboutToBeChanged, this, &Bin::slotSetSorting);
+        m_proxyModel->setDynamicSortFilter(true);
+    }
     m_itemView->setModel(m_proxyModel.get());
     m_itemView->setSelectionModel(m_proxyModel->selectionModel());
-    m_proxyModel->setDynamicSortFilter(true);
     m_layout->insertWidget(2, m_itemView);
     // Reset drag type to normal
     m_itemModel->setDragType(PlaylistState::Disabled);
@@ -4834,6 +4851,20 @@ void Bin::showTitleWidget(const std::shared_ptr<ProjectClip> &clip)
         slotEditClipCommand(clip->AbstractProjectItem::clipId(), clip->currentProperties(newprops), newprops);
         // when edit is triggered from the timeline, project monitor refresh is necessary after an edit is made
         pCore->refreshProjectMonitorOnce();
+        if (!clips.isEmpty() && TitleDocument::isAnimated(dia_ui.xml())) {
+            // Animated titles are re-rendered frame by frame by the producer on playback, queue a background
+            // preview render over the title zones so playback uses pre-rendered frames
+            TimelineWidget *timeline = pCore->window()->getCurrentTimeline();
+            std::shared_ptr<TimelineItemModel> model = timeline ? timeline->model() : nullptr;
+            if (model && model->hasTimelinePreview()) {
+                for (int cid : qAsConst(clips)) {
+                    ObjectId oid(KdenliveObjectType::TimelineClip, cid, pCore->currentTimelineId());
+                    int in = pCore->getItemPosition(oid);
+                    model->previewManager()->addPreviewRange(QPoint(in, in + pCore->getItemDuration(oid)), true);
+                }
+                model->previewManager()->startPreviewRender();
+            }
+        }
     } else {
         pCore->temporaryUnplug(clips, false);
         if (res == QDialog::Accepted + 1) {
@@ -5119,7 +5150,9 @@ void Bin::reloadAllProducers(bool reloadThumbs)
         if (!xml.isNull()) {
             clip->discardAudioThumb();
             if (reloadThumbs) {
-                ThumbnailCache::get()->invalidateThumbsForClip(clip->clipId());
+                // Lazy invalidation: the thumbs are dropped when next requested, so reloading
+                // every producer of a large project stays O(1) per clip here
+                ThumbnailCache::get()->invalidateThumbsForClipLater(clip->clipId());
             }
             clip->setClipStatus(FileStatus::StatusWaiting);
             ObjectId oid(KdenliveObjectType::BinClip, clip->clipId().toInt(), QUuid());
@@ -5171,17 +5204,21 @@ void Bin::rebuildProxies()
 {
     QList<std::shared_ptr<ProjectClip>> clipList = m_itemModel->getRootFolder()->childClips();
     QList<std::shared_ptr<ProjectClip>> toProxy;
+    QList<ObjectId> toDiscard;
     for (const std::shared_ptr<ProjectClip> &clp : qAsConst(clipList)) {
         if (clp->hasProxy()) {
             toProxy << clp;
-            // Abort all pending jobs
-            pCore->taskManager.discardJobs(ObjectId(KdenliveObjectType::BinClip, clp->clipId().toInt(), QUuid()), AbstractTask::PROXYJOB);
-            clp->deleteProxy(false);
+            toDiscard << ObjectId(KdenliveObjectType::BinClip, clp->clipId().toInt(), QUuid());
         }
     }
     if (toProxy.isEmpty()) {
         return;
     }
+    // Abort all pending jobs in one batch so the cancellations happen concurrently
+    pCore->taskManager.discardJobs(toDiscard, AbstractTask::PROXYJOB);
+    for (const std::shared_ptr<ProjectClip> &clp : qAsConst(toProxy)) {
+        clp->deleteProxy(false);
+    }
     auto *masterCommand = new QUndoCommand();
     masterCommand->setText(i18n("Rebuild proxies"));
     m_doc->slotProxyCurrentItem(true, toProxy, true, masterCommand);
@@ -5990,6 +6027,22 @@ void Bin::updateSequenceClip(const QUuid &uuid, int duration, int pos, bool forc
         std::shared_ptr<ProjectClip> clip = m_itemModel->getClipByBinID(binId);
         Q_ASSERT(clip != nullptr);
         if (m_doc->sequenceThumbRequiresRefresh(uuid) || forceUpdate) {
+            // The refresh flag is set on any edit in the sequence, check if the content around the
+            // poster frame really changed before discarding the thumbnail
+            bool posterChanged = true;
+            std::shared_ptr<TimelineItemModel> model = m_doc->getTimeline(uuid);
+            if (model) {
+                const QString posterHash = model->clipsHashAtPosition(clip->getThumbFrame());
+                posterChanged = posterHash != m_doc->getSequenceProperty(uuid, QStringLiteral("thumbHash"));
+                if (posterChanged) {
+                    m_doc->setSequenceProperty(uuid, QStringLiteral("thumbHash"), posterHash);
+                }
+            }
+            if (!posterChanged && !forceUpdate && clip->frameDuration() == size_t(duration)) {
+                // Duration and poster frame content are unchanged, nothing to sync
+                m_doc->sequenceThumbUpdated(uuid);
+                return;
+            }
             // Store general sequence properties
             QMap<QString, QString> properties;
             properties.insert(QStringLiteral("length"), QString::number(duration));
@@ -6000,7 +6053,11 @@ void Bin::updateSequenceClip(const QUuid &uuid, int duration, int pos, bool forc
             // Reset thumbs producer
             m_doc->sequenceThumbUpdated(uuid);
             clip->reloadTimeline();
-            // Don't update thumb now, it causes too much lag on sequence switch or saving
+            if (posterChanged && !m_doc->loading) {
+                // Rebuild the bin thumbnail, only done when the poster frame content changed to
+                // avoid lag on sequence switch or saving
+                clip->reloadProducer(true);
+            }
         }
     }
 }
@@ -54,6 +54,7 @@ void BinPlaylist::manageBinItemInsertion(const std::shared_ptr<AbstractProjectIt
             dummy.set("kdenlive:id", id.toUtf8().constData());
             m_binPlaylist->append(dummy);
         }
+        m_clipPositions[id] = m_binPlaylist->count() - 1;
         m_allClips.insert(id);
         connect(clip.get(), &ProjectClip::producerChanged, this, &BinPlaylist::changeProducer);
         break;
@@ -106,18 +107,18 @@ void BinPlaylist::manageBinItemDeletion(AbstractProjectItem *binElem)
 
 void BinPlaylist::removeBinClip(const QString &id)
 {
-    // we iterate on the clips of the timeline to find the correct one
-    bool ok = false;
-    int size = m_binPlaylist->count();
-    for (int i = 0; !ok && i < size; i++) {
-        QScopedPointer<Mlt::Producer> prod(m_binPlaylist->get_clip(i));
-        QString prodId(prod->parent().get("kdenlive:id"));
-        if (prodId == id) {
-            m_binPlaylist->remove(i);
-            ok = true;
+    // The stored position lets us remove the clip without instantiating a producer for every playlist entry
+    auto pos = m_clipPositions.find(id);
+    Q_ASSERT(pos != m_clipPositions.end());
+    int ix = pos->second;
+    m_binPlaylist->remove(ix);
+    m_clipPositions.erase(pos);
+    // Entries after the removed one shift down
+    for (auto &p : m_clipPositions) {
+        if (p.second > ix) {
+            p.second--;
         }
     }
-    Q_ASSERT(ok);
 }
 
 void BinPlaylist::changeProducer(const QString &id, Mlt::Producer producer)
@@ -125,6 +126,7 @@ void BinPlaylist::changeProducer(const QString &id, Mlt::Producer producer)
     Q_ASSERT(m_allClips.count(id) > 0);
     removeBinClip(id);
     m_binPlaylist->append(producer);
+    m_clipPositions[id] = m_binPlaylist->count() - 1;
 }
 
 void BinPlaylist::setRetainIn(Mlt::Tractor *modelTractor)
@@ -9,6 +9,7 @@
 #include <QObject>
 #include <QUuid>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 
 class AbstractProjectItem;
@@ -96,5 +97,7 @@ private:
     QUuid m_uuid;
     /** @brief Set of the bin inserted */
     std::unordered_set<QString> m_allClips;
+    /** @brief Position of each clip in the playlist, so producer swaps don't require scanning all entries */
+    std::unordered_map<QString, int> m_clipPositions;
     QMap<QUuid, QString> m_sequenceClips;
 };
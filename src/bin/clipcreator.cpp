@@ -22,6 +22,7 @@
 #include <KMessageBox>
 #include <QApplication>
 #include <QDomDocument>
+#include <QElapsedTimer>
 #include <QMimeDatabase>
 #include <utility>
 
@@ -408,6 +409,12 @@ const QString ClipCreator::createClipsFromList(const QList<QUrl> &list, bool che
     QMetaObject::Connection stopConnect = QObject::connect(pCore.get(), &Core::stopProgressTask, &progressOwner, [&stopProcess]() { stopProcess = true; });
     int current = 0;
     int lastCount = -1;
+    // Plain files are collected and inserted in one batch at the end, so the model only
+    // performs one row insertion and registers one undo operation for the whole import
+    QList<QDomElement> batchedDescriptions;
+    // Pumping the event loop for every file adds up on large imports, only do it a few times per second
+    QElapsedTimer progressTimer;
+    progressTimer.start();
     for (const QUrl &file : qAsConst(cleanList)) {
         current++;
         if (stopProcess) {
@@ -431,7 +438,6 @@ const QString ClipCreator::createClipsFromList(const QList<QUrl> &list, bool che
                 lastCount = count;
                 pCore->loadingClips(lastCount, true);
             }
-            qApp->processEvents();
         }
         if (info.isDir()) {
             // user dropped a folder, import its files
@@ -549,27 +555,40 @@ const QString ClipCreator::createClipsFromList(const QList<QUrl> &list, bool che
                 }
                 checkedDirectories << fileDir;
             }
-            std::function<void(const QString &)> callBack = [](const QString &) {};
-            if (firstClip) {
-                callBack = [](const QString &binId) { pCore->activeBin()->selectClipById(binId); };
-                firstClip = false;
-            }
             if (model->uuid() != uuid) {
                 // Project was closed, abort
                 pCore->displayMessage(QString(), OperationCompletedMessage, 100);
                 qDebug() << "/// PROJECT UUID MISMATCH; ABORTING";
                 return QString();
             }
-            const QString clipId = ClipCreator::createClipFromFile(file.toLocalFile(), parentFolder, model, undo, redo, callBack);
-            if (createdItem.isEmpty() && clipId != QLatin1String("-1")) {
-                createdItem = clipId;
+            QDomDocument xml = getXmlFromUrl(file.toLocalFile());
+            if (!xml.isNull()) {
+                batchedDescriptions << xml.documentElement();
             }
         }
-        if (!stopProcess) {
+        if (!stopProcess && progressTimer.elapsed() > 200) {
             qApp->processEvents();
+            progressTimer.restart();
         }
     }
     QObject::disconnect(stopConnect);
+    if (!batchedDescriptions.isEmpty()) {
+        std::function<void(const QString &)> callBack = [](const QString &) {};
+        if (firstClip) {
+            // Select the first clip of the batch that becomes ready
+            auto selectionDone = std::make_shared<bool>(false);
+            callBack = [selectionDone](const QString &binId) {
+                if (!*selectionDone) {
+                    *selectionDone = true;
+                    pCore->activeBin()->selectClipById(binId);
+                }
+            };
+        }
+        QStringList newIds;
+        if (model->requestAddBinClips(newIds, batchedDescriptions, parentFolder, undo, redo, callBack) && createdItem.isEmpty() && !newIds.isEmpty()) {
+            createdItem = newIds.first();
+        }
+    }
     pCore->displayMessage(i18n("Loading done"), OperationCompletedMessage, 100);
     return createdItem == QLatin1String("-1") ? QString() : createdItem;
 }
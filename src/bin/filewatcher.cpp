@@ -4,10 +4,15 @@
 */
 
 #include "filewatcher.hpp"
+#include "kdenlivesettings.h"
 
 #include <KDirWatch>
+#include <QDateTime>
 #include <QFileInfo>
 
+/// Time without any event after which a modified file is considered stable and reloaded
+static const qint64 quiescenceWindowMs = 2000;
+
 FileWatcher::FileWatcher(QObject *parent)
     : QObject(parent)
     , m_fileWatcher(new KDirWatch)
@@ -21,6 +26,13 @@ FileWatcher::FileWatcher(QObject *parent)
     m_queueTimer.setInterval(300);
     m_queueTimer.setSingleShot(true);
     connect(&m_queueTimer, &QTimer::timeout, this, &FileWatcher::slotProcessQueue);
+    connect(&m_pollTimer, &QTimer::timeout, this, &FileWatcher::slotPollFiles);
+    m_eventClock.start();
+}
+
+bool FileWatcher::usePolling()
+{
+    return KdenliveSettings::filewatcherpolling();
 }
 
 void FileWatcher::slotProcessQueue()
@@ -59,8 +71,15 @@ void FileWatcher::doAddFile(const QString &binId, const QString &url)
         return;
     }
     if (m_occurences.count(url) == 0) {
-        // QtConcurrent::run([=] { KDirWatch::self()->addFile(url); });
-        m_fileWatcher->addFile(url);
+        if (usePolling()) {
+            QFileInfo info(url);
+            m_polledFiles[url] = {info.exists(), info.lastModified().toMSecsSinceEpoch(), info.size()};
+            if (!m_pollTimer.isActive()) {
+                m_pollTimer.start(qMax(1, KdenliveSettings::filewatcherpollinterval()) * 1000);
+            }
+        } else {
+            m_fileWatcher->addFile(url);
+        }
     }
     m_occurences[url].insert(binId);
     m_binClipPaths[binId] = url;
@@ -75,11 +94,44 @@ void FileWatcher::removeFile(const QString &binId)
     m_occurences[url].erase(binId);
     m_binClipPaths.erase(binId);
     if (m_occurences[url].empty()) {
-        m_fileWatcher->removeFile(url);
+        if (m_polledFiles.count(url) > 0) {
+            m_polledFiles.erase(url);
+            if (m_polledFiles.empty()) {
+                m_pollTimer.stop();
+            }
+        } else {
+            m_fileWatcher->removeFile(url);
+        }
         m_occurences.erase(url);
     }
 }
 
+void FileWatcher::slotPollFiles()
+{
+    for (auto &polled : m_polledFiles) {
+        QFileInfo info(polled.first);
+        if (!info.exists()) {
+            if (polled.second.exists) {
+                polled.second.exists = false;
+                slotUrlMissing(polled.first);
+            }
+            continue;
+        }
+        const qint64 modified = info.lastModified().toMSecsSinceEpoch();
+        const qint64 size = info.size();
+        if (!polled.second.exists) {
+            polled.second = {true, modified, size};
+            slotUrlAdded(polled.first);
+            continue;
+        }
+        if (modified != polled.second.modified || size != polled.second.size) {
+            polled.second.modified = modified;
+            polled.second.size = size;
+            slotUrlModified(polled.first);
+        }
+    }
+}
+
 void FileWatcher::slotUrlModified(const QString &path)
 {
     if (m_modifiedUrls.insert(path).second) {
@@ -87,6 +139,8 @@ void FileWatcher::slotUrlModified(const QString &path)
             Q_EMIT binClipWaiting(id);
         }
     }
+    // Restart the quiescence window for this file on every event
+    m_lastEventTime[path] = m_eventClock.elapsed();
     if (!m_modifiedTimer.isActive()) {
         m_modifiedTimer.start();
     }
@@ -94,8 +148,12 @@ void FileWatcher::slotUrlModified(const QString &path)
 
 void FileWatcher::slotUrlAdded(const QString &path)
 {
+    QStringList modifiedIds;
     for (const QString &id : m_occurences[path]) {
-        Q_EMIT binClipModified(id);
+        modifiedIds << id;
+    }
+    if (!modifiedIds.isEmpty()) {
+        Q_EMIT binClipsModified(modifiedIds);
     }
 }
 
@@ -108,14 +166,25 @@ void FileWatcher::slotUrlMissing(const QString &path)
 
 void FileWatcher::slotProcessModifiedUrls()
 {
+    QStringList modifiedIds;
     auto checkList = m_modifiedUrls;
     for (const QString &path : checkList) {
-        if (m_fileWatcher->ctime(path).msecsTo(QDateTime::currentDateTime()) > 2000) {
-            for (const QString &id : m_occurences[path]) {
-                Q_EMIT binClipModified(id);
-            }
-            m_modifiedUrls.erase(path);
+        // Only reload once no event was received for the file during the quiescence window
+        if (m_eventClock.elapsed() - m_lastEventTime[path] <= quiescenceWindowMs) {
+            continue;
         }
+        if (m_fileWatcher->contains(path) && m_fileWatcher->ctime(path).msecsTo(QDateTime::currentDateTime()) <= quiescenceWindowMs) {
+            continue;
+        }
+        for (const QString &id : m_occurences[path]) {
+            modifiedIds << id;
+        }
+        m_modifiedUrls.erase(path);
+        m_lastEventTime.erase(path);
+    }
+    if (!modifiedIds.isEmpty()) {
+        // Batch all settled files in one notification so many clips finishing at once trigger one reload pass
+        Q_EMIT binClipsModified(modifiedIds);
     }
     if (m_modifiedUrls.empty()) {
         m_modifiedTimer.stop();
@@ -125,18 +194,23 @@ void FileWatcher::slotProcessModifiedUrls()
 void FileWatcher::clear()
 {
     m_queueTimer.stop();
+    m_pollTimer.stop();
     m_fileWatcher->stopScan();
     for (const auto &f : m_occurences) {
-        m_fileWatcher->removeFile(f.first);
+        if (m_polledFiles.count(f.first) == 0) {
+            m_fileWatcher->removeFile(f.first);
+        }
     }
     m_pendingUrls.clear();
     m_occurences.clear();
     m_modifiedUrls.clear();
+    m_lastEventTime.clear();
+    m_polledFiles.clear();
     m_binClipPaths.clear();
     m_fileWatcher->startScan();
 }
 
 bool FileWatcher::contains(const QString &path) const
 {
-    return m_fileWatcher->contains(path);
+    return m_fileWatcher->contains(path) || m_polledFiles.count(path) > 0;
 }
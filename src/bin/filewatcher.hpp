@@ -7,6 +7,7 @@
 
 #include "definitions.h"
 #include <KDirWatch>
+#include <QElapsedTimer>
 #include <QTimer>
 #include <unordered_map>
 #include <unordered_set>
@@ -32,10 +33,11 @@ public:
     void clear();
 
 Q_SIGNALS:
-    /** @brief This signal is triggered whenever the file corresponding to a bin clip has been modified and should be reloaded. Note that this signal is sent no
-     * more than every 1500 ms. We also make sure that at least 1000ms has passed since the last modification of the file. */
-    void binClipModified(const QString &binId);
-    /** @brief Same signal than binClipModified, but triggers immediately. Can be useful to refresh UI without actually reloading the file (yet)*/
+    /** @brief This signal is triggered with all the bin clips whose files have been modified and should be reloaded. Modified files are debounced: a clip is
+     * only included once no event was received for it during the quiescence window, so files that are being written to (like growing ingest files) trigger one
+     * reload when the writer is done instead of one per write. */
+    void binClipsModified(const QStringList &binIds);
+    /** @brief Signals that a file was modified, but triggers immediately. Can be useful to refresh UI without actually reloading the file (yet)*/
     void binClipWaiting(const QString &binId);
     void binClipMissing(const QString &binId);
 
@@ -45,8 +47,18 @@ private Q_SLOTS:
     void slotUrlAdded(const QString &path);
     void slotProcessModifiedUrls();
     void slotProcessQueue();
+    /** @brief Check the watched files for changes, used when polling mode is enabled */
+    void slotPollFiles();
 
 private:
+    /// Last known state of a file in polling mode
+    struct PolledFileInfo
+    {
+        bool exists;
+        qint64 modified;
+        qint64 size;
+    };
+
     /// This is a handle to the watcher singleton, not owned by this class.
     std::unique_ptr<KDirWatch> m_fileWatcher;
     /// A list with urls as keys, and the corresponding clip ids as value
@@ -57,11 +69,21 @@ private:
     /// List of files for which we received an update since the last send
     std::unordered_set<QString> m_modifiedUrls;
 
+    /// Time of the last received event for each modified file, compared against m_eventClock
+    std::unordered_map<QString, qint64> m_lastEventTime;
+
     /// When loading a project or adding many clips, adding many files to the watcher causes a freeze, so queue them
     std::unordered_map<QString, QString> m_pendingUrls;
 
+    /// Files tracked by polling instead of the system watcher
+    std::unordered_map<QString, PolledFileInfo> m_polledFiles;
+
     QTimer m_modifiedTimer;
     QTimer m_queueTimer;
+    QTimer m_pollTimer;
+    QElapsedTimer m_eventClock;
     /// Add a file to the list of watched items
     void doAddFile(const QString &binId, const QString &url);
+    /** @returns True if changes should be detected by polling (for network mounts where inotify floods or fails) */
+    static bool usePolling();
 };
@@ -62,6 +62,11 @@ MediaBrowser::MediaBrowser(QWidget *parent)
     // Create View
     m_op = new KDirOperator(QUrl(), parent);
     m_op->dirLister()->setAutoUpdate(false);
+    // Entries stream into the view in the lister's batches; without this the lister sniffs the
+    // content of every file during listing to resolve its mime type and icon, which freezes the
+    // interface on large folders over slow mounts. Delayed mime types are resolved on demand
+    // instead, and the preview generator fills in real thumbnails for the visible range anyway.
+    m_op->dirLister()->setDelayedMimeTypes(true);
     // Ensure shortcuts are only active on this widget to avoid conflicts with app shortcuts
     QList<QAction *> actions = m_op->allActions();
     QAction *trash = m_op->action(KDirOperator::Trash);
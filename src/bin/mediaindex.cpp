@@ -0,0 +1,112 @@
+/*
+    SPDX-FileCopyrightText: Jean-Baptiste Mardelle <jb@kdenlive.org>
+    This file is part of Kdenlive. See www.kdenlive.org.
+
+    SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "mediaindex.h"
+#include "bin/projectclip.h"
+#include "core.h"
+#include "doc/kdenlivedoc.h"
+
+#include <QDataStream>
+#include <QFile>
+#include <QSaveFile>
+
+QMutex MediaIndex::m_mutex;
+QHash<QString, QMap<QString, QString>> MediaIndex::m_index;
+QString MediaIndex::m_indexPath;
+bool MediaIndex::m_dirty = false;
+
+// Bump when the stored format changes, outdated index files are simply discarded
+static const quint32 mediaIndexVersion = 1;
+
+const QString MediaIndex::keyForFile(const QString &path)
+{
+    const QPair<QByteArray, qint64> hashData = ProjectClip::calculateHash(path);
+    if (hashData.first.isEmpty()) {
+        return QString();
+    }
+    return QString::fromLatin1(hashData.first.toHex()) + QLatin1Char(':') + QString::number(hashData.second);
+}
+
+void MediaIndex::ensureLoaded()
+{
+    if (pCore->currentDoc() == nullptr) {
+        return;
+    }
+    bool ok = false;
+    QDir cacheDir = pCore->currentDoc()->getCacheDir(CacheBase, &ok);
+    if (!ok) {
+        return;
+    }
+    const QString path = cacheDir.absoluteFilePath(QStringLiteral("mediaindex"));
+    if (path == m_indexPath) {
+        return;
+    }
+    if (m_dirty) {
+        saveLocked();
+    }
+    m_index.clear();
+    m_indexPath = path;
+    m_dirty = false;
+    QFile file(m_indexPath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+    QDataStream in(&file);
+    quint32 version = 0;
+    in >> version;
+    if (version != mediaIndexVersion) {
+        return;
+    }
+    in >> m_index;
+    if (in.status() != QDataStream::Ok) {
+        m_index.clear();
+    }
+}
+
+void MediaIndex::saveLocked()
+{
+    if (m_indexPath.isEmpty()) {
+        return;
+    }
+    QSaveFile file(m_indexPath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return;
+    }
+    QDataStream out(&file);
+    out << mediaIndexVersion << m_index;
+    file.commit();
+    m_dirty = false;
+}
+
+QMap<QString, QString> MediaIndex::getEntry(const QString &key)
+{
+    QMutexLocker lock(&m_mutex);
+    ensureLoaded();
+    return m_index.value(key);
+}
+
+void MediaIndex::updateEntry(const QString &key, const QMap<QString, QString> &properties)
+{
+    if (key.isEmpty()) {
+        return;
+    }
+    QMutexLocker lock(&m_mutex);
+    ensureLoaded();
+    if (m_index.value(key) == properties) {
+        return;
+    }
+    m_index.insert(key, properties);
+    m_dirty = true;
+}
+
+void MediaIndex::saveIndex()
+{
+    QMutexLocker lock(&m_mutex);
+    if (m_dirty) {
+        saveLocked();
+    }
+}
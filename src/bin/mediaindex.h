@@ -0,0 +1,46 @@
+/*
+    SPDX-FileCopyrightText: Jean-Baptiste Mardelle <jb@kdenlive.org>
+    This file is part of Kdenlive. See www.kdenlive.org.
+
+    SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#pragma once
+
+#include <QHash>
+#include <QMap>
+#include <QMutex>
+#include <QString>
+
+/** @class MediaIndex
+    @brief Persistent per-project index of probed media metadata.
+    Entries are keyed by the clip's partial file hash and size, so media that did not
+    change since a previous session can skip the producer probe stage when loaded again.
+    The index is a flat binary file stored in the project's cache folder.
+ */
+class MediaIndex
+{
+public:
+    /** @brief Build the index key for a media file, or an empty string if the file cannot be hashed */
+    static const QString keyForFile(const QString &path);
+
+    /** @brief Return the stored metadata for a key, or an empty map if the media is not indexed */
+    static QMap<QString, QString> getEntry(const QString &key);
+
+    /** @brief Store or update the metadata for a key */
+    static void updateEntry(const QString &key, const QMap<QString, QString> &properties);
+
+    /** @brief Write pending changes of the current project's index to disk */
+    static void saveIndex();
+
+private:
+    /** @brief Ensure the index of the current project is loaded; switching to another project
+     *  saves the previous index first */
+    static void ensureLoaded();
+    /** @brief Write the index to disk. The caller must hold m_mutex */
+    static void saveLocked();
+    static QMutex m_mutex;
+    static QHash<QString, QMap<QString, QString>> m_index;
+    static QString m_indexPath;
+    static bool m_dirty;
+};
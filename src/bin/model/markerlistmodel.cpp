@@ -240,9 +240,15 @@ bool MarkerListModel::addMarker(GenTime pos, const QString &comment, int type, F
 bool MarkerListModel::addMarkers(const QMap<GenTime, QString> &markers, int type)
 {
     QWriteLocker locker(&m_lock);
+    if (markers.isEmpty()) {
+        return true;
+    }
     Fun undo = []() { return true; };
     Fun redo = []() { return true; };
+    if (type == -1) type = KdenliveSettings::default_marker_type();
 
+    // Markers on a new position are inserted in one batch below, existing ones just get their comment changed
+    QList<CommentedTime> newMarkers;
     QMapIterator<GenTime, QString> i(markers);
     bool rename = false;
     bool res = true;
@@ -250,8 +256,20 @@ bool MarkerListModel::addMarkers(const QMap<GenTime, QString> &markers, int type
         i.next();
         if (hasMarker(i.key())) {
             rename = true;
+            res = addMarker(i.key(), i.value(), type, undo, redo);
+        } else {
+            newMarkers << CommentedTime(i.key(), i.value(), type);
+        }
+    }
+    if (res && !newMarkers.isEmpty()) {
+        // Insert all new markers in a single model operation; importing a long speech transcript
+        // would otherwise pay one row insertion and snap update per word
+        Fun local_redo = addMarkers_lambda(newMarkers);
+        Fun local_undo = deleteMarkers_lambda(newMarkers);
+        res = local_redo();
+        if (res) {
+            UPDATE_UNDO_REDO(local_redo, local_undo, undo, redo);
         }
-        res = addMarker(i.key(), i.value(), type, undo, redo);
     }
     if (res) {
         if (rename) {
@@ -273,7 +291,12 @@ bool MarkerListModel::addMarker(GenTime pos, const QString &comment, int type)
     bool res = addMarker(pos, comment, type, undo, redo);
     if (res) {
         if (rename) {
-            PUSH_UNDO(undo, redo, i18n("Rename marker"));
+            // Successive renames of the same marker coalesce into a single undo entry; the
+            // model pointer is folded in so markers of different clips never share a merge id
+            if (auto ptr = m_undoStack.lock()) {
+                int mergeId = MergeableUndoCommand::RenameMarkerId + ((pos.frames(pCore->getCurrentFps()) ^ int(quintptr(this) >> 4)) & 0x00ffffff);
+                ptr->push(new MergeableUndoCommand(undo, redo, i18n("Rename marker"), mergeId));
+            }
         } else {
             PUSH_UNDO(undo, redo, i18n("Add marker"));
         }
@@ -470,6 +493,26 @@ Fun MarkerListModel::addMarker_lambda(GenTime pos, const QString &comment, int t
     };
 }
 
+Fun MarkerListModel::addMarkers_lambda(const QList<CommentedTime> &markers)
+{
+    QWriteLocker locker(&m_lock);
+    return [markers, this]() {
+        int insertionRow = static_cast<int>(m_markerList.size());
+        beginInsertRows(QModelIndex(), insertionRow, insertionRow + static_cast<int>(markers.size()) - 1);
+        for (const CommentedTime &marker : markers) {
+            Q_ASSERT(hasMarker(marker.time()) == false);
+            int mid = TimelineModel::getNextId();
+            m_markerList[mid] = marker;
+            m_markerPositions.insert(marker.time().frames(pCore->getCurrentFps()), mid);
+        }
+        endInsertRows();
+        for (const CommentedTime &marker : markers) {
+            addSnapPoint(marker.time());
+        }
+        return true;
+    };
+}
+
 Fun MarkerListModel::deleteMarker_lambda(GenTime pos)
 {
     QWriteLocker locker(&m_lock);
@@ -486,6 +529,27 @@ Fun MarkerListModel::deleteMarker_lambda(GenTime pos)
     };
 }
 
+Fun MarkerListModel::deleteMarkers_lambda(const QList<CommentedTime> &markers)
+{
+    QWriteLocker locker(&m_lock);
+    return [markers, this]() {
+        // The batch was appended with increasing ids, so on undo it still occupies the last rows
+        int row = static_cast<int>(m_markerList.size() - markers.size());
+        beginRemoveRows(QModelIndex(), row, row + static_cast<int>(markers.size()) - 1);
+        for (const CommentedTime &marker : markers) {
+            Q_ASSERT(hasMarker(marker.time()));
+            int mid = getIdFromPos(marker.time());
+            m_markerList.erase(mid);
+            m_markerPositions.remove(marker.time().frames(pCore->getCurrentFps()));
+        }
+        endRemoveRows();
+        for (const CommentedTime &marker : markers) {
+            removeSnapPoint(marker.time());
+        }
+        return true;
+    };
+}
+
 std::shared_ptr<MarkerListModel> MarkerListModel::getModel(const QString &clipId)
 {
     return pCore->projectItemModel()->getClipByBinID(clipId)->getMarkerModel();
@@ -615,7 +679,7 @@ QList<CommentedTime> MarkerListModel::getMarkersInRange(int start, int end) cons
     for (const auto &marker : mids) {
         markers << m_markerList.at(marker);
     }
-    std::sort(markers.begin(), markers.end());
+    // ids are returned in ascending position order, so the list is already sorted
     return markers;
 }
 
@@ -623,22 +687,23 @@ int MarkerListModel::getMarkerPos(int mid) const
 {
     READ_LOCK();
     Q_ASSERT(m_markerList.count(mid) > 0);
-    return m_markerPositions.key(mid);
+    // The marker knows its own position; looking the id up by value in
+    // m_markerPositions would scan the whole map
+    return m_markerList.at(mid).time().frames(pCore->getCurrentFps());
 }
 
 QVector<int> MarkerListModel::getMarkersIdInRange(int start, int end) const
 {
     READ_LOCK();
-    // First find marker ids in range
+    // First find marker ids in range, jumping straight to the first marker in
+    // range instead of walking the map from the beginning
     QVector<int> markers;
-    QMap<int, int>::const_iterator i = m_markerPositions.constBegin();
+    QMap<int, int>::const_iterator i = m_markerPositions.lowerBound(start);
     while (i != m_markerPositions.constEnd()) {
         if (end > -1 && i.key() > end) {
             break;
         }
-        if (i.key() >= start) {
-            markers << i.value();
-        }
+        markers << i.value();
         ++i;
     }
     return markers;
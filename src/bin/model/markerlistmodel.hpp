@@ -195,9 +195,15 @@ protected:
     /** @brief Helper function that generate a lambda to add given marker */
     Fun addMarker_lambda(GenTime pos, const QString &comment, int type);
 
+    /** @brief Helper function that generate a lambda to add a batch of markers in a single model operation */
+    Fun addMarkers_lambda(const QList<CommentedTime> &markers);
+
     /** @brief Helper function that generate a lambda to remove given marker */
     Fun deleteMarker_lambda(GenTime pos);
 
+    /** @brief Helper function that generate a lambda to remove a batch of markers in a single model operation */
+    Fun deleteMarkers_lambda(const QList<CommentedTime> &markers);
+
     /** @brief Helper function that retrieves a pointer to the markermodel, given whether it's a guide model and its clipId*/
     std::shared_ptr<MarkerListModel> getModel(const QString &clipId);
 
@@ -81,6 +81,23 @@ std::vector<int> MarkerSortModel::getIgnoredSnapPoints() const
     return markers;
 }
 
+QVariantList MarkerSortModel::guidesInRange(int min, int max) const
+{
+    // The rows are not necessarily sorted by position (the guides list can re-sort this
+    // model), so scan all accepted rows and keep those inside the range
+    QVariantList guides;
+    int rows = rowCount();
+    for (int i = 0; i < rows; i++) {
+        const QModelIndex ix = index(i, 0);
+        int frame = data(ix, MarkerListModel::FrameRole).toInt();
+        if (frame < min || (max > -1 && frame > max)) {
+            continue;
+        }
+        guides << frame << data(ix, MarkerListModel::ColorRole);
+    }
+    return guides;
+}
+
 void MarkerSortModel::slotSetSortColumn(int column)
 {
     m_sortColumn = column;
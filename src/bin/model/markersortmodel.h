@@ -30,6 +30,11 @@ public Q_SLOTS:
     void slotSetSortColumn(int column);
     void slotSetSortOrder(bool descending);
     std::vector<int> getIgnoredSnapPoints() const;
+    /** @brief Returns the accepted guides intersecting [min, max] as a packed
+     *  {frame, color, frame, color, …} list, so the timeline overlay can paint all
+     *  guide lines from one array instead of instantiating a delegate per guide.
+     *  Pass max = -1 for an open-ended range. */
+    Q_INVOKABLE QVariantList guidesInRange(int min, int max) const;
 
 protected:
     /** @brief Decide which items should be displayed depending on the search string  */
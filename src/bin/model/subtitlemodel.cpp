@@ -23,10 +23,12 @@
 #include <KLocalizedString>
 #include <KMessageBox>
 #include <QApplication>
+#include <QCryptographicHash>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QRegularExpression>
+#include <QtConcurrent>
 #include <utility>
 #if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
 #include <QStringConverter>
@@ -64,7 +66,27 @@ SubtitleModel::SubtitleModel(std::shared_ptr<TimelineItemModel> timeline, const
             .arg(fontMargin);
     eventSection = QStringLiteral("[Events]\n");
     styleName = QStringLiteral("Default");
-    connect(this, &SubtitleModel::modelChanged, [this]() { jsontoSubtitle(toJson()); });
+    m_saveTimer.setSingleShot(true);
+    m_saveTimer.setInterval(100);
+    connect(&m_saveTimer, &QTimer::timeout, this, [this]() { startBackgroundSave(); });
+    // Coalesce change bursts (dragging a subtitle, group moves) into one work file
+    // rewrite, so the avfilter does not re-parse the whole file on every step
+    connect(this, &SubtitleModel::modelChanged, this, [this]() { m_saveTimer.start(); });
+    connect(&m_saveWatcher, &QFutureWatcher<int>::finished, this, [this]() {
+        if (m_timeline == nullptr || m_timeline->tractor() == nullptr) {
+            return;
+        }
+        if (m_saveWatcher.result() > 0) {
+            m_lastSavedFile = m_pendingSaveFile;
+            m_lastSavedHash = m_pendingSaveHash;
+            m_subtitleFilter->set("av.filename", m_pendingSaveFile.toUtf8().constData());
+            m_timeline->tractor()->attach(*m_subtitleFilter.get());
+        } else {
+            m_lastSavedFile.clear();
+            m_lastSavedHash.clear();
+            m_timeline->tractor()->detach(*m_subtitleFilter.get());
+        }
+    });
     int id = pCore->currentDoc()->getSequenceProperty(timeline->uuid(), QStringLiteral("kdenlive:activeSubtitleIndex"), QStringLiteral("0")).toInt();
     const QString subPath = pCore->currentDoc()->subTitlePath(timeline->uuid(), id, true);
     const QString workPath = pCore->currentDoc()->subTitlePath(timeline->uuid(), id, false);
@@ -89,6 +111,14 @@ SubtitleModel::SubtitleModel(std::shared_ptr<TimelineItemModel> timeline, const
     parseSubtitle(workPath);
 }
 
+SubtitleModel::~SubtitleModel()
+{
+    m_saveWatcher.disconnect(this);
+    if (m_saveFuture.isRunning()) {
+        m_saveFuture.waitForFinished();
+    }
+}
+
 void SubtitleModel::setStyle(const QString &style)
 {
     QString oldStyle = m_subtitleFilter->get("av.force_style");
@@ -185,8 +215,16 @@ void SubtitleModel::importSubtitle(const QString &filePath, int offset, bool ext
         Q_EMIT modelChanged();
         return true;
     };
-    ulong initialCount = m_subtitleList.size();
     GenTime subtitleOffset(offset, pCore->getCurrentFps());
+    // Subtitles are first collected here during parsing, then inserted in one batch so
+    // the import performs a single undo entry and monitor refresh instead of one per line
+    struct ParsedSub
+    {
+        GenTime start;
+        GenTime end;
+        QString text;
+    };
+    QList<ParsedSub> parsedSubs;
     if (filePath.endsWith(".srt") || filePath.endsWith(".vtt") || filePath.endsWith(".sbv")) {
         // if (!filePath.endsWith(".vtt") || !filePath.endsWith(".sbv")) {defaultTurn = -10;}
         if (filePath.endsWith(".vtt") || filePath.endsWith(".sbv")) {
@@ -255,7 +293,7 @@ void SubtitleModel::importSubtitle(const QString &filePath, int offset, bool ext
                 turn++;
             } else {
                 if (endPos > startPos) {
-                    addSubtitle(startPos + subtitleOffset, endPos + subtitleOffset, comment, undo, redo, false);
+                    parsedSubs.append({startPos + subtitleOffset, endPos + subtitleOffset, comment});
                     // qDebug() << "Adding Subtitle: \n  Start time: " << start << "\n  End time: " << end << "\n  Text: " << comment;
                 } else {
                     qDebug() << "===== INVALID SUBTITLE FOUND: " << start << "-" << end << ", " << comment;
@@ -270,7 +308,7 @@ void SubtitleModel::importSubtitle(const QString &filePath, int offset, bool ext
         }
         // Ensure last subtitle is read
         if (endPos > startPos && !comment.isEmpty()) {
-            addSubtitle(startPos + subtitleOffset, endPos + subtitleOffset, comment, undo, redo, false);
+            parsedSubs.append({startPos + subtitleOffset, endPos + subtitleOffset, comment});
         }
         srtFile.close();
     } else if (filePath.endsWith(QLatin1String(".ass"))) {
@@ -368,7 +406,7 @@ void SubtitleModel::importSubtitle(const QString &filePath, int offset, bool ext
                             comment = line.section(",", numEventFields - 1);
                             // qDebug()<<"Start: "<< start << "End: "<<end << comment;
                             if (endPos > startPos) {
-                                addSubtitle(startPos + subtitleOffset, endPos + subtitleOffset, comment, undo, redo, false);
+                                parsedSubs.append({startPos + subtitleOffset, endPos + subtitleOffset, comment});
                             } else {
                                 qDebug() << "==== FOUND INVALID SUBTITLE ITEM: " << start << "-" << end << ", " << comment;
                             }
@@ -384,7 +422,7 @@ void SubtitleModel::importSubtitle(const QString &filePath, int offset, bool ext
         assFile.close();
     } else {
         if (endPos > startPos) {
-            addSubtitle(startPos + subtitleOffset, endPos + subtitleOffset, comment, undo, redo, false);
+            parsedSubs.append({startPos + subtitleOffset, endPos + subtitleOffset, comment});
         } else {
             qDebug() << "===== INVALID VTT SUBTITLE FOUND: " << start << "-" << end << ", " << comment;
         }
@@ -394,11 +432,44 @@ void SubtitleModel::importSubtitle(const QString &filePath, int offset, bool ext
         turn = 0;
         r = 0;
     }
-    if (initialCount == m_subtitleList.size() && externalImport) {
+    if (parsedSubs.isEmpty()) {
         // Nothing imported
-        pCore->displayMessage(i18n("The selected file %1 is invalid.", filePath), ErrorMessage);
+        if (externalImport) {
+            pCore->displayMessage(i18n("The selected file %1 is invalid.", filePath), ErrorMessage);
+        }
         return;
     }
+    // Assign the ids up front so undo / redo always address the same subtitles
+    QVector<int> ids;
+    ids.reserve(parsedSubs.size());
+    for (int i = 0; i < parsedSubs.size(); i++) {
+        ids << TimelineModel::getNextId();
+    }
+    GenTime rangeStart = parsedSubs.constFirst().start;
+    GenTime rangeEnd = parsedSubs.constFirst().end;
+    for (const auto &sub : qAsConst(parsedSubs)) {
+        rangeStart = qMin(rangeStart, sub.start);
+        rangeEnd = qMax(rangeEnd, sub.end);
+    }
+    QPair<int, int> range = {rangeStart.frames(pCore->getCurrentFps()), rangeEnd.frames(pCore->getCurrentFps())};
+    Fun local_redo = [this, parsedSubs, ids, range]() {
+        for (int i = 0; i < parsedSubs.size(); i++) {
+            addSubtitle(ids.at(i), parsedSubs.at(i).start, parsedSubs.at(i).end, parsedSubs.at(i).text, false, false);
+        }
+        pCore->invalidateRange(range);
+        pCore->refreshProjectRange(range);
+        return true;
+    };
+    Fun local_undo = [this, ids, range]() {
+        for (int id : ids) {
+            removeSubtitle(id, false, false);
+        }
+        pCore->invalidateRange(range);
+        pCore->refreshProjectRange(range);
+        return true;
+    };
+    local_redo();
+    UPDATE_UNDO_REDO(local_redo, local_undo, undo, redo);
     Fun update_model = [this]() {
         Q_EMIT modelChanged();
         return true;
@@ -626,7 +697,9 @@ bool SubtitleModel::setText(int id, const QString &text)
         return true;
     };
     local_redo();
-    pCore->pushUndo(local_undo, local_redo, i18n("Edit subtitle"));
+    // Successive edits of the same subtitle coalesce into a single undo entry until the edit
+    // widget loses focus, so a transcription pass does not grow the stack on every apply
+    pCore->pushUndo(new MergeableUndoCommand(local_undo, local_redo, i18n("Edit subtitle"), MergeableUndoCommand::EditSubtitleId + (id & 0x00ffffff)));
     return true;
 }
 
@@ -1169,6 +1242,7 @@ QString SubtitleModel::toJson()
 
 void SubtitleModel::copySubtitle(const QString &path, int ix, bool checkOverwrite, bool updateFilter)
 {
+    flushPendingSave();
     QFile srcFile(pCore->currentDoc()->subTitlePath(m_timeline->uuid(), ix, false));
     if (srcFile.exists()) {
         QFile prev(path);
@@ -1205,16 +1279,64 @@ void SubtitleModel::jsontoSubtitle(const QString &data)
     if (masterFile.isEmpty()) {
         m_subtitleFilter->set("av.filename", outFile.toUtf8().constData());
     }
+    const QByteArray dataHash = QCryptographicHash::hash(data.toUtf8(), QCryptographicHash::Md5);
+    if (outFile == m_lastSavedFile && dataHash == m_lastSavedHash) {
+        // Content on disk is already current, keep the filter's parsed copy
+        return;
+    }
     int line = saveSubtitleData(data, outFile);
     qDebug() << "Saving subtitle filter: " << outFile;
     if (line > 0) {
+        m_lastSavedFile = outFile;
+        m_lastSavedHash = dataHash;
         m_subtitleFilter->set("av.filename", outFile.toUtf8().constData());
         m_timeline->tractor()->attach(*m_subtitleFilter.get());
     } else {
+        m_lastSavedFile.clear();
+        m_lastSavedHash.clear();
         m_timeline->tractor()->detach(*m_subtitleFilter.get());
     }
 }
 
+void SubtitleModel::startBackgroundSave()
+{
+    if (m_timeline == nullptr) {
+        return;
+    }
+    if (m_saveFuture.isRunning()) {
+        // The previous write is still going to disk, retry once it is done
+        m_saveTimer.start();
+        return;
+    }
+    int ix = pCore->currentDoc()->getSequenceProperty(m_timeline->uuid(), QStringLiteral("kdenlive:activeSubtitleIndex"), QStringLiteral("0")).toInt();
+    const QString outFile = pCore->currentDoc()->subTitlePath(m_timeline->uuid(), ix, false);
+    QString masterFile = m_subtitleFilter->get("av.filename");
+    if (masterFile.isEmpty()) {
+        m_subtitleFilter->set("av.filename", outFile.toUtf8().constData());
+    }
+    const QString data = toJson();
+    const QByteArray dataHash = QCryptographicHash::hash(data.toUtf8(), QCryptographicHash::Md5);
+    if (outFile == m_lastSavedFile && dataHash == m_lastSavedHash) {
+        // Content on disk is already current, keep the filter's parsed copy
+        return;
+    }
+    m_pendingSaveFile = outFile;
+    m_pendingSaveHash = dataHash;
+    m_saveFuture = QtConcurrent::run([this, data, outFile]() { return saveSubtitleData(data, outFile); });
+    m_saveWatcher.setFuture(m_saveFuture);
+}
+
+void SubtitleModel::flushPendingSave()
+{
+    if (m_saveFuture.isRunning()) {
+        m_saveFuture.waitForFinished();
+    }
+    if (m_saveTimer.isActive()) {
+        m_saveTimer.stop();
+        jsontoSubtitle(toJson());
+    }
+}
+
 int SubtitleModel::saveSubtitleData(const QString &data, const QString &outFile)
 {
     bool assFormat = outFile.endsWith(".ass");
@@ -1224,7 +1346,13 @@ int SubtitleModel::saveSubtitleData(const QString &data, const QString &outFile)
     QFile outF(outFile);
 
     // qDebug()<< "Import from JSON";
-    QWriteLocker locker(&m_lock);
+    // Copy the header sections under lock so this can run on a worker thread while the model is edited
+    m_lock.lockForRead();
+    const QString scriptInfo = scriptInfoSection;
+    const QString styles = styleSection;
+    const QString events = eventSection;
+    const QString style = styleName;
+    m_lock.unlock();
     auto json = QJsonDocument::fromJson(data.toUtf8());
     if (!json.isArray()) {
         qDebug() << "Error : Json file should be an array";
@@ -1238,9 +1366,9 @@ int SubtitleModel::saveSubtitleData(const QString &data, const QString &outFile)
         out.setCodec("UTF-8");
 #endif
         if (assFormat) {
-            out << scriptInfoSection << '\n';
-            out << styleSection << '\n';
-            out << eventSection;
+            out << scriptInfo << '\n';
+            out << styles << '\n';
+            out << events;
         }
         for (const auto &entry : qAsConst(list)) {
             if (!entry.isObject()) {
@@ -1297,7 +1425,7 @@ int SubtitleModel::saveSubtitleData(const QString &data, const QString &outFile)
             line++;
             if (assFormat) {
                 // Format: Layer, Start, End, Style, Actor, MarginL, MarginR, MarginV, Effect, Text
-                out << "Dialogue: 0," << startTimeString << "," << endTimeString << "," << styleName << ",,0000,0000,0000,," << dialogue << '\n';
+                out << "Dialogue: 0," << startTimeString << "," << endTimeString << "," << style << ",,0000,0000,0000,," << dialogue << '\n';
             } else {
                 out << line << "\n" << startTimeStringSRT << " --> " << endTimeStringSRT << "\n" << dialogue << "\n" << '\n';
             }
@@ -11,7 +11,10 @@
 #include "utils/gentime.h"
 
 #include <QAbstractListModel>
+#include <QFuture>
+#include <QFutureWatcher>
 #include <QReadWriteLock>
+#include <QTimer>
 
 #include <array>
 #include <map>
@@ -39,6 +42,7 @@ public:
     /** @brief Construct a subtitle list bound to the timeline */
     explicit SubtitleModel(std::shared_ptr<TimelineItemModel> timeline = nullptr,
                            const std::weak_ptr<SnapInterface> &snapModel = std::weak_ptr<SnapInterface>(), QObject *parent = nullptr);
+    ~SubtitleModel() override;
 
     enum { SubtitleRole = Qt::UserRole + 1, StartPosRole, EndPosRole, StartFrameRole, FakeStartFrameRole, EndFrameRole, IdRole, SelectedRole, GrabRole };
     /** @brief Function that parses through a subtitle file */
@@ -210,6 +214,8 @@ public Q_SLOTS:
 
     /** @brief Import model to a temporary subtitle file to which the Subtitle effect is applied*/
     void jsontoSubtitle(const QString &data);
+    /** @brief Write any pending model changes to the work file now, called before the file is read or copied*/
+    void flushPendingSave();
     /** @brief Update a subtitle text*/
     bool setText(int id, const QString &text);
 
@@ -238,6 +244,21 @@ private:
     std::unique_ptr<Mlt::Filter> m_subtitleFilter;
     QVector<int> m_selected;
     QVector<int> m_grabbedIds;
+    /** @brief Coalesces bursts of model changes into one work file rewrite */
+    QTimer m_saveTimer;
+    /** @brief Path and content hash of the last work file write, so unchanged
+     *  content is not rewritten (a rewrite makes the avfilter re-parse and
+     *  re-shape every subtitle line) */
+    QString m_lastSavedFile;
+    QByteArray m_lastSavedHash;
+    /** @brief The debounced save runs on a worker thread so typing latency does not
+     *  depend on the subtitle count; the watcher updates the filter when it is done */
+    QFuture<int> m_saveFuture;
+    QFutureWatcher<int> m_saveWatcher;
+    QString m_pendingSaveFile;
+    QByteArray m_pendingSaveHash;
+    /** @brief Serialize the model and hand the file write over to a worker thread */
+    void startBackgroundSave();
     int saveSubtitleData(const QString &data, const QString &outFile);
 
 Q_SIGNALS:
@@ -267,6 +267,9 @@ QString ProjectClip::getToolTip() const
     if (m_clipType == ClipType::Timeline) {
         return i18n("Timeline sequence");
     }
+    if (m_usesProxy && hasProducerProperty(QStringLiteral("kdenlive:proxy_mismatch"))) {
+        return i18n("%1\nProxy does not match its source: %2", m_path, getProducerProperty(QStringLiteral("kdenlive:proxy_mismatch")));
+    }
     return m_path;
 }
 
@@ -443,6 +446,7 @@ void ProjectClip::resetSequenceThumbnails()
     QMutexLocker lk(&m_thumbMutex);
     pCore->taskManager.discardJobs(ObjectId(KdenliveObjectType::BinClip, m_binId.toInt(), QUuid()), AbstractTask::LOADJOB, true);
     m_thumbXml.clear();
+    flushProducerPool();
     ThumbnailCache::get()->invalidateThumbsForClip(m_binId);
     // Force refeshing thumbs producer
     lk.unlock();
@@ -465,6 +469,7 @@ void ProjectClip::reloadProducer(bool refreshOnly, bool isProxy, bool forceAudio
         pCore->taskManager.discardJobs(oid, AbstractTask::THUMBJOB);
         pCore->taskManager.discardJobs(oid, AbstractTask::CACHEJOB);
         m_thumbXml.clear();
+        flushProducerPool();
         // Reset uuid to enforce reloading thumbnails from qml cache
         m_uuid = QUuid::createUuid();
         updateTimelineClips({TimelineModel::ClipThumbRole, TimelineModel::ResourceRole});
@@ -491,6 +496,7 @@ void ProjectClip::reloadProducer(bool refreshOnly, bool isProxy, bool forceAudio
         if (!xml.isNull()) {
             bool hashChanged = false;
             m_thumbXml.clear();
+            flushProducerPool();
             ClipType::ProducerType type = clipType();
             if (type != ClipType::Color && type != ClipType::Image && type != ClipType::SlideShow) {
                 xml.removeAttribute("out");
@@ -516,6 +522,7 @@ void ProjectClip::reloadProducer(bool refreshOnly, bool isProxy, bool forceAudio
                 m_clipStatus = FileStatus::StatusWaiting;
             }
             m_thumbXml.clear();
+            flushProducerPool();
             ClipLoadTask::start(oid, xml, false, -1, -1, this);
         }
     }
@@ -627,6 +634,7 @@ bool ProjectClip::setProducer(std::shared_ptr<Mlt::Producer> producer, bool gene
         pCore->taskManager.discardJobs(ObjectId(KdenliveObjectType::BinClip, m_binId.toInt(), QUuid()), AbstractTask::THUMBJOB);
         m_thumbMutex.lock();
         m_thumbXml.clear();
+        flushProducerPool();
         m_thumbMutex.unlock();
     }
 
@@ -829,7 +837,7 @@ const QString ProjectClip::getProxyFromOriginal(QString originalPath)
     return QString();
 }
 
-std::unique_ptr<Mlt::Producer> ProjectClip::getThumbProducer()
+std::shared_ptr<Mlt::Producer> ProjectClip::getThumbProducer()
 {
     if (m_clipType == ClipType::Unknown || m_masterProducer == nullptr || m_clipStatus == FileStatus::StatusWaiting) {
         return nullptr;
@@ -837,7 +845,7 @@ std::unique_ptr<Mlt::Producer> ProjectClip::getThumbProducer()
     if (!m_thumbMutex.tryLock()) {
         return nullptr;
     }
-    std::unique_ptr<Mlt::Producer> thumbProd;
+    std::shared_ptr<Mlt::Producer> thumbProd;
     if (m_clipType == ClipType::Timeline || m_clipType == ClipType::Playlist) {
         QReadLocker lock(&pCore->xmlMutex);
         // thumbProd.reset(new Mlt::Producer(pCore->getProjectProfile(), "xml-string", m_thumbXml.constData()));
@@ -845,38 +853,37 @@ std::unique_ptr<Mlt::Producer> ProjectClip::getThumbProducer()
         m_thumbMutex.unlock();
         return thumbProd;
     }
-    if (!m_thumbXml.isEmpty()) {
-        QReadLocker lock(&pCore->xmlMutex);
-        thumbProd.reset(new Mlt::Producer(pCore->thumbProfile(), "xml-string", m_thumbXml.constData()));
+    if (!KdenliveSettings::gpu_accel()) {
+        // Reissue a warm clone from the pool when available, only the builder re-opens the file
+        thumbProd = pooledProducer([this]() -> Mlt::Producer * {
+            if (!m_thumbXml.isEmpty()) {
+                QReadLocker lock(&pCore->xmlMutex);
+                return new Mlt::Producer(pCore->thumbProfile(), "xml-string", m_thumbXml.constData());
+            }
+            QString mltService = m_masterProducer->get("mlt_service");
+            const QString mltResource = m_masterProducer->get("resource");
+            if (mltService == QLatin1String("avformat")) {
+                mltService = QStringLiteral("avformat-novalidate");
+            }
+            std::unique_ptr<Mlt::Producer> built(new Mlt::Producer(m_clipType == ClipType::Playlist ? pCore->getProjectProfile() : pCore->thumbProfile(),
+                                                                   mltService.toUtf8().constData(), mltResource.toUtf8().constData()));
+            if (built->is_valid()) {
+                Mlt::Properties original(m_masterProducer->get_properties());
+                Mlt::Properties cloneProps(built->get_properties());
+                cloneProps.pass_list(original, ClipController::getPassPropertiesList());
+                built->set("audio_index", -1);
+                built->set("astream", -1);
+                // Required to make get_playtime() return > 1
+                built->set("out", built->get_length() - 1);
+            }
+            m_thumbXml = ClipController::producerXml(*built.get(), true, false);
+            return built.release();
+        });
         m_thumbMutex.unlock();
         return thumbProd;
     }
-    if (KdenliveSettings::gpu_accel()) {
-        // TODO: when the original producer changes, we must reload this thumb producer
-        thumbProd = softClone(ClipController::getPassPropertiesList());
-    } else if (m_clipType == ClipType::Timeline) {
-        if (pCore->currentDoc()->loading) {
-            m_thumbMutex.unlock();
-            return nullptr;
-        }
-        if (!m_sequenceThumbFile.isOpen() && !m_sequenceThumbFile.open()) {
-            // Something went wrong
-            qWarning() << "Cannot write to temporary file: " << m_sequenceThumbFile.fileName();
-            m_thumbMutex.unlock();
-            return nullptr;
-        }
-        cloneProducerToFile(m_sequenceThumbFile.fileName(), true);
-        QReadLocker lock(&pCore->xmlMutex);
-        thumbProd.reset(new Mlt::Producer(pCore->getProjectProfile(), "xml", m_sequenceThumbFile.fileName().toUtf8().constData()));
-    } else {
-        QString mltService = m_masterProducer->get("mlt_service");
-        const QString mltResource = m_masterProducer->get("resource");
-        if (mltService == QLatin1String("avformat")) {
-            mltService = QStringLiteral("avformat-novalidate");
-        }
-        thumbProd.reset(new Mlt::Producer(m_clipType == ClipType::Playlist ? pCore->getProjectProfile() : pCore->thumbProfile(),
-                                          mltService.toUtf8().constData(), mltResource.toUtf8().constData()));
-    }
+    // TODO: when the original producer changes, we must reload this thumb producer
+    thumbProd = softClone(ClipController::getPassPropertiesList());
     if (thumbProd->is_valid()) {
         Mlt::Properties original(m_masterProducer->get_properties());
         Mlt::Properties cloneProps(thumbProd->get_properties());
@@ -1808,7 +1815,9 @@ void ProjectClip::setProperties(const QMap<QString, QString> &properties, bool r
         // Clip source was changed, update important stuff
         refreshPanel = true;
         reload = true;
-        ThumbnailCache::get()->invalidateThumbsForClip(m_binId);
+        // Lazy invalidation keeps bulk proxy switches O(1) per clip; stale thumbs are dropped
+        // on the next request
+        ThumbnailCache::get()->invalidateThumbsForClipLater(m_binId);
         resetProducerProperty(QStringLiteral("kdenlive:file_hash"));
         if (m_clipType == ClipType::Color) {
             refreshOnly = true;
@@ -1851,6 +1860,8 @@ void ProjectClip::setProperties(const QMap<QString, QString> &properties, bool r
                     setProducerProperty(QStringLiteral("resource"), resource);
                 }
             }
+            // The conformance audit result only makes sense while the proxy is in use
+            resetProducerProperty(QStringLiteral("kdenlive:proxy_mismatch"));
         } else {
             // A proxy was requested, make sure to keep original url
             setProducerProperty(QStringLiteral("kdenlive:originalurl"), url());
@@ -1864,7 +1875,7 @@ void ProjectClip::setProperties(const QMap<QString, QString> &properties, bool r
                 refreshPanel = true;
                 refreshOnly = false;
                 reload = true;
-                ThumbnailCache::get()->invalidateThumbsForClip(m_binId);
+                ThumbnailCache::get()->invalidateThumbsForClipLater(m_binId);
                 break;
             }
         }
@@ -2119,6 +2130,10 @@ const QVariant ProjectClip::getData(DataType type) const
         if (m_properties && m_properties->get_int("meta.media.variable_frame_rate")) {
             return QVariant("emblem-warning");
         }
+        if (m_usesProxy && hasProducerProperty(QStringLiteral("kdenlive:proxy_mismatch"))) {
+            // The proxy audit found a duration / frame rate / geometry drift against the source
+            return QVariant("emblem-warning");
+        }
         return m_effectStack && m_effectStack->rowCount() > 0 ? QVariant("kdenlive-track_has_effect") : QVariant();
     default:
         return AbstractProjectItem::getData(type);
@@ -2816,9 +2831,12 @@ int ProjectClip::getAudioMax(int stream)
     return int(max);
 }
 
-const QVector<uint8_t> ProjectClip::audioFrameCache(int stream)
+const QVector<uint8_t> ProjectClip::audioFrameCache(int stream, int resolution, int *step)
 {
     QVector<uint8_t> audioLevels;
+    if (step) {
+        *step = 1;
+    }
     if (stream == -1) {
         if (m_audioInfo) {
             stream = m_audioInfo->ffmpeg_audio_index();
@@ -2826,13 +2844,33 @@ const QVector<uint8_t> ProjectClip::audioFrameCache(int stream)
             return audioLevels;
         }
     }
-    const QString key = QString("_kdenlive:audio%1").arg(stream);
+    QString key;
+    switch (resolution) {
+    case 1:
+        key = QString("_kdenlive:audio10_%1").arg(stream);
+        if (step) {
+            *step = 10;
+        }
+        break;
+    case 2:
+        key = QString("_kdenlive:audiosec_%1").arg(stream);
+        if (step) {
+            *step = qMax(1, m_masterProducer->get_int(QString("kdenlive:audio_secstep%1").arg(stream).toUtf8().constData()));
+        }
+        break;
+    default:
+        key = QString("_kdenlive:audio%1").arg(stream);
+        break;
+    }
     if (m_masterProducer->get_data(key.toUtf8().constData())) {
         const QVector<uint8_t> audioData = *static_cast<QVector<uint8_t> *>(m_masterProducer->get_data(key.toUtf8().constData()));
         return audioData;
-    } else {
+    } else if (resolution == 0) {
         qDebug() << "=== AUDIO NOT FOUND ";
     }
+    if (step) {
+        *step = 1;
+    }
     return QVector<uint8_t>();
 
     // TODO
@@ -3168,7 +3206,7 @@ QPixmap ProjectClip::pixmap(int framePosition, int width, int height)
 {
     // TODO refac this should use the new thumb infrastructure
     QReadLocker lock(&m_producerLock);
-    std::unique_ptr<Mlt::Producer> thumbProducer = getThumbProducer();
+    std::shared_ptr<Mlt::Producer> thumbProducer = getThumbProducer();
     if (thumbProducer == nullptr) {
         return QPixmap();
     }
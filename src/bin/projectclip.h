@@ -159,7 +159,7 @@ public:
     QPixmap thumbnail(int width, int height);
 
     /** @brief Returns this clip's producer. */
-    std::unique_ptr<Mlt::Producer> getThumbProducer() override;
+    std::shared_ptr<Mlt::Producer> getThumbProducer() override;
 
     /** @brief Recursively disable/enable bin effects. */
     void setBinEffectsEnabled(bool enabled) override;
@@ -240,7 +240,10 @@ public:
     int getThumbFrame() const;
     /** @brief Return audio cache for a stream
      */
-    const QVector <uint8_t> audioFrameCache(int stream = -1);
+    /** @brief Audio level data for a stream. resolution selects a tier of the peak pyramid:
+     *  0 = per frame, 1 = per 10 frames, 2 = per second. When step is provided it receives the
+     *  number of frames each level of the returned tier covers */
+    const QVector <uint8_t> audioFrameCache(int stream = -1, int resolution = 0, int *step = nullptr);
     /** @brief Return FFmpeg's audio stream index for an MLT audio stream index
      */
     int getAudioStreamFfmpegIndex(int mltStream);
@@ -58,7 +58,7 @@ ProjectItemModel::ProjectItemModel(QObject *parent)
     QPixmap pix(QSize(160, 90));
     pix.fill(Qt::lightGray);
     m_blankThumb.addPixmap(pix);
-    connect(m_fileWatcher.get(), &FileWatcher::binClipModified, this, &ProjectItemModel::reloadClip);
+    connect(m_fileWatcher.get(), &FileWatcher::binClipsModified, this, &ProjectItemModel::reloadClips);
     connect(m_fileWatcher.get(), &FileWatcher::binClipWaiting, this, &ProjectItemModel::setClipWaiting);
     connect(m_fileWatcher.get(), &FileWatcher::binClipMissing, this, &ProjectItemModel::setClipInvalid);
     missingClipTimer.setInterval(500);
@@ -494,12 +494,15 @@ std::shared_ptr<ProjectClip> ProjectItemModel::getClipByBinID(const QString &bin
     return nullptr;
 }
 
-const QVector<uint8_t> ProjectItemModel::getAudioLevelsByBinID(const QString &binId, int stream)
+const QVector<uint8_t> ProjectItemModel::getAudioLevelsByBinID(const QString &binId, int stream, int resolution, int *step)
 {
     READ_LOCK();
     auto search = m_allClipItems.find(binId.toInt());
     if (search != m_allClipItems.end()) {
-        return search->second->audioFrameCache(stream);
+        return search->second->audioFrameCache(stream, resolution, step);
+    }
+    if (step) {
+        *step = 1;
     }
     return QVector<uint8_t>();
 }
@@ -905,6 +908,71 @@ bool ProjectItemModel::requestAddBinClip(QString &id, const QDomElement &descrip
     return res;
 }
 
+bool ProjectItemModel::requestAddBinClips(QStringList &ids, const QList<QDomElement> &descriptions, const QString &parentId, Fun &undo, Fun &redo,
+                                          const std::function<void(const QString &)> &readyCallBack)
+{
+    QWriteLocker locker(&m_lock);
+    std::shared_ptr<AbstractProjectItem> parentItem = getItemByBinId(parentId);
+    if (!parentItem || parentItem->itemType() != AbstractProjectItem::FolderItem) {
+        qCDebug(KDENLIVE_LOG) << "  / / ERROR IN PARENT FOLDER";
+        return false;
+    }
+    // Construct all clips up front so the view only processes one insertion
+    ids.clear();
+    std::vector<std::shared_ptr<ProjectClip>> clips;
+    clips.reserve(size_t(descriptions.size()));
+    for (const QDomElement &description : descriptions) {
+        QString id = Xml::getXmlProperty(description, QStringLiteral("kdenlive:id"), QStringLiteral("-1"));
+        if (id == QStringLiteral("-1") || !isIdFree(id) || ids.contains(id)) {
+            // The batched clips are not registered yet, so also guard against duplicates within the batch
+            id = QString::number(getFreeClipId());
+        }
+        clips.push_back(ProjectClip::construct(id, description, m_blankThumb, std::static_pointer_cast<ProjectItemModel>(shared_from_this())));
+        ids << id;
+    }
+    if (clips.empty()) {
+        return true;
+    }
+    int parentDbId = parentItem->getId();
+    Fun operation = [this, clips, parentDbId]() {
+        auto parent = getItemById(parentDbId);
+        if (!parent) {
+            Q_ASSERT(parent);
+            return false;
+        }
+        beginAppendRows(parent, int(clips.size()));
+        bool res = true;
+        for (const auto &clip : clips) {
+            res = parent->appendChild(clip) && res;
+        }
+        endAppendRows();
+        return res;
+    };
+    Fun reverse = [this, clips]() {
+        bool res = true;
+        for (auto it = clips.rbegin(); it != clips.rend(); ++it) {
+            Fun remove = removeProjectItem_lambda((*it)->clipId().toInt(), (*it)->getId());
+            res = remove() && res;
+        }
+        return res;
+    };
+    bool res = operation();
+    if (res) {
+        for (const auto &clip : clips) {
+            Fun checkAudio = clip->getAudio_lambda();
+            PUSH_LAMBDA(checkAudio, operation);
+        }
+        UPDATE_UNDO_REDO(operation, reverse, undo, redo);
+        locker.unlock();
+        for (int ix = 0; ix < descriptions.size(); ix++) {
+            const QString binId = ids.at(ix);
+            ClipLoadTask::start(ObjectId(KdenliveObjectType::BinClip, binId.toInt(), QUuid()), descriptions.at(ix), false, -1, -1, this, false,
+                                std::bind(readyCallBack, binId));
+        }
+    }
+    return res;
+}
+
 bool ProjectItemModel::requestAddBinClip(QString &id, std::shared_ptr<Mlt::Producer> &producer, const QString &parentId, Fun &undo, Fun &redo,
                                          const std::function<void(const QString &)> &readyCallBack)
 {
@@ -1659,6 +1727,17 @@ void ProjectItemModel::reloadClip(const QString &binId)
     }
 }
 
+void ProjectItemModel::reloadClips(const QStringList &binIds)
+{
+    QWriteLocker locker(&m_lock);
+    for (const QString &binId : binIds) {
+        std::shared_ptr<ProjectClip> clip = getClipByBinID(binId);
+        if (clip) {
+            clip->reloadProducer();
+        }
+    }
+}
+
 void ProjectItemModel::setClipWaiting(const QString &binId)
 {
     QWriteLocker locker(&m_lock);
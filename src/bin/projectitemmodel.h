@@ -62,7 +62,9 @@ public:
     /** @brief Returns a clip from the hierarchy, given its id */
     std::shared_ptr<ProjectClip> getClipByBinID(const QString &binId);
     /** @brief Returns audio levels for a clip from its id */
-    const QVector <uint8_t>getAudioLevelsByBinID(const QString &binId, int stream);
+    /** @brief resolution selects a tier of the peak pyramid (0 = per frame, 1 = per 10 frames,
+     *  2 = per second); step receives the frame count each returned level covers */
+    const QVector <uint8_t>getAudioLevelsByBinID(const QString &binId, int stream, int resolution = 0, int *step = nullptr);
     double getAudioMaxLevel(const QString &binId, int stream);
 
     /** @brief Returns a list of clips using the given url */
@@ -164,6 +166,19 @@ public:
                            const std::function<void(const QString &)> &readyCallBack = [](const QString &) {});
     bool requestAddBinClip(QString &id, const QDomElement &description, const QString &parentId, const QString &undoText = QString(), const std::function<void(const QString &)> &readyCallBack = [](const QString &) {});
 
+    /** @brief Request creation of several bin clips under the same folder in one batch.
+       The whole batch is inserted under a single beginInsertRows/endInsertRows pair and
+       registers a single undo operation, which makes large folder imports much cheaper
+       than adding the clips one by one.
+       @param ids Return parameter, filled with the bin ids attributed to the created clips
+       @param descriptions Xml descriptions of the clips
+       @param parentId Bin id of the parent folder
+       @param undo,redo: lambdas that are updated to accumulate operation.
+       @param readyCallBack: lambda that will be executed when each clip becomes ready. It is given the binId as parameter
+    */
+    bool requestAddBinClips(QStringList &ids, const QList<QDomElement> &descriptions, const QString &parentId, Fun &undo, Fun &redo,
+                            const std::function<void(const QString &)> &readyCallBack = [](const QString &) {});
+
     /** @brief This is the addition function when we already have a producer for the clip*/
     bool requestAddBinClip(
         QString &id, std::shared_ptr<Mlt::Producer> &producer, const QString &parentId, Fun &undo, Fun &redo,
@@ -208,6 +223,9 @@ public:
     /** @brief Request that the producer of a given clip is reloaded */
     void reloadClip(const QString &binId);
 
+    /** @brief Request that the producers of a batch of clips are reloaded, taking the model lock only once */
+    void reloadClips(const QStringList &binIds);
+
     /** @brief Set the status of the clip to "waiting". This happens when the corresponding file has changed*/
     void setClipWaiting(const QString &binId);
     void setClipInvalid(const QString &binId);
@@ -7,6 +7,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 
 #include "projectsortproxymodel.h"
 #include "abstractprojectitem.h"
+#include "projectitemmodel.h"
 
 #include <QItemSelectionModel>
 
@@ -21,6 +22,212 @@ ProjectSortProxyModel::ProjectSortProxyModel(QObject *parent)
     setDynamicSortFilter(true);
 }
 
+void ProjectSortProxyModel::setSourceModel(QAbstractItemModel *model)
+{
+    if (model) {
+        // Connected before the base class makes its own connections, so the search
+        // index is refreshed before the proxy re-runs the filter on a change
+        connect(model, &QAbstractItemModel::dataChanged, this, [this](const QModelIndex &topLeft, const QModelIndex &bottomRight) {
+            if (m_indexDirty) {
+                return;
+            }
+            for (int row = topLeft.row(); row <= bottomRight.row(); row++) {
+                indexItem(sourceModel()->index(row, 0, topLeft.parent()));
+            }
+        });
+        connect(model, &QAbstractItemModel::rowsInserted, this, [this](const QModelIndex &parent, int first, int last) {
+            if (m_indexDirty) {
+                return;
+            }
+            for (int row = first; row <= last; row++) {
+                indexSubtree(sourceModel()->index(row, 0, parent));
+            }
+        });
+        connect(model, &QAbstractItemModel::rowsAboutToBeRemoved, this, [this](const QModelIndex &parent, int first, int last) {
+            if (m_indexDirty) {
+                return;
+            }
+            for (int row = first; row <= last; row++) {
+                removeSubtreeFromIndex(sourceModel()->index(row, 0, parent));
+            }
+        });
+        auto resetIndex = [this]() {
+            m_indexDirty = true;
+            if (!m_searchString.isEmpty()) {
+                updateSearchMatches(QString());
+            }
+        };
+        connect(model, &QAbstractItemModel::modelReset, this, resetIndex);
+        connect(model, &QAbstractItemModel::layoutChanged, this, resetIndex);
+    }
+    QSortFilterProxyModel::setSourceModel(model);
+    m_indexDirty = true;
+}
+
+QString ProjectSortProxyModel::searchText(const QModelIndex &sourceIndex) const
+{
+    // Columns 0 to 2 hold the name, date and description
+    QString text = sourceModel()->data(sourceIndex).toString();
+    for (int i = 1; i < 3; i++) {
+        text.append(QLatin1Char('\n'));
+        text.append(sourceModel()->data(sourceIndex.siblingAtColumn(i)).toString());
+    }
+    return text.toLower();
+}
+
+QString ProjectSortProxyModel::itemId(const QModelIndex &sourceIndex) const
+{
+    auto *model = static_cast<ProjectItemModel *>(sourceModel());
+    const std::shared_ptr<AbstractProjectItem> item = model->getBinItemByIndex(sourceIndex);
+    return item ? item->clipId() : QString();
+}
+
+QStringList ProjectSortProxyModel::itemTrigrams(const QString &text)
+{
+    QStringList result;
+    for (int i = 0; i + 3 <= text.size(); i++) {
+        result << text.mid(i, 3);
+    }
+    result.removeDuplicates();
+    return result;
+}
+
+void ProjectSortProxyModel::indexItem(const QModelIndex &sourceIndex)
+{
+    const QString id = itemId(sourceIndex);
+    if (id.isEmpty()) {
+        return;
+    }
+    const QString text = searchText(sourceIndex);
+    auto previous = m_searchTexts.constFind(id);
+    if (previous != m_searchTexts.constEnd()) {
+        if (*previous == text) {
+            return;
+        }
+        for (const QString &trigram : itemTrigrams(*previous)) {
+            auto it = m_trigramIndex.find(trigram);
+            if (it != m_trigramIndex.end()) {
+                it->remove(id);
+                if (it->isEmpty()) {
+                    m_trigramIndex.erase(it);
+                }
+            }
+        }
+    }
+    m_searchTexts.insert(id, text);
+    for (const QString &trigram : itemTrigrams(text)) {
+        m_trigramIndex[trigram].insert(id);
+    }
+    if (!m_searchString.isEmpty()) {
+        // Keep the active search result in sync (renames while filtering)
+        if (text.contains(m_searchString.toLower())) {
+            m_searchMatches.insert(id);
+        } else {
+            m_searchMatches.remove(id);
+        }
+    }
+}
+
+void ProjectSortProxyModel::indexSubtree(const QModelIndex &sourceIndex)
+{
+    indexItem(sourceIndex);
+    const int childCount = sourceModel()->rowCount(sourceIndex);
+    for (int row = 0; row < childCount; row++) {
+        indexSubtree(sourceModel()->index(row, 0, sourceIndex));
+    }
+}
+
+void ProjectSortProxyModel::removeSubtreeFromIndex(const QModelIndex &sourceIndex)
+{
+    const int childCount = sourceModel()->rowCount(sourceIndex);
+    for (int row = 0; row < childCount; row++) {
+        removeSubtreeFromIndex(sourceModel()->index(row, 0, sourceIndex));
+    }
+    const QString id = itemId(sourceIndex);
+    auto previous = m_searchTexts.constFind(id);
+    if (previous == m_searchTexts.constEnd()) {
+        return;
+    }
+    for (const QString &trigram : itemTrigrams(*previous)) {
+        auto it = m_trigramIndex.find(trigram);
+        if (it != m_trigramIndex.end()) {
+            it->remove(id);
+            if (it->isEmpty()) {
+                m_trigramIndex.erase(it);
+            }
+        }
+    }
+    m_searchTexts.erase(previous);
+    m_searchMatches.remove(id);
+}
+
+void ProjectSortProxyModel::rebuildSearchIndex()
+{
+    m_searchTexts.clear();
+    m_trigramIndex.clear();
+    m_searchMatches.clear();
+    if (sourceModel()) {
+        const int rows = sourceModel()->rowCount();
+        for (int row = 0; row < rows; row++) {
+            indexSubtree(sourceModel()->index(row, 0));
+        }
+    }
+    m_indexDirty = false;
+}
+
+void ProjectSortProxyModel::updateSearchMatches(const QString &previousSearch)
+{
+    const QString needle = m_searchString.toLower();
+    if (needle.isEmpty()) {
+        m_searchMatches.clear();
+        return;
+    }
+    const bool wasDirty = m_indexDirty;
+    if (wasDirty) {
+        rebuildSearchIndex();
+    }
+    QSet<QString> matches;
+    const QString previous = previousSearch.toLower();
+    if (!wasDirty && !previous.isEmpty() && needle.startsWith(previous)) {
+        // Typing extended the previous search, only its matches can still match
+        const QSet<QString> candidates = m_searchMatches;
+        for (const QString &id : candidates) {
+            if (m_searchTexts.value(id).contains(needle)) {
+                matches.insert(id);
+            }
+        }
+    } else if (needle.size() >= 3) {
+        // Verify only the posting list of the rarest trigram of the needle
+        const QSet<QString> *smallest = nullptr;
+        for (const QString &trigram : itemTrigrams(needle)) {
+            auto it = m_trigramIndex.constFind(trigram);
+            if (it == m_trigramIndex.constEnd()) {
+                // A trigram matches no item at all, neither does the needle
+                m_searchMatches.clear();
+                return;
+            }
+            if (smallest == nullptr || it->size() < smallest->size()) {
+                smallest = &(*it);
+            }
+        }
+        if (smallest) {
+            for (const QString &id : *smallest) {
+                if (m_searchTexts.value(id).contains(needle)) {
+                    matches.insert(id);
+                }
+            }
+        }
+    } else {
+        // Needle shorter than a trigram, scan the cached texts
+        for (auto it = m_searchTexts.constBegin(); it != m_searchTexts.constEnd(); ++it) {
+            if (it.value().contains(needle)) {
+                matches.insert(it.key());
+            }
+        }
+    }
+    m_searchMatches = matches;
+}
+
 // Responsible for item sorting!
 bool ProjectSortProxyModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
 {
@@ -82,19 +289,17 @@ bool ProjectSortProxyModel::filterAcceptsRowItself(int sourceRow, const QModelIn
         result = true;
     }
 
-    if (result && m_searchString.isEmpty()) {
+    if (m_searchString.isEmpty()) {
         return true;
     }
-    for (int i = 0; i < 3; i++) {
-        QModelIndex index0 = sourceModel()->index(sourceRow, i, sourceParent);
-        if (!index0.isValid()) {
-            return false;
-        }
-        auto data = sourceModel()->data(index0);
-        if (data.toString().contains(m_searchString, Qt::CaseInsensitive)) {
-            result = true;
-            break;
-        }
+    // Membership in the prebuilt search index replaces scanning the item's
+    // name, date and description columns on every keystroke
+    QModelIndex index0 = sourceModel()->index(sourceRow, 0, sourceParent);
+    if (!index0.isValid()) {
+        return false;
+    }
+    if (m_searchMatches.contains(itemId(index0))) {
+        result = true;
     }
     return result;
 }
@@ -126,19 +331,36 @@ bool ProjectSortProxyModel::hasAcceptedChildren(int sourceRow, const QModelIndex
 
 bool ProjectSortProxyModel::lessThan(const QModelIndex &left, const QModelIndex &right) const
 {
+    // Fetch the items directly, going through data() boxes every value in a QVariant per comparison
+    auto *model = static_cast<ProjectItemModel *>(sourceModel());
+    const std::shared_ptr<AbstractProjectItem> leftItem = model->getBinItemByIndex(left);
+    const std::shared_ptr<AbstractProjectItem> rightItem = model->getBinItemByIndex(right);
+    if (leftItem == nullptr || rightItem == nullptr) {
+        return false;
+    }
     // Check item type (folder or clip) as defined in projectitemmodel
-    int leftType = sourceModel()->data(left, AbstractProjectItem::ItemTypeRole).toInt();
-    int rightType = sourceModel()->data(right, AbstractProjectItem::ItemTypeRole).toInt();
+    const int leftType = leftItem->itemType();
+    const int rightType = rightItem->itemType();
     if (leftType == rightType) {
         // Special case, sequences folder always at top
         if (leftType == AbstractProjectItem::FolderItem) {
-            if (sourceModel()->data(left, AbstractProjectItem::SequenceFolder).toBool()) {
+            if (leftItem->getData(AbstractProjectItem::SequenceFolder).toBool()) {
                 return true;
             }
-            if (sourceModel()->data(right, AbstractProjectItem::SequenceFolder).toBool()) {
+            if (rightItem->getData(AbstractProjectItem::SequenceFolder).toBool()) {
                 return false;
             }
         }
+        switch (left.column()) {
+        case 1:
+            // Date column, compare the precomputed integer keys
+            return leftItem->dateSortKey() < rightItem->dateSortKey();
+        case 0:
+            // Name column, compare the precomputed collated keys
+            return leftItem->nameSortKey(m_collator) < rightItem->nameSortKey(m_collator);
+        default:
+            break;
+        }
         // Let the normal alphabetical sort happen
         const QVariant leftData = sourceModel()->data(left, Qt::DisplayRole);
         const QVariant rightData = sourceModel()->data(right, Qt::DisplayRole);
@@ -171,7 +393,9 @@ QItemSelectionModel *ProjectSortProxyModel::selectionModel()
 
 void ProjectSortProxyModel::slotSetSearchString(const QString &str)
 {
+    const QString previousSearch = m_searchString;
     m_searchString = str;
+    updateSearchMatches(previousSearch);
     invalidateFilter();
 }
 
@@ -8,6 +8,8 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #pragma once
 
 #include <QCollator>
+#include <QHash>
+#include <QSet>
 #include <QSortFilterProxyModel>
 
 class QItemSelectionModel;
@@ -25,6 +27,8 @@ public:
 
     explicit ProjectSortProxyModel(QObject *parent = nullptr);
     QItemSelectionModel *selectionModel();
+    /** @brief Reimplemented to keep the search index in sync with the bin model */
+    void setSourceModel(QAbstractItemModel *model) override;
 
 public Q_SLOTS:
     /** @brief Set search string that will filter the view */
@@ -52,6 +56,23 @@ protected:
     bool hasAcceptedChildren(int source_row, const QModelIndex &source_parent) const;
 
 private:
+    /** @brief Rebuild the whole trigram index from the source model */
+    void rebuildSearchIndex();
+    /** @brief Index (or reindex) the searchable text of one item */
+    void indexItem(const QModelIndex &sourceIndex);
+    /** @brief Index an item and all its descendants */
+    void indexSubtree(const QModelIndex &sourceIndex);
+    /** @brief Drop an item and all its descendants from the index */
+    void removeSubtreeFromIndex(const QModelIndex &sourceIndex);
+    /** @brief Recompute the set of items matching the current search string, narrowing
+     *  the previous matches when the user extended the search */
+    void updateSearchMatches(const QString &previousSearch);
+    /** @brief Lowercase concatenation of the searched columns of one item */
+    QString searchText(const QModelIndex &sourceIndex) const;
+    /** @brief Bin id of the item at @sourceIndex, used as key in the index */
+    QString itemId(const QModelIndex &sourceIndex) const;
+    static QStringList itemTrigrams(const QString &text);
+
     QItemSelectionModel *m_selection;
     QString m_searchString;
     QStringList m_searchTag;
@@ -59,6 +80,13 @@ private:
     QList<int> m_searchRating;
     UsageFilter m_usageFilter{UsageFilter::All};
     QCollator m_collator;
+    /** @brief Lowercase searchable text per item, avoids re-querying the model on each keystroke */
+    QHash<QString, QString> m_searchTexts;
+    /** @brief Trigram of the searchable text -> ids of the items containing it */
+    QHash<QString, QSet<QString>> m_trigramIndex;
+    /** @brief Items matching the current search string */
+    QSet<QString> m_searchMatches;
+    bool m_indexDirty{true};
 
 Q_SIGNALS:
     /** @brief Emitted when the row changes, used to prepare action for selected item  */
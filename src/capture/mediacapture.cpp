@@ -166,7 +166,7 @@ qint64 AudioDevInfo::writeData(const char *data, qint64 len)
         QVector<qreal> recLevels;
         for (int j = 0; j < m_format.channelCount(); ++j) {
             qreal val = qMin(levels.at(j), maxAmplitude);
-            val = 20. * log10(val / maxAmplitude);
+            val = IEC_LinearToDB(val / maxAmplitude);
             recLevels << val;
             dbLevels << IEC_ScaleMax(val, 0);
         }
@@ -236,7 +236,7 @@ qint64 AudioDevInfo::writeData(const char *data, qint64 len)
         QVector<qreal> recLevels;
         for (int j = 0; j < m_format.channelCount(); ++j) {
             qreal val = qMin(levels.at(j), maxAmplitude);
-            val = 20. * log10(val / maxAmplitude);
+            val = IEC_LinearToDB(val / maxAmplitude);
             recLevels << val;
             dbLevels << IEC_ScaleMax(val, 0);
         }
@@ -299,6 +299,10 @@ void MediaCapture::initializeAudioSetup()
     m_audioInfo.reset(new AudioDevInfo(format));
     m_audioInput.reset(new QAudioInput(deviceInfo, this));
     m_audioSource = std::make_unique<QAudioSource>(deviceInfo, format, this);
+    if (KdenliveSettings::lowlatencymonitoring()) {
+        // Request ~10 ms periods; the backend may round up to its minimum
+        m_audioSource->setBufferSize(format.bytesForDuration(10000));
+    }
 }
 #endif
 
@@ -338,6 +342,10 @@ void MediaCapture::switchMonitorState(bool run)
         m_audioInfo.reset(new AudioDevInfo(format));
         m_audioInput.reset();
         m_audioInput = std::make_unique<QAudioInput>(deviceInfo, format, this);
+        if (KdenliveSettings::lowlatencymonitoring()) {
+            // Request ~10 ms periods; the backend may round up to its minimum
+            m_audioInput->setBufferSize(format.bytesForDuration(10000));
+        }
         QObject::connect(m_audioInfo.data(), &AudioDevInfo::levelChanged, m_audioInput.get(), [&](const QVector<qreal> &level) {
             m_levels = level;
             if (m_recordState == QMediaRecorder::RecordingState) {
@@ -609,13 +617,26 @@ int MediaCapture::startCapture(bool showCountdown)
     m_recTimer.start();
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
     m_audioRecorder->record();
+    // Estimate the input path latency from the effective device buffer, used to compensate punch-ins
+    if (m_audioInput) {
+        m_captureLatencyMs = m_audioInput->format().durationForBytes(m_audioInput->bufferSize()) / 1000.;
+    }
 #else
     m_mediaRecorder->record();
+    if (m_audioSource) {
+        m_captureLatencyMs = m_audioSource->format().durationForBytes(m_audioSource->bufferSize()) / 1000.;
+    }
 #endif
+    qDebug() << "::: audio capture latency estimate:" << m_captureLatencyMs << "ms";
     m_readyForRecord = false;
     return m_tid;
 }
 
+int MediaCapture::captureLatencyFrames() const
+{
+    return qRound(m_captureLatencyMs * pCore->getCurrentFps() / 1000.);
+}
+
 // TODO: fix video capture
 
 /*void MediaCapture::recordVideo(int tid, bool record)
@@ -87,6 +87,8 @@ public:
     void resumeRecording();
     /** @brief Start the real audio capture **/
     int startCapture(bool showCountdown);
+    /** @brief Estimated input latency of the running capture, in timeline frames **/
+    int captureLatencyFrames() const;
 #if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
     void initializeAudioSetup();
     #endif
@@ -120,6 +122,8 @@ private:
     int m_lastPos;
     /** @brief Duration of pre-pause recording */
     int m_recOffset;
+    /** @brief Estimated input latency of the audio device, in milliseconds */
+    qreal m_captureLatencyMs{0.};
     int m_tid;
     /** @brief true if we started the record countdown */
     bool m_readyForRecord;
@@ -8,6 +8,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include "audiomixer/mixermanager.hpp"
 #include "bin/bin.h"
 #include "bin/mediabrowser.h"
+#include "bin/projectclip.h"
 #include "bin/projectitemmodel.h"
 #include "capture/mediacapture.h"
 #include "dialogs/proxytest.h"
@@ -16,6 +17,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include "dialogs/timeremap.h"
 #include "doc/docundostack.hpp"
 #include "doc/kdenlivedoc.h"
+#include "effects/effectstack/model/effectstackmodel.hpp"
 #include "kdenlive_debug.h"
 #include "kdenlivesettings.h"
 #include "library/librarywidget.h"
@@ -38,6 +40,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include <QCoreApplication>
 #include <QDesktopServices>
 #include <QDir>
+#include <QElapsedTimer>
 #include <QImageReader>
 #include <QInputDialog>
 #include <QQuickStyle>
@@ -150,7 +153,14 @@ void Core::initHeadless(const QUrl &url)
 
 void Core::initGUI(const QString &MltPath, const QUrl &Url, const QString &clipsToLoad)
 {
+    // Time the startup phases so regressions show up in the debug log. The phases below form a
+    // dependency chain (MLT factory -> profiles -> default producer -> show), independent work
+    // (luma scan, codec capabilities, library listing) already runs off the startup path
+    QElapsedTimer startupTimer;
+    startupTimer.start();
+    auto logStartupPhase = [&startupTimer](const char *phase) { qCDebug(KDENLIVE_LOG) << "== startup phase:" << phase << "took" << startupTimer.restart() << "ms"; };
     m_mainWindow = new MainWindow();
+    logStartupPhase("main window construction");
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
 
     QStringList styles = QQuickStyle::availableStyles();
@@ -183,8 +193,11 @@ void Core::initGUI(const QString &MltPath, const QUrl &Url, const QString &clips
     connect(m_projectItemModel.get(), &ProjectItemModel::addTag, m_mainWindow->activeBin(), &Bin::slotTagDropped);
     connect(m_projectItemModel.get(), &QAbstractItemModel::dataChanged, m_mainWindow->activeBin(), &Bin::slotItemEdited);
 
+    logStartupPhase("bin setup");
+
     m_monitorManager = new MonitorManager(this);
     projectManager()->init(Url, clipsToLoad);
+    logStartupPhase("monitor and project managers");
 
     // The MLT Factory will be initiated there, all MLT classes will be usable only after this
     bool inSandbox = m_packageType == LinuxPackageType::AppImage || m_packageType == LinuxPackageType::Flatpak || m_packageType == LinuxPackageType::Snap;
@@ -200,6 +213,7 @@ void Core::initGUI(const QString &MltPath, const QUrl &Url, const QString &clips
         // Open connection with Mlt
         m_mainWindow->init(MltPath);
     }
+    logStartupPhase("main window init");
     m_projectItemModel->buildPlaylist(QUuid());
     // load the profiles from disk
     ProfileRepository::get()->refresh();
@@ -250,12 +264,14 @@ void Core::initGUI(const QString &MltPath, const QUrl &Url, const QString &clips
     // TODO make it a more proper image, it currently causes a crash on exit
     ClipController::mediaUnavailable = std::make_shared<Mlt::Producer>(ProfileRepository::get()->getProfile(m_self->m_profile)->profile(), "color:blue");
     ClipController::mediaUnavailable->set("length", 99999999);
+    logStartupPhase("profile repository");
 
     if (qApp->isSessionRestored()) {
         // NOTE: we are restoring only one window, because Kdenlive only uses one MainWindow
         m_mainWindow->restore(1, false);
     }
     m_mainWindow->show();
+    logStartupPhase("window show");
     // bin->slotUpdatePalette();
     Q_EMIT m_mainWindow->GUISetupDone();
     m_guiConstructed = true;
@@ -870,6 +886,18 @@ void Core::refreshProjectItem(const ObjectId &id)
     case KdenliveObjectType::TimelineClip:
     case KdenliveObjectType::TimelineMix:
         if (currentDoc()->getTimeline(id.uuid)->isClip(id.itemId)) {
+            if (id.type == KdenliveObjectType::TimelineClip) {
+                // If this exact stack state was displayed recently (A/B comparison of effect
+                // parameters), redisplay the cached frame instead of re-rendering it
+                auto stack = currentDoc()->getTimeline(id.uuid)->getClipEffectStackModel(id.itemId);
+                if (stack) {
+                    const QString hash = stack->parametersHash();
+                    if (m_monitorManager->projectMonitor()->displayEffectCachedFrame(hash)) {
+                        break;
+                    }
+                    m_monitorManager->projectMonitor()->cacheNextFrameForEffects(QStringLiteral("%1:%2").arg(id.uuid.toString()).arg(id.itemId), hash);
+                }
+            }
             m_mainWindow->getTimeline(id.uuid)->controller()->refreshItem(id.itemId);
         }
         break;
@@ -886,7 +914,19 @@ void Core::refreshProjectItem(const ObjectId &id)
     case KdenliveObjectType::BinClip:
         if (m_monitorManager->clipMonitorVisible()) {
             m_monitorManager->activateMonitor(Kdenlive::ClipMonitor);
-            m_monitorManager->refreshClipMonitor(true);
+            bool refreshed = false;
+            std::shared_ptr<ProjectClip> clip = projectItemModel()->getClipByBinID(QString::number(id.itemId));
+            if (clip && clip->getEffectStack()) {
+                const QString hash = clip->getEffectStack()->parametersHash();
+                if (m_monitorManager->clipMonitor()->displayEffectCachedFrame(hash)) {
+                    refreshed = true;
+                } else {
+                    m_monitorManager->clipMonitor()->cacheNextFrameForEffects(QStringLiteral("bin:%1").arg(id.itemId), hash);
+                }
+            }
+            if (!refreshed) {
+                m_monitorManager->refreshClipMonitor(true);
+            }
         }
         if (m_monitorManager->projectMonitorVisible() && m_mainWindow->getCurrentTimeline() &&
             m_mainWindow->getCurrentTimeline()->controller()->refreshIfVisible(id.itemId)) {
@@ -1052,6 +1092,14 @@ void Core::invalidateRange(QPair<int, int> range)
 void Core::invalidateItem(ObjectId itemId)
 {
     if (!m_guiConstructed || !m_mainWindow->getCurrentTimeline() || m_mainWindow->getCurrentTimeline()->loading) return;
+    if (m_monitorManager->projectMonitor()->isPlaying()) {
+        // Queue the invalidation: the running consumer picks up the filter change on the next
+        // frame anyway, and restarting preview jobs now would make playback stutter
+        if (!m_pendingItemInvalidations.contains(itemId)) {
+            m_pendingItemInvalidations << itemId;
+        }
+        return;
+    }
     auto tl = m_mainWindow->getTimeline(itemId.uuid);
     switch (itemId.type) {
     case KdenliveObjectType::TimelineClip:
@@ -1079,6 +1127,36 @@ void Core::invalidateItem(ObjectId itemId)
     }
 }
 
+void Core::flushPendingItemInvalidations()
+{
+    if (m_pendingItemInvalidations.isEmpty()) {
+        return;
+    }
+    const QList<ObjectId> pending = m_pendingItemInvalidations;
+    m_pendingItemInvalidations.clear();
+    for (const ObjectId &id : pending) {
+        invalidateItem(id);
+    }
+}
+
+void Core::invalidateItemRange(ObjectId itemId, int in, int out)
+{
+    if (!m_guiConstructed || !m_mainWindow->getCurrentTimeline() || m_mainWindow->getCurrentTimeline()->loading) return;
+    auto tl = m_mainWindow->getTimeline(itemId.uuid);
+    switch (itemId.type) {
+    case KdenliveObjectType::TimelineClip:
+    case KdenliveObjectType::TimelineComposition:
+        if (tl) {
+            tl->controller()->invalidateItemRange(itemId.itemId, in, out);
+        }
+        break;
+    default:
+        // No partial invalidation possible, invalidate the full item
+        invalidateItem(itemId);
+        break;
+    }
+}
+
 double Core::getClipSpeed(ObjectId id) const
 {
     auto tl = m_mainWindow->getTimeline(id.uuid);
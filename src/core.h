@@ -217,8 +217,14 @@ public:
     bool compositionAutoTrack(int cid) const;
     std::shared_ptr<DocUndoStack> undoStack();
     double getClipSpeed(ObjectId id) const;
-    /** @brief Mark an item as invalid for timeline preview */
+    /** @brief Mark an item as invalid for timeline preview. While the project monitor is playing
+     *  the invalidation is queued so toggling effects does not interrupt playback. */
     void invalidateItem(ObjectId itemId);
+    /** @brief Process the invalidations queued while the project monitor was playing */
+    void flushPendingItemInvalidations();
+    /** @brief Mark a part of an item as invalid for timeline preview.
+     *  @param in and @param out are frame offsets relative to the item's position in the timeline. */
+    void invalidateItemRange(ObjectId itemId, int in, int out);
     void invalidateRange(QPair<int, int> range);
     void prepareShutdown();
     void finishShutdown();
@@ -377,6 +383,8 @@ private:
     std::unique_ptr<MediaCapture> m_capture;
     QUrl m_mediaCaptureFile;
     void resetThumbProfile();
+    /** @brief Preview invalidations queued while the project monitor was playing */
+    QList<ObjectId> m_pendingItemInvalidations;
 
 protected:
     /** @brief A unique session id for this app instance */
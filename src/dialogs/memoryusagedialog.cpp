@@ -0,0 +1,75 @@
+/*
+    SPDX-FileCopyrightText: 2026 Jean-Baptiste Mardelle <jb@kdenlive.org>
+
+SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "memoryusagedialog.h"
+
+#include <KFormat>
+#include <KLocalizedString>
+
+#include <QDialogButtonBox>
+#include <QFontDatabase>
+#include <QHeaderView>
+#include <QLabel>
+#include <QPlainTextEdit>
+#include <QScrollBar>
+#include <QTreeWidget>
+#include <QVBoxLayout>
+
+MemoryUsageDialog::MemoryUsageDialog(QWidget *parent)
+    : QDialog(parent)
+{
+    setWindowTitle(i18nc("@title:window", "Memory Usage"));
+    auto *lay = new QVBoxLayout(this);
+    m_tree = new QTreeWidget(this);
+    m_tree->setColumnCount(3);
+    m_tree->setHeaderLabels({i18n("Category"), i18n("Live bytes"), i18n("Items")});
+    m_tree->setRootIsDecorated(false);
+    m_tree->setAlternatingRowColors(true);
+    m_tree->setSelectionMode(QAbstractItemView::NoSelection);
+    for (int i = 0; i < MemoryDiagnostics::CategoryCount; i++) {
+        auto *item = new QTreeWidgetItem(m_tree, {MemoryDiagnostics::categoryName(MemoryDiagnostics::Category(i)), QString(), QString()});
+        item->setTextAlignment(1, Qt::AlignRight | Qt::AlignVCenter);
+        item->setTextAlignment(2, Qt::AlignRight | Qt::AlignVCenter);
+    }
+    m_tree->header()->setSectionResizeMode(0, QHeaderView::Stretch);
+    lay->addWidget(m_tree);
+    if (!MemoryDiagnostics::allocatorStats().isEmpty()) {
+        m_allocatorStats = new QPlainTextEdit(this);
+        m_allocatorStats->setReadOnly(true);
+        m_allocatorStats->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+        lay->addWidget(m_allocatorStats);
+    }
+#ifndef KDENLIVE_MEMORY_DIAGNOSTICS
+    auto *info = new QLabel(i18n("Memory tracking is disabled in this build, configure with BUILD_MEMORY_DIAGNOSTICS to enable it."), this);
+    info->setWordWrap(true);
+    lay->addWidget(info);
+#endif
+    auto *buttonBox = new QDialogButtonBox(QDialogButtonBox::Close, this);
+    connect(buttonBox, &QDialogButtonBox::rejected, this, &QDialog::reject);
+    lay->addWidget(buttonBox);
+    updateValues();
+    m_refreshTimer.setInterval(1000);
+    connect(&m_refreshTimer, &QTimer::timeout, this, &MemoryUsageDialog::updateValues);
+    m_refreshTimer.start();
+}
+
+void MemoryUsageDialog::updateValues()
+{
+    KFormat format;
+    for (int i = 0; i < MemoryDiagnostics::CategoryCount; i++) {
+        QTreeWidgetItem *item = m_tree->topLevelItem(i);
+        const qint64 bytes = MemoryDiagnostics::bytes(MemoryDiagnostics::Category(i));
+        // The undo stack and producer pool only report counts, leave their byte column empty
+        item->setText(1, bytes > 0 ? format.formatByteSize(double(bytes)) : QStringLiteral("-"));
+        item->setText(2, QString::number(MemoryDiagnostics::items(MemoryDiagnostics::Category(i))));
+    }
+    if (m_allocatorStats) {
+        // Keep the viewport position so the report can be read while it refreshes
+        const int scrollPos = m_allocatorStats->verticalScrollBar()->value();
+        m_allocatorStats->setPlainText(MemoryDiagnostics::allocatorStats());
+        m_allocatorStats->verticalScrollBar()->setValue(scrollPos);
+    }
+}
@@ -0,0 +1,39 @@
+/*
+    SPDX-FileCopyrightText: 2026 Jean-Baptiste Mardelle <jb@kdenlive.org>
+
+SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#pragma once
+
+#include "utils/memorydiagnostics.h"
+
+#include <QDialog>
+#include <QTimer>
+
+class QPlainTextEdit;
+class QTreeWidget;
+
+/**
+ * @class MemoryUsageDialog
+ * @brief A diagnostics dialog showing live bytes and item counts per memory category.
+ * Only shows meaningful numbers when the application was configured with
+ * BUILD_MEMORY_DIAGNOSTICS, otherwise all counters stay at zero.
+ */
+class MemoryUsageDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit MemoryUsageDialog(QWidget *parent = nullptr);
+
+private Q_SLOTS:
+    /** @brief Refreshes the category rows from the current counters */
+    void updateValues();
+
+private:
+    QTreeWidget *m_tree;
+    /** @brief Arena statistics of the alternate allocator, only created when one is linked in */
+    QPlainTextEdit *m_allocatorStats{nullptr};
+    QTimer m_refreshTimer;
+};
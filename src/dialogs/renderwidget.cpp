@@ -79,7 +79,9 @@ enum {
     LastTimeRole,
     LastFrameRole,
     OpenBrowserRole,
-    PlayAfterRole
+    PlayAfterRole,
+    PlaylistHashRole,
+    AudioLevelsRole
 };
 
 // Running job status
@@ -288,6 +290,11 @@ RenderWidget::RenderWidget(bool enableProxy, QWidget *parent)
         }
         refreshParams();
     });
+    m_view.numa_pin->setChecked(KdenliveSettings::rendernumapin());
+    connect(m_view.numa_pin, &QCheckBox::toggled, this, [](bool checked) { KdenliveSettings::setRendernumapin(checked); });
+#ifndef Q_OS_LINUX
+    m_view.numa_pin->hide();
+#endif
     connect(m_view.export_meta, &QCheckBox::stateChanged, this, &RenderWidget::refreshParams);
     connect(m_view.checkTwoPass, &QCheckBox::stateChanged, this, &RenderWidget::refreshParams);
 
@@ -697,6 +704,7 @@ void RenderWidget::slotPrepareExport2(bool delayedRendering)
     request->setEmbedSubtitles(m_view.embed_subtitles->isEnabled() && m_view.embed_subtitles->isChecked());
     request->setTwoPass(m_view.checkTwoPass->isChecked());
     request->setAudioFilePerTrack(m_view.stemAudioExport->isChecked() && m_view.stemAudioExport->isEnabled());
+    request->setNormalizeAudio(m_view.audio_box->isChecked() && m_view.normalizeAudio->isChecked());
 
     bool guideMultiExport = m_view.guide_multi_box->isChecked();
     int guideCategory = m_view.guideCategoryChooser->currentCategory();
@@ -732,12 +740,25 @@ void RenderWidget::slotPrepareExport2(bool delayedRendering)
     }
 
     QList<RenderJobItem *> jobList;
+    int skippedJobs = 0;
     for (auto &job : jobs) {
+        if (!job.playlistHash.isEmpty() && QFile::exists(job.outputPath) && RenderRequest::storedRenderHash(job.outputPath) == job.playlistHash) {
+            // The output file was already rendered from an identical playlist, no need to re-encode it
+            skippedJobs++;
+            continue;
+        }
         RenderJobItem *renderItem = createRenderJob(job);
         if (renderItem != nullptr) {
             jobList << renderItem;
         }
     }
+    if (skippedJobs > 0) {
+        m_view.jobInfo->setMessageType(KMessageWidget::Information);
+        m_view.jobInfo->setText(
+            i18np("One rendered file is unchanged since the last render and was skipped.",
+                  "%1 rendered files are unchanged since the last render and were skipped.", skippedJobs));
+        m_view.jobInfo->show();
+    }
     if (jobList.count() > 0) {
         m_view.running_jobs->setCurrentItem(jobList.at(0));
     }
@@ -777,6 +798,7 @@ RenderJobItem *RenderWidget::createRenderJob(const RenderRequest::RenderJob &job
     qDebug() << "* CREATED JOB WITH ARGS: " << argsJob;
     renderItem->setData(1, OpenBrowserRole, m_view.open_browser->isChecked());
     renderItem->setData(1, PlayAfterRole, m_view.play_after->isChecked());
+    renderItem->setData(1, PlaylistHashRole, job.playlistHash);
     if (!m_view.audio_box->isChecked()) {
         renderItem->setData(1, ExtraInfoRole, i18n("Video without audio track"));
     } else if (!m_view.video_box->isChecked()) {
@@ -794,8 +816,9 @@ void RenderWidget::checkRenderStatus()
         return;
     }
 
-    // Make sure no other rendering is running
-    if (runningJobsCount() > 0) {
+    // Make sure we are below the allowed number of concurrent renderings
+    const int maxJobs = qMax(1, KdenliveSettings::maxconcurrentrenderjobs());
+    if (runningJobsCount() >= maxJobs) {
         return;
     }
 
@@ -806,13 +829,33 @@ void RenderWidget::checkRenderStatus()
     // Find first waiting job
     while (item != nullptr) {
         if (item->status() == WAITINGJOB) {
+            QStringList jobData = item->data(1, ParametersRole).toStringList();
+            if (maxJobs > 1 && jobData.size() > 2 && jobData.at(1).endsWith(QStringLiteral("-pass2.mlt"))) {
+                // With concurrent jobs allowed, a second encoding pass must not start
+                // while its first pass is still pending
+                const QString firstPassName = jobData.at(1).section(QLatin1Char('-'), 0, -2) + QStringLiteral(".mlt");
+                QTreeWidgetItem *above = m_view.running_jobs->itemAbove(item);
+                bool firstPassPending = false;
+                while (above) {
+                    QStringList aboveData = above->data(1, ParametersRole).toStringList();
+                    if (aboveData.size() > 2 && aboveData.at(1) == firstPassName) {
+                        int status = static_cast<RenderJobItem *>(above)->status();
+                        firstPassPending = (status == WAITINGJOB || status == STARTINGJOB || status == RUNNINGJOB);
+                        break;
+                    }
+                    above = m_view.running_jobs->itemAbove(above);
+                }
+                if (firstPassPending) {
+                    item = static_cast<RenderJobItem *>(m_view.running_jobs->itemBelow(item));
+                    continue;
+                }
+            }
             QDateTime t = QDateTime::currentDateTime();
             item->setData(1, StartTimeRole, t);
             item->setData(1, LastTimeRole, t);
             waitingJob = true;
             startRendering(item);
             // Check for 2 pass encoding
-            QStringList jobData = item->data(1, ParametersRole).toStringList();
             if (jobData.size() > 2 && jobData.at(1).endsWith(QStringLiteral("-pass2.mlt"))) {
                 // Find and remove 1st pass job
                 QTreeWidgetItem *above = m_view.running_jobs->itemAbove(item);
@@ -1205,6 +1248,15 @@ void RenderWidget::parseProfiles(const QString &selectedProfile)
     focusItem(selectedProfile);
 }
 
+void RenderWidget::setRenderAudioLevels(const QString &dest, const QByteArray &levels)
+{
+    QList<QTreeWidgetItem *> existing = m_view.running_jobs->findItems(dest, Qt::MatchExactly, 1);
+    if (existing.isEmpty()) {
+        return;
+    }
+    existing.at(0)->setData(1, AudioLevelsRole, levels);
+}
+
 void RenderWidget::setRenderProgress(const QString &dest, int progress, int frame)
 {
     RenderJobItem *item = nullptr;
@@ -1276,6 +1328,11 @@ void RenderWidget::setRenderStatus(const QString &dest, int status, const QStrin
     if (status == -1) {
         // Job finished successfully
         item->setStatus(FINISHEDJOB);
+        const QString playlistHash = item->data(1, PlaylistHashRole).toString();
+        if (!playlistHash.isEmpty()) {
+            // Remember the playlist hash so an identical re-export can skip this file
+            RenderRequest::storeRenderHash(dest, playlistHash);
+        }
         QDateTime startTime = item->data(1, StartTimeRole).toDateTime();
         qint64 elapsedTime = startTime.secsTo(QDateTime::currentDateTime());
         int days = static_cast<int>(elapsedTime / 86400);
@@ -1312,6 +1369,8 @@ void RenderWidget::setRenderStatus(const QString &dest, int status, const QStrin
     } else if (status == -2) {
         // Rendering crashed
         item->setStatus(FAILEDJOB);
+        // The output file is now unusable, forget any stored hash
+        RenderRequest::storeRenderHash(dest, QString());
         m_view.error_log->append(i18n("<strong>Rendering of %1 crashed</strong><br />", dest));
         m_view.error_log->append(error);
         m_view.error_log->append(QStringLiteral("<hr />"));
@@ -1319,6 +1378,7 @@ void RenderWidget::setRenderStatus(const QString &dest, int status, const QStrin
     } else if (status == -3) {
         // User aborted job
         item->setStatus(ABORTEDJOB);
+        RenderRequest::storeRenderHash(dest, QString());
     } else {
         delete item;
     }
@@ -74,6 +74,24 @@ public:
                 painter->setPen(Qt::NoPen);
                 bgrect.setWidth((width - 2) * progress / 100);
                 painter->drawRect(bgrect);
+                const QByteArray levels = index.data(Qt::UserRole + 11).toByteArray();
+                if (!levels.isEmpty()) {
+                    // Compact peak strip of the program audio, streamed by the render process
+                    QRectF strip(r1.left() + 2, option.rect.bottom() - 14 - textMargin, width, 6);
+                    QColor stripBg = option.palette.alternateBase().color();
+                    stripBg.setAlpha(150);
+                    painter->fillRect(strip, stripBg);
+                    painter->setBrush(option.palette.highlight().color());
+                    const int count = levels.size();
+                    const double barWidth = strip.width() / count;
+                    for (int i = 0; i < count; ++i) {
+                        const int level = static_cast<unsigned char>(levels.at(i)) * int(strip.height()) / 255;
+                        if (level == 0) {
+                            continue;
+                        }
+                        painter->drawRect(QRectF(strip.left() + i * barWidth, strip.bottom() - level, qMax(1., barWidth), level));
+                    }
+                }
             } else {
                 r1.setBottom(opt.rect.bottom());
                 r1.setTop(r1.bottom() - mid);
@@ -114,6 +132,8 @@ public:
     void setGuides(std::weak_ptr<MarkerListModel> guidesModel);
     void focusItem(const QString &profile = QString());
     void setRenderProgress(const QString &dest, int progress = 0, int frame = 0);
+    /** @brief Show the audio peak strip streamed by the render process on the queue item. */
+    void setRenderAudioLevels(const QString &dest, const QByteArray &levels);
     void setRenderStatus(const QString &dest, int status, const QString &error);
     void setRenderProfile(const QMap<QString, QString> &props);
     void saveRenderProfile();
@@ -8,6 +8,7 @@
 #include "monitor/monitor.h"
 
 #include "core.h"
+#include "doc/docundostack.hpp"
 #include "kdenlivesettings.h"
 #include "widgets/timecodedisplay.h"
 
@@ -35,6 +36,7 @@ bool ShiftEnterFilter::eventFilter(QObject *obj, QEvent *event)
     }
     if (event->type() == QEvent::FocusOut) {
         Q_EMIT triggerUpdate();
+        Q_EMIT focusLost();
         return true;
     }
     return QObject::eventFilter(obj, event);
@@ -49,6 +51,11 @@ SubtitleEdit::SubtitleEdit(QWidget *parent)
     auto *keyFilter = new ShiftEnterFilter(this);
     subText->installEventFilter(keyFilter);
     connect(keyFilter, &ShiftEnterFilter::triggerUpdate, this, &SubtitleEdit::updateSubtitle);
+    connect(keyFilter, &ShiftEnterFilter::focusLost, this, []() {
+        // Edits applied while the text widget kept focus were coalesced into a single undo
+        // entry; leaving the widget ends that session
+        pCore->undoStack()->endCommandMerging();
+    });
     connect(subText, &KTextEdit::textChanged, this, [this]() {
         if (m_activeSub > -1) {
             buttonApply->setEnabled(true);
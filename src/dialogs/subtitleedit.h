@@ -22,7 +22,9 @@ protected:
     bool eventFilter(QObject *obj, QEvent *event) override;
 Q_SIGNALS:
     void triggerUpdate();
-};  
+    /** @brief The text widget lost focus, closing the current edit session */
+    void focusLost();
+};
 
 
 /**
@@ -69,6 +69,11 @@ RemapView::RemapView(QWidget *parent)
     timer.setInterval(500);
     timer.setSingleShot(true);
     connect(&timer, &QTimer::timeout, this, &RemapView::reloadProducer);
+    // While dragging a keyframe, regenerating the MLT time_map on every mouse move stalls the
+    // drag, so coalesce the live preview updates and do the final update on release
+    m_previewTimer.setInterval(50);
+    m_previewTimer.setSingleShot(true);
+    connect(&m_previewTimer, &QTimer::timeout, this, [this]() { Q_EMIT updateKeyframes(false); });
 }
 
 bool RemapView::isInRange() const
@@ -517,7 +522,9 @@ void RemapView::mouseMoveEvent(QMouseEvent *event)
 
                     m_selectedKeyframes = updated;
                     Q_EMIT seekToPos(-1, pos);
-                    Q_EMIT updateKeyframes(false);
+                    if (!m_previewTimer.isActive()) {
+                        m_previewTimer.start();
+                    }
                     if (remapMax() > m_lastMaxDuration) {
                         m_lastMaxDuration = remapMax();
                         int maxWidth = width() - (2 * m_offset);
@@ -580,7 +587,9 @@ void RemapView::mouseMoveEvent(QMouseEvent *event)
                 m_selectedKeyframes = updated;
                 slotSetPosition(pos + m_inFrame);
                 Q_EMIT seekToPos(pos + m_inFrame, -1);
-                Q_EMIT updateKeyframes(false);
+                if (!m_previewTimer.isActive()) {
+                    m_previewTimer.start();
+                }
                 if (remapMax() > m_lastMaxDuration) {
                     m_lastMaxDuration = remapMax();
                     int maxWidth = width() - (2 * m_offset);
@@ -805,6 +814,8 @@ std::pair<int, int> RemapView::getClosestKeyframe(int pos, bool bottomKeyframe)
 void RemapView::mouseReleaseEvent(QMouseEvent *event)
 {
     event->accept();
+    // The final time_map is regenerated below with undo, discard any pending preview update
+    m_previewTimer.stop();
     bool keyframesEdited = m_keyframesOrigin != m_keyframes;
     if (m_moveKeyframeMode == TopMove || m_moveKeyframeMode == BottomMove) {
         // Restore original selection
@@ -1312,6 +1323,9 @@ const QString RemapView::getKeyframesData(QMap<int, int> keyframes) const
     if (keyframes.isEmpty()) {
         keyframes = m_keyframes;
     }
+    if (keyframes == m_remapCacheSource) {
+        return m_remapCacheData;
+    }
     QMapIterator<int, int> i(keyframes);
     int offset = 0;
     Mlt::Properties props;
@@ -1324,7 +1338,9 @@ const QString RemapView::getKeyframesData(QMap<int, int> keyframes) const
         }
         result << QString("%1=%2").arg(props.frames_to_time(i.key() + offset, mlt_time_clock)).arg(GenTime(i.value(), pCore->getCurrentFps()).seconds());
     }
-    return result.join(QLatin1Char(';'));
+    m_remapCacheSource = keyframes;
+    m_remapCacheData = result.join(QLatin1Char(';'));
+    return m_remapCacheData;
 }
 
 void RemapView::reloadProducer()
@@ -120,6 +120,11 @@ private:
     int m_clickEnd;
     int m_offset;
     QMutex m_kfrMutex;
+    /** @brief Coalesces time_map regeneration during a keyframe drag to keep a fluid preview */
+    QTimer m_previewTimer;
+    /** @brief Cache of the last serialized keyframes, the map is often serialized twice in a row unchanged */
+    mutable QMap<int, int> m_remapCacheSource;
+    mutable QString m_remapCacheData;
     QMap <int,int>m_selectedKeyframes;
     QMap<int,int>m_previousSelection;
     std::pair<int,int> getClosestKeyframe(int pos, bool bottomKeyframe = false) const;
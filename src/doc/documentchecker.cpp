@@ -16,7 +16,10 @@
 #include <KLocalizedString>
 
 #include <QCryptographicHash>
+#include <QDirIterator>
+#include <QSet>
 #include <QStandardPaths>
+#include <QtConcurrent/QtConcurrentMap>
 
 QDebug operator<<(QDebug qd, const DocumentChecker::DocumentResource &item)
 {
@@ -236,6 +239,8 @@ bool DocumentChecker::hasErrorInProject()
     const int taskCount = documentProducers.count() + documentChains.count() + documentTractors.count();
     Q_EMIT pCore->loadingMessageNewStage(i18n("Checking for missing items…"), taskCount);
 
+    prefetchFileChecks(documentProducers, documentChains);
+
     QStringList verifiedPaths;
     int max = documentProducers.count();
     for (int i = 0; i < max; ++i) {
@@ -414,6 +419,57 @@ bool DocumentChecker::hasErrorInProject()
 
 DocumentChecker::~DocumentChecker() {}
 
+void DocumentChecker::prefetchFileChecks(const QDomNodeList &producers, const QDomNodeList &chains)
+{
+    QSet<QString> candidates;
+    auto collect = [this, &candidates](const QDomNodeList &nodes) {
+        int max = nodes.count();
+        for (int i = 0; i < max; ++i) {
+            QDomElement e = nodes.item(i).toElement();
+            const QString resource = getProducerResource(e);
+            if (!resource.isEmpty()) {
+                candidates.insert(resource);
+                if (isSlideshow(resource)) {
+                    // For slideshows we check the parent folder
+                    candidates.insert(QFileInfo(resource).absolutePath());
+                }
+            }
+            const QString proxy = Xml::getXmlProperty(e, QStringLiteral("kdenlive:proxy"));
+            if (proxy.length() > 1) {
+                candidates.insert(ensureAbsolutePath(proxy));
+            }
+            QString original = Xml::getXmlProperty(e, QStringLiteral("kdenlive:originalurl"));
+            if (!original.isEmpty()) {
+                original = ensureAbsolutePath(original);
+                candidates.insert(original);
+                if (isSlideshow(original)) {
+                    candidates.insert(QFileInfo(original).absolutePath());
+                }
+            }
+        }
+    };
+    collect(producers);
+    collect(chains);
+    const QStringList paths(candidates.cbegin(), candidates.cend());
+    // One stat per unique path; slow (network) filesystems benefit most from running these concurrently
+    const QList<bool> results = QtConcurrent::blockingMapped(paths, [](const QString &path) { return QFileInfo::exists(path); });
+    for (int i = 0; i < paths.size(); ++i) {
+        m_pathExistsCache.insert(paths.at(i), results.at(i));
+    }
+}
+
+bool DocumentChecker::pathExists(const QString &path)
+{
+    auto it = m_pathExistsCache.constFind(path);
+    if (it != m_pathExistsCache.constEnd()) {
+        return it.value();
+    }
+    // Use QFileInfo to ensure we also handle directories (for slideshows)
+    const bool exists = QFileInfo::exists(path);
+    m_pathExistsCache.insert(path, exists);
+    return exists;
+}
+
 const QString DocumentChecker::relocateResource(QString sourceResource)
 {
     if (m_rootReplacement.first.isEmpty()) {
@@ -422,8 +478,7 @@ const QString DocumentChecker::relocateResource(QString sourceResource)
 
     if (sourceResource.startsWith(m_rootReplacement.first)) {
         sourceResource.replace(m_rootReplacement.first, m_rootReplacement.second);
-        // Use QFileInfo to ensure we also handle directories (for slideshows)
-        if (QFileInfo::exists(sourceResource)) {
+        if (pathExists(sourceResource)) {
             return sourceResource;
         }
         return QString();
@@ -456,8 +511,7 @@ const QString DocumentChecker::relocateResource(QString sourceResource)
     basePath.append(QLatin1Char('/'));
     basePath.append(cutResource.join(QLatin1Char('/')));
     qDebug() << "/// RESULTING PATH: " << basePath;
-    // Use QFileInfo to ensure we also handle directories (for slideshows)
-    if (QFileInfo::exists(basePath)) {
+    if (pathExists(basePath)) {
         return basePath;
     }
     return QString();
@@ -505,7 +559,7 @@ bool DocumentChecker::ensureProducerIsNotPlaceholder(QDomElement &producer)
     }
     resource = ensureAbsolutePath(resource);
 
-    if (!QFile::exists(resource)) {
+    if (!pathExists(resource)) {
         // The source clip is still not available
         return false;
     }
@@ -722,7 +776,7 @@ QString DocumentChecker::getMissingProducers(QDomElement &e, const QDomNodeList
     if (isBinClip && !proxy.isEmpty() && proxy.length() > 1) {
         bool proxyFound = true;
         proxy = ensureAbsolutePath(proxy);
-        if (!QFile::exists(proxy)) {
+        if (!pathExists(proxy)) {
             // Missing clip found
             // Check if proxy exists in current storage folder
             bool fixed = false;
@@ -757,7 +811,7 @@ QString DocumentChecker::getMissingProducers(QDomElement &e, const QDomNodeList
         item.clipId = clipId;
         item.clipType = clipType;
         item.status = MissingStatus::Missing;
-        if (!QFile::exists(original)) {
+        if (!pathExists(original)) {
             bool resourceFixed = false;
             QString movedOriginal = relocateResource(original);
             if (!movedOriginal.isEmpty()) {
@@ -765,7 +819,7 @@ QString DocumentChecker::getMissingProducers(QDomElement &e, const QDomNodeList
                     movedOriginal = QDir(movedOriginal).absoluteFilePath(QFileInfo(original).fileName());
                 }
                 Xml::setXmlProperty(e, QStringLiteral("kdenlive:originalurl"), movedOriginal);
-                if (!QFile::exists(producerResource)) {
+                if (!pathExists(producerResource)) {
                     Xml::setXmlProperty(e, QStringLiteral("resource"), movedOriginal);
                 }
                 resourceFixed = true;
@@ -820,12 +874,12 @@ QString DocumentChecker::getMissingProducers(QDomElement &e, const QDomNodeList
         }
     }
     const QStringList checkHashForService = {QLatin1String("qimage"), QLatin1String("pixbuf"), QLatin1String("glaxnimate")};
-    if (!QFile::exists(resource)) {
+    if (!pathExists(resource)) {
         if (service == QLatin1String("timewarp") && proxy == QLatin1String("-")) {
             // In some corrupted cases, clips with speed effect kept a reference to proxy clip in warp_resource
             QString original = Xml::getXmlProperty(e, QStringLiteral("kdenlive:originalurl"));
             original = ensureAbsolutePath(original);
-            if (original != resource && QFile::exists(original)) {
+            if (original != resource && pathExists(original)) {
                 // Fix timewarp producer
                 Xml::setXmlProperty(e, QStringLiteral("warp_resource"), original);
                 Xml::setXmlProperty(e, QStringLiteral("resource"), Xml::getXmlProperty(e, QStringLiteral("warp_speed")) + QStringLiteral(":") + original);
@@ -841,6 +895,12 @@ QString DocumentChecker::getMissingProducers(QDomElement &e, const QDomNodeList
         // Check if file changed
         const QByteArray hash = Xml::getXmlProperty(e, "kdenlive:file_hash").toLatin1();
         if (!hash.isEmpty()) {
+            // Only pay the content hash (which reads up to 2 MB per clip) when the cheap
+            // size comparison flags the file; an unchanged size means an unchanged clip
+            const QString storedSize = Xml::getXmlProperty(e, QStringLiteral("kdenlive:file_size"));
+            if (!slideshow && !storedSize.isEmpty() && storedSize == QString::number(QFileInfo(resource).size())) {
+                return producerResource;
+            }
             const QByteArray fileData =
                 slideshow ? ProjectClip::getFolderHash(QDir(resource), slidePattern).toHex() : ProjectClip::calculateHash(resource).first.toHex();
             if (hash != fileData) {
@@ -1085,6 +1145,29 @@ QString DocumentChecker::searchFileRecursively(const QDir &dir, const QString &m
     return foundFileName;
 }
 
+QMap<QString, QString> DocumentChecker::hashCandidateFiles(const QDir &dir, const QStringList &sizes)
+{
+    // Collect the files whose size matches a missing clip, they are the only hash candidates
+    QStringList candidates;
+    QDirIterator it(dir.absolutePath(), QDir::Files | QDir::Readable, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        const QString path = it.next();
+        if (sizes.contains(QString::number(it.fileInfo().size()))) {
+            candidates << path;
+        }
+    }
+    // Hash the candidates in parallel, using the same partial head/tail hash as stored in the project file
+    const QList<QPair<QString, QString>> hashes = QtConcurrent::blockingMapped(
+        candidates, [](const QString &path) { return qMakePair(QString::fromLatin1(ProjectClip::calculateHash(path).first.toHex()), path); });
+    QMap<QString, QString> matches;
+    for (const auto &hash : hashes) {
+        if (!hash.first.isEmpty() && !matches.contains(hash.first)) {
+            matches.insert(hash.first, hash.second);
+        }
+    }
+    return matches;
+}
+
 QString DocumentChecker::ensureAbsolutePath(QString filepath)
 {
     bool platformChange = false;
@@ -11,6 +11,7 @@
 
 #include <QDir>
 #include <QDomElement>
+#include <QHash>
 #include <QUrl>
 
 class DocumentChecker : public QObject
@@ -51,6 +52,10 @@ public:
     static QString searchPathRecursively(const QDir &dir, const QString &fileName, ClipType::ProducerType type = ClipType::Unknown);
     static QString searchFileRecursively(const QDir &dir, const QString &matchSize, const QString &matchHash, const QString &fileName);
     static QString searchDirRecursively(const QDir &dir, const QString &matchHash, const QString &fullName);
+    /** @brief Hash all files under @param dir whose size matches one of @param sizes, so candidate
+     *  matching does not re-read the search folder for every missing clip.
+     *  Hashing runs in a parallel pipeline, the result maps file hash to file path. */
+    static QMap<QString, QString> hashCandidateFiles(const QDir &dir, const QStringList &sizes);
 
     bool resolveProblemsWithGUI();
     /* @brief Get a count of missing items in each category */
@@ -73,6 +78,8 @@ private:
 
     QStringList m_binIds;
     QStringList m_warnings;
+    /** @brief Existence cache for resource paths, see pathExists() */
+    QHash<QString, bool> m_pathExistsCache;
 
     QString ensureAbsolutePath(QString filepath);
 
@@ -91,6 +98,13 @@ private:
      */
     bool ensureProducerIsNotPlaceholder(QDomElement &producer);
 
+    /** @brief Stat all candidate resource paths of the given producers in parallel and cache the results.
+     *  Existence checks are cheap locally but can take several milliseconds each on network mounts, so
+     *  doing them concurrently before the sequential producer scan avoids a long serial wait. */
+    void prefetchFileChecks(const QDomNodeList &producers, const QDomNodeList &chains);
+    /** @brief Cached replacement for QFile::exists(), warmed by prefetchFileChecks(). Also handles directories (for slideshows). */
+    bool pathExists(const QString &path);
+
     /** @brief Check for various missing elements */
     QString getMissingProducers(QDomElement &e, const QDomNodeList &entries, const QString &storageFolder);
     /** @brief Check if images and fonts in this clip exists, returns a list of images that do exist so we don't check twice. */
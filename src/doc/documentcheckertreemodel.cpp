@@ -66,6 +66,24 @@ void DocumentCheckerTreeModel::removeItem(const QModelIndex &ix)
 void DocumentCheckerTreeModel::slotSearchRecursively(const QString &newpath)
 {
     QDir searchDir(newpath);
+    // Hash all candidate files matching a missing clip's size in one parallel pass, instead of
+    // rescanning the search folder for every missing clip
+    QStringList wantedSizes;
+    QMapIterator<int, DocumentChecker::DocumentResource> h(m_resourceItems);
+    while (h.hasNext()) {
+        h.next();
+        if (h.value().status != DocumentChecker::MissingStatus::Missing && h.value().status != DocumentChecker::MissingStatus::MissingButProxy) {
+            continue;
+        }
+        if (h.value().type == DocumentChecker::MissingType::Clip && h.value().clipType != ClipType::SlideShow && !h.value().hash.isEmpty() &&
+            !h.value().fileSize.isEmpty()) {
+            wantedSizes << h.value().fileSize;
+        }
+    }
+    QMap<QString, QString> candidates;
+    if (!wantedSizes.isEmpty()) {
+        candidates = DocumentChecker::hashCandidateFiles(searchDir, wantedSizes);
+    }
     QMap<QModelIndex, QString> fixedMap;
     QMapIterator<int, DocumentChecker::DocumentResource> i(m_resourceItems);
     int counter = 1;
@@ -83,7 +101,7 @@ void DocumentCheckerTreeModel::slotSearchRecursively(const QString &newpath)
                 // Slideshows cannot be found with hash / size
                 newPath = DocumentChecker::searchDirRecursively(searchDir, i.value().hash, i.value().originalFilePath);
             } else {
-                newPath = DocumentChecker::searchFileRecursively(searchDir, i.value().fileSize, i.value().hash, i.value().originalFilePath);
+                newPath = candidates.value(i.value().hash);
             }
             if (newPath.isEmpty()) {
                 newPath = DocumentChecker::searchPathRecursively(searchDir, QUrl::fromLocalFile(i.value().originalFilePath).fileName(), type);
@@ -140,17 +140,13 @@ QPair<bool, QString> DocumentValidator::validate(const double currentVersion)
     qDebug() << "FOUND MLT PROJECT VERSION: " << mltMajorVersion << " / " << mltServiceVersion << " / " << mltPatchVersion;
     if (mltMajorVersion <= 7 && mltServiceVersion <= 15) {
         // MLT <= 7.15.0 used the mute_on_pause property that is now deprecated and breaks audio playback so remove it
-        QDomNodeList producers = m_doc.elementsByTagName(QStringLiteral("producer"));
-        QDomNodeList chains = m_doc.elementsByTagName(QStringLiteral("chain"));
-        int max = producers.count();
-        for (int i = 0; i < max; ++i) {
-            QDomElement t = producers.at(i).toElement();
-            Xml::removeXmlProperty(t, QStringLiteral("mute_on_pause"));
-        }
-        max = chains.count();
-        for (int i = 0; i < max; ++i) {
-            QDomElement t = chains.at(i).toElement();
-            Xml::removeXmlProperty(t, QStringLiteral("mute_on_pause"));
+        for (const QString &tag : {QStringLiteral("producer"), QStringLiteral("chain")}) {
+            QDomNodeList nodes = m_doc.elementsByTagName(tag);
+            int max = nodes.count();
+            for (int i = 0; i < max; ++i) {
+                QDomElement t = nodes.at(i).toElement();
+                Xml::removeXmlProperty(t, QStringLiteral("mute_on_pause"));
+            }
         }
     }
 
@@ -205,7 +201,7 @@ bool DocumentValidator::upgrade(double version, const double currentVersion)
     QDomElement infoXml;
     QDomNodeList docs = m_doc.elementsByTagName(QStringLiteral("kdenlivedoc"));
     if (!docs.isEmpty()) {
-        infoXmlNode = m_doc.elementsByTagName(QStringLiteral("kdenlivedoc")).at(0);
+        infoXmlNode = docs.at(0);
         infoXml = infoXmlNode.toElement();
         infoXml.setAttribute(QStringLiteral("upgraded"), 1);
     }
@@ -2061,24 +2057,32 @@ auto DocumentValidator::upgradeTo100(const QLocale &documentLocale) -> QString
             }
         };
 
-        // Fix attributes
-        QList<QString> tagsToFix = {"producer", "filter", "tractor", "entry", "transition", "blank"};
-        for (const QString &tag : tagsToFix) {
-            QDomNodeList elements = m_doc.elementsByTagName(tag);
-            for (int i = 0; i < elements.count(); i++) {
-                QDomElement el = elements.at(i).toElement();
+        // Fix attributes. A single walk over the tree replaces the former per-tag
+        // elementsByTagName() lookups, each of which traversed the whole document again.
+        const QSet<QString> tagsToFix = {QStringLiteral("producer"),   QStringLiteral("filter"), QStringLiteral("tractor"),
+                                         QStringLiteral("entry"),      QStringLiteral("transition"), QStringLiteral("blank")};
+        auto fixElement = [&fixAttribute, &tagsToFix](QDomElement &el) {
+            if (tagsToFix.contains(el.tagName())) {
                 fixAttribute(el, "in");
                 fixAttribute(el, "out");
                 fixAttribute(el, "length");
+            } else if (el.tagName() == QLatin1String("mlt") && el.hasAttribute("LC_NUMERIC")) {
+                qDebug() << "Removing LC_NUMERIC=" << el.attribute("LC_NUMERIC") << "from root node";
+                el.removeAttribute("LC_NUMERIC");
             }
-        }
-
-        auto mltElements = m_doc.elementsByTagName("mlt");
-        for (int i = 0; i < mltElements.count(); i++) {
-            QDomElement mltElement = mltElements.at(i).toElement();
-            if (mltElement.hasAttribute("LC_NUMERIC")) {
-                qDebug() << "Removing LC_NUMERIC=" << mltElement.attribute("LC_NUMERIC") << "from root node";
-                mltElement.removeAttribute("LC_NUMERIC");
+        };
+        QDomElement root = m_doc.documentElement();
+        fixElement(root);
+        QDomElement el = root.firstChildElement();
+        while (!el.isNull()) {
+            fixElement(el);
+            if (!el.firstChildElement().isNull()) {
+                el = el.firstChildElement();
+            } else {
+                while (!el.isNull() && el != root && el.nextSiblingElement().isNull()) {
+                    el = el.parentNode().toElement();
+                }
+                el = (el.isNull() || el == root) ? QDomElement() : el.nextSiblingElement();
             }
         }
 
@@ -2229,8 +2233,29 @@ bool DocumentValidator::isModified() const
 
 bool DocumentValidator::checkMovit()
 {
-    QString playlist = m_doc.toString();
-    if (!playlist.contains(QStringLiteral("movit."))) {
+    // Look for Movit services in the DOM instead of serializing the whole
+    // document to a string, which temporarily doubles memory usage on large
+    // projects just for this check
+    bool usesMovit = false;
+    const QDomNodeList allFilters = m_doc.elementsByTagName(QStringLiteral("filter"));
+    for (int i = 0; i < allFilters.count(); ++i) {
+        const QDomElement filt = allFilters.at(i).toElement();
+        if (filt.attribute(QStringLiteral("id")).startsWith(QLatin1String("movit.")) ||
+            Xml::getXmlProperty(filt, QStringLiteral("mlt_service")).startsWith(QLatin1String("movit."))) {
+            usesMovit = true;
+            break;
+        }
+    }
+    if (!usesMovit) {
+        const QDomNodeList allTransitions = m_doc.elementsByTagName(QStringLiteral("transition"));
+        for (int i = 0; i < allTransitions.count(); ++i) {
+            if (Xml::getXmlProperty(allTransitions.at(i).toElement(), QStringLiteral("mlt_service")).startsWith(QLatin1String("movit."))) {
+                usesMovit = true;
+                break;
+            }
+        }
+    }
+    if (!usesMovit) {
         // Project does not use Movit GLSL effects, we can load it
         return true;
     }
@@ -4,12 +4,18 @@
 */
 
 #include "docundostack.hpp"
+#include "kdenlivesettings.h"
+#include "utils/memorydiagnostics.h"
 #include <QUndoCommand>
 #include <QUndoGroup>
 
 DocUndoStack::DocUndoStack(QUndoGroup *parent)
     : QUndoStack(parent)
 {
+    // Every entry keeps the state captured by its undo / redo lambdas alive, so an
+    // unbounded stack can retain gigabytes over a long editing session. Dropping the
+    // oldest entries beyond the configured depth caps that retention.
+    setUndoLimit(qMax(0, KdenliveSettings::undohistorylimit()));
 }
 
 // TODO: custom undostack everywhere do that
@@ -19,4 +25,23 @@ void DocUndoStack::push(QUndoCommand *cmd)
         Q_EMIT invalidate(index());
     }
     QUndoStack::push(cmd);
+    // The stack owns the commands, report how many are alive (pushing can also drop
+    // redoable commands and entries beyond the undo limit)
+    MEM_DIAG_SET_ITEMS(MemoryDiagnostics::UndoStack, count());
+}
+
+void DocUndoStack::pushChunked(std::vector<std::pair<Fun, Fun>> steps, const QString &text)
+{
+    push(new ChunkedUndoCommand(std::move(steps), text));
+}
+
+void DocUndoStack::endCommandMerging()
+{
+    if (index() > 0 && index() == count()) {
+        if (auto *cmd = dynamic_cast<const MergeableUndoCommand *>(command(index() - 1))) {
+            // command() only hands out const pointers, but sealing does not alter the
+            // document state the command restores, only its merging behavior
+            const_cast<MergeableUndoCommand *>(cmd)->seal();
+        }
+    }
 }
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "undohelper.hpp"
+
 #include <QUndoCommand>
 
 class QUndoGroup;
@@ -16,6 +18,12 @@ class DocUndoStack : public QUndoStack
 public:
     explicit DocUndoStack(QUndoGroup *parent = Q_NULLPTR);
     void push(QUndoCommand *cmd);
+    /** @brief Push a composite operation as a list of atomic {undo, redo} steps. The steps are
+     *  replayed in time-sliced batches, so undoing a heavy operation keeps the interface responsive */
+    void pushChunked(std::vector<std::pair<Fun, Fun>> steps, const QString &text);
+    /** @brief Closes the current edit session: if the topmost command is mergeable it stops
+     *  coalescing with subsequently pushed commands, so the next session gets its own entry */
+    void endCommandMerging();
 Q_SIGNALS:
     void invalidate(int ix);
 };
@@ -42,6 +42,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 
 #include "kdenlive_debug.h"
 #include <QCryptographicHash>
+#include <QDataStream>
 #include <QDomImplementation>
 #include <QFile>
 #include <QFileDialog>
@@ -49,6 +50,8 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include <QJsonObject>
 #include <QSaveFile>
 #include <QStandardPaths>
+#include <QTextStream>
+#include <QtConcurrent/QtConcurrentRun>
 #include <QUndoGroup>
 #include <QUndoStack>
 #include <memory>
@@ -65,6 +68,59 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 // Increasing the document version means that older Kdenlive versions won't be able to open the project files
 const double DOCUMENTVERSION = 1.1;
 
+namespace {
+// A small versioned binary stamp is written to the cache dir on every save; when it still
+// matches the project file on reopen we know the file was written by this document version
+// and is unchanged since, so the validator's upgrade pass can be skipped
+const quint32 STAMPMAGIC = 0x4b444e53;
+const qint32 STAMPVERSION = 1;
+
+QString documentStampPath(const QString &projectFile)
+{
+    const QString dir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/documentstamps");
+    QDir().mkpath(dir);
+    const QString hash = QString::fromLatin1(QCryptographicHash::hash(projectFile.toUtf8(), QCryptographicHash::Md5).toHex());
+    return dir + QLatin1Char('/') + hash + QStringLiteral(".stamp");
+}
+
+void writeDocumentStamp(const QString &projectFile)
+{
+    QFileInfo info(projectFile);
+    QFile file(documentStampPath(projectFile));
+    if (!file.open(QIODevice::WriteOnly)) {
+        return;
+    }
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_15);
+    out << STAMPMAGIC << STAMPVERSION << DOCUMENTVERSION << qint64(info.size()) << info.lastModified();
+}
+
+bool documentStampMatches(const QString &projectFile)
+{
+    QFile file(documentStampPath(projectFile));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_15);
+    quint32 magic = 0;
+    qint32 stampVersion = 0;
+    double docVersion = 0.;
+    qint64 size = -1;
+    QDateTime modified;
+    in >> magic >> stampVersion;
+    if (magic != STAMPMAGIC || stampVersion != STAMPVERSION) {
+        return false;
+    }
+    in >> docVersion >> size >> modified;
+    if (in.status() != QDataStream::Ok) {
+        return false;
+    }
+    QFileInfo info(projectFile);
+    return qFuzzyCompare(docVersion, DOCUMENTVERSION) && info.size() == size && info.lastModified() == modified;
+}
+} // namespace
+
 // The index for all timeline objects
 int KdenliveDoc::next_id = 0;
 
@@ -229,7 +285,18 @@ DocOpenResult KdenliveDoc::Open(const QUrl &url, const QString &projectFolder, Q
         return result;
     }
 
-    auto validationResult = validator.validate(DOCUMENTVERSION);
+    QPair<bool, QString> validationResult = {true, QString()};
+    if (KdenliveSettings::fastprojectreopen() && documentStampMatches(url.toLocalFile())) {
+        // The file was written by this document version and is unchanged since the last
+        // save, skip the validator's upgrade pass. Only replicate its root directory fixup
+        qCDebug(KDENLIVE_LOG) << "// project unchanged since last save, skipping validation";
+        QDomElement mltRoot = domDoc.firstChildElement(QStringLiteral("mlt"));
+        if (mltRoot.attribute(QStringLiteral("root")).isEmpty()) {
+            mltRoot.setAttribute(QStringLiteral("root"), url.adjusted(QUrl::RemoveFilename | QUrl::StripTrailingSlash).toLocalFile());
+        }
+    } else {
+        validationResult = validator.validate(DOCUMENTVERSION);
+    }
     success = validationResult.first;
     if (!success) {
         result.setError(i18n("File %1 is not a valid Kdenlive project file.", url.toLocalFile()));
@@ -335,6 +402,8 @@ KdenliveDoc::~KdenliveDoc()
     m_timelines.clear();
     // qCDebug(KDENLIVE_LOG) << "// DEL CLP MAN done";
     if (m_autosave) {
+        // An autosave write may still be in progress in a worker thread
+        m_autosaveFuture.waitForFinished();
         if (!m_autosave->fileName().isEmpty()) {
             m_autosave->remove();
         }
@@ -435,7 +504,13 @@ const QByteArray KdenliveDoc::getAndClearProjectXml()
 {
     // Profile has already been set, dont overwrite it
     m_document.documentElement().removeChild(m_document.documentElement().firstChildElement(QLatin1String("profile")));
-    const QByteArray result = m_document.toString().toUtf8();
+    // Serialize straight to UTF-8; going through toString() would hold an
+    // additional UTF-16 copy of the whole project next to the DOM, which
+    // matters for very large project files
+    QByteArray result;
+    QTextStream stream(&result, QIODevice::WriteOnly);
+    m_document.save(stream, 1);
+    stream.flush();
     // We don't need the xml data anymore, throw away
     m_document.clear();
     return result;
@@ -581,11 +656,28 @@ void KdenliveDoc::slotAutoSave(const QString &scene)
             KMessageBox::error(QApplication::activeWindow(), i18n("Cannot write to file %1, scene list is corrupted.", m_autosave->fileName()));
             return;
         }
-        m_autosave->resize(0);
-        if (m_autosave->write(scene.toUtf8()) < 0) {
-            pCore->displayMessage(i18n("Cannot create autosave file %1", m_autosave->fileName()), ErrorMessage);
+        // Ensure a previous autosave write is not still running before touching the file
+        m_autosaveFuture.waitForFinished();
+        const size_t sceneHash = qHash(scene);
+        if (sceneHash == m_autosaveSceneHash) {
+            // Project did not change since the last autosave, keep the existing file
+            return;
         }
-        m_autosave->flush();
+        // The UTF-8 conversion and disk write can take seconds on big projects, so
+        // run them in a worker thread to keep the UI responsive. Access to m_autosave
+        // is serialized by waiting on the future before every other use of the file.
+        m_autosaveFuture = QtConcurrent::run([this, scene, sceneHash]() {
+            m_autosave->resize(0);
+            if (m_autosave->write(scene.toUtf8()) < 0 || !m_autosave->flush()) {
+                // Keep the previous hash so the next autosave rewrites the file
+                // instead of skipping the identical scene over a truncated copy
+                QMetaObject::invokeMethod(
+                    this, [this]() { pCore->displayMessage(i18n("Cannot create autosave file %1", m_autosave->fileName()), ErrorMessage); },
+                    Qt::QueuedConnection);
+                return;
+            }
+            m_autosaveSceneHash = sceneHash;
+        });
     }
 }
 
@@ -759,13 +851,17 @@ bool KdenliveDoc::saveSceneList(const QString &path, const QString &scene, bool
         return false;
     }
 
-    const QByteArray sceneData = sceneList.toString().toUtf8();
-
-    file.write(sceneData);
-    if (!file.commit()) {
+    // Stream the document straight into the save file; serializing to an
+    // intermediate string first would hold a second full copy of the project in memory
+    QTextStream stream(&file);
+    sceneList.save(stream, 1);
+    stream.flush();
+    if (stream.status() != QTextStream::Ok || !file.commit()) {
         KMessageBox::error(QApplication::activeWindow(), i18n("Cannot write to file %1", path));
         return false;
     }
+    // Record the saved file's identity so an unchanged project can skip validation on reopen
+    writeDocumentStamp(path);
     cleanupBackupFiles();
     QFileInfo info(path);
     QString fileName = QUrl::fromLocalFile(path).fileName().section(QLatin1Char('.'), 0, -2);
@@ -1405,6 +1501,21 @@ void KdenliveDoc::backupLastSavedVersion(const QString &path)
     fileName.append(QStringLiteral(".kdenlive"));
     QString backupFile = backupFolder.absoluteFilePath(fileName);
     if (file.exists()) {
+        // Don't copy if the file content did not change since the last backup; repeated
+        // saves of an unchanged project would otherwise fill the backup folder with
+        // identical copies
+        QByteArray fileHash;
+        QFile source(path);
+        if (source.open(QIODevice::ReadOnly)) {
+            QCryptographicHash hash(QCryptographicHash::Md5);
+            if (hash.addData(&source)) {
+                fileHash = hash.result();
+            }
+        }
+        if (!fileHash.isEmpty() && fileHash == m_lastBackupHash) {
+            return;
+        }
+        m_lastBackupHash = fileHash;
         // delete previous backup if it was done less than 60 seconds ago
         QFile::remove(backupFile);
         if (!QFile::copy(path, backupFile)) {
@@ -15,6 +15,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include <KJob>
 #include <QAction>
 #include <QDir>
+#include <QFuture>
 #include <QList>
 #include <QMap>
 #include <QObject>
@@ -114,6 +115,12 @@ public:
     int height() const;
     QUrl url() const;
     KAutoSaveFile *m_autosave;
+    /** @brief Tracks the worker thread performing the autosave disk write, see slotAutoSave() */
+    QFuture<void> m_autosaveFuture;
+    /** @brief Hash of the last autosaved scene list, used to skip rewrites when nothing changed */
+    size_t m_autosaveSceneHash{0};
+    /** @brief Content hash of the last project file copied to the backup folder, used to skip duplicate backups */
+    QByteArray m_lastBackupHash;
     /** @brief Whether the project folder should be in the same folder as the project file (var is only used for new projects)*/
     bool m_sameProjectFolder;
     Timecode timecode() const;
@@ -5,6 +5,7 @@
 
 #include "effectsrepository.hpp"
 #include "assets/assetlist/view/assetlistwidget.hpp"
+#include "assets/model/assetparametermodel.hpp"
 #include "core.h"
 #include "kdenlivesettings.h"
 #include "profiles/profilemodel.hpp"
@@ -232,6 +233,11 @@ QString EffectsRepository::assetPreferredListPath() const
     return QStringLiteral(":data/preferred_effects.txt");
 }
 
+QString EffectsRepository::assetCachePath() const
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/effectsrepository");
+}
+
 bool EffectsRepository::isPreferred(const QString &effectId) const
 {
     return m_preferred_list.contains(effectId);
@@ -278,6 +284,8 @@ QPair<QString, QString> EffectsRepository::reloadCustom(const QString &path)
         m_assets[custom.first] = custom.second;
         result.first = custom.first;
         result.second = custom.second.mltId;
+        // Parameter titles may have changed, drop the memoized translations
+        AssetParameterModel::invalidateTitleCache(custom.first);
     }
     return result;
 }
@@ -437,6 +445,7 @@ void EffectsRepository::deleteEffect(const QString &id)
     if (file.exists()) {
         file.remove();
         m_assets.erase(id);
+        AssetParameterModel::invalidateTitleCache(id);
     }
 }
 
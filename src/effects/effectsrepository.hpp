@@ -65,6 +65,9 @@ protected:
     /** @brief Returns the path to the effects' preferred list*/
     QString assetPreferredListPath() const override;
 
+    /** @brief Returns the path of the on-disk parsed effect cache*/
+    QString assetCachePath() const override;
+
     QStringList assetDirs() const override;
 
     void parseType(Mlt::Properties *metadata, Info &res) override;
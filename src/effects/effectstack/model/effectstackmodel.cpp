@@ -418,6 +418,7 @@ bool EffectStackModel::fromXml(const QDomElement &effectsXml, Fun &undo, Fun &re
                     }
                 }
             }
+            bakeFadeAnimation(effect->filter());
         } else if (effectId.startsWith(QLatin1String("fadeout")) || effectId.startsWith(QLatin1String("fade_to_"))) {
             m_fadeOuts.insert(effect->getId());
             int duration = effect->filter().get_length() - 1;
@@ -444,6 +445,7 @@ bool EffectStackModel::fromXml(const QDomElement &effectsXml, Fun &undo, Fun &re
                     }
                 }
             }
+            bakeFadeAnimation(effect->filter());
         }
         local_redo();
         effectAdded = true;
@@ -819,6 +821,18 @@ bool EffectStackModel::adjustStackLength(bool adjustFromEnd, int oldIn, int oldD
     return true;
 }
 
+// static
+void EffectStackModel::bakeFadeAnimation(Mlt::Filter &filter)
+{
+    const int length = filter.get_length();
+    if (QString(filter.get("alpha")).contains(QLatin1Char('='))) {
+        filter.anim_get_double("alpha", 0, length);
+    }
+    if (QString(filter.get("level")).contains(QLatin1Char('='))) {
+        filter.anim_get_double("level", 0, length);
+    }
+}
+
 bool EffectStackModel::adjustFadeLength(int duration, bool fromStart, bool audioFade, bool videoFade, bool logUndo)
 {
     QWriteLocker locker(&m_lock);
@@ -870,6 +884,7 @@ bool EffectStackModel::adjustFadeLength(int duration, bool fromStart, bool audio
                         effect->filter().set("alpha", "0=0;-1=1");
                     }
                 }
+                bakeFadeAnimation(effect->filter());
             }
         }
         if (!indexes.isEmpty()) {
@@ -933,6 +948,7 @@ bool EffectStackModel::adjustFadeLength(int duration, bool fromStart, bool audio
                         effect->filter().set("alpha", "0=1;-1=0");
                     }
                 }
+                bakeFadeAnimation(effect->filter());
             }
         }
         if (!indexes.isEmpty()) {
@@ -1087,10 +1103,21 @@ void EffectStackModel::moveEffect(int destRow, const std::shared_ptr<AbstractEff
     int itemId = item->getId();
     Q_ASSERT(m_allItems.count(itemId) > 0);
     int oldRow = item->row();
-    Fun redo = moveItem_lambda(itemId, destRow);
+    // Swap the filter chain between two frames so a running consumer is not interrupted
+    Fun redo = [this, oper = moveItem_lambda(itemId, destRow)]() {
+        lockServices();
+        bool result = oper();
+        unlockServices();
+        return result;
+    };
     bool res = redo();
     if (res) {
-        Fun undo = moveItem_lambda(itemId, oldRow);
+        Fun undo = [this, oper = moveItem_lambda(itemId, oldRow)]() {
+            lockServices();
+            bool result = oper();
+            unlockServices();
+            return result;
+        };
         Fun update_redo = [this, row = destRow > oldRow ? destRow - 1 : destRow]() {
             setActiveEffect(row);
             Q_EMIT this->dataChanged(QModelIndex(), QModelIndex(), {TimelineModel::EffectNamesRole});
@@ -1109,6 +1136,30 @@ void EffectStackModel::moveEffect(int destRow, const std::shared_ptr<AbstractEff
     }
 }
 
+void EffectStackModel::lockServices()
+{
+    if (auto srv = m_masterService.lock()) {
+        srv->lock();
+    }
+    for (const auto &service : m_childServices) {
+        if (auto srv = service.lock()) {
+            srv->lock();
+        }
+    }
+}
+
+void EffectStackModel::unlockServices()
+{
+    for (auto it = m_childServices.rbegin(); it != m_childServices.rend(); ++it) {
+        if (auto srv = it->lock()) {
+            srv->unlock();
+        }
+    }
+    if (auto srv = m_masterService.lock()) {
+        srv->unlock();
+    }
+}
+
 void EffectStackModel::registerItem(const std::shared_ptr<TreeItem> &item)
 {
     QWriteLocker locker(&m_lock);
@@ -1122,6 +1173,7 @@ void EffectStackModel::registerItem(const std::shared_ptr<TreeItem> &item)
         }
         if (!m_loadingExisting) {
             // qDebug() << "$$$$$$$$$$$$$$$$$$$$$ Planting effect in " << m_childServices.size();
+            lockServices();
             effectItem->plant(m_masterService);
             // Check if we have an internal effect that needs to stay on top
             if (m_ownerId.type == KdenliveObjectType::Master || m_ownerId.type == KdenliveObjectType::TimelineTrack) {
@@ -1145,6 +1197,7 @@ void EffectStackModel::registerItem(const std::shared_ptr<TreeItem> &item)
                 // qDebug() << "$$$$$$$$$$$$$$$$$$$$$ Planting CLONE effect in " << (void *)service.lock().get();
                 effectItem->plantClone(service);
             }
+            unlockServices();
         }
         effectItem->setEffectStackEnabled(m_effectStackEnabled);
         const QString &effectId = effectItem->getAssetId();
@@ -1166,10 +1219,12 @@ void EffectStackModel::deregisterItem(int id, TreeItem *item)
     QWriteLocker locker(&m_lock);
     if (!item->isRoot()) {
         auto effectItem = static_cast<AbstractEffectItem *>(item);
+        lockServices();
         effectItem->unplant(m_masterService);
         for (const auto &service : m_childServices) {
             effectItem->unplantClone(service);
         }
+        unlockServices();
         if (!effectItem->isAudio()) {
             pCore->refreshProjectItem(m_ownerId);
             pCore->invalidateItem(m_ownerId);
@@ -1212,15 +1267,62 @@ bool EffectStackModel::importEffects(const std::shared_ptr<EffectStackModel> &so
     bool found = false;
     bool effectEnabled = rootItem->childCount() > 0;
     int imported = 0;
+    // NO undo. this should only be used on project opening or when cutting a clip
     for (int i = 0; i < sourceStack->rowCount(); i++) {
         auto item = sourceStack->getEffectStackRow(i);
-        // NO undo. this should only be used on project opening
-        if (copyEffect(item, state, false)) {
+        if (item->childCount() > 0) {
+            // TODO: group
+            continue;
+        }
+        std::shared_ptr<EffectItemModel> sourceEffect = std::static_pointer_cast<EffectItemModel>(item);
+        bool audioEffect = sourceEffect->isAudio();
+        if ((state == PlaylistState::VideoOnly && audioEffect) || (state == PlaylistState::AudioOnly && !audioEffect)) {
+            // This effect cannot be used
+            continue;
+        }
+        const QString effectId = sourceEffect->getAssetId();
+        if (m_ownerId.type == KdenliveObjectType::TimelineClip && EffectsRepository::get()->isUnique(effectId) && hasFilter(effectId)) {
+            pCore->displayMessage(i18n("Effect %1 cannot be added twice.", EffectsRepository::get()->getName(effectId)), ErrorMessage);
+            continue;
+        }
+        bool enabled = sourceEffect->isEnabled();
+        // Clone the source filter at the MLT property level instead of re-creating the asset and
+        // copying the parameters one by one; this is what keeps cutting a clip with a large effect
+        // stack cheap, since the parameter/keyframe strings are not reparsed for the copy
+        std::unique_ptr<Mlt::Filter> asset = EffectsRepository::get()->getEffect(effectId);
+        asset->inherit(sourceEffect->filter());
+        auto effect = EffectItemModel::construct(std::move(asset), shared_from_this(), QString());
+        if (!enabled) {
+            effect->filter().set("disable", 1);
+        }
+        if (m_ownerId.type == KdenliveObjectType::TimelineTrack || m_ownerId.type == KdenliveObjectType::Master) {
+            effect->filter().set("in", 0);
+            effect->filter().set("out", pCore->getItemDuration(m_ownerId) - 1);
+        }
+        connect(effect.get(), &AssetParameterModel::modelChanged, this, &EffectStackModel::modelChanged);
+        connect(effect.get(), &AssetParameterModel::replugEffect, this, &EffectStackModel::replugEffect, Qt::DirectConnection);
+        connect(effect.get(), &AssetParameterModel::showEffectZone, this, &EffectStackModel::updateEffectZones);
+        Fun redo = addItem_lambda(effect, rootItem->getId());
+        effect->prepareKeyframes();
+        if (redo()) {
             found = true;
-            if (item->isEnabled()) {
+            if (enabled) {
                 effectEnabled = true;
             }
             imported++;
+            if (effectId.startsWith(QLatin1String("fadein")) || effectId.startsWith(QLatin1String("fade_from_"))) {
+                m_fadeIns.insert(effect->getId());
+                int duration = effect->filter().get_length() - 1;
+                int in = pCore->getItemIn(m_ownerId);
+                effect->filter().set("in", in);
+                effect->filter().set("out", in + duration);
+            } else if (effectId.startsWith(QLatin1String("fadeout")) || effectId.startsWith(QLatin1String("fade_to_"))) {
+                m_fadeOuts.insert(effect->getId());
+                int duration = effect->filter().get_length() - 1;
+                int out = pCore->getItemIn(m_ownerId) + pCore->getItemDuration(m_ownerId) - 1;
+                effect->filter().set("in", out - duration);
+                effect->filter().set("out", out);
+            }
         }
     }
     if (!effectEnabled && imported == 0) {
@@ -1606,6 +1708,21 @@ const QString EffectStackModel::effectNames() const
     return effects.join(QLatin1Char('/'));
 }
 
+const QString EffectStackModel::parametersHash() const
+{
+    QStringList data;
+    for (int i = 0; i < rootItem->childCount(); ++i) {
+        auto effect = std::static_pointer_cast<EffectItemModel>(rootItem->child(i));
+        QStringList params = {effect->getAssetId(), QString::number(effect->isEnabled())};
+        const QVector<QPair<QString, QVariant>> values = effect->getAllParameters();
+        for (const auto &param : values) {
+            params << param.first << param.second.toString();
+        }
+        data << params.join(QLatin1Char(','));
+    }
+    return QString::number(qHash(data.join(QLatin1Char(';'))), 16);
+}
+
 QStringList EffectStackModel::externalFiles() const
 {
     QStringList urls;
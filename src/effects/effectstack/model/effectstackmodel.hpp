@@ -116,6 +116,10 @@ public:
     /** @brief Returns a comma separated list of effect names */
     const QString effectNames() const;
 
+    /** @brief Returns a hash of all effect ids, enabled states and parameter values in the stack,
+     *  used to recognize when the stack returns to a recently displayed state */
+    const QString parametersHash() const;
+
     /** @brief Returns a list of external file urls used by the effects (e.g. LUTs) */
     QStringList externalFiles() const;
 
@@ -189,6 +193,14 @@ private:
      *          true will prevent planting in the producer */
     bool m_loadingExisting;
     bool doAppendEffect(const QString &effectId, bool makeCurrent, stringMap params, Fun &undo, Fun &redo);
+    /** @brief Force MLT to compile a fade's level/alpha ramp into its binary animation
+     *  now, at edit time, so the render thread does not pay the property string parse
+     *  on the first frame after the change */
+    static void bakeFadeAnimation(Mlt::Filter &filter);
+    /** @brief Hold the MLT locks of the master and child services so a running consumer only sees
+     *  the updated filter chain at the next frame boundary */
+    void lockServices();
+    void unlockServices();
 
 private Q_SLOTS:
     /** @brief: Some effects do not support dynamic changes like sox, and need to be unplugged / replugged on each param change
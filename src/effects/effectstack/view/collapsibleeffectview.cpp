@@ -44,6 +44,7 @@ CollapsibleEffectView::CollapsibleEffectView(const QString &effectName, const st
     , m_view(nullptr)
     , m_model(effectModel)
     , m_blockWheel(false)
+    , m_sourceFrameSize(frameSize)
 {
     const QString effectId = effectModel->getAssetId();
     buttonUp->setIcon(QIcon::fromTheme(QStringLiteral("selection-raise")));
@@ -193,7 +194,6 @@ CollapsibleEffectView::CollapsibleEffectView(const QString &effectName, const st
 
     m_view = new AssetParameterView(this);
     const std::shared_ptr<AssetParameterModel> effectParamModel = std::static_pointer_cast<AssetParameterModel>(effectModel);
-    m_view->setModel(effectParamModel, frameSize);
     connect(m_view, &AssetParameterView::seekToPos, this, &AbstractCollapsibleWidget::seekToPos);
     connect(m_view, &AssetParameterView::activateEffect, this, [this]() {
         if (!decoframe->property("active").toBool()) {
@@ -208,8 +208,16 @@ CollapsibleEffectView::CollapsibleEffectView(const QString &effectName, const st
     }
 
     connect(m_view, &AssetParameterView::updateHeight, this, &CollapsibleEffectView::updateHeight);
-    connect(this, &CollapsibleEffectView::refresh, m_view, &AssetParameterView::slotRefresh);
-    keyframesButton->setVisible(m_view->keyframesAllowed());
+    // The parameter widgets are not built yet, so check the model for animated params
+    bool hasAnimatedParam = false;
+    for (int i = 0; i < effectParamModel->rowCount(); ++i) {
+        auto type = effectParamModel->data(effectParamModel->index(i, 0), AssetParameterModel::TypeRole).value<ParamType>();
+        if (AssetParameterModel::isAnimated(type)) {
+            hasAnimatedParam = true;
+            break;
+        }
+    }
+    keyframesButton->setVisible(hasAnimatedParam);
     auto *lay = new QVBoxLayout(widgetFrame);
     lay->setContentsMargins(0, 0, 0, 0);
     lay->setSpacing(0);
@@ -224,7 +232,6 @@ CollapsibleEffectView::CollapsibleEffectView(const QString &effectName, const st
     }
 
     if (m_model->isKeyframesHidden()) {
-        m_view->toggleKeyframes(false);
         m_keyframesButton->setActive(true);
     }
     // Presets
@@ -232,6 +239,8 @@ CollapsibleEffectView::CollapsibleEffectView(const QString &effectName, const st
     presetButton->setMenu(m_view->presetMenu());
     presetButton->setToolTip(i18n("Presets"));
     presetButton->setWhatsThis(xi18nc("@info:whatsthis", "Opens a list of advanced options to manage presets for the effect."));
+    // The preset menu is only filled once the parameter view is built
+    connect(m_view->presetMenu(), &QMenu::aboutToShow, this, &CollapsibleEffectView::loadParamView);
 
     connect(saveEffectButton, &QAbstractButton::clicked, this, [this]() { slotSaveEffect(); });
     saveEffectButton->setIcon(QIcon::fromTheme(QStringLiteral("document-save")));
@@ -252,6 +261,11 @@ CollapsibleEffectView::CollapsibleEffectView(const QString &effectName, const st
     connect(buttonDown, &QAbstractButton::clicked, this, &CollapsibleEffectView::slotEffectDown);
     connect(buttonDel, &QAbstractButton::clicked, this, &CollapsibleEffectView::slotDeleteEffect);
 
+    if (!m_model->isCollapsed()) {
+        // Only build the parameter widgets of expanded effects, collapsed ones are built on demand
+        loadParamView();
+    }
+
     for (QSpinBox *sp : findChildren<QSpinBox *>()) {
         sp->installEventFilter(this);
         sp->setFocusPolicy(Qt::StrongFocus);
@@ -280,6 +294,41 @@ CollapsibleEffectView::~CollapsibleEffectView()
     qDebug() << "deleting collapsibleeffectview";
 }
 
+void CollapsibleEffectView::loadParamView()
+{
+    if (m_paramsLoaded) {
+        return;
+    }
+    m_paramsLoaded = true;
+    const std::shared_ptr<AssetParameterModel> effectParamModel = std::static_pointer_cast<AssetParameterModel>(m_model);
+    m_view->setModel(effectParamModel, m_sourceFrameSize);
+    connect(this, &CollapsibleEffectView::refresh, m_view, &AssetParameterView::slotRefresh);
+    keyframesButton->setVisible(m_view->keyframesAllowed());
+    if (m_model->isKeyframesHidden()) {
+        m_view->toggleKeyframes(false);
+    }
+    for (QSpinBox *sp : m_view->findChildren<QSpinBox *>()) {
+        sp->installEventFilter(this);
+        sp->setFocusPolicy(Qt::StrongFocus);
+    }
+    for (QComboBox *cb : m_view->findChildren<QComboBox *>()) {
+        cb->installEventFilter(this);
+        cb->setFocusPolicy(Qt::StrongFocus);
+    }
+    for (QProgressBar *cb : m_view->findChildren<QProgressBar *>()) {
+        cb->installEventFilter(this);
+        cb->setFocusPolicy(Qt::StrongFocus);
+    }
+    for (WheelContainer *cb : m_view->findChildren<WheelContainer *>()) {
+        cb->installEventFilter(this);
+        cb->setFocusPolicy(Qt::StrongFocus);
+    }
+    for (QDoubleSpinBox *cb : m_view->findChildren<QDoubleSpinBox *>()) {
+        cb->installEventFilter(this);
+        cb->setFocusPolicy(Qt::StrongFocus);
+    }
+}
+
 void CollapsibleEffectView::updateGroupedInstances()
 {
     int groupedInstances = 0;
@@ -415,6 +464,10 @@ bool CollapsibleEffectView::isEnabled() const
 
 void CollapsibleEffectView::slotActivateEffect(bool active)
 {
+    if (active) {
+        // The monitor scene and keyframe view require the parameter widgets
+        loadParamView();
+    }
     decoframe->setProperty("active", active);
     decoframe->setStyleSheet(decoframe->styleSheet());
     if (active) {
@@ -650,6 +703,7 @@ QDomDocument CollapsibleEffectView::toXml() const
 
 void CollapsibleEffectView::slotResetEffect()
 {
+    loadParamView();
     m_view->resetValues();
 }
 
@@ -672,6 +726,13 @@ void CollapsibleEffectView::switchCollapsed(int row)
 
 void CollapsibleEffectView::slotSwitch(bool collapse)
 {
+    if (!collapse && !m_paramsLoaded) {
+        // Build the parameter widgets on first expansion, then let a layout pass run
+        // before measuring the view's height
+        loadParamView();
+        QMetaObject::invokeMethod(this, "slotSwitch", Qt::QueuedConnection, Q_ARG(bool, collapse));
+        return;
+    }
     widgetFrame->setFixedHeight(collapse ? 0 : m_view->height());
     zoneFrame->setFixedHeight(collapse || !m_inOutButton->isChecked() ? 0 : frame->height());
     setFixedHeight(widgetFrame->height() + frame->minimumHeight() + zoneFrame->height() + 2 * (contentsMargins().top() + decoframe->lineWidth()));
@@ -885,7 +946,7 @@ void CollapsibleEffectView::adjustButtons(int ix, int max)
 
 MonitorSceneType CollapsibleEffectView::needsMonitorEffectScene() const
 {
-    if (!m_model->isEnabled() || !m_view) {
+    if (!m_model->isEnabled() || !m_view || !m_paramsLoaded) {
         return MonitorSceneDefault;
     }
     return m_view->needsMonitorEffectScene();
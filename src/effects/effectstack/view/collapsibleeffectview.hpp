@@ -118,6 +118,9 @@ private Q_SLOTS:
     void slotHideKeyframes(bool hide);
 
 private:
+    /** @brief Build the effect's parameter widgets. This is the expensive part of loading a stack,
+     *  so it is deferred for collapsed effects until they are expanded or activated. */
+    void loadParamView();
     AssetParameterView *m_view;
     std::shared_ptr<EffectItemModel> m_model;
     KDualAction *m_collapse;
@@ -130,6 +133,9 @@ private:
     QMenu *m_menu;
     bool m_isMovable;
     bool m_blockWheel;
+    /** @brief True once the parameter widgets were built, see loadParamView() */
+    bool m_paramsLoaded{false};
+    QSize m_sourceFrameSize;
     /** @brief The add group action. */
     QAction *m_groupAction;
     KDualAction *m_enabledButton;
@@ -10,7 +10,6 @@
 #include "bin/projectitemmodel.h"
 #include "core.h"
 #include "dialogs/kdenlivesettingsdialog.h"
-#include "doc/kthumb.h"
 #include "kdenlivesettings.h"
 #include "mainwindow.h"
 #include "timeline2/view/timelinewidget.h"
@@ -170,11 +169,10 @@ void GlaxnimateLauncher::onReadyRead()
             // Temporarily hide this title clip in timeline so that it does not appear when requesting background frame
             pCore->temporaryUnplug(clips, true);
             std::unique_ptr<Mlt::Frame> frame(pCore->window()->getCurrentTimeline()->model()->producer().get()->get_frame());
-            QImage temp = KThumb::getFrame(frame.get(), pCore->getCurrentFrameSize().width(), pCore->getCurrentFrameSize().height());
-            pCore->temporaryUnplug(clips, false);
-            if (copyToShared(temp)) {
+            if (copyFrameToShared(frame.get())) {
                 m_parent->m_frameNum = frameNum;
             }
+            pCore->temporaryUnplug(clips, false);
         }
     }
 }
@@ -193,20 +191,37 @@ void GlaxnimateLauncher::onSocketError(QLocalSocket::LocalSocketError socketErro
     }
 }
 
-bool GlaxnimateLauncher::copyToShared(const QImage &image)
+bool GlaxnimateLauncher::copyFrameToShared(Mlt::Frame *frame)
+{
+    if (frame == nullptr || !frame->is_valid()) {
+        return false;
+    }
+    int width = pCore->getCurrentFrameSize().width();
+    int height = pCore->getCurrentFrameSize().height();
+    mlt_image_format format = mlt_image_rgba;
+    const uchar *imagedata = frame->get_image(format, width, height);
+    if (imagedata == nullptr) {
+        return false;
+    }
+    // MLT's RGBA byte order matches QImage::Format_RGBA8888, so the frame buffer can be
+    // shared as is without the ARGB conversion and swizzle passes
+    return writeToShared(width, height, QImage::Format_RGBA8888, width * 4, imagedata, width * height * 4);
+}
+
+bool GlaxnimateLauncher::writeToShared(qint32 width, qint32 height, qint32 imageFormat, qint32 bytesPerLine, const uchar *data, qint32 dataSize)
 {
     if (!m_sharedMemory) {
         return false;
     }
-    qint32 sizeInBytes = image.sizeInBytes() + 4 * sizeof(qint32);
+    qint32 sizeInBytes = dataSize + 4 * sizeof(qint32);
     if (sizeInBytes > m_sharedMemory->size()) {
         if (m_sharedMemory->isAttached()) {
             m_sharedMemory->lock();
             m_sharedMemory->detach();
             m_sharedMemory->unlock();
         }
-        // over-allocate to avoid recreating
-        if (!m_sharedMemory->create(sizeInBytes)) {
+        // over-allocate to avoid recreating on small frame size changes
+        if (!m_sharedMemory->create(sizeInBytes + sizeInBytes / 4)) {
             qDebug() << m_sharedMemory->errorString();
             return false;
         }
@@ -216,27 +231,23 @@ bool GlaxnimateLauncher::copyToShared(const QImage &image)
 
         uchar *to = (uchar *)m_sharedMemory->data();
         // Write the width of the image and move the pointer forward
-        qint32 width = image.width();
         ::memcpy(to, &width, sizeof(width));
         to += sizeof(width);
 
         // Write the height of the image and move the pointer forward
-        qint32 height = image.height();
         ::memcpy(to, &height, sizeof(height));
         to += sizeof(height);
 
         // Write the image format of the image and move the pointer forward
-        qint32 imageFormat = image.format();
         ::memcpy(to, &imageFormat, sizeof(imageFormat));
         to += sizeof(imageFormat);
 
         // Write the bytes per line of the image and move the pointer forward
-        qint32 bytesPerLine = image.bytesPerLine();
         ::memcpy(to, &bytesPerLine, sizeof(bytesPerLine));
         to += sizeof(bytesPerLine);
 
-        // Write the raw data of the image and move the pointer forward
-        ::memcpy(to, image.constBits(), image.sizeInBytes());
+        // Write the raw data of the image
+        ::memcpy(to, data, size_t(dataSize));
 
         m_sharedMemory->unlock();
         if (m_stream && m_socket) {
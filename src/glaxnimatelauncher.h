@@ -12,6 +12,7 @@
 #include <QObject>
 #include <QPoint>
 #include <QSharedMemory>
+#include <mlt++/MltFrame.h>
 #include <mlt++/MltProducer.h>
 
 class ProjectClip;
@@ -42,7 +43,10 @@ private:
     bool m_isProtocolValid = false;
     QLocalSocket *m_socket;
 
-    bool copyToShared(const QImage &image);
+    /** @brief Write the frame's RGBA image straight into the shared memory block; MLT's
+     *  byte order matches QImage::Format_RGBA8888 so no conversion pass is needed */
+    bool copyFrameToShared(Mlt::Frame *frame);
+    bool writeToShared(qint32 width, qint32 height, qint32 imageFormat, qint32 bytesPerLine, const uchar *data, qint32 dataSize);
     void reset();
 
 private Q_SLOTS:
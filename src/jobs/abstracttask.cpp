@@ -23,17 +23,54 @@
 #include <windows.h>
 #endif
 
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
 #include <QElapsedTimer>
 #include <QFile>
+#include <QFileInfo>
 #include <QImage>
 #include <QList>
 #include <QProcess>
 #include <QRgb>
 #include <QString>
+#include <QTextStream>
+#include <QThread>
 #include <QThreadPool>
 #include <QTime>
 #include <QVariantList>
 
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+QMutex sourceLocksMutex;
+std::unordered_map<int, std::weak_ptr<QMutex>> sourceLocks;
+} // namespace
+
+std::shared_ptr<QMutex> AbstractTask::sourceLock(int ownerId)
+{
+    QMutexLocker lk(&sourceLocksMutex);
+    auto it = sourceLocks.find(ownerId);
+    if (it != sourceLocks.end()) {
+        if (auto existing = it->second.lock()) {
+            return existing;
+        }
+    }
+    auto created = std::make_shared<QMutex>();
+    sourceLocks[ownerId] = created;
+    // Drop entries whose tasks are all gone
+    for (auto i = sourceLocks.begin(); i != sourceLocks.end();) {
+        if (i->second.expired()) {
+            i = sourceLocks.erase(i);
+        } else {
+            ++i;
+        }
+    }
+    return created;
+}
+
 AbstractTask::AbstractTask(const ObjectId &owner, JOBTYPE type, QObject *object)
     : QRunnable()
     , m_owner(owner)
@@ -55,6 +92,13 @@ AbstractTask::AbstractTask(const ObjectId &owner, JOBTYPE type, QObject *object)
     case AbstractTask::PROXYJOB:
         m_priority = 8;
         break;
+    case AbstractTask::THUMBJOB:
+    case AbstractTask::CACHEJOB:
+    case AbstractTask::AUDIOTHUMBJOB:
+        // Interactive tasks: thumbnails and audio levels feed what is displayed
+        // right now, so they must jump ahead of queued analysis jobs
+        m_priority = 9;
+        break;
     case AbstractTask::FILTERCLIPJOB:
     case AbstractTask::STABILIZEJOB:
     case AbstractTask::ANALYSECLIPJOB:
@@ -127,6 +171,157 @@ void AbstractTask::setPreferredPriority(qint64 pid)
 #endif
 }
 
+bool AbstractTask::runSegmentedEncode(const QStringList &parameters, const QString &source, const QString &dest, int jobDuration, QString &logDetails)
+{
+    const int inputIndex = parameters.indexOf(QStringLiteral("-i"));
+    if (inputIndex < 0 || parameters.constLast() != dest) {
+        return false;
+    }
+    // Segments target ~1 minute so several encoders stay busy without creating a flood of tiny files
+    const int segmentDuration = qMax(60, jobDuration / 32);
+    const int segmentCount = (jobDuration + segmentDuration - 1) / segmentDuration;
+    if (segmentCount < 2) {
+        return false;
+    }
+    QDir segmentDir(dest + QStringLiteral(".segments"));
+    if (!segmentDir.exists() && !QDir().mkpath(segmentDir.absolutePath())) {
+        return false;
+    }
+    const QString suffix = QFileInfo(dest).suffix();
+    auto segmentName = [&suffix](int ix) { return QStringLiteral("seg_%1.%2").arg(ix, 4, 10, QLatin1Char('0')).arg(suffix); };
+    // The manifest starts with a signature of the encoding parameters and source file; each
+    // completed segment index is appended below it so an interrupted job can resume
+    const QString signature = QString::fromLatin1(QCryptographicHash::hash((parameters.join(QLatin1Char(' ')) + source +
+                                                                            QString::number(QFileInfo(source).lastModified().toSecsSinceEpoch()) +
+                                                                            QString::number(segmentCount))
+                                                                               .toUtf8(),
+                                                                           QCryptographicHash::Md5)
+                                                      .toHex());
+    QVector<bool> completed(segmentCount, false);
+    QFile manifest(segmentDir.absoluteFilePath(QStringLiteral("manifest")));
+    if (manifest.exists() && manifest.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        QTextStream in(&manifest);
+        if (in.readLine() == signature) {
+            QString line;
+            while (in.readLineInto(&line)) {
+                bool ok = false;
+                int ix = line.toInt(&ok);
+                if (ok && ix >= 0 && ix < segmentCount && QFileInfo(segmentDir.absoluteFilePath(segmentName(ix))).size() > 0) {
+                    completed[ix] = true;
+                }
+            }
+            manifest.close();
+        } else {
+            // Parameters or source changed, the old segments cannot be reused
+            manifest.close();
+            segmentDir.removeRecursively();
+            QDir().mkpath(segmentDir.absolutePath());
+        }
+    }
+    if (!manifest.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text)) {
+        return false;
+    }
+    if (manifest.size() == 0) {
+        manifest.write(signature.toUtf8() + '\n');
+        manifest.flush();
+    }
+    std::vector<int> pending;
+    for (int ix = 0; ix < segmentCount; ix++) {
+        if (!completed.at(ix)) {
+            pending.push_back(ix);
+        }
+    }
+    QMutex mutex;
+    std::vector<QProcess *> running;
+    QMetaObject::Connection killConnection = QObject::connect(
+        this, &AbstractTask::jobCanceled, this,
+        [&mutex, &running]() {
+            QMutexLocker lk(&mutex);
+            for (QProcess *p : running) {
+                p->kill();
+            }
+        },
+        Qt::DirectConnection);
+    QAtomicInt doneCount(segmentCount - int(pending.size()));
+    QAtomicInt encodeFailed(0);
+    auto encodeSegment = [&](int ix) {
+        if (m_isCanceled.loadAcquire() || encodeFailed.loadAcquire()) {
+            return;
+        }
+        QStringList segParams = parameters;
+        segParams[segParams.size() - 1] = segmentDir.absoluteFilePath(segmentName(ix));
+        const int start = ix * segmentDuration;
+        // Seeking before the input lets FFmpeg jump to the previous keyframe and decode up to
+        // the exact frame, so segment cuts stay frame accurate while seeking fast
+        segParams.insert(inputIndex, QString::number(qMin(segmentDuration, jobDuration - start)));
+        segParams.insert(inputIndex, QStringLiteral("-t"));
+        segParams.insert(inputIndex, QString::number(start));
+        segParams.insert(inputIndex, QStringLiteral("-ss"));
+        QProcess segProcess;
+        {
+            QMutexLocker lk(&mutex);
+            running.push_back(&segProcess);
+        }
+        segProcess.start(KdenliveSettings::ffmpegpath(), segParams, QIODevice::ReadOnly);
+        AbstractTask::setPreferredPriority(segProcess.processId());
+        segProcess.waitForFinished(-1);
+        QMutexLocker lk(&mutex);
+        running.erase(std::remove(running.begin(), running.end(), &segProcess), running.end());
+        if (m_isCanceled.loadAcquire()) {
+            return;
+        }
+        if (segProcess.exitStatus() != QProcess::NormalExit || segProcess.exitCode() != 0) {
+            logDetails.append(QString::fromUtf8(segProcess.readAllStandardError()));
+            encodeFailed.storeRelease(1);
+            return;
+        }
+        manifest.write(QByteArray::number(ix) + '\n');
+        manifest.flush();
+        // Keep a bit of headroom for the final concat pass
+        m_progress = 95 * (doneCount.fetchAndAddRelaxed(1) + 1) / segmentCount;
+        QMetaObject::invokeMethod(m_object, "updateJobProgress");
+    };
+    // Each FFmpeg process is already multithreaded, a few concurrent ones saturate the box
+    QThreadPool encodePool;
+    encodePool.setMaxThreadCount(qBound(2, QThread::idealThreadCount() / 2, 4));
+    for (int ix : pending) {
+        encodePool.start([&encodeSegment, ix]() { encodeSegment(ix); });
+    }
+    encodePool.waitForDone();
+    QObject::disconnect(killConnection);
+    manifest.close();
+    if (m_isCanceled.loadAcquire() || encodeFailed.loadAcquire()) {
+        return false;
+    }
+    // All segments done, concatenate them with stream copy (paths are resolved relative to the list file)
+    QFile listFile(segmentDir.absoluteFilePath(QStringLiteral("concat.txt")));
+    if (!listFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return false;
+    }
+    for (int ix = 0; ix < segmentCount; ix++) {
+        listFile.write("file '" + segmentName(ix).toUtf8() + "'\n");
+    }
+    listFile.close();
+    QStringList concatParams = {QStringLiteral("-hide_banner"), QStringLiteral("-y"),     QStringLiteral("-v"),    QStringLiteral("error"),
+                                QStringLiteral("-f"),           QStringLiteral("concat"), QStringLiteral("-safe"), QStringLiteral("0"),
+                                QStringLiteral("-i"),           listFile.fileName(),      QStringLiteral("-c"),    QStringLiteral("copy"),
+                                QStringLiteral("-map"),         QStringLiteral("0"),      dest};
+    QProcess concatProcess;
+    QMetaObject::Connection concatKill =
+        QObject::connect(this, &AbstractTask::jobCanceled, &concatProcess, &QProcess::kill, Qt::DirectConnection);
+    concatProcess.start(KdenliveSettings::ffmpegpath(), concatParams, QIODevice::ReadOnly);
+    concatProcess.waitForFinished(-1);
+    QObject::disconnect(concatKill);
+    if (concatProcess.exitStatus() != QProcess::NormalExit || concatProcess.exitCode() != 0) {
+        logDetails.append(QString::fromUtf8(concatProcess.readAllStandardError()));
+        return false;
+    }
+    segmentDir.removeRecursively();
+    m_progress = 100;
+    QMetaObject::invokeMethod(m_object, "updateJobProgress");
+    return true;
+}
+
 AbstractTaskDone::~AbstractTaskDone() {
     pCore->taskManager.taskDone(m_cid, m_task);
 }
@@ -14,6 +14,8 @@
 #include <QRunnable>
 #include <QUuid>
 
+#include <memory>
+
 class AbstractTask : public QObject, public QRunnable
 {
     Q_OBJECT
@@ -38,6 +40,10 @@ public:
     ~AbstractTask() override;
     static void closeAll();
     static void setPreferredPriority(qint64 pid);
+    /** @brief Returns a mutex shared by all tasks decoding the same bin clip. IO heavy tasks
+     *  hold it while decoding, so co-scheduled jobs on one file run their sequential passes
+     *  one at a time instead of seek-thrashing each other (costly on spinning disks). */
+    static std::shared_ptr<QMutex> sourceLock(int ownerId);
     const ObjectId ownerId() const;
     bool operator==(const AbstractTask& b);
 
@@ -55,6 +61,14 @@ protected:
     QUuid m_uuid;
     void run() override;
     void cleanup();
+    /** @brief Encode dest in concurrent FFmpeg segments, then concatenate them into dest.
+     *  Completed segments are recorded in a manifest next to the destination, so an interrupted
+     *  job resumes from the last finished segment instead of starting over.
+     *  @param parameters the single-pass FFmpeg command built by the calling task, used as a template
+     *  @param jobDuration the source duration in seconds, used to split the segments
+     *  @param logDetails receives the FFmpeg error output of failed segments
+     *  @returns true on success; on failure finished segments are kept on disk for resume */
+    bool runSegmentedEncode(const QStringList &parameters, const QString &source, const QString &dest, int jobDuration, QString &logDetails);
 
 private:
     //QString cacheKey();
@@ -10,19 +10,26 @@
 #include "bin/projectclip.h"
 #include "bin/projectitemmodel.h"
 #include "core.h"
+#include "utils/memorydiagnostics.h"
 
 #include <KLocalizedString>
 #include <KMessageWidget>
+#include <QDataStream>
 #include <QElapsedTimer>
 #include <QFile>
+#include <cstring>
 #include <QImage>
 #include <QList>
 #include <QMutex>
 #include <QRgb>
 #include <QString>
+#include <QThread>
 #include <QThreadPool>
 #include <QTime>
+#include <QtConcurrent/QtConcurrentMap>
 #include <QVariantList>
+#include <memory>
+#include <vector>
 
 static QList<AudioLevelsTask *> tasksList;
 static QMutex tasksListMutex;
@@ -32,6 +39,112 @@ static void deleteQVariantList(QVector<uint8_t> *list)
     delete list;
 }
 
+// Magic and version of the binary peaks sidecar holding the multi-resolution level pyramid
+static const quint32 peaksFileMagic = 0x4b50454b; // 'KPEK'
+static const quint32 peaksFileVersion = 1;
+
+/** @brief Build a downsampled tier of the peak pyramid, keeping the per-channel maximum of each
+ *  group of step frames */
+static QVector<uint8_t> downsampleLevels(const QVector<uint8_t> &levels, int channels, int step)
+{
+    if (step <= 1 || channels <= 0) {
+        return levels;
+    }
+    int frames = levels.size() / channels;
+    QVector<uint8_t> result;
+    result.reserve(((frames + step - 1) / step) * channels);
+    for (int f = 0; f < frames; f += step) {
+        for (int c = 0; c < channels; c++) {
+            uint8_t peak = 0;
+            int groupEnd = qMin(f + step, frames);
+            for (int k = f; k < groupEnd; k++) {
+                peak = qMax(peak, levels.at(k * channels + c));
+            }
+            result << peak;
+        }
+    }
+    return result;
+}
+
+/** @brief Persist the peak pyramid as a versioned binary sidecar next to the thumb image */
+static bool writePeaksFile(const QString &path, int channels, int secondStep, const QVector<uint8_t> &perFrame, const QVector<uint8_t> &perTenFrames,
+                           const QVector<uint8_t> &perSecond)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_15);
+    out << peaksFileMagic << peaksFileVersion << qint32(channels) << qint32(secondStep);
+    for (const QVector<uint8_t> *tier : {&perFrame, &perTenFrames, &perSecond}) {
+        out << quint32(tier->size());
+        out.writeRawData(reinterpret_cast<const char *>(tier->constData()), tier->size());
+    }
+    return out.status() == QDataStream::Ok;
+}
+
+/** @brief Load the peak pyramid from a sidecar written by writePeaksFile. The file is memory
+ *  mapped and each tier filled with one bulk copy, so reloading on project open doesn't decode
+ *  anything */
+static bool readPeaksFile(const QString &path, int channels, int *secondStep, QVector<uint8_t> *perFrame, QVector<uint8_t> *perTenFrames,
+                          QVector<uint8_t> *perSecond)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly) || file.size() == 0) {
+        return false;
+    }
+    uchar *mapped = file.map(0, file.size());
+    if (mapped == nullptr) {
+        return false;
+    }
+    QDataStream in(QByteArray::fromRawData(reinterpret_cast<const char *>(mapped), int(file.size())));
+    in.setVersion(QDataStream::Qt_5_15);
+    quint32 magic = 0, version = 0;
+    qint32 fileChannels = 0, fileSecondStep = 0;
+    in >> magic >> version >> fileChannels >> fileSecondStep;
+    if (magic != peaksFileMagic || version != peaksFileVersion || fileChannels != channels || fileSecondStep <= 0) {
+        return false;
+    }
+    qint64 offset = 4 * sizeof(quint32);
+    for (QVector<uint8_t> *tier : {perFrame, perTenFrames, perSecond}) {
+        quint32 size = 0;
+        in.device()->seek(offset);
+        in >> size;
+        offset += sizeof(quint32);
+        if (in.status() != QDataStream::Ok || offset + size > file.size()) {
+            return false;
+        }
+        tier->resize(int(size));
+        memcpy(tier->data(), mapped + offset, size);
+        offset += size;
+    }
+    *secondStep = fileSecondStep;
+    return !perFrame->isEmpty();
+}
+
+/** @brief Attach the pyramid tiers to the bin producer, where the timeline waveform picks the
+ *  resolution matching its zoom level */
+static void storeLevelsInProducer(const std::shared_ptr<Mlt::Producer> &producer, int stream, const QVector<uint8_t> &perFrame,
+                                  const QVector<uint8_t> &perTenFrames, const QVector<uint8_t> &perSecond, int secondStep)
+{
+    producer->lock();
+#ifdef KDENLIVE_MEMORY_DIAGNOSTICS
+    // Regeneration replaces the previous tiers, account for the ones we are about to free
+    for (const QString &key : {QString("_kdenlive:audio%1").arg(stream), QString("_kdenlive:audio10_%1").arg(stream), QString("_kdenlive:audiosec_%1").arg(stream)}) {
+        if (auto *previous = static_cast<QVector<uint8_t> *>(producer->get_data(key.toUtf8().constData()))) {
+            MEM_DIAG_SUB(MemoryDiagnostics::AudioLevels, previous->size(), 1);
+        }
+    }
+    MEM_DIAG_ADD(MemoryDiagnostics::AudioLevels, perFrame.size() + perTenFrames.size() + perSecond.size(), 3);
+#endif
+    producer->set(QString("_kdenlive:audio%1").arg(stream).toUtf8().constData(), new QVector<uint8_t>(perFrame), 0, (mlt_destructor)deleteQVariantList);
+    producer->set(QString("_kdenlive:audio10_%1").arg(stream).toUtf8().constData(), new QVector<uint8_t>(perTenFrames), 0, (mlt_destructor)deleteQVariantList);
+    producer->set(QString("_kdenlive:audiosec_%1").arg(stream).toUtf8().constData(), new QVector<uint8_t>(perSecond), 0, (mlt_destructor)deleteQVariantList);
+    producer->set(QString("kdenlive:audio_secstep%1").arg(stream).toUtf8().constData(), secondStep);
+    producer->unlock();
+}
+
 AudioLevelsTask::AudioLevelsTask(const ObjectId &owner, QObject *object)
     : AbstractTask(owner, AbstractTask::AUDIOTHUMBJOB, object)
 {
@@ -112,7 +225,21 @@ void AudioLevelsTask::run()
         streamIndex++;
         // Generate one thumb per stream
         QString cachePath = binClip->getAudioThumbPath(stream);
+        const QString peaksPath = cachePath + QStringLiteral(".peaks");
+        const int secondStep = qMax(1, qRound(pCore->getCurrentFps()));
         QVector<uint8_t> mltLevels;
+        if (!m_isForce && QFile::exists(peaksPath)) {
+            // Binary peak pyramid sidecar exists, load it without any decoding
+            QVector<uint8_t> perTenFrames, perSecond;
+            int fileSecondStep = 0;
+            if (!m_isCanceled && readPeaksFile(peaksPath, channels, &fileSecondStep, &mltLevels, &perTenFrames, &perSecond)) {
+                producer = binClip->originalProducer();
+                storeLevelsInProducer(producer, stream, mltLevels, perTenFrames, perSecond, fileSecondStep);
+                producer.reset();
+                continue;
+            }
+            mltLevels.clear();
+        }
         if (!m_isForce && QFile::exists(cachePath)) {
             // Audio thumb already exists
             QImage image(cachePath);
@@ -127,82 +254,127 @@ void AudioLevelsTask::run()
                     mltLevels << qAlpha(p);
                 }
                 if (mltLevels.size() > 0) {
-                    QVector<uint8_t> *levelsCopy = new QVector<uint8_t>(mltLevels);
+                    // Upgrade the old cache so the next load skips the image decoding
+                    const QVector<uint8_t> perTenFrames = downsampleLevels(mltLevels, channels, 10);
+                    const QVector<uint8_t> perSecond = downsampleLevels(mltLevels, channels, secondStep);
+                    writePeaksFile(peaksPath, channels, secondStep, mltLevels, perTenFrames, perSecond);
                     producer = binClip->originalProducer();
-                    producer->lock();
-                    QString key = QString("_kdenlive:audio%1").arg(stream);
-                    producer->set(key.toUtf8().constData(), levelsCopy, 0, (mlt_destructor)deleteQVariantList);
-                    producer->unlock();
+                    storeLevelsInProducer(producer, stream, mltLevels, perTenFrames, perSecond, secondStep);
                     producer.reset();
+                    mltLevels.clear();
                     continue;
                 }
             }
         }
 
-        Mlt::Producer *aProd = new Mlt::Producer(pCore->getProjectProfile(), service.toUtf8().constData(), res.toUtf8().constData());
-        if (!aProd->is_valid()) {
-            QMetaObject::invokeMethod(pCore.get(), "displayBinMessage", Qt::QueuedConnection, Q_ARG(QString, i18n("Audio thumbs: cannot open file %1", res)),
-                                      Q_ARG(int, int(KMessageWidget::Warning)));
-            delete aProd;
-            return;
+        // Other decode tasks may be queued on this clip (thumbnails on ingest); run the
+        // sequential passes one at a time, interleaved seeks on one file are slower,
+        // dramatically so on spinning disks
+        std::shared_ptr<QMutex> decodeLock = AbstractTask::sourceLock(m_owner.itemId);
+        QMutexLocker sourceLocker(decodeLock.get());
+        {
+            // Probe the producer once so a broken file errors out before spawning workers
+            Mlt::Producer probe(pCore->getProjectProfile(), service.toUtf8().constData(), res.toUtf8().constData());
+            if (!probe.is_valid()) {
+                QMetaObject::invokeMethod(pCore.get(), "displayBinMessage", Qt::QueuedConnection, Q_ARG(QString, i18n("Audio thumbs: cannot open file %1", res)),
+                                          Q_ARG(int, int(KMessageWidget::Warning)));
+                return;
+            }
         }
-        aProd->set("video_index", -1);
-        aProd->set("audio_index", stream);
-        aProd->set("vstream", -1);
-        aProd->set("astream", streamIndex);
-        Mlt::Filter chans(pCore->getProjectProfile(), "audiochannels");
-        Mlt::Filter converter(pCore->getProjectProfile(), "audioconvert");
-        Mlt::Filter levels(pCore->getProjectProfile(), "audiolevel");
-        aProd->attach(chans);
-        aProd->attach(converter);
-        aProd->attach(levels);
-        std::unique_ptr<Mlt::Producer> audioProducer;
-        audioProducer.reset(aProd);
 
-        double framesPerSecond = audioProducer->get_fps();
         mlt_audio_format audioFormat = mlt_audio_s16;
         QStringList keys;
         keys.reserve(channels);
         for (int i = 0; i < channels; i++) {
             keys << "meta.media.audio_level." + QString::number(i);
         }
-        uint maxLevel = 1;
-        QElapsedTimer updateTime;
-        updateTime.start();
-        for (int z = 0; z < lengthInFrames && !m_isCanceled; ++z) {
-            int val = int(100.0 * z / lengthInFrames);
-            if (m_progress != val) {
-                m_progress = val;
-                QMetaObject::invokeMethod(m_object, "updateJobProgress");
+
+        // Split the extraction into seek partitioned segments decoded in parallel, each worker
+        // opening its own producer. Short clips are not worth the extra producers and stay serial
+        int workers = qBound(1, QThread::idealThreadCount(), 8);
+        if (lengthInFrames < 500 * workers) {
+            workers = 1;
+        }
+        struct Segment
+        {
+            int start;
+            int end;
+            QVector<uint8_t> levels;
+            uint maxLevel;
+        };
+        std::vector<Segment> segments;
+        const int segmentLength = lengthInFrames / workers;
+        for (int i = 0; i < workers; i++) {
+            segments.push_back({i * segmentLength, i == workers - 1 ? lengthInFrames : (i + 1) * segmentLength, {}, 1});
+        }
+        QAtomicInt processedFrames = 0;
+        const bool serial = workers == 1;
+        auto processSegment = [&](Segment &seg) {
+            auto audioProducer = std::make_unique<Mlt::Producer>(pCore->getProjectProfile(), service.toUtf8().constData(), res.toUtf8().constData());
+            if (!audioProducer->is_valid()) {
+                return;
             }
-            QScopedPointer<Mlt::Frame> mltFrame(audioProducer->get_frame());
-            if ((mltFrame != nullptr) && mltFrame->is_valid() && (mltFrame->get_int("test_audio") == 0)) {
-                int samples = mlt_audio_calculate_frame_samples(float(framesPerSecond), frequency, z);
-                mltFrame->get_audio(audioFormat, frequency, channels, samples);
-                for (int channel = 0; channel < channels; ++channel) {
-                    uint lev = 256 * qMin(mltFrame->get_double(keys.at(channel).toUtf8().constData()) * 0.9, 1.0);
-                    mltLevels << lev;
-                    // double lev = mltFrame->get_double(keys.at(channel).toUtf8().constData());
-                    // mltLevels << lev;
-                    maxLevel = qMax(lev, maxLevel);
+            audioProducer->set("video_index", -1);
+            audioProducer->set("audio_index", stream);
+            audioProducer->set("vstream", -1);
+            audioProducer->set("astream", streamIndex);
+            Mlt::Filter chans(pCore->getProjectProfile(), "audiochannels");
+            Mlt::Filter converter(pCore->getProjectProfile(), "audioconvert");
+            Mlt::Filter levels(pCore->getProjectProfile(), "audiolevel");
+            audioProducer->attach(chans);
+            audioProducer->attach(converter);
+            audioProducer->attach(levels);
+            double framesPerSecond = audioProducer->get_fps();
+            if (seg.start > 0) {
+                audioProducer->seek(seg.start);
+            }
+            QElapsedTimer updateTime;
+            updateTime.start();
+            for (int z = seg.start; z < seg.end && !m_isCanceled; ++z) {
+                int done = processedFrames.fetchAndAddRelaxed(1) + 1;
+                int val = int(100.0 * done / lengthInFrames);
+                if (m_progress != val) {
+                    m_progress = val;
+                    QMetaObject::invokeMethod(m_object, "updateJobProgress");
                 }
-            } else if (!mltLevels.isEmpty()) {
-                for (int channel = 0; channel < channels; channel++) {
-                    mltLevels << mltLevels.last();
+                QScopedPointer<Mlt::Frame> mltFrame(audioProducer->get_frame());
+                if ((mltFrame != nullptr) && mltFrame->is_valid() && (mltFrame->get_int("test_audio") == 0)) {
+                    int samples = mlt_audio_calculate_frame_samples(float(framesPerSecond), frequency, z);
+                    mltFrame->get_audio(audioFormat, frequency, channels, samples);
+                    for (int channel = 0; channel < channels; ++channel) {
+                        uint lev = 256 * qMin(mltFrame->get_double(keys.at(channel).toUtf8().constData()) * 0.9, 1.0);
+                        seg.levels << lev;
+                        seg.maxLevel = qMax(lev, seg.maxLevel);
+                    }
+                } else if (!seg.levels.isEmpty()) {
+                    for (int channel = 0; channel < channels; channel++) {
+                        seg.levels << seg.levels.last();
+                    }
+                }
+                // Incrementally update the audio levels every 3 seconds. Only done when decoding
+                // serially, since parallel segments are not contiguous until merged
+                if (serial && updateTime.elapsed() > 3000 && !m_isCanceled) {
+                    updateTime.restart();
+                    QVector<uint8_t> *levelsCopy = new QVector<uint8_t>(seg.levels);
+                    producer = binClip->originalProducer();
+                    producer->lock();
+                    QString key = QString("_kdenlive:audio%1").arg(stream);
+                    producer->set(key.toUtf8().constData(), levelsCopy, 0, (mlt_destructor)deleteQVariantList);
+                    producer->unlock();
+                    producer.reset();
+                    QMetaObject::invokeMethod(m_object, "updateAudioThumbnail", Q_ARG(bool, false));
                 }
             }
-            // Incrementally update the audio levels every 3 seconds.
-            if (updateTime.elapsed() > 3000 && !m_isCanceled) {
-                updateTime.restart();
-                QVector<uint8_t> *levelsCopy = new QVector<uint8_t>(mltLevels);
-                producer = binClip->originalProducer();
-                producer->lock();
-                QString key = QString("_kdenlive:audio%1").arg(stream);
-                producer->set(key.toUtf8().constData(), levelsCopy, 0, (mlt_destructor)deleteQVariantList);
-                producer->unlock();
-                producer.reset();
-                QMetaObject::invokeMethod(m_object, "updateAudioThumbnail", Q_ARG(bool, false));
-            }
+        };
+        if (serial) {
+            processSegment(segments.front());
+        } else {
+            QtConcurrent::blockingMap(segments, processSegment);
+        }
+        uint maxLevel = 1;
+        for (const auto &seg : segments) {
+            maxLevel = qMax(maxLevel, seg.maxLevel);
+            mltLevels += seg.levels;
         }
 
         /*// Normalize
@@ -215,16 +387,16 @@ void AudioLevelsTask::run()
             QMetaObject::invokeMethod(m_object, "updateJobProgress");
         }
         if (mltLevels.size() > 0) {
-            QVector<uint8_t> *levelsCopy = new QVector<uint8_t>(mltLevels);
+            const QVector<uint8_t> perTenFrames = downsampleLevels(mltLevels, channels, 10);
+            const QVector<uint8_t> perSecond = downsampleLevels(mltLevels, channels, secondStep);
             producer = binClip->originalProducer();
             producer->lock();
-            QString key = QString("_kdenlive:audio%1").arg(stream);
             QString key2 = QString("kdenlive:audio_max%1").arg(stream);
             producer->set(key2.toUtf8().constData(), int(maxLevel));
-            producer->set(key.toUtf8().constData(), levelsCopy, 0, (mlt_destructor)deleteQVariantList);
             producer->unlock();
+            storeLevelsInProducer(producer, stream, mltLevels, perTenFrames, perSecond, secondStep);
             producer.reset();
-            // qDebug()<<"=== FINISHED PRODUCING AUDIO FOR: "<<key<<", SIZE: "<<levelsCopy->size();
+            writePeaksFile(peaksPath, channels, secondStep, mltLevels, perTenFrames, perSecond);
             m_progress = 100;
             QMetaObject::invokeMethod(m_object, "updateJobProgress");
             // Put into an image for caching.
@@ -51,7 +51,10 @@ void CacheTask::generateThumbnail(std::shared_ptr<ProjectClip> binClip)
 {
     // Fetch thumbnail
     if (binClip->clipType() != ClipType::Audio) {
-        std::unique_ptr<Mlt::Producer> thumbProd(nullptr);
+        // Serialize with other decode tasks on this clip (see AbstractTask::sourceLock)
+        std::shared_ptr<QMutex> decodeLock = AbstractTask::sourceLock(m_owner.itemId);
+        QMutexLocker sourceLocker(decodeLock.get());
+        std::shared_ptr<Mlt::Producer> thumbProd(nullptr);
         int duration = m_out > 0 ? m_out - m_in : binClip->getFramePlaytime();
         std::set<int> frames;
         int steps = qCeil(qMax(pCore->getCurrentFps(), double(duration) / m_thumbsCount));
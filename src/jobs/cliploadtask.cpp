@@ -7,6 +7,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 
 #include "cliploadtask.h"
 #include "audio/audioStreamInfo.h"
+#include "bin/mediaindex.h"
 #include "bin/projectclip.h"
 #include "bin/projectitemmodel.h"
 #include "core.h"
@@ -26,6 +27,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include <QImage>
 #include <QMimeDatabase>
 #include <QPainter>
+#include <QProcess>
 #include <QString>
 #include <QTime>
 #include <QUuid>
@@ -229,7 +231,7 @@ void ClipLoadTask::generateThumbnail(std::shared_ptr<ProjectClip> binClip, std::
             if (m_isCanceled.loadAcquire() || pCore->taskManager.isBlocked()) {
                 return;
             }
-            std::unique_ptr<Mlt::Producer> thumbProd = binClip->getThumbProducer();
+            std::shared_ptr<Mlt::Producer> thumbProd = binClip->getThumbProducer();
             if (thumbProd && thumbProd->is_valid()) {
                 if (binClip->clipType() != ClipType::Timeline && binClip->clipType() != ClipType::Playlist) {
                     Mlt::Profile *prodProfile = &pCore->thumbProfile();
@@ -278,6 +280,46 @@ void ClipLoadTask::generateThumbnail(std::shared_ptr<ProjectClip> binClip, std::
     }
 }
 
+/** @brief Returns the keyframe cadence in frames detected over the first few hundred video
+ *  packets of @param resource, or 0 when unknown or intra-only. The scan only reads packet
+ *  headers so it stays cheap even on large files. */
+static int probeGopSize(const QString &resource)
+{
+    if (!QFileInfo(KdenliveSettings::ffprobepath()).isFile()) {
+        return 0;
+    }
+    QProcess probe;
+    const QStringList args = {QStringLiteral("-v"),
+                              QStringLiteral("error"),
+                              QStringLiteral("-select_streams"),
+                              QStringLiteral("v:0"),
+                              QStringLiteral("-show_entries"),
+                              QStringLiteral("packet=flags"),
+                              QStringLiteral("-of"),
+                              QStringLiteral("csv=p=0"),
+                              QStringLiteral("-read_intervals"),
+                              QStringLiteral("%+#600"),
+                              resource};
+    probe.start(KdenliveSettings::ffprobepath(), args, QIODevice::ReadOnly);
+    if (!probe.waitForFinished(10000) || probe.exitStatus() != QProcess::NormalExit) {
+        return 0;
+    }
+    const QStringList flags = QString::fromUtf8(probe.readAllStandardOutput()).split(QLatin1Char('\n'), Qt::SkipEmptyParts);
+    int packet = 0;
+    int lastKey = -1;
+    int gop = 0;
+    for (const QString &f : flags) {
+        if (f.startsWith(QLatin1Char('K'))) {
+            if (lastKey >= 0) {
+                gop = qMax(gop, packet - lastKey);
+            }
+            lastKey = packet;
+        }
+        packet++;
+    }
+    return gop > 1 ? gop : 0;
+}
+
 void ClipLoadTask::run()
 {
     AbstractTaskDone whenFinished(m_owner.itemId, this);
@@ -316,6 +358,22 @@ void ClipLoadTask::run()
         type = ClipType::AV;
         service.clear();
     }
+    if (type == ClipType::Unknown && QFileInfo(resource).isAbsolute()) {
+        // Cheap stat check before handing the file to avformat: on a bulk import,
+        // missing or empty files would otherwise pay the full demuxer open/probe
+        // latency just to fail
+        QFileInfo info(resource);
+        if (!info.exists() || info.size() == 0) {
+            auto binClip = pCore->projectItemModel()->getClipByBinID(QString::number(m_owner.itemId));
+            if (binClip && !binClip->isReloading) {
+                QMetaObject::invokeMethod(pCore.get(), "displayBinMessage", Qt::QueuedConnection, Q_ARG(QString, i18n("Cannot open file %1", resource)),
+                                          Q_ARG(int, int(KMessageWidget::Warning)));
+            }
+            Q_EMIT taskDone();
+            abort();
+            return;
+        }
+    }
     std::shared_ptr<Mlt::Producer> producer;
     switch (type) {
     case ClipType::Color:
@@ -635,6 +693,7 @@ void ClipLoadTask::run()
         int vindex = producer->get_int("video_index");
         bool hasAudio = false;
         bool hasVideo = false;
+        int gopSize = 0;
         // Work around MLT freeze on files with cover art
         if (vindex > -1) {
             QString key = QString("meta.media.%1.stream.frame_rate").arg(vindex);
@@ -650,21 +709,41 @@ void ClipLoadTask::run()
                 vindex = -1;
             }
         }
-        // Check audio / video
-        producer->probe();
-        hasAudio = producer->get_int("video_index") > -1;
-        hasVideo = producer->get_int("audio_index") > -1;
-        if (hasAudio) {
-            if (hasVideo) {
-                producer->set("kdenlive:clip_type", 0);
-            } else {
-                producer->set("kdenlive:clip_type", 1);
+        // Check the media index, unchanged files can skip the probe stage
+        const QString indexKey = MediaIndex::keyForFile(resource);
+        QMap<QString, QString> indexEntry = indexKey.isEmpty() ? QMap<QString, QString>() : MediaIndex::getEntry(indexKey);
+        if (!indexEntry.isEmpty()) {
+            producer->set("kdenlive:clip_type", indexEntry.value(QStringLiteral("clip_type")).toInt());
+            hasAudio = indexEntry.value(QStringLiteral("hasAudio")).toInt() == 1;
+            hasVideo = indexEntry.value(QStringLiteral("hasVideo")).toInt() == 1;
+            seekable = indexEntry.value(QStringLiteral("seekable")).toInt() == 1;
+            isVariableFrameRate = indexEntry.value(QStringLiteral("variable_frame_rate")).toInt() == 1;
+            gopSize = indexEntry.value(QStringLiteral("gop")).toInt();
+            if (fps <= 0) {
+                fps = indexEntry.value(QStringLiteral("fps")).toDouble();
+            }
+        } else {
+            // Check audio / video
+            producer->probe();
+            hasAudio = producer->get_int("video_index") > -1;
+            hasVideo = producer->get_int("audio_index") > -1;
+            if (hasAudio) {
+                if (hasVideo) {
+                    producer->set("kdenlive:clip_type", 0);
+                } else {
+                    producer->set("kdenlive:clip_type", 1);
+                }
+            } else if (hasVideo) {
+                producer->set("kdenlive:clip_type", 2);
+            }
+            // Check if file is seekable
+            seekable = producer->get_int("seekable");
+            isVariableFrameRate = producer->get_int("meta.media.variable_frame_rate");
+            if (vindex > -1 && seekable && !isVariableFrameRate) {
+                // Detect the keyframe cadence so the monitor can align coarse seeks on it
+                gopSize = probeGopSize(resource);
             }
-        } else if (hasVideo) {
-            producer->set("kdenlive:clip_type", 2);
         }
-        // Check if file is seekable
-        seekable = producer->get_int("seekable");
         if (vindex <= -1) {
             checkProfile = false;
         }
@@ -689,7 +768,6 @@ void ClipLoadTask::run()
         }
 
         // Check for variable frame rate
-        isVariableFrameRate = producer->get_int("meta.media.variable_frame_rate");
         if (isVariableFrameRate && seekable) {
             if (checkProfile) {
                 pCore->bin()->shouldCheckProfile = false;
@@ -723,6 +801,20 @@ void ClipLoadTask::run()
                 fps = producer->get_double("source_fps");
             }
         }
+        if (!indexKey.isEmpty() && indexEntry.isEmpty() && !m_isCanceled.loadAcquire()) {
+            // Remember the probe results so reloading unchanged media skips the probe
+            indexEntry.insert(QStringLiteral("clip_type"), QString::number(producer->get_int("kdenlive:clip_type")));
+            indexEntry.insert(QStringLiteral("hasAudio"), QString::number(hasAudio ? 1 : 0));
+            indexEntry.insert(QStringLiteral("hasVideo"), QString::number(hasVideo ? 1 : 0));
+            indexEntry.insert(QStringLiteral("seekable"), QString::number(seekable ? 1 : 0));
+            indexEntry.insert(QStringLiteral("variable_frame_rate"), QString::number(isVariableFrameRate ? 1 : 0));
+            indexEntry.insert(QStringLiteral("fps"), QString::number(fps));
+            indexEntry.insert(QStringLiteral("gop"), QString::number(gopSize));
+            MediaIndex::updateEntry(indexKey, indexEntry);
+        }
+        if (gopSize > 1) {
+            producer->set("kdenlive:gopsize", gopSize);
+        }
     }
     if (fps <= 0 && type == ClipType::Unknown) {
         // something wrong, maybe audio file with embedded image
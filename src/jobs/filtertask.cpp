@@ -156,34 +156,16 @@ void FilterTask::run()
         length = producer->get_length();
     }
 
-    // Build consumer
-    QTemporaryFile sourceFile(QDir::temp().absoluteFilePath(QStringLiteral("kdenlive-XXXXXX.mlt")));
-    if (!sourceFile.open()) {
-        // Something went wrong
-        return;
-    }
-    sourceFile.close();
-    QTemporaryFile destFile(QDir::temp().absoluteFilePath(QStringLiteral("kdenlive-XXXXXX.mlt")));
-    if (!destFile.open()) {
-        // Something went wrong
-        return;
-    }
-    destFile.close();
-    QReadLocker xmlLock(&pCore->xmlMutex);
-    std::unique_ptr<Mlt::Consumer> consumer(new Mlt::Consumer(profile, "xml", sourceFile.fileName().toUtf8().constData()));
-    if (!consumer->is_valid()) {
-        QMetaObject::invokeMethod(pCore.get(), "displayBinMessage", Qt::QueuedConnection, Q_ARG(QString, i18n("Cannot create consumer.")),
-                                  Q_ARG(int, int(KMessageWidget::Warning)));
-        return;
+    QString key(QStringLiteral("results"));
+    if (m_filterData.find(QStringLiteral("key")) != m_filterData.end()) {
+        key = m_filterData.at(QStringLiteral("key"));
     }
 
-    consumer->connect(*producer.get());
-    producer->set_speed(0);
-
+    std::unique_ptr<Mlt::Filter> filter = nullptr;
     if (binClip) {
         // Build filter
-        Mlt::Filter filter(profile, m_filterName.toUtf8().data());
-        if (!filter.is_valid()) {
+        filter = std::make_unique<Mlt::Filter>(profile, m_filterName.toUtf8().data());
+        if (!filter->is_valid()) {
             QMetaObject::invokeMethod(pCore.get(), "displayBinMessage", Qt::QueuedConnection, Q_ARG(QString, i18n("Cannot create filter %1", m_filterName)),
                                       Q_ARG(int, int(KMessageWidget::Warning)));
             return;
@@ -201,100 +183,139 @@ void FilterTask::run()
 #else
             if (it.second.typeId() == QMetaType::Double) {
 #endif
-                filter.set(it.first.toUtf8().constData(), it.second.toDouble());
+                filter->set(it.first.toUtf8().constData(), it.second.toDouble());
             } else {
-                filter.set(it.first.toUtf8().constData(), it.second.toString().toUtf8().constData());
+                filter->set(it.first.toUtf8().constData(), it.second.toString().toUtf8().constData());
             }
         }
         if (m_filterData.find(QLatin1String("relativeInOut")) != m_filterData.end()) {
             // leave it operate on full clip
         } else {
-            filter.set_in_and_out(m_inPoint, m_outPoint);
+            filter->set_in_and_out(m_inPoint, m_outPoint);
         }
-        producer->attach(filter);
-        filter.set("kdenlive:id", "kdenlive-analysis");
+        producer->attach(*filter.get());
+        filter->set("kdenlive:id", "kdenlive-analysis");
     }
 
     qDebug() << "=== FILTER READY TO PROCESS; LENGTH: " << length;
-    consumer->run();
-    consumer.reset();
-    producer.reset();
-    xmlLock.unlock();
-    // wholeProducer.reset();
+    QString resultData;
+    if (binClip && !KdenliveSettings::gpu_accel()) {
+        // Run the analysis in this process, polling the filter so partial results reach
+        // the effect while the job progresses. GPU (movit) processing still goes through
+        // the external melt run below
+        bool result = runInProcessAnalysis(profile, producer.get(), *filter.get(), key, resultData);
+        producer.reset();
+        m_progress = 100;
+        if (auto ptr = m_model.lock()) {
+            QMetaObject::invokeMethod(ptr.get(), "setProgress", Q_ARG(int, 100));
+        }
+        if (m_isCanceled || !result) {
+            if (!m_isCanceled) {
+                QMetaObject::invokeMethod(pCore.get(), "displayBinLogMessage", Qt::QueuedConnection, Q_ARG(QString, i18n("Failed to filter source.")),
+                                          Q_ARG(int, int(KMessageWidget::Warning)), Q_ARG(QString, m_logDetails));
+            }
+            return;
+        }
+    } else {
+        // Build consumer
+        QTemporaryFile sourceFile(QDir::temp().absoluteFilePath(QStringLiteral("kdenlive-XXXXXX.mlt")));
+        if (!sourceFile.open()) {
+            // Something went wrong
+            return;
+        }
+        sourceFile.close();
+        QTemporaryFile destFile(QDir::temp().absoluteFilePath(QStringLiteral("kdenlive-XXXXXX.mlt")));
+        if (!destFile.open()) {
+            // Something went wrong
+            return;
+        }
+        destFile.close();
+        QReadLocker xmlLock(&pCore->xmlMutex);
+        std::unique_ptr<Mlt::Consumer> consumer(new Mlt::Consumer(profile, "xml", sourceFile.fileName().toUtf8().constData()));
+        if (!consumer->is_valid()) {
+            QMetaObject::invokeMethod(pCore.get(), "displayBinMessage", Qt::QueuedConnection, Q_ARG(QString, i18n("Cannot create consumer.")),
+                                      Q_ARG(int, int(KMessageWidget::Warning)));
+            return;
+        }
 
-    QDomDocument dom(sourceFile.fileName());
-    Xml::docContentFromFile(dom, sourceFile.fileName(), false);
+        consumer->connect(*producer.get());
+        producer->set_speed(0);
 
-    // add consumer element
-    QDomElement consumerNode = dom.createElement("consumer");
-    QDomNodeList profiles = dom.elementsByTagName("profile");
-    if (profiles.isEmpty()) {
-        dom.documentElement().insertAfter(consumerNode, dom.documentElement());
-    } else {
-        dom.documentElement().insertAfter(consumerNode, profiles.at(profiles.length() - 1));
-    }
-    consumerNode.setAttribute("mlt_service", "xml");
-    for (const QString &param : qAsConst(m_consumerArgs)) {
-        if (param.contains(QLatin1Char('='))) {
-            consumerNode.setAttribute(param.section(QLatin1Char('='), 0, 0), param.section(QLatin1Char('='), 1));
+        consumer->run();
+        consumer.reset();
+        producer.reset();
+        xmlLock.unlock();
+        // wholeProducer.reset();
+
+        QDomDocument dom(sourceFile.fileName());
+        Xml::docContentFromFile(dom, sourceFile.fileName(), false);
+
+        // add consumer element
+        QDomElement consumerNode = dom.createElement("consumer");
+        QDomNodeList profiles = dom.elementsByTagName("profile");
+        if (profiles.isEmpty()) {
+            dom.documentElement().insertAfter(consumerNode, dom.documentElement());
+        } else {
+            dom.documentElement().insertAfter(consumerNode, profiles.at(profiles.length() - 1));
         }
-    }
-    consumerNode.setAttribute("resource", destFile.fileName());
-    consumerNode.setAttribute("store", "kdenlive");
+        consumerNode.setAttribute("mlt_service", "xml");
+        for (const QString &param : qAsConst(m_consumerArgs)) {
+            if (param.contains(QLatin1Char('='))) {
+                consumerNode.setAttribute(param.section(QLatin1Char('='), 0, 0), param.section(QLatin1Char('='), 1));
+            }
+        }
+        consumerNode.setAttribute("resource", destFile.fileName());
+        consumerNode.setAttribute("store", "kdenlive");
 
-    QFile f1(sourceFile.fileName());
-    f1.open(QIODevice::WriteOnly);
-    QTextStream stream(&f1);
+        QFile f1(sourceFile.fileName());
+        f1.open(QIODevice::WriteOnly);
+        QTextStream stream(&f1);
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
-    stream.setCodec("UTF-8");
+        stream.setCodec("UTF-8");
 #endif
-    stream << dom.toString();
-    f1.close();
-    dom.clear();
+        stream << dom.toString();
+        f1.close();
+        dom.clear();
 
-    // Step 2: process the xml file and save in another .mlt file
-    QStringList args({QStringLiteral("progress=1"), sourceFile.fileName()});
-    m_jobProcess.reset(new QProcess);
-    QObject::connect(this, &AbstractTask::jobCanceled, m_jobProcess.get(), &QProcess::kill, Qt::DirectConnection);
-    QObject::connect(m_jobProcess.get(), &QProcess::readyReadStandardError, this, &FilterTask::processLogInfo);
-    m_jobProcess->start(KdenliveSettings::meltpath(), args);
-    m_jobProcess->waitForFinished(-1);
-    bool result = m_jobProcess->exitStatus() == QProcess::NormalExit;
-    m_progress = 100;
-    if (auto ptr = m_model.lock()) {
-        QMetaObject::invokeMethod(ptr.get(), "setProgress", Q_ARG(int, 100));
-    }
-    if (m_isCanceled || !result) {
-        if (!m_isCanceled) {
-            QMetaObject::invokeMethod(pCore.get(), "displayBinLogMessage", Qt::QueuedConnection, Q_ARG(QString, i18n("Failed to filter source.")),
-                                      Q_ARG(int, int(KMessageWidget::Warning)), Q_ARG(QString, m_logDetails));
+        // Step 2: process the xml file and save in another .mlt file
+        QStringList args({QStringLiteral("progress=1"), sourceFile.fileName()});
+        m_jobProcess.reset(new QProcess);
+        QObject::connect(this, &AbstractTask::jobCanceled, m_jobProcess.get(), &QProcess::kill, Qt::DirectConnection);
+        QObject::connect(m_jobProcess.get(), &QProcess::readyReadStandardError, this, &FilterTask::processLogInfo);
+        m_jobProcess->start(KdenliveSettings::meltpath(), args);
+        m_jobProcess->waitForFinished(-1);
+        bool result = m_jobProcess->exitStatus() == QProcess::NormalExit;
+        m_progress = 100;
+        if (auto ptr = m_model.lock()) {
+            QMetaObject::invokeMethod(ptr.get(), "setProgress", Q_ARG(int, 100));
         }
-        return;
-    }
-
-    paramVector params;
-    QString key("results");
-    if (m_filterData.find(QStringLiteral("key")) != m_filterData.end()) {
-        key = m_filterData.at(QStringLiteral("key"));
-    }
-
-    QString resultData;
-    if (Xml::docContentFromFile(dom, destFile.fileName(), false)) {
-        qDebug() << "AAAA\nGOT DOC\n" << dom.toString();
-        QDomNodeList filters = dom.elementsByTagName(QLatin1String("filter"));
-        for (int i = 0; i < filters.count(); ++i) {
-            QDomElement currentParameter = filters.item(i).toElement();
-            if (Xml::getXmlProperty(currentParameter, QLatin1String("mlt_service")) == m_filterName) {
-                resultData = Xml::getXmlProperty(currentParameter, key);
-            } else if (Xml::getXmlProperty(currentParameter, QLatin1String("kdenlive:id")) == QLatin1String("kdenlive-analysis")) {
-                resultData = Xml::getXmlProperty(currentParameter, key);
+        if (m_isCanceled || !result) {
+            if (!m_isCanceled) {
+                QMetaObject::invokeMethod(pCore.get(), "displayBinLogMessage", Qt::QueuedConnection, Q_ARG(QString, i18n("Failed to filter source.")),
+                                          Q_ARG(int, int(KMessageWidget::Warning)), Q_ARG(QString, m_logDetails));
             }
-            if (!resultData.isEmpty()) {
-                break;
+            return;
+        }
+
+        if (Xml::docContentFromFile(dom, destFile.fileName(), false)) {
+            qDebug() << "AAAA\nGOT DOC\n" << dom.toString();
+            QDomNodeList filters = dom.elementsByTagName(QLatin1String("filter"));
+            for (int i = 0; i < filters.count(); ++i) {
+                QDomElement currentParameter = filters.item(i).toElement();
+                if (Xml::getXmlProperty(currentParameter, QLatin1String("mlt_service")) == m_filterName) {
+                    resultData = Xml::getXmlProperty(currentParameter, key);
+                } else if (Xml::getXmlProperty(currentParameter, QLatin1String("kdenlive:id")) == QLatin1String("kdenlive-analysis")) {
+                    resultData = Xml::getXmlProperty(currentParameter, key);
+                }
+                if (!resultData.isEmpty()) {
+                    break;
+                }
             }
         }
     }
 
+    paramVector params;
+
     if (m_inPoint > 0 && (m_filterData.find(QLatin1String("relativeInOut")) == m_filterData.end())) {
         // Motion tracker keyframes always start at master clip 0, so no need to set in/out points
         params.append({QStringLiteral("in"), m_inPoint});
@@ -317,6 +338,63 @@ void FilterTask::run()
     }
 }
 
+bool FilterTask::runInProcessAnalysis(Mlt::Profile &profile, Mlt::Producer *producer, Mlt::Filter &filter, const QString &key, QString &resultData)
+{
+    Mlt::Consumer consumer(profile, "null");
+    if (!consumer.is_valid()) {
+        QMetaObject::invokeMethod(pCore.get(), "displayBinMessage", Qt::QueuedConnection, Q_ARG(QString, i18n("Cannot create consumer.")),
+                                  Q_ARG(int, int(KMessageWidget::Warning)));
+        return false;
+    }
+    consumer.set("real_time", -1);
+    consumer.set("terminate_on_pause", 1);
+    for (const QString &param : qAsConst(m_consumerArgs)) {
+        if (param.contains(QLatin1Char('='))) {
+            consumer.set(param.section(QLatin1Char('='), 0, 0).toUtf8().constData(), param.section(QLatin1Char('='), 1).toUtf8().constData());
+        }
+    }
+    consumer.connect(*producer);
+    consumer.start();
+
+    const QByteArray resultsKey = key.toUtf8();
+    QString lastPartialData;
+    int polls = 0;
+    while (!consumer.is_stopped()) {
+        if (m_isCanceled) {
+            consumer.stop();
+            return false;
+        }
+        QThread::msleep(250);
+        int progress = length > 0 ? qBound(0, 100 * producer->position() / length, 99) : 0;
+        if (progress != m_progress) {
+            m_progress = progress;
+            if (auto ptr = m_model.lock()) {
+                QMetaObject::invokeMethod(ptr.get(), "setProgress", Q_ARG(int, m_progress));
+            }
+        }
+        if (++polls % 8 == 0) {
+            // Push the results gathered so far to the effect, so for example tracking
+            // keyframes appear progressively instead of all at once when the job ends
+            const QString partialData = QString::fromUtf8(filter.get(resultsKey.constData()));
+            if (!partialData.isEmpty() && partialData != lastPartialData) {
+                lastPartialData = partialData;
+                paramVector params;
+                if (m_inPoint > 0 && (m_filterData.find(QLatin1String("relativeInOut")) == m_filterData.end())) {
+                    params.append({QStringLiteral("in"), m_inPoint});
+                    params.append({QStringLiteral("out"), m_outPoint});
+                }
+                params.append({key, QVariant(partialData)});
+                if (auto ptr = m_model.lock()) {
+                    QMetaObject::invokeMethod(ptr.get(), "setParametersFromTask", Q_ARG(paramVector, std::move(params)));
+                }
+            }
+        }
+    }
+    consumer.stop();
+    resultData = QString::fromUtf8(filter.get(resultsKey.constData()));
+    return !m_isCanceled;
+}
+
 void FilterTask::processLogInfo()
 {
     const QString buffer = QString::fromUtf8(m_jobProcess->readAllStandardError());
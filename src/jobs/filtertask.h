@@ -36,6 +36,14 @@ protected:
     void run() override;
 
 private:
+    /** @brief Run the analysis in process with a null consumer, streaming the filter's
+     *  partial results (e.g. tracking keyframes) to the effect while the job progresses.
+     *  @param producer the producer with the analysis filter already attached
+     *  @param filter the analysis filter, polled for intermediate results
+     *  @param key the filter property holding the analysis results
+     *  @param resultData receives the final analysis results
+     *  @returns true unless the consumer could not be created or the job was canceled */
+    bool runInProcessAnalysis(Mlt::Profile &profile, Mlt::Producer *producer, Mlt::Filter &filter, const QString &key, QString &resultData);
     QString m_binId;
     int m_inPoint;
     int m_outPoint;
@@ -66,6 +66,8 @@ void ProxyTask::run()
     ClipType::ProducerType type = binClip->clipType();
     m_progress = 0;
     bool result = false;
+    // Path of the low resolution draft rung swapped in while the full proxy renders
+    QString draftProxy;
     QString source = binClip->getProducerProperty(QStringLiteral("kdenlive:originalurl"));
     int exif = binClip->getProducerIntProperty(QStringLiteral("_exif_orientation"));
     if (type == ClipType::Playlist || type == ClipType::SlideShow) {
@@ -267,6 +269,7 @@ void ProxyTask::run()
         QStringList parameters = {QStringLiteral("-hide_banner"), QStringLiteral("-y"), QStringLiteral("-stats"), QStringLiteral("-v"),
                                   QStringLiteral("error")};
         m_jobDuration = int(binClip->duration().seconds());
+        bool segmented = false;
         if (binClip->hasProducerProperty(QStringLiteral("kdenlive:camcorderproxy"))) {
             // ffmpeg -an -i proxy.mp4 -vn -i original.MXF -map 0:v -map 1:a -c:v copy out.MP4
             // Create a new proxy file with video from camcorder proxy and audio from source clip
@@ -379,21 +382,62 @@ void ProxyTask::run()
             parameters << QStringLiteral("-ignore_unknown");
             parameters << dest;
             qDebug() << "/// FULL PROXY PARAMS:\n" << parameters << "\n------";
+            // Hardware encoders only support a couple of concurrent sessions, keep those single-pass
+            bool hwEncode = proxyParams.contains(QLatin1String("vaapi")) || proxyParams.contains(QLatin1String("nvenc")) ||
+                            proxyParams.contains(QLatin1String("cuvid")) || proxyParams.contains(QLatin1String("videotoolbox"));
+            segmented = !hwEncode && m_jobDuration >= 120 && QThread::idealThreadCount() > 2;
+            const int sourceWidth = binClip->getProducerProperty(QStringLiteral("meta.media.width")).toInt();
+            if (KdenliveSettings::proxyladder() && !m_isCanceled && sourceWidth >= 4 * proxyResize) {
+                // The full quality proxy of a very large source can take a long time; encode a
+                // small draft rung first and swap it in so the clip is usable right away. The
+                // draft is replaced and deleted once the real proxy finishes.
+                int draftWidth = qMax(320, proxyResize / 4);
+                draftWidth += draftWidth % 2;
+                const QString draftDest = dest.section(QLatin1Char('.'), 0, -2) + QStringLiteral("-draft.") + dest.section(QLatin1Char('.'), -1);
+                QStringList draftParams = {QStringLiteral("-hide_banner"), QStringLiteral("-y"), QStringLiteral("-v"), QStringLiteral("error")};
+                draftParams << QStringLiteral("-noautorotate") << QStringLiteral("-i") << source;
+                draftParams << QStringLiteral("-vf") << QStringLiteral("scale=%1:-2").arg(draftWidth);
+                draftParams << QStringLiteral("-c:v") << QStringLiteral("libx264") << QStringLiteral("-preset") << QStringLiteral("ultrafast")
+                            << QStringLiteral("-crf") << QStringLiteral("30") << QStringLiteral("-g") << QStringLiteral("5");
+                draftParams << QStringLiteral("-c:a") << QStringLiteral("aac") << QStringLiteral("-b:a") << QStringLiteral("128k");
+                draftParams << QStringLiteral("-sn") << QStringLiteral("-dn") << QStringLiteral("-map") << QStringLiteral("0")
+                            << QStringLiteral("-ignore_unknown") << draftDest;
+                QProcess draftProcess;
+                QObject::connect(this, &ProxyTask::jobCanceled, &draftProcess, &QProcess::kill, Qt::DirectConnection);
+                draftProcess.start(KdenliveSettings::ffmpegpath(), draftParams, QIODevice::ReadOnly);
+                AbstractTask::setPreferredPriority(draftProcess.processId());
+                draftProcess.waitForFinished(-1);
+                if (!m_isCanceled && draftProcess.exitStatus() == QProcess::NormalExit && QFileInfo(draftDest).size() > 0) {
+                    draftProxy = draftDest;
+                    QMetaObject::invokeMethod(binClip.get(), "updateProxyProducer", Qt::QueuedConnection, Q_ARG(QString, draftDest));
+                } else {
+                    QFile::remove(draftDest);
+                }
+            }
+        }
+        if (segmented) {
+            // Long clip on a multicore box: encode in concurrent segments so the job scales
+            // across cores and an interrupted encode resumes from the last finished segment
+            result = runSegmentedEncode(parameters, source, dest, m_jobDuration, m_logDetails);
+        } else {
+            m_jobProcess.reset(new QProcess);
+            // m_jobProcess->setProcessChannelMode(QProcess::MergedChannels);
+            QObject::connect(m_jobProcess.get(), &QProcess::readyReadStandardError, this, &ProxyTask::processLogInfo);
+            QObject::connect(this, &ProxyTask::jobCanceled, m_jobProcess.get(), &QProcess::kill, Qt::DirectConnection);
+            m_jobProcess->start(KdenliveSettings::ffmpegpath(), parameters, QIODevice::ReadOnly);
+            AbstractTask::setPreferredPriority(m_jobProcess->processId());
+            m_jobProcess->waitForFinished(-1);
+            result = m_jobProcess->exitStatus() == QProcess::NormalExit;
         }
-        m_jobProcess.reset(new QProcess);
-        // m_jobProcess->setProcessChannelMode(QProcess::MergedChannels);
-        QObject::connect(m_jobProcess.get(), &QProcess::readyReadStandardError, this, &ProxyTask::processLogInfo);
-        QObject::connect(this, &ProxyTask::jobCanceled, m_jobProcess.get(), &QProcess::kill, Qt::DirectConnection);
-        m_jobProcess->start(KdenliveSettings::ffmpegpath(), parameters, QIODevice::ReadOnly);
-        AbstractTask::setPreferredPriority(m_jobProcess->processId());
-        m_jobProcess->waitForFinished(-1);
-        result = m_jobProcess->exitStatus() == QProcess::NormalExit;
     }
     // remove temporary playlist if it exists
     m_progress = 100;
     if (result && !m_isCanceled) {
         if (QFileInfo(dest).size() == 0) {
             QFile::remove(dest);
+            if (!draftProxy.isEmpty()) {
+                QFile::remove(draftProxy);
+            }
             // File was not created
             result = false;
             QMetaObject::invokeMethod(pCore.get(), "displayBinLogMessage", Qt::QueuedConnection, Q_ARG(QString, i18n("Failed to create proxy clip.")),
@@ -403,11 +447,30 @@ void ProxyTask::run()
             }
         } else if (binClip) {
             // Job successful
+            if (type != ClipType::Image) {
+                // Audit the fresh proxy against the source before it goes live; a silent
+                // duration or frame rate drift would corrupt every render using it
+                const QString conformance = checkProxyConformance(binClip, dest);
+                if (conformance.isEmpty()) {
+                    binClip->resetProducerProperty(QStringLiteral("kdenlive:proxy_mismatch"));
+                } else {
+                    binClip->setProducerProperty(QStringLiteral("kdenlive:proxy_mismatch"), conformance);
+                    QMetaObject::invokeMethod(pCore.get(), "displayBinLogMessage", Qt::QueuedConnection,
+                                              Q_ARG(QString, i18n("Proxy clip does not match its source (%1)", conformance)),
+                                              Q_ARG(int, int(KMessageWidget::Warning)), Q_ARG(QString, m_logDetails));
+                }
+            }
             QMetaObject::invokeMethod(binClip.get(), "updateProxyProducer", Qt::QueuedConnection, Q_ARG(QString, dest));
+            if (!draftProxy.isEmpty()) {
+                QFile::remove(draftProxy);
+            }
         }
     } else {
         // Proxy process crashed
         QFile::remove(dest);
+        if (!draftProxy.isEmpty()) {
+            QFile::remove(draftProxy);
+        }
         if (!m_isCanceled) {
             QMetaObject::invokeMethod(pCore.get(), "displayBinLogMessage", Qt::QueuedConnection, Q_ARG(QString, i18n("Failed to create proxy clip.")),
                                       Q_ARG(int, int(KMessageWidget::Warning)), Q_ARG(QString, m_logDetails));
@@ -417,6 +480,65 @@ void ProxyTask::run()
     return;
 }
 
+const QString ProxyTask::checkProxyConformance(const std::shared_ptr<ProjectClip> &binClip, const QString &proxyPath)
+{
+    if (!QFileInfo(KdenliveSettings::ffprobepath()).isFile()) {
+        return QString();
+    }
+    QProcess probe;
+    const QStringList args = {QStringLiteral("-v"),
+                              QStringLiteral("error"),
+                              QStringLiteral("-select_streams"),
+                              QStringLiteral("v:0"),
+                              QStringLiteral("-show_entries"),
+                              QStringLiteral("stream=width,height,r_frame_rate:format=duration"),
+                              QStringLiteral("-of"),
+                              QStringLiteral("default=noprint_wrappers=1"),
+                              proxyPath};
+    probe.start(KdenliveSettings::ffprobepath(), args, QIODevice::ReadOnly);
+    if (!probe.waitForFinished(10000) || probe.exitStatus() != QProcess::NormalExit) {
+        return QString();
+    }
+    double proxyFps = 0.;
+    double proxyDuration = 0.;
+    int proxyWidth = 0;
+    int proxyHeight = 0;
+    const QStringList lines = QString::fromUtf8(probe.readAllStandardOutput()).split(QLatin1Char('\n'), Qt::SkipEmptyParts);
+    for (const QString &line : lines) {
+        const QString value = line.section(QLatin1Char('='), 1).simplified();
+        if (line.startsWith(QLatin1String("width="))) {
+            proxyWidth = value.toInt();
+        } else if (line.startsWith(QLatin1String("height="))) {
+            proxyHeight = value.toInt();
+        } else if (line.startsWith(QLatin1String("r_frame_rate="))) {
+            double num = value.section(QLatin1Char('/'), 0, 0).toDouble();
+            double den = value.section(QLatin1Char('/'), 1, 1).toDouble();
+            proxyFps = den > 0. ? num / den : num;
+        } else if (line.startsWith(QLatin1String("duration="))) {
+            proxyDuration = value.toDouble();
+        }
+    }
+    QStringList problems;
+    const double sourceFps = binClip->getOriginalFps();
+    if (proxyFps > 0. && sourceFps > 0. && qAbs(proxyFps - sourceFps) > 0.01) {
+        problems << i18n("frame rate %1 instead of %2", QString::number(proxyFps, 'f', 3), QString::number(sourceFps, 'f', 3));
+    }
+    const double sourceDuration = binClip->duration().seconds();
+    if (proxyDuration > 0. && sourceDuration > 0. && qAbs(proxyDuration - sourceDuration) > qMax(0.5, sourceDuration / 100.)) {
+        problems << i18n("duration %1s instead of %2s", QString::number(proxyDuration, 'f', 2), QString::number(sourceDuration, 'f', 2));
+    }
+    const int sourceWidth = binClip->getProducerProperty(QStringLiteral("meta.media.width")).toInt();
+    const int sourceHeight = binClip->getProducerProperty(QStringLiteral("meta.media.height")).toInt();
+    if (proxyWidth > 0 && proxyHeight > 0 && sourceWidth > 0 && sourceHeight > 0) {
+        const double proxyRatio = double(proxyWidth) / proxyHeight;
+        const double sourceRatio = double(sourceWidth) / sourceHeight;
+        if (qAbs(proxyRatio - sourceRatio) > 0.02) {
+            problems << i18n("frame geometry %1x%2 does not match the source aspect", proxyWidth, proxyHeight);
+        }
+    }
+    return problems.join(QLatin1String(", "));
+}
+
 void ProxyTask::processLogInfo()
 {
     const QString buffer = QString::fromUtf8(m_jobProcess->readAllStandardError());
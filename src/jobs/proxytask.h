@@ -8,6 +8,9 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 
 #include "abstracttask.h"
 
+#include <memory>
+
+class ProjectClip;
 class QProcess;
 
 class ProxyTask : public AbstractTask
@@ -23,6 +26,10 @@ private Q_SLOTS:
     void processLogInfo();
 
 private:
+    /** @brief Probe the rendered proxy and compare duration, frame rate and frame geometry
+     *  against the source clip. Returns a description of the discrepancies, or an empty
+     *  string when the proxy conforms (or cannot be probed). */
+    const QString checkProxyConformance(const std::shared_ptr<ProjectClip> &binClip, const QString &proxyPath);
     int m_jobDuration;
     bool m_isFfmpegJob;
     std::unique_ptr<QProcess> m_jobProcess;
@@ -129,15 +129,28 @@ void SceneSplitTask::run()
     }
     m_jobDuration = int(binClip->duration().seconds());
     int producerDuration = binClip->frameDuration();
+    // On long clips, run the scene score on downscaled video first: FFmpeg computes the
+    // score on the frames it is given, so a 320px wide pass is mostly decode bound and
+    // an order of magnitude faster. Candidate cuts are then re-scored at full resolution
+    // in a short window around each candidate, and false positives are dropped.
+    const bool fastPass = m_jobDuration > 60;
+    QString detectFilter;
+    if (fastPass) {
+        // Slightly lower threshold for the candidate pass, downscaling softens the score
+        detectFilter = QString("scale=320:-2:flags=fast_bilinear,select='gt(scene,%1)',showinfo").arg(m_threshold * 0.6);
+    } else {
+        detectFilter = QString("select='gt(scene,%1)',showinfo").arg(m_threshold);
+    }
     // QStringList parameters =
     // {QStringLiteral("-loglevel"),QStringLiteral("info"),QStringLiteral("-i"),source,QStringLiteral("-filter:v"),QString("scdet"),QStringLiteral("-f"),QStringLiteral("null"),QStringLiteral("-")};
     QStringList parameters = {QStringLiteral("-y"),
                               QStringLiteral("-loglevel"),
                               QStringLiteral("info"),
+                              QStringLiteral("-an"),
                               QStringLiteral("-i"),
                               source,
                               QStringLiteral("-filter:v"),
-                              QString("select='gt(scene,%1)',showinfo").arg(m_threshold),
+                              detectFilter,
                               QStringLiteral("-vsync"),
                               QStringLiteral("vfr"),
                               QStringLiteral("-f"),
@@ -162,6 +175,65 @@ void SceneSplitTask::run()
     m_jobProcess->waitForFinished(-1);
     result = m_jobProcess->exitStatus() == QProcess::NormalExit;
 
+    if (fastPass && result && !m_isCanceled) {
+        // Refine the low resolution candidates at full resolution, decoding only a
+        // 2 second window around each one
+        const QList<double> candidates = m_results;
+        m_results.clear();
+        int done = 0;
+        for (double candidate : candidates) {
+            if (m_isCanceled) {
+                break;
+            }
+            const double windowStart = qMax(0., candidate - 1.);
+            QStringList refineParams = {QStringLiteral("-y"),
+                                        QStringLiteral("-loglevel"),
+                                        QStringLiteral("info"),
+                                        QStringLiteral("-an"),
+                                        QStringLiteral("-ss"),
+                                        QString::number(windowStart, 'f', 3),
+                                        QStringLiteral("-t"),
+                                        QStringLiteral("2"),
+                                        QStringLiteral("-i"),
+                                        source,
+                                        QStringLiteral("-filter:v"),
+                                        QString("select='gt(scene,%1)',showinfo").arg(m_threshold),
+                                        QStringLiteral("-vsync"),
+                                        QStringLiteral("vfr"),
+                                        QStringLiteral("-f"),
+                                        QStringLiteral("null"),
+                                        QStringLiteral("-")};
+            QProcess refineProcess;
+            refineProcess.setProcessChannelMode(QProcess::MergedChannels);
+            QMetaObject::Connection killConnection =
+                QObject::connect(this, &SceneSplitTask::jobCanceled, &refineProcess, &QProcess::kill, Qt::DirectConnection);
+            refineProcess.start(KdenliveSettings::ffmpegpath(), refineParams);
+            refineProcess.waitForFinished(-1);
+            QObject::disconnect(killConnection);
+            const QString log = QString::fromUtf8(refineProcess.readAllStandardOutput());
+            QStringList output = log.split(QStringLiteral("[Parsed_showinfo"));
+            output.removeFirst();
+            for (const QString &o : qAsConst(output)) {
+                if (o.contains(QLatin1String("pts_time:"))) {
+                    bool ok = false;
+                    // Timestamps restart at 0 after the input seek
+                    double res = o.section(QStringLiteral("pts_time:"), 1).section(QLatin1Char(' '), 0, 0).toDouble(&ok);
+                    if (ok) {
+                        double refined = windowStart + res;
+                        // Close candidates can refine to the same cut
+                        if (m_results.isEmpty() || refined - m_results.constLast() > 0.25) {
+                            m_results << refined;
+                        }
+                        break;
+                    }
+                }
+            }
+            done++;
+            m_progress = 90 + 10 * done / int(candidates.size());
+            QMetaObject::invokeMethod(m_object, "updateJobProgress");
+        }
+    }
+
     // remove temporary playlist if it exists
     m_progress = 100;
     QMetaObject::invokeMethod(m_object, "updateJobProgress");
@@ -109,6 +109,15 @@ void StabilizeTask::run()
         }
         producerArgs << url;
         producerArgs << binClip->enforcedParams();
+        // Decoding, not the vidstab analysis, is the bottleneck on typical long-GOP
+        // footage, so enable multithreaded decoding like proxy/transcode jobs do
+        int threadCount = QThread::idealThreadCount();
+        if (threadCount > 2) {
+            threadCount = qMin(threadCount - 1, 4);
+        } else {
+            threadCount = 1;
+        }
+        producerArgs << QString("threads=%1").arg(threadCount);
 
         if (m_inPoint > -1) {
             producerArgs << QString("in=%1").arg(m_inPoint);
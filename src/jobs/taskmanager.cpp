@@ -24,8 +24,10 @@ TaskManager::TaskManager(QObject *parent)
     , m_tasksListLock(QReadWriteLock::Recursive)
     , m_blockUpdates(false)
 {
-    int maxThreads = qMin(4, QThread::idealThreadCount() - 1);
-    m_taskPool.setMaxThreadCount(qMax(maxThreads, 1));
+    // Load tasks are dominated by avformat probe latency, so allow more of them
+    // in flight on larger machines to speed up bulk imports
+    int maxThreads = qBound(2, QThread::idealThreadCount() - 1, 8);
+    m_taskPool.setMaxThreadCount(maxThreads);
     m_transcodePool.setMaxThreadCount(KdenliveSettings::proxythreads());
 }
 
@@ -47,53 +49,58 @@ void TaskManager::updateConcurrency()
 void TaskManager::discardJobs(const ObjectId &owner, AbstractTask::JOBTYPE type, bool softDelete, const QVector<AbstractTask::JOBTYPE> exceptions)
 {
     qDebug() << "========== READY FOR TASK DISCARD ON: " << owner.itemId;
+    discardJobs(QList<ObjectId>{owner}, type, softDelete, exceptions);
+}
+
+void TaskManager::discardJobs(const QList<ObjectId> &owners, AbstractTask::JOBTYPE type, bool softDelete, const QVector<AbstractTask::JOBTYPE> exceptions)
+{
     if (m_blockUpdates) {
         // We are already deleting all tasks
         return;
     }
+    std::vector<AbstractTask *> taskList;
     m_tasksListLock.lockForRead();
-    // See if there is already a task for this MLT service and resource.
-    if (m_taskList.find(owner.itemId) == m_taskList.end()) {
-        m_tasksListLock.unlock();
-        return;
+    for (const ObjectId &owner : owners) {
+        auto it = m_taskList.find(owner.itemId);
+        if (it != m_taskList.end()) {
+            taskList.insert(taskList.end(), it->second.begin(), it->second.end());
+        }
     }
-    std::vector<AbstractTask *> taskList = m_taskList.at(owner.itemId);
     m_tasksListLock.unlock();
-    int ix = taskList.size() - 1;
-    while (ix >= 0) {
-        AbstractTask *t = taskList.at(ix);
+    // First pass: drain the tasks that were not started yet and signal cancellation to
+    // every matching running task at once
+    std::vector<AbstractTask *> canceledTasks;
+    for (AbstractTask *t : taskList) {
         AbstractTask::JOBTYPE taskType = t->m_type;
-        // If so, then just add ourselves to be notified upon completion.
         if (exceptions.contains(taskType) || t->isCanceled()) {
             // Don't abort
-            ix--;
             continue;
         }
         if ((type != AbstractTask::NOJOBTYPE && type != taskType) || t->m_progress == 100) {
-            ix--;
             continue;
         }
         if (taskType != AbstractTask::TRANSCODEJOB && taskType != AbstractTask::PROXYJOB) {
             if (m_taskPool.tryTake(t)) {
                 // Task was not started yet, we can simply delete
                 delete t;
-                ix--;
                 continue;
             }
         } else {
             if (m_transcodePool.tryTake(t)) {
                 // Task was not started yet, we can simply delete
                 delete t;
-                ix--;
                 continue;
             }
         }
         t->cancelJob(softDelete);
-        // Block until the task is finished
+        canceledTasks.push_back(t);
+    }
+    // Second pass: block until the running tasks are finished; they were all signaled
+    // above, so the total wait is the longest task instead of the sum of all of them
+    for (AbstractTask *t : canceledTasks) {
         t->m_runMutex.lock();
         t->m_runMutex.unlock();
         t->deleteLater();
-        ix--;
     }
 }
 
@@ -215,51 +222,53 @@ void TaskManager::slotCancelJobs(bool leaveBlocked, const QVector<AbstractTask::
     }
     m_tasksListLock.lockForWrite();
     m_blockUpdates = true;
-
+    // Snapshot the task list and release the lock, so clip status queries from the UI
+    // are not stalled while we wait for the running tasks to terminate
+    std::vector<AbstractTask *> allTasks;
     for (const auto &task : m_taskList) {
-        int ix = task.second.size() - 1;
-        while (ix >= 0) {
-            AbstractTask *t = task.second.at(ix);
-            AbstractTask::JOBTYPE taskType = t->m_type;
-            if (exceptions.contains(taskType) || t->isCanceled() || t->m_progress == 100) {
-                ix--;
+        allTasks.insert(allTasks.end(), task.second.begin(), task.second.end());
+    }
+    m_tasksListLock.unlock();
+
+    // Signal cancellation to all tasks first so they abort concurrently, then wait
+    std::vector<AbstractTask *> canceledTasks;
+    for (AbstractTask *t : allTasks) {
+        AbstractTask::JOBTYPE taskType = t->m_type;
+        if (exceptions.contains(taskType) || t->isCanceled() || t->m_progress == 100) {
+            continue;
+        }
+        if (taskType != AbstractTask::TRANSCODEJOB && taskType != AbstractTask::PROXYJOB) {
+            if (m_taskPool.tryTake(t)) {
+                // Task was not started yet, we can simply delete
+                delete t;
                 continue;
             }
-            if (taskType != AbstractTask::TRANSCODEJOB && taskType != AbstractTask::PROXYJOB) {
-                if (m_taskPool.tryTake(t)) {
-                    // Task was not started yet, we can simply delete
-                    delete t;
-                    ix--;
-                    continue;
-                }
-            } else {
-                if (m_transcodePool.tryTake(t)) {
-                    // Task was not started yet, we can simply delete
-                    delete t;
-                    ix--;
-                    continue;
-                }
-            }
-            if (m_taskList.find(task.first) != m_taskList.end()) {
-                // If so, then just add ourselves to be notified upon completion.
-                t->cancelJob();
-                t->m_runMutex.lock();
-                t->m_runMutex.unlock();
-                t->deleteLater();
+        } else {
+            if (m_transcodePool.tryTake(t)) {
+                // Task was not started yet, we can simply delete
+                delete t;
+                continue;
             }
-            ix--;
         }
+        t->cancelJob();
+        canceledTasks.push_back(t);
+    }
+    for (AbstractTask *t : canceledTasks) {
+        t->m_runMutex.lock();
+        t->m_runMutex.unlock();
+        t->deleteLater();
     }
     if (exceptions.isEmpty()) {
         m_taskPool.waitForDone();
         m_transcodePool.waitForDone();
+        m_tasksListLock.lockForWrite();
         m_taskList.clear();
+        m_tasksListLock.unlock();
         m_taskPool.clear();
     }
     if (!leaveBlocked) {
         m_blockUpdates = false;
     }
-    m_tasksListLock.unlock();
     updateJobCount();
 }
 
@@ -276,18 +285,28 @@ void TaskManager::startTask(int ownerId, AbstractTask *task)
         return;
     }
     m_tasksListLock.lockForWrite();
+    size_t queuedForOwner = 0;
     if (m_taskList.find(ownerId) == m_taskList.end()) {
         // First task for this clip
         m_taskList[ownerId] = {task};
     } else {
+        queuedForOwner = m_taskList[ownerId].size();
         m_taskList[ownerId].emplace_back(task);
     }
     m_tasksListLock.unlock();
+    int priority = task->m_priority;
+    if (ownerId == displayedClip) {
+        // Tasks feeding the clip currently shown in the monitor serve what is on screen right now
+        priority += 2;
+    }
+    // Per-owner fairness: each task already queued for the same clip lowers the priority
+    // a notch, so one giant clip cannot monopolize the pool over everybody else
+    priority -= qMin(int(queuedForOwner), 4);
     if (task->m_type == AbstractTask::TRANSCODEJOB || task->m_type == AbstractTask::PROXYJOB) {
         // We only want a limited concurrent jobs for those as for example GPU usually only accept 2 concurrent encoding jobs
-        m_transcodePool.start(task, task->m_priority);
+        m_transcodePool.start(task, priority);
     } else {
-        m_taskPool.start(task, task->m_priority);
+        m_taskPool.start(task, priority);
     }
     updateJobCount();
 }
@@ -43,6 +43,12 @@ public:
      *  @param type The type of job that you want to abort, leave to NOJOBTYPE to abort all jobs
      */
     void discardJobs(const ObjectId &owner, AbstractTask::JOBTYPE type = AbstractTask::NOJOBTYPE, bool softDelete = false, const QVector<AbstractTask::JOBTYPE> exceptions = {});
+    /** @brief Discard jobs for a whole group of items (e.g. all clips of a folder) in one
+     *  batch: every matching task is signaled to cancel first, then the running ones are
+     *  waited for, so the total wait is the longest task instead of the sum
+     */
+    void discardJobs(const QList<ObjectId> &owners, AbstractTask::JOBTYPE type = AbstractTask::NOJOBTYPE, bool softDelete = false,
+                     const QVector<AbstractTask::JOBTYPE> exceptions = {});
     void discardJob(const ObjectId &owner, const QUuid &uuid);
 
     /** @brief Check if there is a pending / running job a clip.
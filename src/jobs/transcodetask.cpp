@@ -214,14 +214,46 @@ void TranscodeTask::run()
             }
         }
         qDebug() << "/// FULL TRANSCODE PARAMS:\n" << parameters << "\n------";
-        m_jobProcess.reset(new QProcess);
-        // m_jobProcess->setProcessChannelMode(QProcess::MergedChannels);
-        QObject::connect(this, &TranscodeTask::jobCanceled, m_jobProcess.get(), &QProcess::kill, Qt::DirectConnection);
-        QObject::connect(m_jobProcess.get(), &QProcess::readyReadStandardError, this, &TranscodeTask::processLogInfo);
-        m_jobProcess->start(KdenliveSettings::ffmpegpath(), parameters, QIODevice::ReadOnly);
-        AbstractTask::setPreferredPriority(m_jobProcess->processId());
-        m_jobProcess->waitForFinished(-1);
-        result = m_jobProcess->exitStatus() == QProcess::NormalExit;
+        result = false;
+        const QStringList hwParameters = hwAcceleratedParams(parameters);
+        if (!hwParameters.isEmpty()) {
+            // A hardware encoder matching the preset codec passed the wizard probe, try it first
+            qDebug() << "/// HW TRANSCODE PARAMS:\n" << hwParameters << "\n------";
+            m_jobProcess.reset(new QProcess);
+            QObject::connect(this, &TranscodeTask::jobCanceled, m_jobProcess.get(), &QProcess::kill, Qt::DirectConnection);
+            QObject::connect(m_jobProcess.get(), &QProcess::readyReadStandardError, this, &TranscodeTask::processLogInfo);
+            m_jobProcess->start(KdenliveSettings::ffmpegpath(), hwParameters, QIODevice::ReadOnly);
+            AbstractTask::setPreferredPriority(m_jobProcess->processId());
+            m_jobProcess->waitForFinished(-1);
+            result = m_jobProcess->exitStatus() == QProcess::NormalExit && m_jobProcess->exitCode() == 0;
+            if (!result && !m_isCanceled) {
+                // The hardware session can fail on unsupported sources or exhausted encode
+                // sessions, silently fall back to the preset's software encoder
+                qDebug() << "/// HW TRANSCODE FAILED, falling back to software";
+                QFile::remove(destUrl + transcoderExt);
+                m_progress = 0;
+                QMetaObject::invokeMethod(m_object, "updateJobProgress");
+            }
+        }
+        if (!result && !m_isCanceled) {
+            // Long clip on a multicore box: software encode in concurrent segments like
+            // proxy generation does, so converting long rushes scales across cores
+            bool segmented = hwParameters.isEmpty() && m_inPoint < 0 && m_outPoint < 0 && m_jobDuration >= 120 && QThread::idealThreadCount() > 2 &&
+                             !m_transcodeParams.contains(QLatin1String("copy")) && !m_transcodeParams.contains(QLatin1String("-vn"));
+            if (segmented) {
+                result = runSegmentedEncode(parameters, source, destUrl + transcoderExt, m_jobDuration, m_logDetails);
+            }
+            if (!result && !m_isCanceled) {
+                m_jobProcess.reset(new QProcess);
+                // m_jobProcess->setProcessChannelMode(QProcess::MergedChannels);
+                QObject::connect(this, &TranscodeTask::jobCanceled, m_jobProcess.get(), &QProcess::kill, Qt::DirectConnection);
+                QObject::connect(m_jobProcess.get(), &QProcess::readyReadStandardError, this, &TranscodeTask::processLogInfo);
+                m_jobProcess->start(KdenliveSettings::ffmpegpath(), parameters, QIODevice::ReadOnly);
+                AbstractTask::setPreferredPriority(m_jobProcess->processId());
+                m_jobProcess->waitForFinished(-1);
+                result = m_jobProcess->exitStatus() == QProcess::NormalExit;
+            }
+        }
     }
     destUrl.append(transcoderExt);
     // remove temporary playlist if it exists
@@ -273,6 +305,89 @@ void TranscodeTask::run()
     }
 }
 
+QStringList TranscodeTask::hwAcceleratedParams(const QStringList &parameters) const
+{
+    const QStringList hwCodecs = KdenliveSettings::supportedHWCodecs();
+    if (hwCodecs.isEmpty()) {
+        return {};
+    }
+    // Only x264/x265 presets have fixed-function twins on all vendors
+    int codecIndex = -1;
+    QString family;
+    for (int ix = 1; ix < parameters.size(); ix++) {
+        const QString &arg = parameters.at(ix - 1);
+        if (arg == QLatin1String("-vcodec") || arg == QLatin1String("-c:v") || arg == QLatin1String("-codec:v")) {
+            if (parameters.at(ix) == QLatin1String("libx264")) {
+                family = QStringLiteral("h264");
+            } else if (parameters.at(ix) == QLatin1String("libx265")) {
+                family = QStringLiteral("hevc");
+            }
+            codecIndex = ix;
+            break;
+        }
+    }
+    if (family.isEmpty()) {
+        return {};
+    }
+    // VAAPI runs the whole frame path on the GPU, which conflicts with software filters
+    const bool hasFilters = parameters.contains(QStringLiteral("-vf")) || parameters.contains(QStringLiteral("-filter:v"));
+    QString encoder;
+    for (const QString &suffix :
+         {QStringLiteral("_nvenc"), QStringLiteral("_qsv"), QStringLiteral("_videotoolbox"), QStringLiteral("_amf"), QStringLiteral("_vaapi")}) {
+        const QString candidate = family + suffix;
+        if (hwCodecs.contains(candidate) && !(hasFilters && suffix == QLatin1String("_vaapi"))) {
+            encoder = candidate;
+            break;
+        }
+    }
+    if (encoder.isEmpty()) {
+        return {};
+    }
+    QStringList hwParams = parameters;
+    hwParams[codecIndex] = encoder;
+    // Convert the libx264/libx265 rate control to the hardware encoder's equivalent
+    int crfIndex = hwParams.indexOf(QStringLiteral("-crf"));
+    if (crfIndex > -1 && crfIndex + 1 < hwParams.size()) {
+        if (encoder.endsWith(QLatin1String("_nvenc"))) {
+            hwParams[crfIndex] = QStringLiteral("-cq");
+        } else if (encoder.endsWith(QLatin1String("_qsv"))) {
+            hwParams[crfIndex] = QStringLiteral("-global_quality");
+        } else if (encoder.endsWith(QLatin1String("_vaapi"))) {
+            hwParams[crfIndex] = QStringLiteral("-qp");
+        } else if (encoder.endsWith(QLatin1String("_videotoolbox"))) {
+            hwParams[crfIndex] = QStringLiteral("-q:v");
+        } else {
+            // AMF has no CRF equivalent, use its default rate control
+            hwParams.removeAt(crfIndex + 1);
+            hwParams.removeAt(crfIndex);
+        }
+    }
+    // Drop the libx264 speed presets the hardware encoders do not understand
+    int presetIndex = hwParams.indexOf(QStringLiteral("-preset"));
+    if (presetIndex > -1 && presetIndex + 1 < hwParams.size()) {
+        static const QStringList compatiblePresets = {QStringLiteral("fast"), QStringLiteral("medium"), QStringLiteral("slow")};
+        if (!compatiblePresets.contains(hwParams.at(presetIndex + 1))) {
+            hwParams.removeAt(presetIndex + 1);
+            hwParams.removeAt(presetIndex);
+        }
+    }
+    if (encoder.endsWith(QLatin1String("_vaapi"))) {
+        int inputIndex = hwParams.indexOf(QStringLiteral("-i"));
+        if (inputIndex < 0) {
+            return {};
+        }
+        // Decode on the GPU when possible; the format/hwupload chain covers sources the
+        // hardware cannot decode by uploading the software frames
+        hwParams.insert(inputIndex, QStringLiteral("vaapi"));
+        hwParams.insert(inputIndex, QStringLiteral("-hwaccel_output_format"));
+        hwParams.insert(inputIndex, QStringLiteral("vaapi"));
+        hwParams.insert(inputIndex, QStringLiteral("-hwaccel"));
+        hwParams.insert(hwParams.size() - 1, QStringLiteral("-vf"));
+        hwParams.insert(hwParams.size() - 1, QStringLiteral("format=nv12|vaapi,hwupload"));
+    }
+    return hwParams;
+}
+
 void TranscodeTask::processLogInfo()
 {
     const QString buffer = QString::fromUtf8(m_jobProcess->readAllStandardError());
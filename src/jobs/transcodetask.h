@@ -35,4 +35,9 @@ private:
     std::unique_ptr<QProcess> m_jobProcess;
     QString m_errorMessage;
     QString m_logDetails;
+    /** @brief Rewrite an FFmpeg command to use a hardware encoder probed by the config wizard.
+     *  Picks the encoder matching the preset's software codec (NVENC/VAAPI/QSV/AMF/VideoToolbox)
+     *  and converts the rate control options accordingly.
+     *  @returns the rewritten command, or an empty list if no suitable hardware encoder is available */
+    QStringList hwAcceleratedParams(const QStringList &parameters) const;
 };
@@ -30,6 +30,7 @@ JogShuttleAction::JogShuttleAction(const JogShuttle *jogShuttle, QStringList act
 
     connect(m_jogShuttle, &JogShuttle::jogBack, pCore->monitorManager(), &MonitorManager::slotRewindOneFrame);
     connect(m_jogShuttle, &JogShuttle::jogForward, pCore->monitorManager(), &MonitorManager::slotForwardOneFrame);
+    connect(m_jogShuttle, &JogShuttle::jogStep, this, &JogShuttleAction::slotJogStep);
     connect(m_jogShuttle, &JogShuttle::shuttlePos, this, &JogShuttleAction::slotShuttlePos);
     connect(m_jogShuttle, &JogShuttle::button, this, &JogShuttleAction::slotButton);
 
@@ -54,6 +55,20 @@ void JogShuttleAction::slotShuttlePos(int shuttle_pos)
     }
 }
 
+void JogShuttleAction::slotJogStep(int offset)
+{
+    int fps = qRound(pCore->getCurrentFps());
+    if (fps > 0 && qAbs(offset) >= fps / 2) {
+        // The ring is spinning fast, align the step on a whole second so long-GOP seeks land
+        // close to an I-frame instead of forcing a mid-GOP decode on every tick
+        int rounded = qRound(double(offset) / fps) * fps;
+        if (rounded != 0) {
+            offset = rounded;
+        }
+    }
+    pCore->monitorManager()->slotStepFrames(offset);
+}
+
 void JogShuttleAction::slotButton(int button_id)
 {
     if (button_id >= m_actionMap.size() || m_actionMap[button_id].isEmpty()) {
@@ -22,6 +22,7 @@ private:
 
 public Q_SLOTS:
     void slotShuttlePos(int);
+    void slotJogStep(int offset);
     void slotButton(int);
 
 Q_SIGNALS:
@@ -11,6 +11,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 
 #include <QApplication>
 #include <QDir>
+#include <QElapsedTimer>
 #include <cerrno>
 #include <cstring>
 #include <sys/select.h>
@@ -76,12 +77,7 @@ void ShuttleThread::run()
         } else if (result > 0) {
             // we have input
             if (FD_ISSET(mc.fd, &readset)) {
-                media_ctrl_event mev;
-                mev.type = MEDIA_CTRL_EVENT_NONE;
-                // read input
-                media_ctrl_read_event(&mc, &mev);
-                // process event
-                handleEvent(mev);
+                readPendingEvents(&mc);
             }
         } else if (result == 0) {
             // on timeout
@@ -91,14 +87,44 @@ void ShuttleThread::run()
     media_ctrl_close(&mc);
 }
 
-void ShuttleThread::handleEvent(const media_ctrl_event &ev)
+void ShuttleThread::readPendingEvents(media_ctrl *mc)
 {
-    if (ev.type == MEDIA_CTRL_EVENT_KEY) {
-        key(ev);
-    } else if (ev.type == MEDIA_CTRL_EVENT_JOG) {
-        jog(ev);
-    } else if (ev.type == MEDIA_CTRL_EVENT_SHUTTLE) {
-        shuttle(ev);
+    // Fast ring spins generate events quicker than long-GOP seeking can satisfy them. Drain
+    // everything the device buffered in one go: jog ticks are summed into a single net step and
+    // only the latest shuttle position is kept, so the transport never replays a stale queue
+    int jogDelta = 0;
+    bool shuttleMoved = false;
+    int shuttleValue = 0;
+    fd_set readset;
+    struct timeval timeout;
+    while (true) {
+        media_ctrl_event mev;
+        mev.type = MEDIA_CTRL_EVENT_NONE;
+        // read input
+        media_ctrl_read_event(mc, &mev);
+        // process event
+        if (mev.type == MEDIA_CTRL_EVENT_KEY) {
+            key(mev);
+        } else if (mev.type == MEDIA_CTRL_EVENT_JOG) {
+            jogDelta += mev.value;
+        } else if (mev.type == MEDIA_CTRL_EVENT_SHUTTLE) {
+            shuttleMoved = true;
+            shuttleValue = mev.value;
+        }
+        // check if the device already buffered another event
+        FD_ZERO(&readset);
+        FD_SET(mc->fd, &readset);
+        timeout.tv_sec = 0;
+        timeout.tv_usec = 0;
+        if (select(mc->fd + 1, &readset, nullptr, nullptr, &timeout) <= 0 || !FD_ISSET(mc->fd, &readset)) {
+            break;
+        }
+    }
+    if (jogDelta != 0) {
+        QApplication::postEvent(m_parent, new MediaCtrlEvent(MediaCtrlEvent::Jog, jogDelta));
+    }
+    if (shuttleMoved) {
+        shuttle(shuttleValue);
     }
 }
 
@@ -109,9 +135,9 @@ void ShuttleThread::key(const media_ctrl_event &ev)
     }
 }
 
-void ShuttleThread::shuttle(const media_ctrl_event &ev)
+void ShuttleThread::shuttle(int shuttleValue)
 {
-    int value = ev.value / 2;
+    int value = shuttleValue / 2;
 
     if (value > MaxShuttleRange || value < -MaxShuttleRange) {
         // qCDebug(KDENLIVE_LOG) << "Jog shuttle value is out of range: " << MaxShuttleRange;
@@ -120,11 +146,6 @@ void ShuttleThread::shuttle(const media_ctrl_event &ev)
     QApplication::postEvent(m_parent, new MediaCtrlEvent(MediaCtrlEvent::Shuttle, value));
 }
 
-void ShuttleThread::jog(const media_ctrl_event &ev)
-{
-    QApplication::postEvent(m_parent, new MediaCtrlEvent(MediaCtrlEvent::Jog, ev.value));
-}
-
 JogShuttle::JogShuttle(const QString &device, QObject *parent)
     : QObject(parent)
     , m_shuttleProcess(device, this)
@@ -164,11 +185,19 @@ void JogShuttle::customEvent(QEvent *e)
     } else if (type == MediaCtrlEvent::Jog) {
         auto *mev = static_cast<MediaCtrlEvent *>(e);
         int value = mev->value();
-
-        if (value < 0) {
+        const qint64 queueDelay = QDateTime::currentMSecsSinceEpoch() - mev->postTime();
+        QElapsedTimer seekTimer;
+        seekTimer.start();
+        if (value == -1) {
             Q_EMIT jogBack();
-        } else if (value > 0) {
+        } else if (value == 1) {
             Q_EMIT jogForward();
+        } else if (value != 0) {
+            // Several ticks were coalesced while the previous seek was running
+            Q_EMIT jogStep(value);
+        }
+        if (value != 0) {
+            qCDebug(KDENLIVE_LOG) << "jog seek:" << value << "frame(s), queued for" << queueDelay << "ms, seek took" << seekTimer.elapsed() << "ms";
         }
     } else if (type == MediaCtrlEvent::Shuttle) {
         auto *mev = static_cast<MediaCtrlEvent *>(e);
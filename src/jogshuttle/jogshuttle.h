@@ -7,6 +7,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 
 #pragma once
 
+#include <QDateTime>
 #include <QEvent>
 #include <QMap>
 #include <QObject>
@@ -20,10 +21,13 @@ public:
     MediaCtrlEvent(QEvent::Type type, int value)
         : QEvent(type)
         , m_value(value)
+        , m_postTime(QDateTime::currentMSecsSinceEpoch())
     {
     }
 
     int value() { return m_value; }
+    /** @brief Time the device thread posted the event, to measure how far seeking lags behind the device */
+    qint64 postTime() { return m_postTime; }
 
     static const QEvent::Type Key;
     static const QEvent::Type Jog;
@@ -31,6 +35,7 @@ public:
 
 private:
     int m_value;
+    qint64 m_postTime;
 };
 
 class ShuttleThread : public QThread
@@ -46,9 +51,9 @@ public:
 private:
     enum { MaxShuttleRange = 7 };
 
-    void handleEvent(const media_ctrl_event &ev);
-    void jog(const media_ctrl_event &ev);
-    void shuttle(const media_ctrl_event &ev);
+    /** @brief Reads all buffered device events, coalescing jog ticks and keeping only the latest shuttle position */
+    void readPendingEvents(media_ctrl *mc);
+    void shuttle(int value);
     void key(const media_ctrl_event &ev);
 
     QString m_device;
@@ -80,6 +85,8 @@ private:
 Q_SIGNALS:
     void jogBack();
     void jogForward();
+    /** @brief Several jog ticks arrived while the previous seek was still running, step by the coalesced frame count */
+    void jogStep(int offset);
     void shuttlePos(int);
     void button(int);
 };
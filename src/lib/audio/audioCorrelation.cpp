@@ -9,6 +9,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include "kdenlive_debug.h"
 #include "klocalizedstring.h"
 #include <QElapsedTimer>
+#include <QtConcurrent>
 #include <cmath>
 #include <iostream>
 
@@ -22,6 +23,7 @@ AudioCorrelation::AudioCorrelation(std::unique_ptr<AudioEnvelope> mainTrackEnvel
 
 AudioCorrelation::~AudioCorrelation()
 {
+    m_futures.waitForFinished();
     for (AudioEnvelope *envelope : qAsConst(m_children)) {
         delete envelope;
     }
@@ -49,37 +51,46 @@ void AudioCorrelation::addChild(AudioEnvelope *envelope)
 
 void AudioCorrelation::slotProcessChild(AudioEnvelope *envelope)
 {
+    // Dispatch the correlation to the thread pool: when several clips are
+    // aligned against the same reference, they are processed concurrently
+    // instead of each waiting for the previous one to finish.
     // Note that at this point the computation of the envelope of the
     // main track might not be finished. envelope() will block until
     // the computation is done.
-    const size_t sizeMain = m_mainTrackEnvelope->envelope().size();
-    const size_t sizeSub = envelope->envelope().size();
+    m_futures.addFuture(QtConcurrent::run([this, envelope]() {
+        const size_t sizeMain = m_mainTrackEnvelope->envelope().size();
+        const size_t sizeSub = envelope->envelope().size();
 
-    auto *info = new AudioCorrelationInfo(sizeMain, sizeSub);
-    qint64 *correlation = info->correlationVector();
+        auto *info = new AudioCorrelationInfo(sizeMain, sizeSub);
+        qint64 *correlation = info->correlationVector();
 
-    const std::vector<qint64> &envMain = m_mainTrackEnvelope->envelope();
-    const std::vector<qint64> &envSub = envelope->envelope();
-    qint64 max = 0;
-
-    if (sizeSub > 200) {
-        FFTCorrelation::correlate(&envMain[0], sizeMain, &envSub[0], sizeSub, correlation);
-    } else {
-        correlate(&envMain[0], sizeMain, &envSub[0], sizeSub, correlation, &max);
-        info->setMax(max);
-    }
+        const std::vector<qint64> &envMain = m_mainTrackEnvelope->envelope();
+        const std::vector<qint64> &envSub = envelope->envelope();
+        qint64 max = 0;
 
-    m_children.append(envelope);
-    m_correlations.append(info);
+        if (sizeSub > 200) {
+            FFTCorrelation::correlate(&envMain[0], sizeMain, &envSub[0], sizeSub, correlation);
+        } else {
+            correlate(&envMain[0], sizeMain, &envSub[0], sizeSub, correlation, &max);
+            info->setMax(max);
+        }
 
-    Q_ASSERT(m_correlations.size() == m_children.size());
-    int index = m_children.indexOf(envelope);
-    int shift = getShift(index);
-    Q_EMIT gotAudioAlignData(envelope->clipId(), shift);
+        int index;
+        {
+            QMutexLocker locker(&m_listLock);
+            m_children.append(envelope);
+            m_correlations.append(info);
+            Q_ASSERT(m_correlations.size() == m_children.size());
+            index = m_children.size() - 1;
+        }
+        int shift = getShift(index);
+        Q_EMIT gotAudioAlignData(envelope->clipId(), shift);
+    }));
 }
 
 int AudioCorrelation::getShift(int childIndex) const
 {
+    QMutexLocker locker(&m_listLock);
     Q_ASSERT(childIndex >= 0);
     Q_ASSERT(childIndex < m_correlations.size());
 
@@ -92,6 +103,7 @@ int AudioCorrelation::getShift(int childIndex) const
 
 AudioCorrelationInfo const *AudioCorrelation::info(int childIndex) const
 {
+    QMutexLocker locker(&m_listLock);
     Q_ASSERT(childIndex >= 0);
     Q_ASSERT(childIndex < m_correlations.size());
 
@@ -10,7 +10,9 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include "audioCorrelationInfo.h"
 #include "audioEnvelope.h"
 #include "definitions.h"
+#include <QFutureSynchronizer>
 #include <QList>
+#include <QMutex>
 
 /**
   This class does the correlation between two tracks
@@ -63,6 +65,12 @@ private:
 
     QList<AudioEnvelope *> m_children;
     QList<AudioCorrelationInfo *> m_correlations;
+    /** Guards m_children and m_correlations, which are appended to from the
+        thread pool once a child correlation is computed. */
+    mutable QMutex m_listLock;
+    /** Correlations dispatched to the thread pool; the destructor waits for
+        them before deleting the children. */
+    QFutureSynchronizer<void> m_futures;
 
 private Q_SLOTS:
     /**
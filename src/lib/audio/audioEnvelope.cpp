@@ -14,6 +14,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include <KLocalizedString>
 #include <QElapsedTimer>
 #include <QImage>
+#include <QThread>
 #include <QtConcurrent>
 #include <algorithm>
 #include <cmath>
@@ -33,6 +34,20 @@ AudioEnvelope::AudioEnvelope(const QString &binId, int clipId, size_t offset, si
     m_envelopeSize = size_t(m_producer->get_playtime());
 
     m_producer->set("set.test_image", 1);
+    if (m_envelopeSize > 4000) {
+        // Long clips are decoded in parallel segments. Each worker needs its own
+        // producer, so create the clones here while we are still on the caller's
+        // thread.
+        int workers = qBound(2, QThread::idealThreadCount() / 2, 4);
+        for (int i = 0; i < workers; ++i) {
+            std::shared_ptr<Mlt::Producer> segmentProducer = clip->cloneProducer();
+            if (length > 2000) {
+                segmentProducer->set_in_and_out(int(offset), int(offset + length));
+            }
+            segmentProducer->set("set.test_image", 1);
+            m_segmentProducers.push_back(std::move(segmentProducer));
+        }
+    }
     connect(&m_watcher, &QFutureWatcherBase::finished, this, [this] { Q_EMIT envelopeReady(this); });
     if (!m_producer || !m_producer->is_valid()) {
         qCDebug(KDENLIVE_LOG) << "// Cannot create envelope for producer: " << binId;
@@ -108,19 +123,40 @@ AudioEnvelope::AudioSummary AudioEnvelope::loadAndNormalizeEnvelope() const
 
     QElapsedTimer t;
     t.start();
-    m_producer->seek(0);
     size_t max = summary.audioAmplitudes.size();
-    for (size_t i = 0; i < max; ++i) {
-        std::unique_ptr<Mlt::Frame> frame(m_producer->get_frame(int(i)));
-        qint64 position = mlt_frame_get_position(frame->get_frame());
-        int samples = mlt_audio_calculate_frame_samples(float(m_producer->get_fps()), samplingRate, position);
-        auto *data = static_cast<qint16 *>(frame->get_audio(format_s16, samplingRate, channels, samples));
-
-        summary.audioAmplitudes[i] = 0;
-        for (int k = 0; k < samples; ++k) {
-            summary.audioAmplitudes[i] += abs(data[k]);
+    QAtomicInt framesDone;
+    auto decodeRange = [&](Mlt::Producer *producer, size_t first, size_t last) {
+        producer->seek(int(first));
+        for (size_t i = first; i < last; ++i) {
+            std::unique_ptr<Mlt::Frame> frame(producer->get_frame(int(i)));
+            qint64 position = mlt_frame_get_position(frame->get_frame());
+            int samples = mlt_audio_calculate_frame_samples(float(producer->get_fps()), samplingRate, position);
+            auto *data = static_cast<qint16 *>(frame->get_audio(format_s16, samplingRate, channels, samples));
+
+            summary.audioAmplitudes[i] = 0;
+            for (int k = 0; k < samples; ++k) {
+                summary.audioAmplitudes[i] += abs(data[k]);
+            }
+            pCore->displayMessage(i18n("Processing data analysis"), ProcessingJobMessage, int(100 * size_t(framesDone.fetchAndAddRelaxed(1)) / max));
         }
-        pCore->displayMessage(i18n("Processing data analysis"), ProcessingJobMessage, int(100 * i / max));
+    };
+    if (m_segmentProducers.size() > 1) {
+        // Decode the envelope in parallel segments, each worker writing to its
+        // own non-overlapping slice of the amplitude vector
+        struct Segment
+        {
+            Mlt::Producer *producer;
+            size_t first;
+            size_t last;
+        };
+        std::vector<Segment> segments;
+        const size_t segmentLength = (max + m_segmentProducers.size() - 1) / m_segmentProducers.size();
+        for (size_t s = 0; s < m_segmentProducers.size(); ++s) {
+            segments.push_back({m_segmentProducers[s].get(), s * segmentLength, std::min(max, (s + 1) * segmentLength)});
+        }
+        QtConcurrent::blockingMap(segments, [&](const Segment &segment) { decodeRange(segment.producer, segment.first, segment.last); });
+    } else {
+        decodeRange(m_producer.get(), 0, max);
     }
     qCDebug(KDENLIVE_LOG) << "Calculating the envelope (" << m_envelopeSize << " frames) took " << t.elapsed() << " ms.";
     qCDebug(KDENLIVE_LOG) << "Normalizing envelope …";
@@ -86,6 +86,9 @@ private:
     AudioSummary loadAndNormalizeEnvelope() const;
 
     std::shared_ptr<Mlt::Producer> m_producer;
+    /** Additional producer clones used to decode long clips in parallel
+        segments; MLT producers must not be shared across threads. */
+    std::vector<std::shared_ptr<Mlt::Producer>> m_segmentProducers;
     std::unique_ptr<AudioInfo> m_info;
     QFutureWatcher<AudioSummary> m_watcher;
     QFuture<AudioSummary> m_audioSummary;
@@ -15,8 +15,10 @@ extern "C" {
 
 void FFTCorrelation::correlate(const qint64 *left, const size_t leftSize, const qint64 *right, const size_t rightSize, qint64 *out_correlated)
 {
-    auto *correlatedFloat = new float[leftSize + rightSize + 1];
-    correlate(left, leftSize, right, rightSize, correlatedFloat);
+    // The scratch buffer is pooled per thread instead of reallocated on each run
+    thread_local std::vector<float> correlatedFloat;
+    correlatedFloat.resize(leftSize + rightSize + 1);
+    correlate(left, leftSize, right, rightSize, correlatedFloat.data());
 
     // The correlation vector will have entries up to N (number of entries
     // of the vector), so converting to integers will not lose that much
@@ -24,7 +26,6 @@ void FFTCorrelation::correlate(const qint64 *left, const size_t leftSize, const
     for (size_t i = 0; i < leftSize + rightSize + 1; ++i) {
         out_correlated[i] = qint64(correlatedFloat[i]);
     }
-    delete[] correlatedFloat;
 }
 
 void FFTCorrelation::correlate(const qint64 *left, const size_t leftSize, const qint64 *right, const size_t rightSize, float *out_correlated)
@@ -32,8 +33,12 @@ void FFTCorrelation::correlate(const qint64 *left, const size_t leftSize, const
     QElapsedTimer t;
     t.start();
 
-    auto *leftF = new float[leftSize];
-    auto *rightF = new float[rightSize];
+    thread_local std::vector<float> leftBuffer;
+    thread_local std::vector<float> rightBuffer;
+    leftBuffer.resize(leftSize);
+    rightBuffer.resize(rightSize);
+    float *leftF = leftBuffer.data();
+    float *rightF = rightBuffer.data();
 
     // First the qint64 values need to be normalized to floats
     // Dividing by the max value is maybe not the best solution, but the
@@ -65,8 +70,6 @@ void FFTCorrelation::correlate(const qint64 *left, const size_t leftSize, const
     convolve(leftF, leftSize, rightF, rightSize, out_correlated);
 
     qCDebug(KDENLIVE_LOG) << "Correlation (FFT based) computed in " << t.elapsed() << " ms.";
-    delete[] leftF;
-    delete[] rightF;
 }
 
 void FFTCorrelation::convolve(const float *left, const size_t leftSize, const float *right, const size_t rightSize, float *out_convolved)
@@ -87,16 +90,40 @@ void FFTCorrelation::convolve(const float *left, const size_t leftSize, const fl
     }
 
     const size_t fft_size = size / 2 + 1;
-    kiss_fftr_cfg fftConfig = kiss_fftr_alloc(int(size), 0, nullptr, nullptr);
-    kiss_fftr_cfg ifftConfig = kiss_fftr_alloc(int(size), 1, nullptr, nullptr);
-    std::vector<kiss_fft_cpx> leftFFT(fft_size);
-    std::vector<kiss_fft_cpx> rightFFT(fft_size);
-    std::vector<kiss_fft_cpx> correlatedFFT(fft_size);
 
-    // Fill in the data into our new vectors with padding
-    std::vector<float> leftData(size, 0);
-    std::vector<float> rightData(size, 0);
-    std::vector<float> convolved(size);
+    // The FFT plans and scratch vectors are kept per thread so that repeated
+    // correlations of similar length reuse them instead of redoing the plan
+    // setup and heap allocations on every run
+    struct ConvolvePlans
+    {
+        size_t size = 0;
+        kiss_fftr_cfg fft = nullptr;
+        kiss_fftr_cfg ifft = nullptr;
+    };
+    thread_local ConvolvePlans plans;
+    if (plans.size != size) {
+        kiss_fftr_free(plans.fft);
+        kiss_fftr_free(plans.ifft);
+        plans.fft = kiss_fftr_alloc(int(size), 0, nullptr, nullptr);
+        plans.ifft = kiss_fftr_alloc(int(size), 1, nullptr, nullptr);
+        plans.size = size;
+    }
+    kiss_fftr_cfg fftConfig = plans.fft;
+    kiss_fftr_cfg ifftConfig = plans.ifft;
+    thread_local std::vector<kiss_fft_cpx> leftFFT;
+    thread_local std::vector<kiss_fft_cpx> rightFFT;
+    thread_local std::vector<kiss_fft_cpx> correlatedFFT;
+    leftFFT.resize(fft_size);
+    rightFFT.resize(fft_size);
+    correlatedFFT.resize(fft_size);
+
+    // Fill in the data into our vectors with padding
+    thread_local std::vector<float> leftData;
+    thread_local std::vector<float> rightData;
+    thread_local std::vector<float> convolved;
+    leftData.assign(size, 0);
+    rightData.assign(size, 0);
+    convolved.resize(size);
 
     std::copy(left, left + leftSize, leftData.begin());
     std::copy(right, right + rightSize, rightData.begin());
@@ -120,9 +147,5 @@ void FFTCorrelation::convolve(const float *left, const size_t leftSize, const fl
     kiss_fftri(ifftConfig, &correlatedFFT[0], &convolved[0]);
     std::copy(convolved.begin(), convolved.begin() + int(out_size) - 1, out_convolved + 1);
 
-    // Finally some cleanup.
-    kiss_fftr_free(fftConfig);
-    kiss_fftr_free(ifftConfig);
-
     qCDebug(KDENLIVE_LOG) << "FFT convolution computed. Time taken: " << time.elapsed() << " ms";
 }
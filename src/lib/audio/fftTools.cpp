@@ -159,13 +159,21 @@ void FFTTools::fftNormalized(const audioShortVector &audioFrame, const uint chan
     }
 
     // Prepare frequency space vector. The resulting FFT vector is only half as long.
-    auto *freqData = new kiss_fft_cpx[size_t(windowSize) / 2];
-    auto *data = new float[size_t(windowSize)];
+    // The scratch buffers are kept across calls like the configurations above
+    // to avoid a heap allocation on every repaint.
+    if (m_freqBuffer.size() < int(windowSize) / 2) {
+        m_freqBuffer.resize(int(windowSize) / 2);
+    }
+    if (m_timeBuffer.size() < int(windowSize)) {
+        m_timeBuffer.resize(int(windowSize));
+    }
+    kiss_fft_cpx *freqData = m_freqBuffer.data();
+    float *data = m_timeBuffer.data();
 
     // Copy the first channel's audio into a vector for the FFT display;
     // Fill the data vector indices that cannot be covered with sample data with 0
     if (numSamples < windowSize) {
-        std::fill(&data[numSamples], &data[windowSize - 1], 0);
+        std::fill(&data[numSamples], &data[windowSize], 0);
     }
     // Normalize signals to [0,1] to get correct dB values later on
     for (uint i = 0; i < numSamples && i < windowSize; ++i) {
@@ -221,8 +229,6 @@ void FFTTools::fftNormalized(const audioShortVector &audioFrame, const uint chan
 #ifdef DEBUG_FFTTOOLS
     qCDebug(KDENLIVE_LOG) << "Calculated FFT in " << start.elapsed() << " ms.";
 #endif
-    delete[] freqData;
-    delete[] data;
 }
 
 const QVector<float> FFTTools::interpolatePeakPreserving(const QVector<float> &in, const uint targetSize, uint left, uint right, float fill)
@@ -72,4 +72,6 @@ public:
 private:
     QHash<QString, kiss_fftr_cfg> m_fftCfgs;          // FFT cfg cache
     QHash<QString, QVector<float>> m_windowFunctions; // Window function cache
+    QVector<float> m_timeBuffer;                      // Scratch buffer holding the windowed input samples
+    QVector<kiss_fft_cpx> m_freqBuffer;               // Scratch buffer holding the FFT output
 };
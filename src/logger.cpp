@@ -9,6 +9,7 @@
 #include "timeline2/model/timelineitemmodel.hpp"
 #include "timeline2/model/timelinemodel.hpp"
 #include <QString>
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -30,11 +31,26 @@ std::unordered_map<std::string, std::vector<Logger::Constr>> Logger::constr;
 std::unordered_map<std::string, std::string> Logger::translation_table;
 std::unordered_map<std::string, std::string> Logger::back_translation_table;
 int Logger::dump_count = 0;
+double Logger::budget_ms = 0.;
+std::unordered_map<std::string, Logger::OpStats> Logger::op_stats;
+thread_local std::string Logger::current_op;
 
 thread_local size_t Logger::result_awaiting = INT_MAX;
 
+// Number of recent durations kept per operation for the rolling percentiles
+static const size_t statsWindow = 512;
+
 void Logger::init()
 {
+    // The operation profiler is opt-in: the variable holds the frame budget in milliseconds
+    if (qEnvironmentVariableIsSet("KDENLIVE_OPERATION_BUDGET")) {
+        bool ok = false;
+        double budget = qEnvironmentVariable("KDENLIVE_OPERATION_BUDGET").toDouble(&ok);
+        if (ok && budget > 0.) {
+            budget_ms = budget;
+            std::cout << "// Operation profiler enabled, budget: " << budget_ms << "ms" << std::endl;
+        }
+    }
     std::string cur_ind = "a";
     auto incr_ind = [&](auto &&self, size_t i = 0) {
         if (i >= cur_ind.size()) {
@@ -410,10 +426,16 @@ void Logger::clear()
 LogGuard::LogGuard()
 {
     m_hasGuard = Logger::start_logging();
+    if (m_hasGuard && Logger::profiling_enabled()) {
+        m_start = std::chrono::steady_clock::now();
+    }
 }
 LogGuard::~LogGuard()
 {
     if (m_hasGuard) {
+        if (Logger::profiling_enabled()) {
+            Logger::record_duration(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count());
+        }
         Logger::stop_logging();
     }
 }
@@ -428,3 +450,33 @@ void Logger::log_undo(bool undo)
     u.undo = undo;
     operations.push_back(u);
 }
+
+bool Logger::profiling_enabled()
+{
+    return budget_ms > 0.;
+}
+
+void Logger::record_duration(double ms)
+{
+    std::unique_lock<std::mutex> lk(mut);
+    const std::string op = current_op.empty() ? std::string("unnamed operation") : current_op;
+    current_op.clear();
+    auto &stats = op_stats[op];
+    if (stats.durations.size() < statsWindow) {
+        stats.durations.push_back(ms);
+    } else {
+        stats.durations[stats.head] = ms;
+    }
+    stats.head = (stats.head + 1) % statsWindow;
+    if (ms <= budget_ms) {
+        return;
+    }
+    std::vector<double> sorted = stats.durations;
+    std::sort(sorted.begin(), sorted.end());
+    auto percentile = [&sorted](double p) { return sorted[size_t(p * double(sorted.size() - 1))]; };
+    std::cerr << "// WARNING: " << op << " took " << ms << "ms, over the " << budget_ms << "ms budget (p50: " << percentile(0.5)
+              << "ms, p90: " << percentile(0.9) << "ms, p99: " << percentile(0.99) << "ms over " << sorted.size()
+              << " samples). Dumping the operation log." << std::endl;
+    // Write the captured operation log so the trace can be attached to a bug report
+    print_trace();
+}
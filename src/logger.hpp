@@ -6,6 +6,7 @@
 */
 
 #pragma once
+#include <chrono>
 #include <climits>
 #include <iostream>
 #include <memory>
@@ -59,6 +60,15 @@ public:
     /** @brief Resets the current log */
     static void clear();
 
+    /** @brief True if the opt-in operation profiler was enabled by setting the
+     * KDENLIVE_OPERATION_BUDGET environment variable to a frame budget in milliseconds */
+    static bool profiling_enabled();
+    /** @brief Records the duration of a completed top-level operation. Updates the rolling
+     * percentiles for the operation and, when the duration exceeds the configured budget,
+     * prints a warning with the percentiles and dumps the captured operation log so the
+     * trace can be attached to a bug report. Called by LogGuard. */
+    static void record_duration(double ms);
+
     static std::unordered_map<std::string, std::string> translation_table;
     static std::unordered_map<std::string, std::string> back_translation_table;
 
@@ -95,6 +105,18 @@ protected:
     static std::unordered_map<std::string, std::vector<Constr>> constr;
     static std::vector<Invok> invoks;
     static int dump_count;
+
+    /** @brief Rolling window of recent durations for one operation, in milliseconds */
+    struct OpStats
+    {
+        std::vector<double> durations;
+        size_t head = 0;
+    };
+    /** @brief Frame budget in milliseconds, 0 when the profiler is disabled */
+    static double budget_ms;
+    static std::unordered_map<std::string, OpStats> op_stats;
+    /** @brief Name of the top-level operation being timed on this thread */
+    thread_local static std::string current_op;
 };
 
 /** @brief This class provides a RAII mechanism to log the execution of a function */
@@ -108,6 +130,8 @@ public:
 
 protected:
     bool m_hasGuard = false;
+    /** @brief Start of the guarded operation, used by the opt-in profiler */
+    std::chrono::steady_clock::time_point m_start;
 };
 
 /// See Logger::log_constr. Note that the macro fills in the ptr instance for you.
@@ -155,6 +179,10 @@ template <typename T> void Logger::log_constr(T *inst, std::vector<rttr::variant
 template <typename T> void Logger::log(T *inst, std::string fctName, std::vector<rttr::variant> args)
 {
     std::unique_lock<std::mutex> lk(mut);
+    if (budget_ms > 0) {
+        // Only top-level calls reach this point, so this names the operation being timed
+        current_op = fctName;
+    }
     for (auto &a : args) {
         // this will rewove shared/weak/unique ptrs
         if (a.get_type().is_wrapper()) {
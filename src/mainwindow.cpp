@@ -58,6 +58,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include "project/dialogs/projectsettings.h"
 #include "project/dialogs/temporarydata.h"
 #include "project/projectmanager.h"
+#include "renderpresets/renderpresetrepository.hpp"
 #include "scopes/scopemanager.h"
 #include "timeline2/view/timelinecontroller.h"
 #include "timeline2/view/timelinetabs.hpp"
@@ -72,6 +73,9 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #ifdef USE_JOGSHUTTLE
 #include "jogshuttle/jogmanager.h"
 #endif
+#ifdef KDENLIVE_MEMORY_DIAGNOSTICS
+#include "dialogs/memoryusagedialog.h"
+#endif
 
 // KStyleManager exists since QT_VERSION_CHECK(6, 3, 0)
 #define HAVE_STYLE_MANAGER __has_include(<KStyleManager>)
@@ -113,6 +117,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include <QClipboard>
 #include <QDesktopServices>
 #include <QDialogButtonBox>
+#include <QElapsedTimer>
 #include <QFileDialog>
 #include <QMenu>
 #include <QMenuBar>
@@ -168,6 +173,10 @@ MainWindow::MainWindow(QWidget *parent)
 
 void MainWindow::init(const QString &mltPath)
 {
+    // Per phase timing, logged so startup regressions can be tracked between releases
+    QElapsedTimer initTimer;
+    initTimer.start();
+    auto logInitPhase = [&initTimer](const char *phase) { qCDebug(KDENLIVE_LOG) << "== init phase:" << phase << "took" << initTimer.restart() << "ms"; };
     QString desktopStyle = QApplication::style()->objectName();
     // Load themes
     auto themeManager = new ThemeManager(actionCollection());
@@ -240,8 +249,11 @@ void MainWindow::init(const QString &mltPath)
 #endif
     QString defaultProfile = KdenliveSettings::default_profile();
 
+    logInitPhase("themes and styles");
+
     // Initialise MLT connection
     MltConnection::construct(mltPath);
+    logInitPhase("mlt factory");
     pCore->setCurrentProfile(defaultProfile.isEmpty() ? ProjectManager::getDefaultProjectFormat() : defaultProfile);
     m_commandStack = new QUndoGroup();
 
@@ -302,8 +314,10 @@ void MainWindow::init(const QString &mltPath)
     fr->setLineWidth(1);
     ctnLay->addWidget(fr);
     setupActions();
+    logInitPhase("actions");
     auto *layoutManager = new LayoutManagement(this);
     pCore->buildDocks();
+    logInitPhase("docks");
 
     QDockWidget *libraryDock = addDock(i18n("Library"), QStringLiteral("library"), pCore->library());
     QDockWidget *subtitlesDock = addDock(i18n("Subtitles"), QStringLiteral("Subtitles"), pCore->subtitleWidget());
@@ -336,10 +350,12 @@ void MainWindow::init(const QString &mltPath)
     });
     installEventFilter(this);
     pCore->monitorManager()->initMonitors(m_clipMonitor, m_projectMonitor);
+    logInitPhase("monitors");
 
     m_timelineTabs = new TimelineTabs(this);
     ctnLay->addWidget(m_timelineTabs);
     setCentralWidget(m_timelineToolBarContainer);
+    logInitPhase("timeline");
 
     // Screen grab widget
     QWidget *grabWidget = new QWidget(this);
@@ -890,8 +906,12 @@ void MainWindow::init(const QString &mltPath)
     m_hamburgerMenu->setMenuBar(menuBar());
     m_hamburgerMenu->setShowMenuBarAction(showMenuBarAction);
 
-    // Detect shortcut conflicts bewtween mainwindow and media browser
-    pCore->mediaBrowser()->detectShortcutConflicts();
+    // Detect shortcut conflicts bewtween mainwindow and media browser. This only depends on the
+    // action collections built above, queue it so it runs once the window is shown
+    QMetaObject::invokeMethod(this, []() { pCore->mediaBrowser()->detectShortcutConflicts(); }, Qt::QueuedConnection);
+
+    // Load the codec capabilities in the background so the render dialog opens instantly
+    RenderPresetRepository::warmCodecCache();
 
     connect(toolBar(), &KToolBar::visibilityChanged, this, [&](bool visible) {
         if (visible && !toolBar()->actions().contains(m_hamburgerMenu)) {
@@ -929,6 +949,7 @@ void MainWindow::init(const QString &mltPath)
         m_loadingDialog->setMaximum(0);
         m_loadingDialog->close();
     });
+    logInitPhase("menus and layout");
 }
 
 void MainWindow::loadContainerActions()
@@ -1551,6 +1572,15 @@ void MainWindow::setupActions()
     addAction(QStringLiteral("reset_config"), resetAction);
     connect(resetAction, &QAction::triggered, this, [&]() { slotRestart(true); });
 
+#ifdef KDENLIVE_MEMORY_DIAGNOSTICS
+    QAction *memoryUsage = new QAction(QIcon::fromTheme(QStringLiteral("utilities-system-monitor")), i18n("Memory Usage…"), this);
+    addAction(QStringLiteral("memory_usage"), memoryUsage);
+    connect(memoryUsage, &QAction::triggered, this, [this]() {
+        MemoryUsageDialog dialog(this);
+        dialog.exec();
+    });
+#endif
+
     m_playZoneFromCursor =
         addAction(QStringLiteral("monitor_play_zone_cursor"), i18n("Play Zone From Cursor"), pCore->monitorManager(), SLOT(slotPlayZoneFromCursor()),
                   QIcon::fromTheme(QStringLiteral("media-playback-start")), QKeySequence(), QStringLiteral("navandplayback"));
@@ -2414,6 +2444,13 @@ void MainWindow::setRenderingProgress(const QString &url, int progress, int fram
     }
 }
 
+void MainWindow::setRenderingAudioLevels(const QString &url, const QByteArray &levels)
+{
+    if (m_renderWidget) {
+        m_renderWidget->setRenderAudioLevels(url, levels);
+    }
+}
+
 void MainWindow::setRenderingFinished(const QString &url, int status, const QString &error)
 {
     Q_EMIT setRenderProgress(100);
@@ -4530,6 +4567,11 @@ void MainWindow::closeTimelineTab(const QUuid uuid)
     m_timelineTabs->closeTimelineTab(uuid);
 }
 
+std::shared_ptr<TimelineItemModel> MainWindow::retiredTimelineModel(const QUuid &uuid) const
+{
+    return m_timelineTabs ? m_timelineTabs->retiredTimelineModel(uuid) : nullptr;
+}
+
 const QStringList MainWindow::openedSequences() const
 {
     if (m_timelineTabs) {
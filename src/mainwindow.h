@@ -138,6 +138,8 @@ public:
     TimelineWidget *getTimeline(const QUuid uuid) const;
     void getSequenceProperties(const QUuid &uuid, QMap<QString, QString> &props);
     void closeTimelineTab(const QUuid uuid);
+    /** @brief Model of a recently closed timeline tab whose scene is still retained, if any */
+    std::shared_ptr<TimelineItemModel> retiredTimelineModel(const QUuid &uuid) const;
     /** @brief Returns a list of opened tabs uuids */
     const QStringList openedSequences() const;
 
@@ -343,6 +345,7 @@ private:
 public Q_SLOTS:
     void slotReloadEffects(const QStringList &paths);
     Q_SCRIPTABLE void setRenderingProgress(const QString &url, int progress, int frame);
+    Q_SCRIPTABLE void setRenderingAudioLevels(const QString &url, const QByteArray &levels);
     Q_SCRIPTABLE void setRenderingFinished(const QString &url, int status, const QString &error);
     Q_SCRIPTABLE void addProjectClip(const QString &url, const QString &folder = QStringLiteral("-1"));
     Q_SCRIPTABLE void addTimelineClip(const QString &url);
@@ -78,7 +78,16 @@ MltConnection::MltConnection(const QString &mltPath)
     KdenliveSettings::setProducerslist(producersList);
     mlt_log_set_level(MLT_LOG_WARNING);
     mlt_log_set_callback(mlt_log_handler);
-    refreshLumas();
+    if (!qEnvironmentVariableIsSet("MLT_TESTS")) {
+        // Scanning the luma directories only feeds the transition ui and can be slow on network
+        // homes, keep it off the startup path: scan on a background thread and publish the
+        // result on the gui thread
+        (void)QtConcurrent::run([]() {
+            LumaScanResult result = scanLumas();
+            QMetaObject::invokeMethod(
+                qApp, [result]() { applyLumas(result); }, Qt::QueuedConnection);
+        });
+    }
 }
 
 void MltConnection::construct(const QString &mltPath)
@@ -265,8 +274,13 @@ void MltConnection::refreshLumas()
         // No need for luma list / thumbs in tests
         return;
     }
+    applyLumas(scanLumas());
+}
+
+MltConnection::LumaScanResult MltConnection::scanLumas()
+{
+    LumaScanResult result;
     QStringList fileFilters;
-    MainWindow::m_lumaFiles.clear();
     fileFilters << QStringLiteral("*.png") << QStringLiteral("*.pgm");
     QStringList customLumas = QStandardPaths::locateAll(QStandardPaths::AppLocalDataLocation, QStringLiteral("lumas"), QStandardPaths::LocateDirectory);
     customLumas.append(QString(mlt_environment("MLT_DATA")) + QStringLiteral("/lumas"));
@@ -276,11 +290,9 @@ void MltConnection::refreshLumas()
     QStringList ntscLumas;
     QStringList verticalLumas;
     QStringList squareLumas;
-    QStringList allImagefiles;
     for (const QString &folder : qAsConst(customLumas)) {
         QDir topDir(folder);
         QStringList folders = topDir.entryList(QDir::AllDirs | QDir::NoDotAndDotDot);
-        QString format;
         for (const QString &f : qAsConst(folders)) {
             QStringList imagefiles;
             QDir dir(topDir.absoluteFilePath(f));
@@ -289,9 +301,6 @@ void MltConnection::refreshLumas()
             while (it.hasNext()) {
                 filesnames.append(it.next());
             }
-            if (MainWindow::m_lumaFiles.contains(format)) {
-                imagefiles = MainWindow::m_lumaFiles.value(format);
-            }
             for (const QString &fname : qAsConst(filesnames)) {
                 imagefiles.append(dir.absoluteFilePath(fname));
             }
@@ -306,7 +315,7 @@ void MltConnection::refreshLumas()
             } else if (f == QLatin1String("SQUARE")) {
                 squareLumas << imagefiles;
             }
-            allImagefiles << imagefiles;
+            result.allImageFiles << imagefiles;
         }
     }
     // Insert MLT builtin lumas (created on the fly)
@@ -320,15 +329,21 @@ void MltConnection::refreshLumas()
     ntscLumas << autoLumas;
     verticalLumas << autoLumas;
     squareLumas << autoLumas;
-    MainWindow::m_lumaFiles.insert(QStringLiteral("16_9"), hdLumas);
-    MainWindow::m_lumaFiles.insert(QStringLiteral("9_16"), verticalLumas);
-    MainWindow::m_lumaFiles.insert(QStringLiteral("square"), squareLumas);
-    MainWindow::m_lumaFiles.insert(QStringLiteral("PAL"), sdLumas);
-    MainWindow::m_lumaFiles.insert(QStringLiteral("NTSC"), ntscLumas);
-    allImagefiles.removeDuplicates();
+    result.lumaFiles.insert(QStringLiteral("16_9"), hdLumas);
+    result.lumaFiles.insert(QStringLiteral("9_16"), verticalLumas);
+    result.lumaFiles.insert(QStringLiteral("square"), squareLumas);
+    result.lumaFiles.insert(QStringLiteral("PAL"), sdLumas);
+    result.lumaFiles.insert(QStringLiteral("NTSC"), ntscLumas);
+    result.allImageFiles.removeDuplicates();
+    return result;
+}
+
+void MltConnection::applyLumas(const LumaScanResult &result)
+{
+    MainWindow::m_lumaFiles = result.lumaFiles;
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
-    QtConcurrent::run(pCore.get(), &Core::buildLumaThumbs, allImagefiles);
+    QtConcurrent::run(pCore.get(), &Core::buildLumaThumbs, result.allImageFiles);
 #else
-    (void)QtConcurrent::run(&Core::buildLumaThumbs, pCore.get(), allImagefiles);
+    (void)QtConcurrent::run(&Core::buildLumaThumbs, pCore.get(), result.allImageFiles);
 #endif
 }
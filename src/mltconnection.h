@@ -5,7 +5,9 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 
 #pragma once
 
+#include <QMap>
 #include <QString>
+#include <QStringList>
 #include <memory>
 
 namespace Mlt {
@@ -40,6 +42,18 @@ protected:
     */
     MltConnection(const QString &mltPath);
 
+    /** @brief Result of the luma directory scan, built without touching any gui state so the
+     *  scan can run on a background thread */
+    struct LumaScanResult
+    {
+        QMap<QString, QStringList> lumaFiles;
+        QStringList allImageFiles;
+    };
+    /** @brief Walks the luma directories, this is the disk-bound part of refreshLumas() */
+    static LumaScanResult scanLumas();
+    /** @brief Publishes a scan result to the gui and queues the luma thumbnails */
+    static void applyLumas(const LumaScanResult &result);
+
     /** @brief Locates the MLT environment.
      * @param mltPath (optional) path to MLT environment
      *
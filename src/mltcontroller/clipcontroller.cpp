@@ -17,6 +17,8 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include "kdenlivesettings.h"
 #include "lib/audio/audioStreamInfo.h"
 #include "profiles/profilemodel.hpp"
+#include "utils/memorydiagnostics.h"
+#include "utils/qstringutils.h"
 
 #include "core.h"
 #include "kdenlive_debug.h"
@@ -27,6 +29,19 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 
 std::shared_ptr<Mlt::Producer> ClipController::mediaUnavailable;
 
+/** @brief Warm producer clones parked between uses, shared with in-flight deleters */
+struct ClipController::ProducerPool
+{
+    ~ProducerPool()
+    {
+        qDeleteAll(parked);
+    }
+    /** @brief Maximum number of clones kept warm per bin clip */
+    static const int maxParked = 3;
+    QMutex mutex;
+    QList<Mlt::Producer *> parked;
+};
+
 ClipController::ClipController(const QString &clipId, const std::shared_ptr<Mlt::Producer> &producer)
     : selectedEffectIndex(1)
     , m_audioThumbCreated(false)
@@ -45,7 +60,10 @@ ClipController::ClipController(const QString &clipId, const std::shared_ptr<Mlt:
     , m_hasAudio(false)
     , m_hasVideo(false)
     , m_controllerBinId(clipId)
+    , m_producerPool(std::make_shared<ProducerPool>())
 {
+    MEM_DIAG_ADD(MemoryDiagnostics::Producers, 0, 1);
+    publishSnapshot(m_masterProducer);
     if (m_masterProducer && !m_masterProducer->is_valid()) {
         qCDebug(KDENLIVE_LOG) << "// WARNING, USING INVALID PRODUCER";
         return;
@@ -62,7 +80,9 @@ ClipController::ClipController(const QString &clipId, const std::shared_ptr<Mlt:
 
 ClipController::~ClipController()
 {
+    MEM_DIAG_SUB(MemoryDiagnostics::Producers, 0, 1);
     delete m_properties;
+    publishSnapshot(nullptr);
     Q_ASSERT(m_masterProducer.use_count() <= 1);
     m_masterProducer.reset();
 }
@@ -88,6 +108,7 @@ void ClipController::addMasterProducer(const std::shared_ptr<Mlt::Producer> &pro
         m_masterProducer = std::move(producer);
     }
     m_properties = new Mlt::Properties(m_masterProducer->get_properties());
+    publishSnapshot(m_masterProducer);
     m_producerLock.unlock();
     // Pass temporary properties
     QMapIterator<QString, QVariant> i(m_tempProps);
@@ -124,6 +145,7 @@ void ClipController::addMasterProducer(const std::shared_ptr<Mlt::Producer> &pro
     m_effectStack = EffectStackModel::construct(m_masterProducer, ObjectId(KdenliveObjectType::BinClip, id, QUuid()), pCore->undoStack());
     if (!m_masterProducer->is_valid()) {
         m_masterProducer = ClipController::mediaUnavailable;
+        publishSnapshot(m_masterProducer);
         qCDebug(KDENLIVE_LOG) << "// WARNING, USING INVALID PRODUCER";
     } else {
         setProducerProperty(QStringLiteral("kdenlive:id"), m_controllerBinId);
@@ -402,6 +424,51 @@ Mlt::Producer *ClipController::masterProducer()
     return new Mlt::Producer(*m_masterProducer);
 }
 
+std::shared_ptr<Mlt::Producer> ClipController::pooledProducer(const std::function<Mlt::Producer *()> &builder)
+{
+    Mlt::Producer *prod = nullptr;
+    m_producerPool->mutex.lock();
+    if (!m_producerPool->parked.isEmpty()) {
+        // Reissue a warm clone instead of re-opening the file
+        prod = m_producerPool->parked.takeLast();
+    }
+    m_producerPool->mutex.unlock();
+    if (prod == nullptr) {
+        prod = builder();
+        if (prod == nullptr) {
+            return nullptr;
+        }
+    }
+    // The deleter parks the clone back in the pool if it is still alive and not full
+    std::weak_ptr<ProducerPool> pool = m_producerPool;
+    return std::shared_ptr<Mlt::Producer>(prod, [pool](Mlt::Producer *p) {
+        if (auto lockedPool = pool.lock()) {
+            if (p->is_valid()) {
+                // Strip the scaler / converter filters users may have attached so the clone comes back clean
+                for (int ix = p->filter_count() - 1; ix >= 0; ix--) {
+                    std::unique_ptr<Mlt::Filter> filter(p->filter(ix));
+                    if (filter) {
+                        p->detach(*filter.get());
+                    }
+                }
+                lockedPool->mutex.lock();
+                if (lockedPool->parked.size() < ProducerPool::maxParked) {
+                    lockedPool->parked.append(p);
+                    p = nullptr;
+                }
+                lockedPool->mutex.unlock();
+            }
+        }
+        delete p;
+    });
+}
+
+void ClipController::flushProducerPool()
+{
+    // In-flight deleters hold a weak_ptr to the old pool, so their clones are simply destroyed
+    m_producerPool = std::make_shared<ProducerPool>();
+}
+
 bool ClipController::isValid()
 {
     if (m_masterProducer == nullptr) {
@@ -470,7 +537,10 @@ void ClipController::updateProducer(const std::shared_ptr<Mlt::Producer> &produc
         m_masterProducer = std::move(producer);
     }
     m_properties = new Mlt::Properties(m_masterProducer->get_properties());
+    publishSnapshot(m_masterProducer);
     m_producerLock.unlock();
+    // Parked clones were built from the previous producer, discard them
+    flushProducerPool();
     if (!m_masterProducer->is_valid()) {
         qCDebug(KDENLIVE_LOG) << "// WARNING, USING INVALID PRODUCER";
     } else {
@@ -560,66 +630,93 @@ int ClipController::getFramePlaytime() const
     return m_masterProducer->get_length();
 }
 
+void ClipController::publishSnapshot(const std::shared_ptr<Mlt::Producer> &producer)
+{
+#ifdef __cpp_lib_atomic_shared_ptr
+    m_producerSnapshot.store(producer);
+#else
+    std::atomic_store(&m_producerSnapshot, producer);
+#endif
+}
+
+std::shared_ptr<Mlt::Producer> ClipController::readSnapshot() const
+{
+#ifdef __cpp_lib_atomic_shared_ptr
+    std::shared_ptr<Mlt::Producer> producer = m_producerSnapshot.load();
+#else
+    std::shared_ptr<Mlt::Producer> producer = std::atomic_load(&m_producerSnapshot);
+#endif
+    if (producer == nullptr) {
+        // The initial producer is still being opened, wait for addMasterProducer to publish it
+        // the way the locked getters used to
+        QReadLocker lock(&m_producerLock);
+#ifdef __cpp_lib_atomic_shared_ptr
+        producer = m_producerSnapshot.load();
+#else
+        producer = std::atomic_load(&m_producerSnapshot);
+#endif
+    }
+    return producer;
+}
+
 bool ClipController::hasProducerProperty(const QString &name) const
 {
-    QReadLocker lock(&m_producerLock);
-    if (m_properties == nullptr) {
+    const std::shared_ptr<Mlt::Producer> producer = readSnapshot();
+    if (producer == nullptr) {
         return false;
     }
-    return m_properties->property_exists(name.toUtf8().constData());
+    return producer->property_exists(QStringUtils::mltKey(name).constData());
 }
 
 QString ClipController::getProducerProperty(const QString &name) const
 {
-    QReadLocker lock(&m_producerLock);
-    if (m_properties == nullptr) {
+    const std::shared_ptr<Mlt::Producer> producer = readSnapshot();
+    if (producer == nullptr) {
         return m_tempProps.value(name).toString();
     }
     if (m_usesProxy && name.startsWith(QLatin1String("meta."))) {
-        QString correctedName = QStringLiteral("kdenlive:") + name;
-        return m_properties->get(correctedName.toUtf8().constData());
+        return producer->get(QStringUtils::mltKey(QStringLiteral("kdenlive:") + name).constData());
     }
-    return QString(m_properties->get(name.toUtf8().constData()));
+    return QString(producer->get(QStringUtils::mltKey(name).constData()));
 }
 
 int ClipController::getProducerIntProperty(const QString &name) const
 {
-    QReadLocker lock(&m_producerLock);
-    if (!m_properties) {
+    const std::shared_ptr<Mlt::Producer> producer = readSnapshot();
+    if (producer == nullptr) {
         return 0;
     }
     if (m_usesProxy && name.startsWith(QLatin1String("meta."))) {
-        QString correctedName = QStringLiteral("kdenlive:") + name;
-        return m_properties->get_int(correctedName.toUtf8().constData());
+        return producer->get_int(QStringUtils::mltKey(QStringLiteral("kdenlive:") + name).constData());
     }
-    return m_properties->get_int(name.toUtf8().constData());
+    return producer->get_int(QStringUtils::mltKey(name).constData());
 }
 
 qint64 ClipController::getProducerInt64Property(const QString &name) const
 {
-    QReadLocker lock(&m_producerLock);
-    if (!m_properties) {
+    const std::shared_ptr<Mlt::Producer> producer = readSnapshot();
+    if (producer == nullptr) {
         return 0;
     }
-    return m_properties->get_int64(name.toUtf8().constData());
+    return producer->get_int64(QStringUtils::mltKey(name).constData());
 }
 
 double ClipController::getProducerDoubleProperty(const QString &name) const
 {
-    QReadLocker lock(&m_producerLock);
-    if (!m_properties) {
+    const std::shared_ptr<Mlt::Producer> producer = readSnapshot();
+    if (producer == nullptr) {
         return 0;
     }
-    return m_properties->get_double(name.toUtf8().constData());
+    return producer->get_double(QStringUtils::mltKey(name).constData());
 }
 
 QColor ClipController::getProducerColorProperty(const QString &name) const
 {
-    QReadLocker lock(&m_producerLock);
-    if (!m_properties) {
+    const std::shared_ptr<Mlt::Producer> producer = readSnapshot();
+    if (producer == nullptr) {
         return {};
     }
-    mlt_color color = m_properties->get_color(name.toUtf8().constData());
+    mlt_color color = producer->get_color(QStringUtils::mltKey(name).constData());
     return QColor::fromRgb(color.r, color.g, color.b);
 }
 
@@ -693,7 +790,7 @@ void ClipController::setProducerProperty(const QString &name, int value)
         return;
     }
     QWriteLocker lock(&m_producerLock);
-    m_masterProducer->parent().set(name.toUtf8().constData(), value);
+    m_masterProducer->parent().set(QStringUtils::mltKey(name).constData(), value);
 }
 
 void ClipController::setProducerProperty(const QString &name, double value)
@@ -703,7 +800,7 @@ void ClipController::setProducerProperty(const QString &name, double value)
         return;
     }
     QWriteLocker lock(&m_producerLock);
-    m_masterProducer->parent().set(name.toUtf8().constData(), value);
+    m_masterProducer->parent().set(QStringUtils::mltKey(name).constData(), value);
 }
 
 void ClipController::setProducerProperty(const QString &name, const QString &value)
@@ -715,9 +812,9 @@ void ClipController::setProducerProperty(const QString &name, const QString &val
 
     QWriteLocker lock(&m_producerLock);
     if (value.isEmpty()) {
-        m_masterProducer->parent().set(name.toUtf8().constData(), nullptr);
+        m_masterProducer->parent().set(QStringUtils::mltKey(name).constData(), nullptr);
     } else {
-        m_masterProducer->parent().set(name.toUtf8().constData(), value.toUtf8().constData());
+        m_masterProducer->parent().set(QStringUtils::mltKey(name).constData(), value.toUtf8().constData());
     }
 }
 
@@ -729,7 +826,7 @@ void ClipController::resetProducerProperty(const QString &name)
     }
 
     QWriteLocker lock(&m_producerLock);
-    m_masterProducer->parent().set(name.toUtf8().constData(), nullptr);
+    m_masterProducer->parent().set(QStringUtils::mltKey(name).constData(), nullptr);
 }
 
 ClipType::ProducerType ClipController::clipType() const
@@ -921,6 +1018,16 @@ Mlt::Properties &ClipController::properties()
     return *m_properties;
 }
 
+std::shared_ptr<Mlt::Properties> ClipController::propertiesSnapshot()
+{
+    QReadLocker lock(&m_producerLock);
+    std::shared_ptr<Mlt::Properties> props(new Mlt::Properties());
+    if (m_properties) {
+        props->inherit(*m_properties);
+    }
+    return props;
+}
+
 void ClipController::backupOriginalProperties()
 {
     QReadLocker lock(&m_producerLock);
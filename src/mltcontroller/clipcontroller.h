@@ -16,6 +16,8 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include <QMutex>
 #include <QString>
 #include <QReadWriteLock>
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <mlt++/Mlt.h>
 
@@ -76,7 +78,14 @@ public:
     const QString binId() const;
 
     /** @brief Returns this clip's producer. */
-    virtual std::unique_ptr<Mlt::Producer> getThumbProducer() = 0;
+    virtual std::shared_ptr<Mlt::Producer> getThumbProducer() = 0;
+
+    /** @brief Hand out a producer clone for temporary use (thumbnails, analysis tasks).
+     *  A warm clone parked by a previous user is reissued when available, otherwise
+     *  @a builder opens a fresh one. The clone returns to the pool when the last
+     *  reference is dropped, so rapidly previewing many clips does not re-open the
+     *  same files over and over. */
+    std::shared_ptr<Mlt::Producer> pooledProducer(const std::function<Mlt::Producer *()> &builder);
 
     virtual void reloadProducer(bool refreshOnly = false, bool isProxy = false, bool forceAudioReload = false) = 0;
     virtual void setThumbFrame(int frame) = 0;
@@ -152,6 +161,9 @@ public:
     bool hasLimitedDuration() const;
     void forceLimitedDuration();
     Mlt::Properties &properties();
+    /** @brief Returns a detached copy of all producer properties, taken under a single lock
+     *  so widgets can read many fields without contending with playback */
+    std::shared_ptr<Mlt::Properties> propertiesSnapshot();
     void mirrorOriginalProperties(std::shared_ptr<Mlt::Properties> props);
     bool copyEffect(const std::shared_ptr<EffectStackModel> &stackModel, int rowId);
     bool copyEffectWithUndo(const std::shared_ptr<EffectStackModel> &stackModel, int rowId, Fun &undo, Fun &redo);
@@ -217,8 +229,26 @@ protected:
     void refreshAudioInfo();
     void backupOriginalProperties();
     void clearBackupProperties();
+    /** @brief Drop the parked producer clones, called when the master producer changes */
+    void flushProducerPool();
 
     std::shared_ptr<Mlt::Producer> m_masterProducer;
+    /** @brief Atomically published copy of m_masterProducer. The generic property getters
+     *  read through this snapshot instead of taking m_producerLock, so a producer swap in a
+     *  background task (proxy switch, reload) never stalls the monitor or the scopes reading
+     *  properties during playback; MLT serializes the individual accesses internally. */
+#ifdef __cpp_lib_atomic_shared_ptr
+    std::atomic<std::shared_ptr<Mlt::Producer>> m_producerSnapshot;
+#else
+    // The std::atomic_load/store shared_ptr overloads are deprecated in C++20, only
+    // use them where the atomic shared_ptr specialization is not available
+    std::shared_ptr<Mlt::Producer> m_producerSnapshot;
+#endif
+    /** @brief Atomically publish the given producer as the current snapshot */
+    void publishSnapshot(const std::shared_ptr<Mlt::Producer> &producer);
+    /** @brief Returns the current producer snapshot without locking, waiting on
+     *  m_producerLock only while the initial producer is still being opened */
+    std::shared_ptr<Mlt::Producer> readSnapshot() const;
     Mlt::Properties *m_properties;
     bool m_usesProxy;
     std::unique_ptr<AudioStreamInfo> m_audioInfo;
@@ -246,4 +276,8 @@ private:
     QString m_controllerBinId;
     /** @brief Build the audio info object */
     void buildAudioInfo(int audioIndex);
+    struct ProducerPool;
+    /** @brief Bounded pool of warm producer clones, shared with the custom deleters
+     *  of the clones currently in flight */
+    std::shared_ptr<ProducerPool> m_producerPool;
 };
@@ -207,7 +207,7 @@ ClipPropertiesController::ClipPropertiesController(const QString &clipName, Clip
     , m_controller(controller)
     , m_id(controller->binId())
     , m_type(controller->clipType())
-    , m_properties(new Mlt::Properties(controller->properties()))
+    , m_properties(controller->propertiesSnapshot())
     , m_sourceProperties(new Mlt::Properties())
     , m_audioStream(nullptr)
     , m_textEdit(nullptr)
@@ -1072,7 +1072,7 @@ void ClipPropertiesController::updateTab(int ix)
 void ClipPropertiesController::slotReloadProperties()
 {
     mlt_color color;
-    m_properties.reset(new Mlt::Properties(m_controller->properties()));
+    m_properties = m_controller->propertiesSnapshot();
     m_sourceProperties.reset(new Mlt::Properties());
     m_controller->mirrorOriginalProperties(m_sourceProperties);
     m_clipLabel->setText(m_properties->get("kdenlive:clipname"));
@@ -1172,7 +1172,9 @@ void ClipPropertiesController::slotEnableForce(int state)
             auto *timePos = findChild<TimecodeDisplay *>(param + QStringLiteral("_value"));
             timePos->setValue(m_properties->get_int("kdenlive:original_length"));
             int original = m_properties->get_int("kdenlive:original_length");
+            // m_properties is a detached snapshot, also update the real producer
             m_properties->set("kdenlive:original_length", nullptr);
+            m_controller->resetProducerProperty(QStringLiteral("kdenlive:original_length"));
             slotDurationChanged(original);
             return;
         }
@@ -1195,7 +1197,10 @@ void ClipPropertiesController::slotEnableForce(int state)
             int original_length = m_properties->get_int("kdenlive:original_length");
             if (original_length == 0) {
                 int kdenlive_length = m_properties->time_to_frames(m_properties->get("kdenlive:duration"));
-                m_properties->set("kdenlive:original_length", kdenlive_length > 0 ? m_properties->get("kdenlive:duration") : m_properties->get("length"));
+                const QString originalLength(kdenlive_length > 0 ? m_properties->get("kdenlive:duration") : m_properties->get("length"));
+                // m_properties is a detached snapshot, also update the real producer
+                m_properties->set("kdenlive:original_length", originalLength.toUtf8().constData());
+                m_controller->setProducerProperty(QStringLiteral("kdenlive:original_length"), originalLength);
             }
         } else if (param == QLatin1String("force_fps")) {
             auto *spin = findChild<QDoubleSpinBox *>(param + QStringLiteral("_value"));
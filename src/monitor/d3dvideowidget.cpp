@@ -137,13 +137,22 @@ void D3DVideoWidget::beforeRendering()
     }
     int iwidth = m_sharedFrame.get_image_width();
     int iheight = m_sharedFrame.get_image_height();
-    const uint8_t *image = m_sharedFrame.get_image(mlt_image_yuv420p);
+    // Keep 10 bit frames at their native depth so the conversion stays on the GPU
+    const bool tenBit = m_sharedFrame.get_image_format() == mlt_image_yuv420p10;
+    const uint8_t *image = m_sharedFrame.get_image(tenBit ? mlt_image_yuv420p10 : mlt_image_yuv420p);
+    const int bpp = tenBit ? 2 : 1;
     for (int i = 0; i < 3; i++) {
         if (m_texture[i]) m_texture[i]->Release();
     }
-    m_texture[0] = initTexture(image, iwidth, iheight);
-    m_texture[1] = initTexture(image + iwidth * iheight, iwidth / 2, iheight / 2);
-    m_texture[2] = initTexture(image + iwidth * iheight + iwidth / 2 * iheight / 2, iwidth / 2, iheight / 2);
+    m_texture[0] = initTexture(image, iwidth, iheight, bpp);
+    m_texture[1] = initTexture(image + bpp * iwidth * iheight, iwidth / 2, iheight / 2, bpp);
+    m_texture[2] = initTexture(image + bpp * (iwidth * iheight + iwidth / 2 * iheight / 2), iwidth / 2, iheight / 2, bpp);
+    int colorspace = pCore->getCurrentProfile()->colorspace();
+    if (m_sharedFrame.get_int("colorspace") > 0) {
+        colorspace = m_sharedFrame.get_int("colorspace");
+    }
+    const int transfer = m_sharedFrame.get_int("color_trc");
+    const bool fullRange = m_sharedFrame.get_int("full_range") != 0;
     m_mutex.unlock();
 
     // Update the constants
@@ -151,7 +160,7 @@ void D3DVideoWidget::beforeRendering()
     // will copy the entire constant buffer every time -> pass WRITE_DISCARD -> prevent pipeline stalls
     HRESULT hr = m_context->Map(m_cbuf, 0, D3D11_MAP_WRITE_DISCARD, 0, &mp);
     if (SUCCEEDED(hr)) {
-        m_constants.colorspace = pCore->getCurrentProfile()->colorspace();
+        m_constants = VideoColorParams::frameColorConstants(colorspace, transfer, tenBit ? 10 : 8, fullRange);
         ::memcpy(mp.pData, &m_constants, sizeof(m_constants));
         m_context->Unmap(m_cbuf, 0);
     } else {
@@ -218,10 +227,19 @@ void D3DVideoWidget::prepareShader(Stage stage)
         Q_ASSERT(!m_vert.isEmpty());
         m_vertEntryPoint = QByteArrayLiteral("main");
     } else {
+        // Format agnostic conversion: the matrix, offsets, bit depth scale and transfer
+        // function come from the constant buffer (see videocolorparams.h), so the same
+        // shader covers 601/709/2020, 8/10 bit and PQ/HLG sources
         m_frag = "Texture2D yTex, uTex, vTex;"
                  "SamplerState yuvSampler;"
                  "cbuffer buf {"
-                 "    int colorspace;"
+                 "    float4 coefR;"
+                 "    float4 coefG;"
+                 "    float4 coefB;"
+                 "    float texelScale;"
+                 "    float yOffset;"
+                 "    float cOffset;"
+                 "    int transferFunc;"
                  "};"
                  "struct PSInput {"
                  "  float2 coords : TEXCOORD0;"
@@ -229,25 +247,36 @@ void D3DVideoWidget::prepareShader(Stage stage)
                  "struct PSOutput {"
                  "  float4 color : SV_Target0;"
                  "};"
+                 // SMPTE ST 2084 EOTF, normalized so the 203 nit reference white lands on 1.0
+                 "float3 toneMapPq(float3 rgb) {"
+                 "  float3 p = pow(max(rgb, 0.0f), 1.0f/78.84375f);"
+                 "  float3 lin = pow(max(p - 0.8359375f, 0.0f) / (18.8515625f - 18.6875f * p), 1.0f/0.1593017578125f);"
+                 "  return pow(saturate(lin * 49.26f), 1.0f/2.2f);"
+                 "}"
+                 // ARIB STD-B67 inverse OETF with a simple gamma re-encode for SDR display
+                 "float3 toneMapHlg(float3 rgb) {"
+                 "  float3 v = max(rgb, 0.0f);"
+                 "  float3 low = v * v / 3.0f;"
+                 "  float3 high = (exp((v - 0.55991073f) / 0.17883277f) + 0.28466892f) / 12.0f;"
+                 "  float3 lin = lerp(low, high, step(0.5f, v));"
+                 "  return pow(saturate(lin), 1.0f/2.2f);"
+                 "}"
                  "PSOutput main(PSInput input) {"
                  "  float3 yuv;"
-                 "  yuv.x = yTex.Sample(yuvSampler, input.coords).r -  16.0f/255.0f;"
-                 "  yuv.y = uTex.Sample(yuvSampler, input.coords).r - 128.0f/255.0f;"
-                 "  yuv.z = vTex.Sample(yuvSampler, input.coords).r - 128.0f/255.0f;"
-                 "  float3x3 coefficients;"
-                 "  if (colorspace == 601) {"
-                 "    coefficients = float3x3("
-                 "      1.1643f,  0.0f,      1.5958f,"
-                 "      1.1643f, -0.39173f, -0.8129f,"
-                 "      1.1643f,  2.017f,    0.0f);"
-                 "  } else {" // ITU-R 709
-                 "    coefficients = float3x3("
-                 "      1.1643f,  0.0f,    1.793f,"
-                 "      1.1643f, -0.213f, -0.533f,"
-                 "      1.1643f,  2.112f,  0.0f);"
+                 "  yuv.x = yTex.Sample(yuvSampler, input.coords).r * texelScale - yOffset;"
+                 "  yuv.y = uTex.Sample(yuvSampler, input.coords).r * texelScale - cOffset;"
+                 "  yuv.z = vTex.Sample(yuvSampler, input.coords).r * texelScale - cOffset;"
+                 "  float3 rgb;"
+                 "  rgb.r = dot(coefR.xyz, yuv);"
+                 "  rgb.g = dot(coefG.xyz, yuv);"
+                 "  rgb.b = dot(coefB.xyz, yuv);"
+                 "  if (transferFunc == 16) {"
+                 "    rgb = toneMapPq(rgb);"
+                 "  } else if (transferFunc == 18) {"
+                 "    rgb = toneMapHlg(rgb);"
                  "  }"
                  "  PSOutput output;"
-                 "  output.color = float4(mul(coefficients, yuv), 1.0f);"
+                 "  output.color = float4(rgb, 1.0f);"
                  "  return output;"
                  "}";
         m_fragEntryPoint = QByteArrayLiteral("main");
@@ -290,7 +319,7 @@ QByteArray D3DVideoWidget::compileShader(Stage stage, const QByteArray &source,
     return result;
 }
 
-ID3D11ShaderResourceView *D3DVideoWidget::initTexture(const void *p, int width, int height)
+ID3D11ShaderResourceView *D3DVideoWidget::initTexture(const void *p, int width, int height, int bytesPerPixel)
 {
     ID3D11ShaderResourceView *result;
     D3D11_TEXTURE2D_DESC desc;
@@ -298,7 +327,7 @@ ID3D11ShaderResourceView *D3DVideoWidget::initTexture(const void *p, int width,
     desc.Height = height;
     desc.MipLevels = 1;
     desc.ArraySize = 1;
-    desc.Format = DXGI_FORMAT_R8_UNORM;
+    desc.Format = bytesPerPixel == 2 ? DXGI_FORMAT_R16_UNORM : DXGI_FORMAT_R8_UNORM;
     desc.SampleDesc.Count = 1;
     desc.SampleDesc.Quality = 0;
     desc.Usage = D3D11_USAGE_DEFAULT;
@@ -308,7 +337,7 @@ ID3D11ShaderResourceView *D3DVideoWidget::initTexture(const void *p, int width,
 
     D3D11_SUBRESOURCE_DATA subresourceData;
     subresourceData.pSysMem = p;
-    subresourceData.SysMemPitch = width;
+    subresourceData.SysMemPitch = width * bytesPerPixel;
     subresourceData.SysMemSlicePitch = 0;
 
     ID3D11Texture2D *texture;
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "videocolorparams.h"
 #include "videowidget.h"
 
 #include <d3d11.h>
@@ -26,7 +27,7 @@ private:
     enum Stage { VertexStage, FragmentStage };
     void prepareShader(Stage stage);
     QByteArray compileShader(Stage stage, const QByteArray &source, const QByteArray &entryPoint);
-    ID3D11ShaderResourceView *initTexture(const void *p, int width, int height);
+    ID3D11ShaderResourceView *initTexture(const void *p, int width, int height, int bytesPerPixel);
 
     ID3D11Device *m_device = nullptr;
     ID3D11DeviceContext *m_context = nullptr;
@@ -45,10 +46,5 @@ private:
     ID3D11DepthStencilState *m_dsState = nullptr;
     ID3D11ShaderResourceView *m_texture[3] = {nullptr, nullptr, nullptr};
 
-    struct ConstantBuffer
-    {
-        int32_t colorspace;
-    };
-
-    ConstantBuffer m_constants;
+    VideoColorParams::FrameColorConstants m_constants;
 };
@@ -0,0 +1,142 @@
+/*
+    SPDX-FileCopyrightText: 2026 Jean-Baptiste Mardelle <jb@kdenlive.org>
+    SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "frametrace.h"
+#include "kdenlive_debug.h"
+
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QThread>
+
+// Enough for a couple of minutes of playback, old events are overwritten
+static const int ringSize = 16384;
+static const char *stageNames[FrameTrace::StageCount] = {"consumer frame", "convert", "upload", "display"};
+
+FrameTrace *FrameTrace::self()
+{
+    // Constructed on first use, the destructor of the static writes the trace on exit
+    static FrameTrace instance;
+    return &instance;
+}
+
+FrameTrace::FrameTrace()
+    : m_active(qEnvironmentVariableIsSet("KDENLIVE_FRAME_TRACE"))
+    , m_head(0)
+{
+    for (int i = 0; i < StageCount; i++) {
+        m_lastDurations[i] = 0;
+    }
+    if (m_active) {
+        const QString value = qEnvironmentVariable("KDENLIVE_FRAME_TRACE");
+        // The variable holds the output path, any other value selects the default location
+        m_outputPath = value.contains(QLatin1Char('/')) ? value : QDir::temp().absoluteFilePath(QStringLiteral("kdenlive-frame-trace.json"));
+        m_events.reserve(ringSize);
+        m_clock.start();
+        qCDebug(KDENLIVE_LOG) << "Frame pipeline tracing enabled, trace will be written to" << m_outputPath;
+    }
+}
+
+FrameTrace::~FrameTrace()
+{
+    if (m_active && !m_events.isEmpty()) {
+        exportChromeTrace(m_outputPath);
+    }
+}
+
+bool FrameTrace::isActive()
+{
+    return self()->m_active;
+}
+
+qint64 FrameTrace::now()
+{
+    return self()->m_clock.nsecsElapsed();
+}
+
+void FrameTrace::append(const Event &ev)
+{
+    QMutexLocker lock(&m_mutex);
+    if (m_events.size() < ringSize) {
+        m_events.append(ev);
+    } else {
+        m_events[m_head] = ev;
+    }
+    m_head = (m_head + 1) % ringSize;
+    if (ev.duration > 0) {
+        m_lastDurations[ev.stage] = ev.duration;
+    }
+}
+
+void FrameTrace::record(Stage stage, int position, qint64 startNs)
+{
+    FrameTrace *trace = self();
+    if (!trace->m_active) {
+        return;
+    }
+    trace->append({qint8(stage), qint32(position), startNs, trace->m_clock.nsecsElapsed() - startNs, quint64(quintptr(QThread::currentThreadId()))});
+}
+
+void FrameTrace::instant(Stage stage, int position)
+{
+    FrameTrace *trace = self();
+    if (!trace->m_active) {
+        return;
+    }
+    trace->append({qint8(stage), qint32(position), trace->m_clock.nsecsElapsed(), 0, quint64(quintptr(QThread::currentThreadId()))});
+}
+
+QString FrameTrace::lastFrameSummary()
+{
+    FrameTrace *trace = self();
+    QMutexLocker lock(&trace->m_mutex);
+    QStringList parts;
+    for (int i = 0; i < StageCount; i++) {
+        if (trace->m_lastDurations[i] > 0) {
+            parts << QStringLiteral("%1 %2ms").arg(QLatin1String(stageNames[i])).arg(trace->m_lastDurations[i] / 1000000., 0, 'f', 2);
+        }
+    }
+    return parts.join(QStringLiteral(" | "));
+}
+
+bool FrameTrace::exportChromeTrace(const QString &path)
+{
+    FrameTrace *trace = self();
+    QJsonArray events;
+    {
+        QMutexLocker lock(&trace->m_mutex);
+        for (const Event &ev : qAsConst(trace->m_events)) {
+            QJsonObject event;
+            event.insert(QStringLiteral("name"), QLatin1String(stageNames[ev.stage]));
+            event.insert(QStringLiteral("cat"), QStringLiteral("monitor"));
+            // Timestamps are in microseconds in the trace format
+            event.insert(QStringLiteral("ts"), double(ev.start) / 1000.);
+            if (ev.duration > 0) {
+                event.insert(QStringLiteral("ph"), QStringLiteral("X"));
+                event.insert(QStringLiteral("dur"), double(ev.duration) / 1000.);
+            } else {
+                event.insert(QStringLiteral("ph"), QStringLiteral("i"));
+                event.insert(QStringLiteral("s"), QStringLiteral("t"));
+            }
+            event.insert(QStringLiteral("pid"), 1);
+            event.insert(QStringLiteral("tid"), double(ev.threadId));
+            QJsonObject args;
+            args.insert(QStringLiteral("frame"), ev.position);
+            event.insert(QStringLiteral("args"), args);
+            events.append(event);
+        }
+    }
+    QJsonObject root;
+    root.insert(QStringLiteral("traceEvents"), events);
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(KDENLIVE_LOG) << "Cannot write frame trace to" << path;
+        return false;
+    }
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+    return true;
+}
@@ -0,0 +1,61 @@
+/*
+    SPDX-FileCopyrightText: 2026 Jean-Baptiste Mardelle <jb@kdenlive.org>
+    SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#pragma once
+
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QString>
+#include <QVector>
+
+/** @class FrameTrace
+    @brief Lightweight tracing of the monitor frame pipeline.
+    Tracing is off unless the KDENLIVE_FRAME_TRACE environment variable is set, so a release
+    build can be instrumented in place on a machine showing dropped frames. Each pipeline
+    stage records a timestamped span into a fixed size ring; on exit the ring is written out
+    in the Chrome trace event format (open with chrome://tracing or Perfetto). The most
+    recent duration of every stage also feeds the monitor HUD overlay.
+ */
+class FrameTrace
+{
+public:
+    enum Stage { FrameShow = 0, Convert, Upload, Display, StageCount };
+
+    /** @brief True if tracing was requested through the environment */
+    static bool isActive();
+    /** @brief Returns a timestamp to pass back to record() around a stage */
+    static qint64 now();
+    /** @brief Records a span for a stage that started at startNs, thread safe */
+    static void record(Stage stage, int position, qint64 startNs);
+    /** @brief Records a zero length marker event, thread safe */
+    static void instant(Stage stage, int position);
+    /** @brief One line per stage summary of the most recent frame, shown in the monitor HUD */
+    static QString lastFrameSummary();
+    /** @brief Writes the collected events to path in Chrome trace format */
+    static bool exportChromeTrace(const QString &path);
+
+private:
+    struct Event
+    {
+        qint8 stage;
+        qint32 position;
+        qint64 start;
+        qint64 duration;
+        quint64 threadId;
+    };
+    FrameTrace();
+    ~FrameTrace();
+    static FrameTrace *self();
+    void append(const Event &ev);
+
+    bool m_active;
+    QString m_outputPath;
+    /** @brief Monotonic clock shared by all stages so the spans line up in the trace */
+    QElapsedTimer m_clock;
+    QMutex m_mutex;
+    QVector<Event> m_events;
+    int m_head;
+    qint64 m_lastDurations[StageCount];
+};
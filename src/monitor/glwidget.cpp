@@ -29,6 +29,7 @@
 
 #include "bin/model/markersortmodel.h"
 #include "core.h"
+#include "frametrace.h"
 #include "glwidget.h"
 #include "monitorproxy.h"
 #include "profiles/profilemodel.hpp"
@@ -253,6 +254,7 @@ void VideoWidget::initializeGL()
 #endif
     connect(m_frameRenderer, &FrameRenderer::frameDisplayed, this, &VideoWidget::onFrameDisplayed, Qt::QueuedConnection);
     connect(m_frameRenderer, &FrameRenderer::frameDisplayed, this, &VideoWidget::frameDisplayed, Qt::QueuedConnection);
+    connect(m_frameRenderer, &FrameRenderer::frameDisplayed, this, &VideoWidget::cachePendingFrame, Qt::QueuedConnection);
     connect(m_frameRenderer, &FrameRenderer::textureReady, this, &VideoWidget::updateTexture, Qt::DirectConnection);
     m_initSem.release();
     m_isInitialized = true;
@@ -587,6 +589,7 @@ void VideoWidget::paintGL()
     QOpenGLFunctions *f = context.functions();
 #endif
 
+    qint64 displayStart = FrameTrace::isActive() ? FrameTrace::now() : 0;
     float width = this->width() * devicePixelRatioF();
     float height = this->height() * devicePixelRatioF();
     f->glClearColor(float(m_bgColor.redF()), float(m_bgColor.greenF()), float(m_bgColor.blueF()), 1);
@@ -696,6 +699,9 @@ void VideoWidget::paintGL()
 
     releaseSharedFrameTextures();
     check_error(f);
+    if (displayStart > 0) {
+        FrameTrace::record(FrameTrace::Display, m_sharedFrame.is_valid() ? m_sharedFrame.get_position() : -1, displayStart);
+    }
 }
 
 void VideoWidget::slotZoom(bool zoomIn)
@@ -740,6 +746,16 @@ void VideoWidget::requestSeek(int position, bool noAudioScrub)
 
 void VideoWidget::requestRefresh(bool slowRefresh)
 {
+    if (m_pendingCacheKey.isEmpty()) {
+        // Refresh requested for another reason than an effect parameter change, cached comparison frames are stale
+        clearFrameCache();
+    }
+    if (!slowRefresh && rootObject() != nullptr && rootObject()->property("captureRightClick").toBool()) {
+        // A monitor overlay handle is being dragged. The scene graph keeps compositing the moving overlay
+        // over the last displayed frame, so throttle the expensive consumer pulls during the drag; the
+        // pending timer fires after the last commit and catches up with the final parameters
+        slowRefresh = true;
+    }
     if (m_refreshTimer.isActive()) {
         m_refreshTimer.start(slowRefresh ? 200 : 10);
     } else if (m_producer && qFuzzyIsNull(m_producer->get_speed())) {
@@ -979,6 +995,7 @@ static void onThreadStopped(mlt_properties owner, VideoWidget *self, mlt_event_d
 
 int VideoWidget::setProducer(const QString &file)
 {
+    clearFrameCache();
     if (m_producer) {
         m_producer.reset();
     }
@@ -1004,6 +1021,7 @@ int VideoWidget::setProducer(const QString &file)
 
 int VideoWidget::setProducer(const std::shared_ptr<Mlt::Producer> &producer, bool isActive, int position)
 {
+    clearFrameCache();
     int error = 0;
     QString currentId;
     int consumerPosition = 0;
@@ -1198,13 +1216,11 @@ int VideoWidget::reconfigure()
         // m_consumer->set("progressive", 1);
         m_consumer->set("rescale", KdenliveSettings::mltinterpolation().toUtf8().constData());
         m_consumer->set("deinterlacer", KdenliveSettings::mltdeinterlacer().toUtf8().constData());
-        /*
-#ifdef Q_OS_WIN
-        m_consumer->set("audio_buffer", 2048);
-#else
-        m_consumer->set("audio_buffer", 512);
-#endif
-        */
+        if (KdenliveSettings::lowlatencymonitoring()) {
+            // Small period keeps the output latency around 10 ms at 48 kHz; backends like
+            // PipeWire or JACK can be selected through the audio driver setting
+            m_consumer->set("audio_buffer", 512);
+        }
         int fps = qRound(pCore->getCurrentFps());
         m_consumer->set("buffer", qMax(25, fps));
         m_consumer->set("prefill", 6);
@@ -1292,6 +1308,9 @@ void VideoWidget::onFrameDisplayed(const SharedFrame &frame)
     m_sendFrame = sendFrameForAnalysis;
     m_contextSharedAccess.unlock();
     quickWindow()->update();
+    if (FrameTrace::isActive()) {
+        m_proxy->setFrameTrace(FrameTrace::lastFrameSummary());
+    }
 }
 
 void VideoWidget::mouseReleaseEvent(QMouseEvent *event)
@@ -1320,6 +1339,59 @@ void VideoWidget::purgeCache()
     }
 }
 
+bool VideoWidget::displayEffectCachedFrame(const QString &key)
+{
+    if (!m_consumer || !m_producer || !qFuzzyIsNull(m_producer->get_speed())) {
+        return false;
+    }
+    for (const auto &entry : qAsConst(m_frameCache)) {
+        if (entry.first == key) {
+            // This stack state was rendered recently, redisplay it without decoding
+            onFrameDisplayed(entry.second);
+            return true;
+        }
+    }
+    return false;
+}
+
+void VideoWidget::cacheNextFrame(const QString &context, const QString &key, int position)
+{
+    if (context != m_frameCacheContext) {
+        // Another item's effects were adjusted, previous entries can no longer be trusted
+        m_frameCache.clear();
+        m_frameCacheContext = context;
+    }
+    m_pendingCacheKey = key;
+    m_pendingCachePos = position;
+}
+
+void VideoWidget::clearFrameCache()
+{
+    m_frameCache.clear();
+    m_frameCacheContext.clear();
+    m_pendingCacheKey.clear();
+    m_pendingCachePos = -1;
+}
+
+void VideoWidget::cachePendingFrame(const SharedFrame &frame)
+{
+    if (m_pendingCacheKey.isEmpty()) {
+        return;
+    }
+    if (frame.get_position() != m_pendingCachePos) {
+        // A seek or playback started before the tagged frame came through
+        m_pendingCacheKey.clear();
+        m_pendingCachePos = -1;
+        return;
+    }
+    m_frameCache.append({m_pendingCacheKey, frame});
+    while (m_frameCache.size() > 10) {
+        m_frameCache.removeFirst();
+    }
+    m_pendingCacheKey.clear();
+    m_pendingCachePos = -1;
+}
+
 void VideoWidget::mouseDoubleClickEvent(QMouseEvent *event)
 {
     QQuickWidget::mouseDoubleClickEvent(event);
@@ -1381,6 +1453,9 @@ void VideoWidget::on_frame_show(mlt_consumer, VideoWidget *widget, mlt_event_dat
 {
     auto frame = Mlt::EventData(data).to_frame();
     if (frame.is_valid() && frame.get_int("rendered")) {
+        if (FrameTrace::isActive()) {
+            FrameTrace::instant(FrameTrace::FrameShow, frame.get_position());
+        }
         int timeout = (widget->consumer()->get_int("real_time") > 0) ? 0 : 1000;
         if ((widget->m_frameRenderer != nullptr) && widget->m_frameRenderer->semaphore()->tryAcquire(1, timeout)) {
             QMetaObject::invokeMethod(widget->m_frameRenderer, "showFrame", Qt::QueuedConnection, Q_ARG(Mlt::Frame, frame));
@@ -1480,14 +1555,22 @@ FrameRenderer::~FrameRenderer()
 
 void FrameRenderer::showFrame(Mlt::Frame frame)
 {
+    qint64 traceStart = FrameTrace::isActive() ? FrameTrace::now() : 0;
     // Save this frame for future use and to keep a reference to the GL Texture.
     m_displayFrame = SharedFrame(frame);
+    if (traceStart > 0) {
+        FrameTrace::record(FrameTrace::Convert, m_displayFrame.get_position(), traceStart);
+    }
 
     if ((m_context != nullptr) && m_context->isValid()) {
         m_context->makeCurrent(m_surface);
         // Upload each plane of YUV to a texture.
         QOpenGLFunctions *f = m_context->functions();
+        qint64 uploadStart = traceStart > 0 ? FrameTrace::now() : 0;
         uploadTextures(m_context, m_displayFrame, m_renderTexture);
+        if (uploadStart > 0) {
+            FrameTrace::record(FrameTrace::Upload, m_displayFrame.get_position(), uploadStart);
+        }
         f->glBindTexture(GL_TEXTURE_2D, 0);
         check_error(f);
         f->glFinish();
@@ -122,6 +122,13 @@ public:
     void setConsumerProperty(const QString &name, const QString &value);
     /** @brief Clear consumer cache */
     void purgeCache();
+    /** @brief Redisplay the frame cached under @p key if we have it, returns false on cache miss */
+    bool displayEffectCachedFrame(const QString &key);
+    /** @brief Store the next frame displayed at @p position under @p key so it can be redisplayed
+     *  without a re-render. Switching to another @p context drops all previous entries. */
+    void cacheNextFrame(const QString &context, const QString &key, int position);
+    /** @brief Drop all frames kept for effect parameter comparison */
+    void clearFrameCache();
     /** @brief Show / hide monitor ruler */
     void switchRuler(bool show);
     /** @brief Returns true if consumer is initialized */
@@ -232,6 +239,12 @@ private:
     int m_loopOut;
     QPoint m_offset;
     MonitorProxy *m_proxy;
+    /** @brief Recently displayed frames kept for A/B comparison of effect parameters, keyed by
+     *  (position, effect stack hash). Invalidated whenever the scene changes for another reason. */
+    QList<QPair<QString, SharedFrame>> m_frameCache;
+    QString m_frameCacheContext;
+    QString m_pendingCacheKey;
+    int m_pendingCachePos{-1};
     std::shared_ptr<Mlt::Producer> m_blackClip;
     static void on_frame_show(mlt_consumer, VideoWidget *widget, mlt_event_data);
     static void on_frame_render(mlt_consumer, VideoWidget *widget, mlt_frame frame);
@@ -252,6 +265,8 @@ private Q_SLOTS:
     void onFrameDisplayed(const SharedFrame &frame);
     int reconfigure();
     void refresh();
+    /** @brief Store the displayed frame if it was tagged for the effect comparison cache */
+    void cachePendingFrame(const SharedFrame &frame);
     void switchRecordState(bool on);
     /** @brief Enforce a zoom refresh, can be useful when switching to/from fullscreen to adjust image size/position */
     void forceRefreshZoom();
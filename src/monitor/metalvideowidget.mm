@@ -6,6 +6,7 @@
 #include "metalvideowidget.h"
 #include "core.h"
 #include "profiles/profilemodel.hpp"
+#include "videocolorparams.h"
 #include <Metal/Metal.h>
 
 
@@ -63,7 +64,7 @@ public:
         m_vbuf = [m_device newBufferWithLength: 16*sizeof(float) options: MTLResourceStorageModeShared];
 
         for (int i = 0; i < m_window->graphicsStateInfo().framesInFlight && i < 3; ++i)
-            m_ubuf[i] = [m_device newBufferWithLength: sizeof(int) options: MTLResourceStorageModeShared];
+            m_ubuf[i] = [m_device newBufferWithLength: sizeof(VideoColorParams::FrameColorConstants) options: MTLResourceStorageModeShared];
 
         MTLVertexDescriptor *inputLayout = [MTLVertexDescriptor vertexDescriptor];
         inputLayout.attributes[0].format = MTLVertexFormatFloat4;
@@ -143,8 +144,15 @@ public:
         memcpy(p, vertexData, sizeof(vertexData));
 
         p = [m_ubuf[stateInfo.currentFrameSlot] contents];
+        // Keep 10 bit frames at their native depth so the conversion stays on the GPU
+        const bool tenBit = sharedFrame.get_image_format() == mlt_image_yuv420p10;
         int colorspace = pCore->getCurrentProfile()->colorspace();
-        memcpy(p, &colorspace, sizeof(colorspace));
+        if (sharedFrame.get_int("colorspace") > 0) {
+            colorspace = sharedFrame.get_int("colorspace");
+        }
+        const VideoColorParams::FrameColorConstants constants = VideoColorParams::frameColorConstants(
+            colorspace, sharedFrame.get_int("color_trc"), tenBit ? 10 : 8, sharedFrame.get_int("full_range") != 0);
+        memcpy(p, &constants, sizeof(constants));
 
         MTLViewport vp;
         vp.originX = 0;
@@ -158,14 +166,15 @@ public:
         // (Re)create the textures
         int iwidth = sharedFrame.get_image_width();
         int iheight = sharedFrame.get_image_height();
-        const uint8_t *image = sharedFrame.get_image(mlt_image_yuv420p);
+        const uint8_t *image = sharedFrame.get_image(tenBit ? mlt_image_yuv420p10 : mlt_image_yuv420p);
+        const int bpp = tenBit ? 2 : 1;
         for (int i = 0; i < 3; i++) {
             [m_texture[i] release];
         }
-        m_texture[0] = initTexture(image, iwidth, iheight);
-        m_texture[1] = initTexture(image + iwidth * iheight, iwidth / 2, iheight / 2);
-        m_texture[2] = initTexture(image + iwidth * iheight + iwidth / 2 * iheight / 2, iwidth / 2,
-                                   iheight / 2);
+        m_texture[0] = initTexture(image, iwidth, iheight, bpp);
+        m_texture[1] = initTexture(image + bpp * iwidth * iheight, iwidth / 2, iheight / 2, bpp);
+        m_texture[2] = initTexture(image + bpp * (iwidth * iheight + iwidth / 2 * iheight / 2), iwidth / 2,
+                                   iheight / 2, bpp);
         // Set the texture object.  The AAPLTextureIndexBaseColor enum value corresponds
         ///  to the 'colorMap' argument in the 'samplingShader' function because its
         //   texture attribute qualifier also uses AAPLTextureIndexBaseColor for its index.
@@ -182,12 +191,12 @@ public:
         m_window->endExternalCommands();
     }
 
-    id<MTLTexture> initTexture(const void *p, NSUInteger width, NSUInteger height)
+    id<MTLTexture> initTexture(const void *p, NSUInteger width, NSUInteger height, NSUInteger bytesPerPixel)
     {
         MTLTextureDescriptor *textureDescriptor = [[MTLTextureDescriptor alloc] init];
 
-        // 8-bit unsigned normalized value (i.e. 0 maps to 0.0 and 255 maps to 1.0)
-        textureDescriptor.pixelFormat = MTLPixelFormatR8Unorm;
+        // unsigned normalized value (i.e. 0 maps to 0.0 and the maximum code value maps to 1.0)
+        textureDescriptor.pixelFormat = bytesPerPixel == 2 ? MTLPixelFormatR16Unorm : MTLPixelFormatR8Unorm;
         textureDescriptor.width = width;
         textureDescriptor.height = height;
         id<MTLTexture> texture = [m_device newTextureWithDescriptor:textureDescriptor];
@@ -199,7 +208,7 @@ public:
         };
 
         // Copy the bytes from the data object into the texture
-        [texture replaceRegion:region mipmapLevel:0 withBytes:p bytesPerRow:width];
+        [texture replaceRegion:region mipmapLevel:0 withBytes:p bytesPerRow:width * bytesPerPixel];
         return texture;
     }
 
@@ -244,11 +253,20 @@ private:
             Q_ASSERT(!m_vert.isEmpty());
             m_vertEntryPoint = QByteArrayLiteral("main0");
         } else {
+            // Format agnostic conversion: the matrix, offsets, bit depth scale and transfer
+            // function come from the uniform buffer (see videocolorparams.h), so the same
+            // shader covers 601/709/2020, 8/10 bit and PQ/HLG sources
             m_frag ="#include <metal_stdlib>\n"
                     "#include <simd/simd.h>\n"
                     "using namespace metal;"
                     "struct buf {"
-                    "    int colorspace;"
+                    "    float4 coefR;"
+                    "    float4 coefG;"
+                    "    float4 coefB;"
+                    "    float texelScale;"
+                    "    float yOffset;"
+                    "    float cOffset;"
+                    "    int transferFunc;"
                     "};"
                     "struct main0_out {"
                     "    float4 fragColor [[color(0)]];"
@@ -256,6 +274,20 @@ private:
                     "struct main0_in {"
                     "    float2 coords [[user(locn0)]];"
                     "};"
+                    // SMPTE ST 2084 EOTF, normalized so the 203 nit reference white lands on 1.0
+                    "static float3 toneMapPq(float3 rgb) {"
+                    "    float3 p = pow(max(rgb, 0.0f), 1.0f/78.84375f);"
+                    "    float3 lin = pow(max(p - 0.8359375f, 0.0f) / (18.8515625f - 18.6875f * p), 1.0f/0.1593017578125f);"
+                    "    return pow(saturate(lin * 49.26f), 1.0f/2.2f);"
+                    "}"
+                    // ARIB STD-B67 inverse OETF with a simple gamma re-encode for SDR display
+                    "static float3 toneMapHlg(float3 rgb) {"
+                    "    float3 v = max(rgb, 0.0f);"
+                    "    float3 low = v * v / 3.0f;"
+                    "    float3 high = (exp((v - 0.55991073f) / 0.17883277f) + 0.28466892f) / 12.0f;"
+                    "    float3 lin = mix(low, high, step(0.5f, v));"
+                    "    return pow(saturate(lin), 1.0f/2.2f);"
+                    "}"
                     "fragment main0_out main0(main0_in in [[stage_in]], constant buf& ubuf [[buffer(0)]],"
                     "      texture2d<half> yTex [[texture(0)]],"
                     "      texture2d<half> uTex [[texture(1)]],"
@@ -264,22 +296,19 @@ private:
                     "    main0_out out = {};"
                     "    constexpr sampler yuvSampler (mag_filter::linear, min_filter::linear);"
                     "    float3 yuv;"
-                    "    yuv.x = yTex.sample(yuvSampler, in.coords).r -  16.0f/255.0f;"
-                    "    yuv.y = uTex.sample(yuvSampler, in.coords).r - 128.0f/255.0f;"
-                    "    yuv.z = vTex.sample(yuvSampler, in.coords).r - 128.0f/255.0f;"
-                    "    float3x3 coefficients;"
-                    "    if (ubuf.colorspace == 601) {"
-                    "      coefficients = float3x3("
-                    "        {1.1643f,  1.1643f,  1.1643f},"
-                    "        {0.0f,    -0.39173f, 2.017f},"
-                    "        {1.5958f, -0.8129f,  0.0f});"
-                    "    } else {" // ITU-R 709
-                    "      coefficients = float3x3("
-                    "        {1.1643f, 1.1643f, 1.1643f},"
-                    "        {0.0f,   -0.213f,  2.112f},"
-                    "        {1.793f, -0.533f,  0.0f});"
+                    "    yuv.x = yTex.sample(yuvSampler, in.coords).r * ubuf.texelScale - ubuf.yOffset;"
+                    "    yuv.y = uTex.sample(yuvSampler, in.coords).r * ubuf.texelScale - ubuf.cOffset;"
+                    "    yuv.z = vTex.sample(yuvSampler, in.coords).r * ubuf.texelScale - ubuf.cOffset;"
+                    "    float3 rgb;"
+                    "    rgb.r = dot(ubuf.coefR.xyz, yuv);"
+                    "    rgb.g = dot(ubuf.coefG.xyz, yuv);"
+                    "    rgb.b = dot(ubuf.coefB.xyz, yuv);"
+                    "    if (ubuf.transferFunc == 16) {"
+                    "      rgb = toneMapPq(rgb);"
+                    "    } else if (ubuf.transferFunc == 18) {"
+                    "      rgb = toneMapHlg(rgb);"
                     "    }"
-                    "    out.fragColor = float4(coefficients * yuv, 1.0f);"
+                    "    out.fragColor = float4(rgb, 1.0f);"
                     "    return out;"
                     "}";
             m_fragEntryPoint = QByteArrayLiteral("main0");
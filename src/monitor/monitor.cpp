@@ -182,6 +182,11 @@ Monitor::Monitor(Kdenlive::MonitorId id, MonitorManager *manager, QWidget *paren
     connect(m_qmlManager, &QmlManager::effectChanged, this, &Monitor::effectChanged);
     connect(this, &Monitor::blockSceneChange, m_qmlManager, &QmlManager::blockSceneChange);
     connect(m_qmlManager, &QmlManager::effectPointsChanged, this, &Monitor::effectPointsChanged);
+    // Dragging a geometry handle re-renders the frame through the CPU compositing path on
+    // every mouse move; serve those frames at reduced resolution so layout work happens at
+    // display rate, the full resolution frame is committed once the drag rests
+    connect(m_qmlManager, &QmlManager::effectChanged, m_glMonitor, &VideoWidget::beginInteractiveScaling);
+    connect(m_qmlManager, &QmlManager::effectPointsChanged, m_glMonitor, &VideoWidget::beginInteractiveScaling);
     connect(m_qmlManager, &QmlManager::activateTrack, this, [&](int ix) { Q_EMIT activateTrack(ix, false); });
 
     glayout->addWidget(m_glMonitor, 0, 0);
@@ -777,8 +782,24 @@ void Monitor::buildBackgroundedProducer(int pos)
         return;
     }
     if (KdenliveSettings::monitor_background() != "black") {
-        Mlt::Tractor trac(pCore->getProjectProfile());
+        const QString binId = m_controller->clipId();
         QString color = QString("color:%1").arg(KdenliveSettings::monitor_background());
+        std::shared_ptr<Mlt::Producer> cached = m_backgroundedProducers.value(binId);
+        if (cached && cached->is_valid() && color == QLatin1String(cached->get("kdenlive:monitor_bg"))) {
+            // Make sure the cached tractor still wraps the clip's current producer (it
+            // is rebuilt when the clip is reloaded or switches proxy)
+            Mlt::Tractor cachedTrac(*cached.get());
+            std::unique_ptr<Mlt::Producer> track(cachedTrac.track(1));
+            if (track && track->parent().get_producer() == m_controller->originalProducer()->parent().get_producer()) {
+                m_backgroundedOrder.removeAll(binId);
+                m_backgroundedOrder.prepend(binId);
+                m_glMonitor->setProducer(cached, isActive(), pos);
+                return;
+            }
+            m_backgroundedProducers.remove(binId);
+            m_backgroundedOrder.removeAll(binId);
+        }
+        Mlt::Tractor trac(pCore->getProjectProfile());
         std::shared_ptr<Mlt::Producer> bg(new Mlt::Producer(*trac.profile(), color.toUtf8().constData()));
         int maxLength = m_controller->originalProducer()->get_length();
         bg->set("length", maxLength);
@@ -791,7 +812,14 @@ void Monitor::buildBackgroundedProducer(int pos)
         transition->set("always_active", 1);
         transition->set_tracks(0, 1);
         trac.plant_transition(*transition.get(), 0, 1);
-        m_glMonitor->setProducer(std::make_shared<Mlt::Producer>(trac), isActive(), pos);
+        auto wrapped = std::make_shared<Mlt::Producer>(trac);
+        wrapped->set("kdenlive:monitor_bg", color.toUtf8().constData());
+        m_backgroundedProducers.insert(binId, wrapped);
+        m_backgroundedOrder.prepend(binId);
+        while (m_backgroundedOrder.size() > 4) {
+            m_backgroundedProducers.remove(m_backgroundedOrder.takeLast());
+        }
+        m_glMonitor->setProducer(wrapped, isActive(), pos);
     } else {
         m_glMonitor->setProducer(m_controller->originalProducer(), isActive(), pos);
     }
@@ -1562,7 +1590,11 @@ void Monitor::slotRewindOneFrame(int diff)
     if (!slotActivateMonitor()) {
         return;
     }
-    m_glMonitor->getControllerProxy()->setPosition(qMax(0, m_glMonitor->getCurrentPos() - diff));
+    int pos = qMax(0, m_glMonitor->getCurrentPos() - diff);
+    if (diff > 1) {
+        pos = qMax(0, snapSeekToKeyframe(pos));
+    }
+    m_glMonitor->getControllerProxy()->setPosition(pos);
 }
 
 void Monitor::slotForwardOneFrame(int diff)
@@ -1570,13 +1602,31 @@ void Monitor::slotForwardOneFrame(int diff)
     if (!slotActivateMonitor()) {
         return;
     }
+    int pos = m_glMonitor->getCurrentPos() + diff;
+    if (diff > 1) {
+        pos = snapSeekToKeyframe(pos);
+    }
     if (m_id == Kdenlive::ClipMonitor) {
-        m_glMonitor->getControllerProxy()->setPosition(qMin(m_glMonitor->duration() - 1, m_glMonitor->getCurrentPos() + diff));
+        m_glMonitor->getControllerProxy()->setPosition(qMin(m_glMonitor->duration() - 1, pos));
     } else {
-        m_glMonitor->getControllerProxy()->setPosition(m_glMonitor->getCurrentPos() + diff);
+        m_glMonitor->getControllerProxy()->setPosition(pos);
     }
 }
 
+int Monitor::snapSeekToKeyframe(int pos) const
+{
+    // Coarse jumps don't need frame accuracy; landing on the keyframe cadence detected at
+    // load time lets the decoder start on a keyframe instead of decoding a full GOP
+    if (m_id != Kdenlive::ClipMonitor || m_controller == nullptr) {
+        return pos;
+    }
+    int gop = m_controller->getProducerIntProperty(QStringLiteral("kdenlive:gopsize"));
+    if (gop > 1) {
+        pos = qRound(double(pos) / gop) * gop;
+    }
+    return pos;
+}
+
 void Monitor::adjustRulerSize(int length, const std::shared_ptr<MarkerSortModel> &markerModel)
 {
     if (m_controller != nullptr) {
@@ -1678,6 +1728,22 @@ void Monitor::refreshMonitorIfActive(bool directUpdate)
     }
 }
 
+bool Monitor::displayEffectCachedFrame(const QString &stackHash)
+{
+    if (!m_glMonitor->isReady() || !isActive() || isPlaying()) {
+        return false;
+    }
+    return m_glMonitor->displayEffectCachedFrame(QStringLiteral("%1:%2").arg(position()).arg(stackHash));
+}
+
+void Monitor::cacheNextFrameForEffects(const QString &context, const QString &stackHash)
+{
+    if (!m_glMonitor->isReady() || isPlaying()) {
+        return;
+    }
+    m_glMonitor->cacheNextFrame(context, QStringLiteral("%1:%2").arg(position()).arg(stackHash), position());
+}
+
 void Monitor::pause()
 {
     if (!m_playAction->isActive() || !slotActivateMonitor()) {
@@ -1702,6 +1768,9 @@ void Monitor::switchPlay(bool play)
         play = false;
     }
     m_playAction->setActive(play);
+    if (!play && m_id == Kdenlive::ProjectMonitor) {
+        pCore->flushPendingItemInvalidations();
+    }
 }
 
 void Monitor::updatePlayAction(bool play)
@@ -1709,6 +1778,9 @@ void Monitor::updatePlayAction(bool play)
     m_playAction->setActive(play);
     if (!play) {
         m_droppedTimer.stop();
+        if (m_id == Kdenlive::ProjectMonitor) {
+            pCore->flushPendingItemInvalidations();
+        }
     }
     if (!KdenliveSettings::autoscroll()) {
         Q_EMIT pCore->autoScrollChanged();
@@ -2000,6 +2072,9 @@ void Monitor::slotOpenClip(const std::shared_ptr<ProjectClip> &controller, int i
         // hasEffects =  controller->hasEffects();
     } else {
         m_markerModel = nullptr;
+        // Release the warm producer cache so clearing the monitor frees the decoders
+        m_backgroundedProducers.clear();
+        m_backgroundedOrder.clear();
         loadQmlScene(MonitorSceneDefault);
         m_glMonitor->setProducer(nullptr, isActive(), -1);
         m_glMonitor->getControllerProxy()->setAudioThumb();
@@ -2621,6 +2696,8 @@ void Monitor::slotSwitchTrimming(bool enable)
         m_trimmingbar->setVisible(false);
         m_toolbar->setVisible(true);
         m_glMonitor->switchRuler(KdenliveSettings::displayClipMonitorInfo() & 0x01);
+        // Drop the boundary frames cached for the trim preview
+        m_glMonitor->clearFrameCache();
     }
 }
 
@@ -2829,6 +2906,12 @@ void Monitor::slotStart()
 void Monitor::slotTrimmingPos(int pos, int offset, int frames1, int frames2)
 {
     if (m_glMonitor->producer() != pCore->window()->getCurrentTimeline()->model()->producer().get()) {
+        // Show the already decoded frame for this boundary instantly if we have it, the
+        // seek below then refreshes it with a fresh decode once that completes
+        const QString key = QStringLiteral("trim:%1").arg(pos);
+        if (!m_glMonitor->displayEffectCachedFrame(key)) {
+            m_glMonitor->cacheNextFrame(QStringLiteral("trimming"), key, pos);
+        }
         processSeek(pos);
     }
     QString tc(pCore->timecode().getDisplayTimecodeFromFrames(offset, KdenliveSettings::frametimecode()));
@@ -2841,7 +2924,12 @@ void Monitor::slotTrimmingPos(int offset)
 {
     offset = pCore->window()->getCurrentTimeline()->controller()->trimmingBoundOffset(offset);
     if (m_glMonitor->producer() != pCore->window()->getCurrentTimeline()->model()->producer().get()) {
-        processSeek(m_glMonitor->producer()->position() + offset);
+        int pos = m_glMonitor->producer()->position() + offset;
+        const QString key = QStringLiteral("trim:%1").arg(pos);
+        if (!m_glMonitor->displayEffectCachedFrame(key)) {
+            m_glMonitor->cacheNextFrame(QStringLiteral("trimming"), key, pos);
+        }
+        processSeek(pos);
     }
     QString tc(pCore->timecode().getDisplayTimecodeFromFrames(offset, KdenliveSettings::frametimecode()));
     m_trimmingOffset->setText(tc);
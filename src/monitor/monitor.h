@@ -143,6 +143,12 @@ public:
     void normalizeAudioThumbs();
     /** @brief Returns true if monitor is playing */
     bool isPlaying() const;
+    /** @brief Redisplay the frame cached for the current position and effect stack state @p stackHash,
+     *  returns false on cache miss */
+    bool displayEffectCachedFrame(const QString &stackHash);
+    /** @brief Remember the next displayed frame under @p stackHash so A/B comparisons of effect
+     *  parameters can redisplay it without a re-render. @p context identifies the tweaked item. */
+    void cacheNextFrameForEffects(const QString &context, const QString &stackHash);
     /** @brief Enables / disables effect scene*/
     void enableEffectScene(bool enable);
     /** @brief Update the document's uuid - used for qml thumb cache*/
@@ -194,6 +200,12 @@ private:
 
     std::shared_ptr<Mlt::Filter> m_splitEffect;
     std::shared_ptr<Mlt::Producer> m_splitProducer;
+    /** @brief Recently displayed backgrounded producers, keyed by bin clip id. Keeping
+     *  the wrapping tractor (and the MLT caches attached to it) warm makes switching
+     *  back to a recently reviewed clip instantaneous. */
+    QMap<QString, std::shared_ptr<Mlt::Producer>> m_backgroundedProducers;
+    /** @brief Most recently used first, bounds m_backgroundedProducers */
+    QStringList m_backgroundedOrder;
     std::shared_ptr<MarkerListModel> m_markerModel{nullptr};
     int m_length;
     bool m_dragStarted;
@@ -237,6 +249,10 @@ private:
     QMetaObject::Connection m_captureConnection;
 
     void adjustScrollBars(float horizontal, float vertical);
+    /** @brief Align a coarse seek target on the clip's keyframe cadence (detected at load
+     *  time) so the decoder starts on a keyframe. Returns @param pos unchanged in the
+     *  project monitor or when the cadence is unknown. */
+    int snapSeekToKeyframe(int pos) const;
     void loadQmlScene(MonitorSceneType type, const QVariant &sceneData = QVariant());
     void updateQmlDisplay(int currentOverlay);
     /** @brief Create temporary Mlt::Tractor holding a clip and it's effectless clone */
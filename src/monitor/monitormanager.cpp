@@ -351,6 +351,25 @@ void MonitorManager::slotForwardOneFrame()
     }
 }
 
+void MonitorManager::slotStepFrames(int diff)
+{
+    if (diff == 0) {
+        return;
+    }
+    if (pCore->activeTool() == ToolType::SlipTool) {
+        m_projectMonitor->slotTrimmingPos(diff);
+        pCore->window()->getCurrentTimeline()->model()->requestSlipSelection(diff, true);
+    } else if (isTrimming()) {
+        return;
+    } else {
+        if (m_activeMonitor == m_clipMonitor) {
+            diff < 0 ? m_clipMonitor->slotRewindOneFrame(-diff) : m_clipMonitor->slotForwardOneFrame(diff);
+        } else if (m_activeMonitor == m_projectMonitor) {
+            diff < 0 ? m_projectMonitor->slotRewindOneFrame(-diff) : m_projectMonitor->slotForwardOneFrame(diff);
+        }
+    }
+}
+
 void MonitorManager::slotRewindOneSecond()
 {
     if (pCore->activeTool() == ToolType::SlipTool) {
@@ -82,6 +82,8 @@ public Q_SLOTS:
     void slotForward(double speed = 0);
     void slotRewindOneFrame();
     void slotForwardOneFrame();
+    /** @brief Seek the active monitor by diff frames, used for coalesced jog wheel steps */
+    void slotStepFrames(int diff);
     void slotRewindOneSecond();
     void slotForwardOneSecond();
     void slotStart();
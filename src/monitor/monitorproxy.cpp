@@ -31,6 +31,8 @@ MonitorProxy::MonitorProxy(VideoWidget *parent)
     , m_clipType(0)
     , m_clipId(-1)
     , m_seekFinished(true)
+    , m_pendingSeek(-1)
+    , m_pendingSeekNoAudioScrub(false)
     , m_td(nullptr)
     , m_trimmingFrames1(0)
     , m_trimmingFrames2(0)
@@ -40,6 +42,9 @@ MonitorProxy::MonitorProxy(VideoWidget *parent)
         connect(pCore->bin(), &Bin::clipNameChanged, this, &MonitorProxy::updateClipName);
     }
     m_showGrid = KdenliveSettings::showMonitorGrid();
+    m_positionCatchup.setSingleShot(true);
+    m_positionCatchup.setInterval(50);
+    connect(&m_positionCatchup, &QTimer::timeout, this, [this]() { Q_EMIT positionChanged(m_position); });
 }
 
 void MonitorProxy::switchGrid()
@@ -127,8 +132,14 @@ bool MonitorProxy::setPositionAdvanced(int pos, bool noAudioScrub)
         return true;
     }
     m_position = pos;
-    Q_EMIT requestSeek(pos, noAudioScrub);
-    if (m_seekFinished) {
+    if (!m_seekFinished) {
+        // The consumer is still decoding a previous seek. Only remember the newest
+        // target so a slider drag or jog shuttle burst does not queue a full
+        // seek + decode for every crossed frame of long GOP media
+        m_pendingSeek = pos;
+        m_pendingSeekNoAudioScrub = noAudioScrub;
+    } else {
+        Q_EMIT requestSeek(pos, noAudioScrub);
         m_seekFinished = false;
         Q_EMIT seekFinishedChanged();
     }
@@ -146,15 +157,35 @@ void MonitorProxy::positionFromConsumer(int pos, bool playing)
 {
     if (playing) {
         m_position = pos;
-        Q_EMIT positionChanged(pos);
+        m_pendingSeek = -1;
         if (!m_seekFinished) {
             m_seekFinished = true;
             Q_EMIT seekFinishedChanged();
         }
+        if (m_positionThrottle.isValid() && m_positionThrottle.elapsed() < 16) {
+            // Updating position, timecode and the bindings hanging off them on every
+            // consumer frame starves the QML thread on high fps projects. Skip this
+            // frame; the catchup timer delivers the newest position if no further
+            // frame event follows, so pausing still settles on the exact frame
+            m_positionCatchup.start();
+            return;
+        }
+        m_positionThrottle.start();
+        m_positionCatchup.stop();
+        Q_EMIT positionChanged(pos);
     } else {
-        if (!m_seekFinished && m_position == pos) {
-            m_seekFinished = true;
-            Q_EMIT seekFinishedChanged();
+        if (!m_seekFinished) {
+            if (m_pendingSeek > -1 && m_pendingSeek != pos) {
+                // The scrub head moved on while this frame was decoding, jump
+                // straight to the latest position
+                const int target = m_pendingSeek;
+                m_pendingSeek = -1;
+                Q_EMIT requestSeek(target, m_pendingSeekNoAudioScrub);
+            } else if (m_position == pos) {
+                m_pendingSeek = -1;
+                m_seekFinished = true;
+                Q_EMIT seekFinishedChanged();
+            }
         }
     }
 }
@@ -571,6 +602,14 @@ void MonitorProxy::setWidgetKeyBinding(const QString &text) const
     pCore->setWidgetKeyBinding(text);
 }
 
+void MonitorProxy::setFrameTrace(const QString &trace)
+{
+    if (m_frameTrace != trace) {
+        m_frameTrace = trace;
+        Q_EMIT frameTraceChanged();
+    }
+}
+
 void MonitorProxy::setSpeed(double speed)
 {
     if (qAbs(m_speed) > 1. || qAbs(speed) > 1.) {
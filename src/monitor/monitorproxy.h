@@ -13,8 +13,10 @@
 #else // Qt6
 #include "glwidget.h"
 #endif
+#include <QElapsedTimer>
 #include <QImage>
 #include <QObject>
+#include <QTimer>
 #include <QUrl>
 
 class TimecodeDisplay;
@@ -65,6 +67,9 @@ class MonitorProxy : public QObject
     Q_PROPERTY(int clipType MEMBER m_clipType NOTIFY clipTypeChanged)
     Q_PROPERTY(int clipId MEMBER m_clipId NOTIFY clipIdChanged)
     Q_PROPERTY(QStringList runningJobs MEMBER m_runningJobs NOTIFY runningJobsChanged)
+    /** @brief Per stage timings of the last displayed frame, empty unless frame tracing is active
+     * */
+    Q_PROPERTY(QString frameTrace MEMBER m_frameTrace NOTIFY frameTraceChanged)
     Q_PROPERTY(QList<int> jobsProgress MEMBER m_jobsProgress NOTIFY jobsProgressChanged)
     Q_PROPERTY(QStringList jobsUuids MEMBER m_jobsUuids NOTIFY jobsProgressChanged)
 
@@ -143,6 +148,8 @@ public:
     /** @brief Temporarily set timeline cursor position (-1 to hide it)*/
     void setCursorPosition(int pos);
     void setJobsProgress(const ObjectId &owner, const QStringList &jobNames, const QList<int> &jobProgress, const QStringList &jobUuids);
+    /** @brief Update the frame pipeline timings shown in the monitor HUD*/
+    void setFrameTrace(const QString &trace);
 
 Q_SIGNALS:
     void positionChanged(int);
@@ -181,6 +188,7 @@ Q_SIGNALS:
     void clipBoundsChanged();
     void runningJobsChanged();
     void jobsProgressChanged();
+    void frameTraceChanged();
     void addTimelineEffect(const QStringList &);
     void lastClipsChanged();
     /** @brief Switch to another clip at the same time position that uses the same effect scene*/
@@ -200,9 +208,20 @@ private:
     QColor m_markerColor;
     QString m_clipName;
     QString m_clipStream;
+    QString m_frameTrace;
     int m_clipType;
     int m_clipId;
     bool m_seekFinished;
+    /** @brief Limits playback position updates to roughly the display refresh rate,
+     *  per-frame property churn on high fps projects starves the QML thread */
+    QElapsedTimer m_positionThrottle;
+    /** @brief Delivers the newest playback position when the throttle swallowed it,
+     *  so the UI always settles on the exact frame the consumer stopped on */
+    QTimer m_positionCatchup;
+    /** @brief Latest position requested while a seek was still decoding, -1 if none.
+     *  Successive scrub positions are coalesced so only the newest one is decoded. */
+    int m_pendingSeek;
+    bool m_pendingSeekNoAudioScrub;
     QPoint m_undoZone;
     TimecodeDisplay *m_td;
     int m_trimmingFrames1;
@@ -5,7 +5,13 @@
 
 #include "openglvideowidget.h"
 #include "core.h"
+#include "frametrace.h"
 #include "profiles/profilemodel.hpp"
+#include "videocolorparams.h"
+
+#ifndef GL_LUMINANCE16
+#define GL_LUMINANCE16 0x8042
+#endif
 
 #if QT_CONFIG(opengles2)
 #include <QOpenGLFunctions_ES2>
@@ -91,94 +97,113 @@ void OpenGLVideoWidget::createShader()
                                                              "  gl_Position = projection * modelView * vertex;"
                                                              "  coordinates = texCoord;"
                                                              "}");
+    // Format agnostic conversion: the matrix, offsets, bit depth scale and transfer
+    // function are computed on the CPU (see videocolorparams.h) and fed as uniforms,
+    // so the same shader covers 601/709/2020, 8/10 bit and PQ/HLG sources
     m_shader->addShaderFromSourceCode(QOpenGLShader::Fragment,
                                       "uniform sampler2D Ytex, Utex, Vtex;"
-                                      "uniform lowp int colorspace;"
+                                      "uniform highp mat3 coefficients;"
+                                      "uniform highp float texelScale;"
+                                      "uniform highp float yOffset;"
+                                      "uniform highp float cOffset;"
+                                      "uniform lowp int transferFunc;"
                                       "varying highp vec2 coordinates;"
+                                      // SMPTE ST 2084 EOTF, normalized so the 203 nit reference white lands on 1.0
+                                      "highp vec3 toneMapPq(highp vec3 rgb) {"
+                                      "  highp vec3 p = pow(max(rgb, 0.0), vec3(1.0/78.84375));"
+                                      "  highp vec3 lin = pow(max(p - 0.8359375, 0.0) / (18.8515625 - 18.6875 * p), vec3(1.0/0.1593017578125));"
+                                      "  return pow(clamp(lin * 49.26, 0.0, 1.0), vec3(1.0/2.2));"
+                                      "}"
+                                      // ARIB STD-B67 inverse OETF with a simple gamma re-encode for SDR display
+                                      "highp vec3 toneMapHlg(highp vec3 rgb) {"
+                                      "  highp vec3 v = max(rgb, 0.0);"
+                                      "  highp vec3 low = v * v / 3.0;"
+                                      "  highp vec3 high = (exp((v - 0.55991073) / 0.17883277) + 0.28466892) / 12.0;"
+                                      "  highp vec3 lin = mix(low, high, step(0.5, v));"
+                                      "  return pow(clamp(lin, 0.0, 1.0), vec3(1.0/2.2));"
+                                      "}"
                                       "void main(void) {"
-                                      "  mediump vec3 texel;"
-                                      "  texel.r = texture2D(Ytex, coordinates).r -  16.0/255.0;" // Y
-                                      "  texel.g = texture2D(Utex, coordinates).r - 128.0/255.0;" // U
-                                      "  texel.b = texture2D(Vtex, coordinates).r - 128.0/255.0;" // V
-                                      "  mediump mat3 coefficients;"
-                                      "  if (colorspace == 601) {"
-                                      "    coefficients = mat3("
-                                      "      1.1643,  1.1643,  1.1643," // column 1
-                                      "      0.0,    -0.39173, 2.017,"  // column 2
-                                      "      1.5958, -0.8129,  0.0);"   // column 3
-                                      "  } else {"                      // ITU-R 709
-                                      "    coefficients = mat3("
-                                      "      1.1643, 1.1643, 1.1643," // column 1
-                                      "      0.0,   -0.213,  2.112,"  // column 2
-                                      "      1.793, -0.533,  0.0);"   // column 3
+                                      "  highp vec3 texel;"
+                                      "  texel.r = texture2D(Ytex, coordinates).r * texelScale - yOffset;" // Y
+                                      "  texel.g = texture2D(Utex, coordinates).r * texelScale - cOffset;" // U
+                                      "  texel.b = texture2D(Vtex, coordinates).r * texelScale - cOffset;" // V
+                                      "  highp vec3 rgb = coefficients * texel;"
+                                      "  if (transferFunc == 16) {"
+                                      "    rgb = toneMapPq(rgb);"
+                                      "  } else if (transferFunc == 18) {"
+                                      "    rgb = toneMapHlg(rgb);"
                                       "  }"
-                                      "  gl_FragColor = vec4(coefficients * texel, 1.0);"
+                                      "  gl_FragColor = vec4(rgb, 1.0);"
                                       "}");
     m_shader->link();
     m_textureLocation[0] = m_shader->uniformLocation("Ytex");
     m_textureLocation[1] = m_shader->uniformLocation("Utex");
     m_textureLocation[2] = m_shader->uniformLocation("Vtex");
-    m_colorspaceLocation = m_shader->uniformLocation("colorspace");
+    m_coefficientsLocation = m_shader->uniformLocation("coefficients");
+    m_texelScaleLocation = m_shader->uniformLocation("texelScale");
+    m_yOffsetLocation = m_shader->uniformLocation("yOffset");
+    m_cOffsetLocation = m_shader->uniformLocation("cOffset");
+    m_transferLocation = m_shader->uniformLocation("transferFunc");
     m_projectionLocation = m_shader->uniformLocation("projection");
     m_modelViewLocation = m_shader->uniformLocation("modelView");
     m_vertexLocation = m_shader->attributeLocation("vertex");
     m_texCoordLocation = m_shader->attributeLocation("texCoord");
 }
 
-static void uploadTextures(QOpenGLContext *context, const SharedFrame &frame, GLuint texture[])
+void OpenGLVideoWidget::uploadTextures(QOpenGLContext *context, const SharedFrame &frame, GLuint texture[], QSize &textureSize, bool &textureIs10Bit)
 {
     int width = frame.get_image_width();
     int height = frame.get_image_height();
-    const uint8_t *image = frame.get_image(mlt_image_yuv420p);
+    // Keep 10 bit frames at their native depth so the conversion stays on the GPU.
+    // OpenGL ES 2 has no 16 bit luminance textures, fall back to the 8 bit path there
+    const bool tenBit = frame.get_image_format() == mlt_image_yuv420p10 && !context->isOpenGLES();
+    const uint8_t *image = frame.get_image(tenBit ? mlt_image_yuv420p10 : mlt_image_yuv420p);
+    const int bpp = tenBit ? 2 : 1;
+    const GLint internalFormat = tenBit ? GL_LUMINANCE16 : GL_LUMINANCE;
+    const GLenum pixelType = tenBit ? GL_UNSIGNED_SHORT : GL_UNSIGNED_BYTE;
     QOpenGLFunctions *f = context->functions();
+    const QSize frameSize(width, height);
+    // Plane sizes of the three YUV 4:2:0 textures
+    const QSize planes[] = {frameSize, frameSize / 2, frameSize / 2};
+    // Plane offsets in the packed image data
+    const uint8_t *data[] = {image, image + bpp * width * height, image + bpp * (width * height + width / 2 * height / 2)};
 
     // The planes of pixel data may not be a multiple of the default 4 bytes.
     f->glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-    // Upload each plane of YUV to a texture.
-    if (texture[0]) f->glDeleteTextures(3, texture);
-    check_error(f);
-    f->glGenTextures(3, texture);
-    check_error(f);
-
-    f->glBindTexture(GL_TEXTURE_2D, texture[0]);
-    check_error(f);
-    f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    check_error(f);
-    f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    check_error(f);
-    f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    check_error(f);
-    f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    check_error(f);
-    f->glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, width, height, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, image);
-    check_error(f);
-
-    f->glBindTexture(GL_TEXTURE_2D, texture[1]);
-    check_error(f);
-    f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    check_error(f);
-    f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    check_error(f);
-    f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    check_error(f);
-    f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    check_error(f);
-    f->glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, width / 2, height / 2, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, image + width * height);
-    check_error(f);
-
-    f->glBindTexture(GL_TEXTURE_2D, texture[2]);
-    check_error(f);
-    f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    check_error(f);
-    f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    check_error(f);
-    f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    check_error(f);
-    f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    check_error(f);
-    f->glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, width / 2, height / 2, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, image + width * height + width / 2 * height / 2);
-    check_error(f);
+    if (textureSize != frameSize || textureIs10Bit != tenBit) {
+        // Frame format changed (or first frame), (re)allocate the textures
+        if (texture[0]) f->glDeleteTextures(3, texture);
+        check_error(f);
+        f->glGenTextures(3, texture);
+        check_error(f);
+        for (int i = 0; i < 3; ++i) {
+            f->glBindTexture(GL_TEXTURE_2D, texture[i]);
+            check_error(f);
+            f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            check_error(f);
+            f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            check_error(f);
+            f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            check_error(f);
+            f->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            check_error(f);
+            f->glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, planes[i].width(), planes[i].height(), 0, GL_LUMINANCE, pixelType, data[i]);
+            check_error(f);
+        }
+        textureSize = frameSize;
+        textureIs10Bit = tenBit;
+    } else {
+        // Same format as the previous frame, update the existing textures in place.
+        // This avoids a texture allocation per plane on every frame, which is
+        // where most of the upload CPU time went
+        for (int i = 0; i < 3; ++i) {
+            f->glBindTexture(GL_TEXTURE_2D, texture[i]);
+            check_error(f);
+            f->glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, planes[i].width(), planes[i].height(), GL_LUMINANCE, pixelType, data[i]);
+            check_error(f);
+        }
+    }
     // Restore the default pixel alignement .
     f->glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 }
@@ -197,6 +222,7 @@ void OpenGLVideoWidget::renderVideo()
 #ifndef QT_NO_DEBUG
     QOpenGLFunctions *f = context->functions();
 #endif
+    qint64 displayStart = FrameTrace::isActive() ? FrameTrace::now() : 0;
     float width = this->width() * devicePixelRatioF();
     float height = this->height() * devicePixelRatioF();
 
@@ -212,7 +238,11 @@ void OpenGLVideoWidget::renderVideo()
             m_mutex.unlock();
             return;
         }
-        uploadTextures(context, m_sharedFrame, m_displayTexture);
+        qint64 uploadStart = displayStart > 0 ? FrameTrace::now() : 0;
+        uploadTextures(context, m_sharedFrame, m_displayTexture, m_displayTextureSize, m_displayTextureIs10Bit);
+        if (uploadStart > 0) {
+            FrameTrace::record(FrameTrace::Upload, m_sharedFrame.get_position(), uploadStart);
+        }
         m_mutex.unlock();
     }
 
@@ -234,7 +264,28 @@ void OpenGLVideoWidget::renderVideo()
     m_shader->setUniformValue(m_textureLocation[0], 0);
     m_shader->setUniformValue(m_textureLocation[1], 1);
     m_shader->setUniformValue(m_textureLocation[2], 2);
-    m_shader->setUniformValue(m_colorspaceLocation, pCore->getCurrentProfile()->colorspace());
+    {
+        int colorspace = pCore->getCurrentProfile()->colorspace();
+        int transfer = VideoColorParams::TransferSdr;
+        bool fullRange = false;
+        if (m_sharedFrame.is_valid()) {
+            if (m_sharedFrame.get_int("colorspace") > 0) {
+                colorspace = m_sharedFrame.get_int("colorspace");
+            }
+            transfer = m_sharedFrame.get_int("color_trc");
+            fullRange = m_sharedFrame.get_int("full_range") != 0;
+        }
+        const VideoColorParams::FrameColorConstants constants =
+            VideoColorParams::frameColorConstants(colorspace, transfer, m_displayTextureIs10Bit ? 10 : 8, fullRange);
+        const float rowMajor[9] = {constants.coefficients[0][0], constants.coefficients[0][1], constants.coefficients[0][2],
+                                   constants.coefficients[1][0], constants.coefficients[1][1], constants.coefficients[1][2],
+                                   constants.coefficients[2][0], constants.coefficients[2][1], constants.coefficients[2][2]};
+        m_shader->setUniformValue(m_coefficientsLocation, QMatrix3x3(rowMajor));
+        m_shader->setUniformValue(m_texelScaleLocation, constants.texelScale);
+        m_shader->setUniformValue(m_yOffsetLocation, constants.yOffset);
+        m_shader->setUniformValue(m_cOffsetLocation, constants.cOffset);
+        m_shader->setUniformValue(m_transferLocation, constants.transfer);
+    }
     check_error(f);
 
     // Setup an orthographic projection.
@@ -322,6 +373,9 @@ void OpenGLVideoWidget::renderVideo()
     check_error(f);
 
     quickWindow()->endExternalCommands();
+    if (displayStart > 0) {
+        FrameTrace::record(FrameTrace::Display, m_sharedFrame.is_valid() ? m_sharedFrame.get_position() : -1, displayStart);
+    }
     VideoWidget::renderVideo();
 }
 
@@ -339,7 +393,11 @@ void OpenGLVideoWidget::onFrameDisplayed(const SharedFrame &frame)
         // Using threaded OpenGL to upload textures.
         QOpenGLFunctions *f = m_context->functions();
         m_context->makeCurrent(&m_offscreenSurface);
-        uploadTextures(m_context.get(), frame, m_renderTexture);
+        qint64 uploadStart = FrameTrace::isActive() ? FrameTrace::now() : 0;
+        uploadTextures(m_context.get(), frame, m_renderTexture, m_renderTextureSize, m_renderTextureIs10Bit);
+        if (uploadStart > 0) {
+            FrameTrace::record(FrameTrace::Upload, frame.get_position(), uploadStart);
+        }
         f->glBindTexture(GL_TEXTURE_2D, 0);
         check_error(f);
         f->glFinish();
@@ -348,6 +406,7 @@ void OpenGLVideoWidget::onFrameDisplayed(const SharedFrame &frame)
         m_mutex.lock();
         for (int i = 0; i < 3; ++i)
             std::swap(m_renderTexture[i], m_displayTexture[i]);
+        std::swap(m_renderTextureSize, m_displayTextureSize);
         m_mutex.unlock();
     }
     VideoWidget::onFrameDisplayed(frame);
@@ -36,12 +36,26 @@ private:
     GLint m_modelViewLocation;
     GLint m_vertexLocation;
     GLint m_texCoordLocation;
-    GLint m_colorspaceLocation;
+    GLint m_coefficientsLocation;
+    GLint m_texelScaleLocation;
+    GLint m_yOffsetLocation;
+    GLint m_cOffsetLocation;
+    GLint m_transferLocation;
     GLint m_textureLocation[3];
     QOpenGLContext *m_quickContext;
     std::unique_ptr<QOpenGLContext> m_context;
     QOpenGLFramebufferObject *m_fbo{nullptr};
     GLuint m_renderTexture[3];
     GLuint m_displayTexture[3];
+    /** @brief Frame size the texture sets were allocated for, so the planes can be
+     *  updated in place instead of reallocated on every frame. */
+    QSize m_renderTextureSize;
+    QSize m_displayTextureSize;
+    /** @brief Whether the texture sets hold 16 bit planes (10 bit frames) */
+    bool m_renderTextureIs10Bit{false};
+    bool m_displayTextureIs10Bit{false};
     bool m_isThreadedOpenGL;
+
+    /** @brief Upload the frame planes, reusing the textures when the frame format is unchanged. */
+    void uploadTextures(QOpenGLContext *context, const SharedFrame &frame, GLuint texture[], QSize &textureSize, bool &textureIs10Bit);
 };
@@ -8,8 +8,11 @@
 #include "qmlmanager.h"
 #include "kdenlivesettings.h"
 
+#include <QDebug>
 #include <QFontDatabase>
+#include <QQmlComponent>
 #include <QQmlContext>
+#include <QQmlEngine>
 #include <QQuickItem>
 #include <QQuickWidget>
 
@@ -20,6 +23,16 @@ QmlManager::QmlManager(QQuickWidget *view)
 {
 }
 
+QmlManager::~QmlManager()
+{
+    // The view only owns the currently displayed scene, delete the cached ones ourselves
+    for (auto it = m_sceneCache.constBegin(); it != m_sceneCache.constEnd(); ++it) {
+        if (it.key() != m_sceneType) {
+            delete it.value().item;
+        }
+    }
+}
+
 MonitorSceneType QmlManager::sceneType() const
 {
     return m_sceneType;
@@ -35,21 +48,76 @@ void QmlManager::blockSceneChange(bool block)
     m_sceneChangeBlocked = block;
 }
 
+QQuickItem *QmlManager::loadScene(Kdenlive::MonitorId id, MonitorSceneType type)
+{
+    QUrl url;
+    switch (type) {
+    case MonitorSceneGeometry:
+        url = QUrl(QStringLiteral("qrc:/qml/kdenlivemonitoreffectscene.qml"));
+        break;
+    case MonitorSceneCorners:
+        url = QUrl(QStringLiteral("qrc:/qml/kdenlivemonitorcornerscene.qml"));
+        break;
+    case MonitorSceneRoto:
+        url = QUrl(QStringLiteral("qrc:/qml/kdenlivemonitorrotoscene.qml"));
+        break;
+    case MonitorSplitTrack:
+        url = QUrl(QStringLiteral("qrc:/qml/kdenlivemonitorsplittracks.qml"));
+        break;
+    case MonitorSceneSplit:
+        url = QUrl(QStringLiteral("qrc:/qml/kdenlivemonitorsplit.qml"));
+        break;
+    case MonitorSceneTrimming:
+        url = QUrl(QStringLiteral("qrc:/qml/kdenlivemonitortrimming.qml"));
+        break;
+    default:
+        url = QUrl(id == Kdenlive::ClipMonitor ? QStringLiteral("qrc:/qml/kdenliveclipmonitor.qml") : QStringLiteral("qrc:/qml/kdenlivemonitor.qml"));
+        break;
+    }
+    QQuickItem *previous = m_view->rootObject();
+    auto it = m_sceneCache.constFind(type);
+    if (it != m_sceneCache.constEnd()) {
+        // Re-parameterize the cached scene instead of re-instantiating it
+        if (previous && previous != it->item) {
+            previous->setVisible(false);
+        }
+        m_view->setContent(url, it->component, it->item);
+        it->item->setVisible(true);
+        return it->item;
+    }
+    auto *component = new QQmlComponent(m_view->engine(), url, QQmlComponent::PreferSynchronous, this);
+    QObject *obj = component->create(m_view->rootContext());
+    auto *item = qobject_cast<QQuickItem *>(obj);
+    if (!item) {
+        qWarning() << "Failed to create monitor scene" << url << component->errorString();
+        delete obj;
+        delete component;
+        return nullptr;
+    }
+    if (previous) {
+        previous->setVisible(false);
+    }
+    m_view->setContent(url, component, item);
+    m_sceneCache.insert(type, {component, item});
+    return item;
+}
+
 void QmlManager::setScene(Kdenlive::MonitorId id, MonitorSceneType type, QSize profile, double profileStretch, QRect displayRect, double zoom, int duration)
 {
     if (type == m_sceneType || m_sceneChangeBlocked) {
         // Scene type already active
         return;
     }
-    m_sceneType = type;
-    QQuickItem *root = nullptr;
     m_view->rootContext()->setContextProperty("fixedFont", QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    QQuickItem *root = loadScene(id, type);
+    if (!root) {
+        return;
+    }
+    m_sceneType = type;
     double scalex = double(displayRect.width()) / profile.width() * zoom;
     double scaley = double(displayRect.height()) / profile.height() * zoom;
     switch (type) {
     case MonitorSceneGeometry:
-        m_view->setSource(QUrl(QStringLiteral("qrc:/qml/kdenlivemonitoreffectscene.qml")));
-        root = m_view->rootObject();
         QObject::connect(root, SIGNAL(effectChanged()), this, SLOT(effectRectChanged()), Qt::UniqueConnection);
         QObject::connect(root, SIGNAL(centersChanged()), this, SLOT(effectPolygonChanged()), Qt::UniqueConnection);
         root->setProperty("profile", QPoint(profile.width(), profile.height()));
@@ -59,8 +127,6 @@ void QmlManager::setScene(Kdenlive::MonitorId id, MonitorSceneType type, QSize p
         root->setProperty("center", displayRect.center());
         break;
     case MonitorSceneCorners:
-        m_view->setSource(QUrl(QStringLiteral("qrc:/qml/kdenlivemonitorcornerscene.qml")));
-        root = m_view->rootObject();
         QObject::connect(root, SIGNAL(effectPolygonChanged()), this, SLOT(effectPolygonChanged()), Qt::UniqueConnection);
         root->setProperty("profile", QPoint(profile.width(), profile.height()));
         root->setProperty("framesize", QRect(0, 0, profile.width(), profile.height()));
@@ -70,8 +136,6 @@ void QmlManager::setScene(Kdenlive::MonitorId id, MonitorSceneType type, QSize p
         root->setProperty("center", displayRect.center());
         break;
     case MonitorSceneRoto:
-        m_view->setSource(QUrl(QStringLiteral("qrc:/qml/kdenlivemonitorrotoscene.qml")));
-        root = m_view->rootObject();
         QObject::connect(root, SIGNAL(effectPolygonChanged(QVariant, QVariant)), this, SLOT(effectRotoChanged(QVariant, QVariant)), Qt::UniqueConnection);
         root->setProperty("profile", QPoint(profile.width(), profile.height()));
         root->setProperty("framesize", QRect(0, 0, profile.width(), profile.height()));
@@ -81,8 +145,6 @@ void QmlManager::setScene(Kdenlive::MonitorId id, MonitorSceneType type, QSize p
         root->setProperty("center", displayRect.center());
         break;
     case MonitorSplitTrack:
-        m_view->setSource(QUrl(QStringLiteral("qrc:/qml/kdenlivemonitorsplittracks.qml")));
-        root = m_view->rootObject();
         QObject::connect(root, SIGNAL(activateTrack(int)), this, SIGNAL(activateTrack(int)), Qt::UniqueConnection);
         root->setProperty("profile", QPoint(profile.width(), profile.height()));
         root->setProperty("framesize", QRect(0, 0, profile.width(), profile.height()));
@@ -92,21 +154,14 @@ void QmlManager::setScene(Kdenlive::MonitorId id, MonitorSceneType type, QSize p
         root->setProperty("center", displayRect.center());
         break;
     case MonitorSceneSplit:
-        m_view->setSource(QUrl(QStringLiteral("qrc:/qml/kdenlivemonitorsplit.qml")));
-        root = m_view->rootObject();
         root->setProperty("profile", QPoint(profile.width(), profile.height()));
         root->setProperty("scalex", scalex);
         root->setProperty("scaley", scaley);
         root->setProperty("center", displayRect.center());
         break;
     case MonitorSceneTrimming:
-        m_view->setSource(QUrl(QStringLiteral("qrc:/qml/kdenlivemonitortrimming.qml")));
-        root = m_view->rootObject();
         break;
     default:
-        m_view->setSource(
-            QUrl(id == Kdenlive::ClipMonitor ? QStringLiteral("qrc:/qml/kdenliveclipmonitor.qml") : QStringLiteral("qrc:/qml/kdenlivemonitor.qml")));
-        root = m_view->rootObject();
         root->setProperty("profile", QPoint(profile.width(), profile.height()));
         root->setProperty("scalex", scalex);
         root->setProperty("scaley", scaley);
@@ -117,7 +172,7 @@ void QmlManager::setScene(Kdenlive::MonitorId id, MonitorSceneType type, QSize p
         }
         break;
     }
-    if (root && duration > 0) {
+    if (duration > 0) {
         root->setProperty("duration", duration);
     }
 }
@@ -9,6 +9,10 @@
 
 #include "definitions.h"
 
+#include <QMap>
+
+class QQmlComponent;
+class QQuickItem;
 class QQuickWidget;
 
 /** @class QmlManager
@@ -21,6 +25,7 @@ class QmlManager : public QObject
 
 public:
     explicit QmlManager(QQuickWidget *view);
+    ~QmlManager() override;
 
     /** @brief return current active scene type */
     MonitorSceneType sceneType() const;
@@ -30,9 +35,22 @@ public:
     void setScene(Kdenlive::MonitorId id, MonitorSceneType type, QSize profile, double profileStretch, QRect displayRect, double zoom, int duration);
 
 private:
+    struct SceneData
+    {
+        QQmlComponent *component;
+        QQuickItem *item;
+    };
+
     QQuickWidget *m_view;
     MonitorSceneType m_sceneType;
     bool m_sceneChangeBlocked{false};
+    /** @brief Scene instances are kept alive per type and re-parameterized when switching back,
+     *  instead of being torn down and reloaded on every scene change */
+    QMap<int, SceneData> m_sceneCache;
+
+    /** @brief Load the QML scene for the given type, reusing a cached instance when available.
+     *  Returns the scene's root item, or nullptr if the scene could not be created */
+    QQuickItem *loadScene(Kdenlive::MonitorId id, MonitorSceneType type);
 
 public Q_SLOTS:
     void blockSceneChange(bool block);
@@ -333,23 +333,25 @@ void AudioGraphSpectrum::refreshPixmap()
 
 void AudioGraphSpectrum::refreshScope(const QSize & /*size*/, bool /*full*/)
 {
-    SharedFrame sFrame;
-    while (m_queue.count() > 0) {
-        sFrame = m_queue.pop();
-        if (sFrame.is_valid() && sFrame.get_audio_samples() > 0) {
-            mlt_audio_format format = mlt_audio_s16;
-            int channels = sFrame.get_audio_channels();
-            int frequency = sFrame.get_audio_frequency();
-            int samples = sFrame.get_audio_samples();
-            Mlt::Frame mFrame = sFrame.clone(true, false, false);
-            m_filter->process(mFrame);
-            mFrame.get_audio(format, frequency, channels, samples);
-            if (samples == 0 || format == 0) {
-                // There was an error processing audio from frame
-                continue;
-            }
-            processSpectrum();
+    if (m_queue.count() == 0) {
+        return;
+    }
+    // Only analyze the most recent frame: the FFT and the audio clone it requires are
+    // per-frame costs, and spectra of stale frames are never displayed
+    SharedFrame sFrame = m_queue.popLatest();
+    if (sFrame.is_valid() && sFrame.get_audio_samples() > 0) {
+        mlt_audio_format format = mlt_audio_s16;
+        int channels = sFrame.get_audio_channels();
+        int frequency = sFrame.get_audio_frequency();
+        int samples = sFrame.get_audio_samples();
+        Mlt::Frame mFrame = sFrame.clone(true, false, false);
+        m_filter->process(mFrame);
+        mFrame.get_audio(format, frequency, channels, samples);
+        if (samples == 0 || format == 0) {
+            // There was an error processing audio from frame
+            return;
         }
+        processSpectrum();
     }
 }
 
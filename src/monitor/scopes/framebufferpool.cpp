@@ -0,0 +1,83 @@
+/*
+    SPDX-FileCopyrightText: 2026 Jean-Baptiste Mardelle <jb@kdenlive.org>
+    SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "framebufferpool.h"
+
+#include <QMultiHash>
+#include <QMutex>
+#include <cstring>
+
+namespace {
+struct PooledBuffer
+{
+    uchar *data;
+    qsizetype size;
+};
+
+QMutex poolMutex;
+/** Free buffers bucketed by their byte size */
+QMultiHash<qsizetype, PooledBuffer *> freeBuffers;
+qsizetype pooledBytes = 0;
+/** Retention cap; a few frames at UHD resolution. Buffers returned while the pool is full
+ *  are simply freed, so a one-off extraction at an unusual size does not pin memory */
+constexpr qsizetype maxPooledBytes = 64 * 1024 * 1024;
+
+void recycleBuffer(void *info)
+{
+    auto *buffer = static_cast<PooledBuffer *>(info);
+    QMutexLocker lock(&poolMutex);
+    if (pooledBytes + buffer->size > maxPooledBytes) {
+        lock.unlock();
+        delete[] buffer->data;
+        delete buffer;
+        return;
+    }
+    pooledBytes += buffer->size;
+    freeBuffers.insert(buffer->size, buffer);
+}
+} // namespace
+
+// static
+QImage FrameBufferPool::acquire(int width, int height, QImage::Format format)
+{
+    if (width <= 0 || height <= 0) {
+        return QImage();
+    }
+    // Same scanline alignment as QImage's own allocation
+    const qsizetype bytesPerLine = ((qsizetype(width) * QImage::toPixelFormat(format).bitsPerPixel() + 31) / 32) * 4;
+    const qsizetype size = bytesPerLine * height;
+    PooledBuffer *buffer = nullptr;
+    {
+        QMutexLocker lock(&poolMutex);
+        auto it = freeBuffers.find(size);
+        if (it != freeBuffers.end()) {
+            buffer = it.value();
+            freeBuffers.erase(it);
+            pooledBytes -= size;
+        }
+    }
+    if (buffer == nullptr) {
+        buffer = new PooledBuffer{new uchar[size_t(size)], size};
+    }
+    return QImage(buffer->data, width, height, bytesPerLine, format, recycleBuffer, buffer);
+}
+
+// static
+QImage FrameBufferPool::copy(const QImage &source)
+{
+    if (source.isNull()) {
+        return QImage();
+    }
+    QImage dest = acquire(source.width(), source.height(), source.format());
+    if (dest.bytesPerLine() == source.bytesPerLine()) {
+        std::memcpy(dest.bits(), source.constBits(), size_t(source.sizeInBytes()));
+    } else {
+        const qsizetype lineBytes = qMin(dest.bytesPerLine(), source.bytesPerLine());
+        for (int y = 0; y < source.height(); ++y) {
+            std::memcpy(dest.scanLine(y), source.constScanLine(y), size_t(lineBytes));
+        }
+    }
+    return dest;
+}
@@ -0,0 +1,30 @@
+/*
+    SPDX-FileCopyrightText: 2026 Jean-Baptiste Mardelle <jb@kdenlive.org>
+    SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#pragma once
+
+#include <QImage>
+
+/**
+  @class FrameBufferPool
+  @brief Recycles frame sized image buffers for the monitor frame path.
+
+  threadsafe
+
+  Each displayed frame that is handed to the analysis scopes needs a full frame sized
+  buffer; allocating and freeing those on every frame shows up as periodic pacing hiccups
+  during playback. The pool buckets free buffers by their byte size and backs the returned
+  QImage with a recycled buffer whose cleanup handler puts the memory back in the pool once
+  the last copy of the image is gone, so steady state playback at a fixed frame size
+  performs no frame sized allocation at all.
+*/
+class FrameBufferPool
+{
+public:
+    /** @brief Returns an uninitialized image backed by a pooled buffer */
+    static QImage acquire(int width, int height, QImage::Format format);
+    /** @brief Returns a deep copy of @param source backed by a pooled buffer */
+    static QImage copy(const QImage &source);
+};
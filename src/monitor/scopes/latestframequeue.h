@@ -0,0 +1,77 @@
+/*
+    SPDX-FileCopyrightText: 2026 Jean-Baptiste Mardelle <jb@kdenlive.org>
+
+    SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#pragma once
+
+#include <atomic>
+
+/*!
+  \class LatestFrameQueue
+  \brief The LatestFrameQueue passes the most recent item from a producer
+  thread to a consumer thread without locking.
+
+  threadsafe
+
+  LatestFrameQueue is a wait-free single-producer/single-consumer exchange
+  built on three buffer slots: at any time one slot is owned by the producer,
+  one holds the latest published item and one is owned by the consumer.
+  push() and popLatest() swap slot ownership with a single atomic exchange,
+  so the producer never blocks on a slow consumer and older items are
+  implicitly dropped, which matches how the monitor scopes consume frames.
+
+  The interface is a drop-in subset of DataQueue in drop-oldest mode for
+  consumers that only analyze the latest item: count() tells whether an item
+  has been pushed since the last popLatest(), and popLatest() returns the
+  most recent item (or the previous one again if nothing new arrived, so
+  check count() first).
+*/
+
+template <class T> class LatestFrameQueue
+{
+public:
+    LatestFrameQueue() = default;
+
+    /*!
+      Pushes an item into the queue, replacing any unconsumed one.
+
+      Wait-free; must only be called from one producer thread.
+    */
+    void push(const T &item)
+    {
+        m_slots[m_writeSlot] = item;
+        const int previous = m_latest.exchange(m_writeSlot | FreshFlag, std::memory_order_acq_rel);
+        m_writeSlot = previous & SlotMask;
+    }
+
+    /*!
+      Pops the most recent item from the queue, discarding all older items.
+
+      Wait-free; must only be called from one consumer thread. If no new item
+      was pushed since the last call, the previously returned item is handed
+      out again, so callers should check count() first.
+    */
+    T popLatest()
+    {
+        const int latest = m_latest.exchange(m_readSlot, std::memory_order_acq_rel);
+        m_readSlot = latest & SlotMask;
+        return m_slots[m_readSlot];
+    }
+
+    //! Returns 1 if an item was pushed since the last popLatest(), else 0.
+    int count() const { return (m_latest.load(std::memory_order_acquire) & FreshFlag) != 0 ? 1 : 0; }
+
+private:
+    enum { SlotMask = 3, FreshFlag = 4 };
+
+    T m_slots[3];
+    // Index of the slot holding the latest published item, with FreshFlag set
+    // when it has not been consumed yet.
+    std::atomic<int> m_latest{1};
+    // Slot owned by the producer thread, written outside of any lock.
+    int m_writeSlot{0};
+    // Slot owned by the consumer thread, read outside of any lock.
+    int m_readSlot{2};
+};
@@ -12,11 +12,13 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 
 #include "mlt++/Mlt.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include <QFont>
 #include <QPaintEvent>
 #include <QPainter>
+#include <QVarLengthArray>
 
 MonitorAudioLevel::MonitorAudioLevel(int height, QWidget *parent)
     : ScopeWidget(parent)
@@ -28,6 +30,7 @@ MonitorAudioLevel::MonitorAudioLevel(int height, QWidget *parent)
 {
     setSizePolicy(QSizePolicy::MinimumExpanding, QSizePolicy::Preferred);
     isValid = true;
+    m_decayTimer.start();
     connect(this, &MonitorAudioLevel::audioLevelsAvailable, this, &MonitorAudioLevel::setAudioValues);
 }
 
@@ -35,35 +38,46 @@ MonitorAudioLevel::~MonitorAudioLevel() = default;
 
 void MonitorAudioLevel::refreshScope(const QSize & /*size*/, bool /*full*/)
 {
-    SharedFrame sFrame;
-    while (m_queue.count() > 0) {
-        sFrame = m_queue.pop();
-        if (sFrame.is_valid()) {
-            int samples = sFrame.get_audio_samples();
-            if (samples <= 0) {
-                continue;
-            }
-            // TODO: the 200 value is aligned with the MLT audiolevel filter, but seems arbitrary.
-            samples = qMin(200, samples);
-            int channels = sFrame.get_audio_channels();
-            QVector<double> levels;
-            const int16_t *audio = sFrame.get_audio();
-            for (int c = 0; c < channels; c++) {
-                int16_t peak = 0;
-                const int16_t *p = audio + c;
-                for (int s = 0; s < samples; s++) {
-                    int16_t sample = abs(*p);
-                    if (sample > peak) peak = sample;
-                    p += channels;
-                }
-                if (peak == 0) {
-                    levels << -100;
-                } else {
-                    levels << 20 * log10((double)peak / (double)std::numeric_limits<int16_t>::max());
+    if (m_queue.count() == 0) {
+        return;
+    }
+    // The meter only shows the current level, so analyze the most recent frame and
+    // drop stale ones instead of scanning and emitting once per queued frame
+    SharedFrame sFrame = m_queue.popLatest();
+    if (sFrame.is_valid()) {
+        int samples = sFrame.get_audio_samples();
+        if (samples <= 0) {
+            return;
+        }
+        // TODO: the 200 value is aligned with the MLT audiolevel filter, but seems arbitrary.
+        samples = qMin(200, samples);
+        int channels = sFrame.get_audio_channels();
+        const int16_t *audio = sFrame.get_audio();
+        // Scan the interleaved buffer in a single linear pass, updating all
+        // channel peaks as we go. The previous per-channel strided loops walked
+        // the same memory once per channel, which adds up with many channels;
+        // the linear pass also lets the compiler unroll the inner maximum.
+        QVarLengthArray<int16_t, 16> peaks(channels);
+        std::fill(peaks.begin(), peaks.end(), int16_t(0));
+        const int total = samples * channels;
+        for (int s = 0; s < total; s += channels) {
+            for (int c = 0; c < channels; ++c) {
+                const int16_t sample = int16_t(abs(audio[s + c]));
+                if (sample > peaks[c]) {
+                    peaks[c] = sample;
                 }
             }
-            Q_EMIT audioLevelsAvailable(levels);
         }
+        QVector<double> levels;
+        levels.reserve(channels);
+        for (int c = 0; c < channels; ++c) {
+            if (peaks[c] == 0) {
+                levels << -100;
+            } else {
+                levels << IEC_LinearToDB((double)peaks[c] / (double)std::numeric_limits<int16_t>::max());
+            }
+        }
+        Q_EMIT audioLevelsAvailable(levels);
     }
 }
 
@@ -165,8 +179,12 @@ void MonitorAudioLevel::setAudioValues(const QVector<double> &values)
         m_peaks = values;
         drawBackground(values.size());
     } else {
+        // IEC 60268-10 style fallback: the peak hold decays at a constant rate
+        // of 20 dB per 1.7 s. Scaling by the elapsed time keeps the ballistics
+        // independent of the frame delivery rate.
+        const double decay = 20. / 1700. * double(qMin(m_decayTimer.restart(), qint64(200)));
         for (int i = 0; i < m_values.size(); i++) {
-            m_peaks[i] -= 0.2;
+            m_peaks[i] -= decay;
             if (m_values.at(i) > m_peaks.at(i)) {
                 m_peaks[i] = m_values.at(i);
             }
@@ -8,6 +8,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #pragma once
 
 #include "scopewidget.h"
+#include <QElapsedTimer>
 #include <QWidget>
 #include <memory>
 
@@ -30,6 +31,8 @@ private:
     int m_height;
     QPixmap m_pixmap;
     QVector<double> m_peaks;
+    /** Measures the time between level updates for the peak-hold decay. */
+    QElapsedTimer m_decayTimer;
     int m_maxDb;
     QVector<double> m_values;
     int m_channelHeight;
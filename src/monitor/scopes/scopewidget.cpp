@@ -12,7 +12,7 @@
 
 ScopeWidget::ScopeWidget(QWidget *parent)
     : QWidget(parent)
-    , m_queue(3, DataQueue<SharedFrame>::OverflowModeDiscardOldest)
+    , m_queue()
     , m_future()
     , m_mutex()
     , m_size(0, 0)
@@ -7,7 +7,7 @@
 
 #pragma once
 
-#include "dataqueue.h"
+#include "latestframequeue.h"
 #include "sharedframe.h"
 #include <QFuture>
 #include <QMutex>
@@ -25,8 +25,9 @@
   is the ability to trigger the "heavy lifting" to be done in a worker thread.
 
   Frames are received by the onNewFrame() slot. The ScopeWidget automatically
-  places new frames in the DataQueue (m_queue). Subclasses shall implement the
-  refreshScope() function and can check for new frames in m_queue.
+  places new frames in the LatestFrameQueue (m_queue). Subclasses shall
+  implement the refreshScope() function and can check for new frames in
+  m_queue.
 
   refreshScope() is run from a separate thread. Therefore, any members that are
   accessed by both the worker thread (refreshScope) and the GUI thread
@@ -96,7 +97,7 @@ protected:
       Subclasses should check this queue for new frames in the refreshScope()
       implementation.
     */
-    DataQueue<SharedFrame> m_queue;
+    LatestFrameQueue<SharedFrame> m_queue;
 
     void resizeEvent(QResizeEvent *) override;
     void changeEvent(QEvent *) override;
@@ -0,0 +1,71 @@
+/*
+    SPDX-FileCopyrightText: 2023 Meltytech, LLC
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#include "videocolorparams.h"
+
+namespace VideoColorParams {
+
+FrameColorConstants frameColorConstants(int colorspace, int transfer, int bitDepth, bool fullRange)
+{
+    // Luma coefficients of the matrix standards
+    double kr;
+    double kb;
+    switch (colorspace) {
+    case 601:
+        kr = 0.299;
+        kb = 0.114;
+        break;
+    case 2020:
+        kr = 0.2627;
+        kb = 0.0593;
+        break;
+    default: // ITU-R 709
+        kr = 0.2126;
+        kb = 0.0722;
+        break;
+    }
+    const double kg = 1. - kr - kb;
+    const double maxCode = (1 << bitDepth) - 1;
+    const int shift = bitDepth - 8;
+    double yScale = 1.;
+    double cScale = 1.;
+    double yOffset = 0.;
+    if (!fullRange) {
+        // Limited range: luma spans 16-235 and chroma 16-240, shifted up for higher bit depths
+        yOffset = double(16 << shift) / maxCode;
+        yScale = maxCode / double(219 << shift);
+        cScale = maxCode / double(224 << shift);
+    }
+    // Row major: each row maps the offset (Y', Cb, Cr) triple to one of R, G, B
+    const double rows[3][3] = {
+        {yScale, 0., 2. * (1. - kr) * cScale},
+        {yScale, -2. * kb * (1. - kb) / kg * cScale, -2. * kr * (1. - kr) / kg * cScale},
+        {yScale, 2. * (1. - kb) * cScale, 0.},
+    };
+    FrameColorConstants c;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            c.coefficients[i][j] = float(rows[i][j]);
+        }
+        c.coefficients[i][3] = 0.f;
+    }
+    // Planes deeper than 8 bit are stored in 16 bit words, so a normalized sample
+    // must be rescaled from the 16 bit range to the real code value range
+    c.texelScale = bitDepth > 8 ? float(65535. / maxCode) : 1.f;
+    c.yOffset = float(yOffset);
+    c.cOffset = float((1 << (bitDepth - 1)) / maxCode);
+    switch (transfer) {
+    case TransferPq:
+    case TransferHlg:
+        c.transfer = transfer;
+        break;
+    default:
+        c.transfer = TransferSdr;
+        break;
+    }
+    return c;
+}
+
+} // namespace VideoColorParams
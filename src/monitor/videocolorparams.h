@@ -0,0 +1,47 @@
+/*
+    SPDX-FileCopyrightText: 2023 Meltytech, LLC
+    SPDX-License-Identifier: GPL-3.0-or-later
+*/
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * Shared YUV to RGB conversion parameters for the video display widgets.
+ *
+ * The OpenGL, Direct3D and Metal widgets all run the same conversion in their
+ * fragment shaders. Instead of hard coding one matrix per colorspace in three
+ * shading languages, the per-format math (coefficients, code value offsets,
+ * bit depth scale and transfer function) is computed here once and fed to a
+ * format agnostic shader, so 10 bit and HDR frames can be converted on the
+ * GPU instead of falling back to a CPU conversion.
+ */
+namespace VideoColorParams {
+
+/** ITU-T H.273 transfer characteristics handled by the display shaders */
+enum TransferFunction { TransferSdr = 0, TransferPq = 16, TransferHlg = 18 };
+
+/** @brief Conversion constants consumed by the fragment shaders.
+ *  The layout matches the Direct3D constant buffer and Metal uniform buffer:
+ *  matrix rows padded to vec4, scalars packed in the last 16 byte register. */
+struct FrameColorConstants
+{
+    /** Row major matrix mapping offset (Y', Cb, Cr) to (R, G, B) */
+    float coefficients[3][4];
+    /** Rescales normalized texture samples when planes are stored in 16 bit words */
+    float texelScale;
+    float yOffset;
+    float cOffset;
+    int32_t transfer;
+};
+
+/** @brief Compute the conversion constants for a frame format.
+ * @param colorspace 601, 709 or 2020 (anything else falls back to ITU-R 709)
+ * @param transfer ITU-T H.273 code as found in the frame "color_trc" property
+ * @param bitDepth 8 for yuv420p, 10 for yuv420p10 (stored in 16 bit words)
+ * @param fullRange true when the frame uses full range code values
+ */
+FrameColorConstants frameColorConstants(int colorspace, int transfer, int bitDepth, bool fullRange);
+
+} // namespace VideoColorParams
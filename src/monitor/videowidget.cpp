@@ -33,8 +33,10 @@
 
 #include "bin/model/markersortmodel.h"
 #include "core.h"
+#include "frametrace.h"
 #include "monitorproxy.h"
 #include "profiles/profilemodel.hpp"
+#include "scopes/framebufferpool.h"
 #include "timeline2/view/qml/timelineitems.h"
 #include "timeline2/view/qmltypes/thumbnailprovider.h"
 #include "videowidget.h"
@@ -114,6 +116,9 @@ VideoWidget::VideoWidget(int id, QObject *parent)
 
     m_refreshTimer.setSingleShot(true);
     m_refreshTimer.setInterval(10);
+    m_scrubTimer.setSingleShot(true);
+    m_scrubTimer.setInterval(150);
+    connect(&m_scrubTimer, &QTimer::timeout, this, &VideoWidget::endScrubScaling);
     m_blackClip.reset(new Mlt::Producer(pCore->getProjectProfile(), "color:0"));
     m_blackClip->set("mlt_image_format", "rgba");
     m_blackClip->set("kdenlive:id", "black");
@@ -152,6 +157,7 @@ void VideoWidget::initialize()
     m_frameRenderer = new FrameRenderer();
     connect(m_frameRenderer, &FrameRenderer::frameDisplayed, this, &VideoWidget::onFrameDisplayed, Qt::QueuedConnection);
     connect(m_frameRenderer, &FrameRenderer::frameDisplayed, this, &VideoWidget::frameDisplayed, Qt::QueuedConnection);
+    connect(m_frameRenderer, &FrameRenderer::frameDisplayed, this, &VideoWidget::cachePendingFrame, Qt::QueuedConnection);
     connect(m_frameRenderer, SIGNAL(imageReady()), SIGNAL(imageReady()));
     m_initSem.release();
     m_isInitialized = true;
@@ -177,7 +183,9 @@ QImage VideoWidget::image() const
             int width = frame.get_image_width();
             int height = frame.get_image_height();
             QImage temp(image, width, height, QImage::Format_RGBA8888);
-            return temp.copy();
+            // Pooled copy: the wrapped MLT image dies with the frame, and a plain copy()
+            // would allocate a frame sized buffer on every analyzed frame
+            return FrameBufferPool::copy(temp);
         }
     }
     return QImage();
@@ -303,6 +311,10 @@ void VideoWidget::requestSeek(int position, bool noAudioScrub)
     }
     if (!qFuzzyIsNull(m_producer->get_speed())) {
         m_consumer->purge();
+    } else if (KdenliveSettings::adaptiveScrubScaling() && KdenliveSettings::previewScaling() == 1) {
+        // Serve scrub frames at quarter resolution; the full resolution frame is only
+        // decoded once the playhead rests, keeping effect-heavy timelines scrubbable
+        beginScrubScaling();
     }
     restartConsumer();
     m_consumer->set("refresh", 1);
@@ -315,6 +327,16 @@ void VideoWidget::requestSeek(int position, bool noAudioScrub)
 
 void VideoWidget::requestRefresh(bool slowRefresh)
 {
+    if (m_pendingCacheKey.isEmpty()) {
+        // Refresh requested for another reason than an effect parameter change, cached comparison frames are stale
+        clearFrameCache();
+    }
+    if (!slowRefresh && rootObject() != nullptr && rootObject()->property("captureRightClick").toBool()) {
+        // A monitor overlay handle is being dragged. The scene graph keeps compositing the moving overlay
+        // over the last displayed frame, so throttle the expensive consumer pulls during the drag; the
+        // pending timer fires after the last commit and catches up with the final parameters
+        slowRefresh = true;
+    }
     if (m_refreshTimer.isActive()) {
         m_refreshTimer.start(slowRefresh ? 200 : 10);
     } else if (m_producer && qFuzzyIsNull(m_producer->get_speed())) {
@@ -338,6 +360,45 @@ void VideoWidget::refresh()
     }
 }
 
+void VideoWidget::beginInteractiveScaling()
+{
+    if (!m_consumer || !KdenliveSettings::adaptiveScrubScaling() || KdenliveSettings::previewScaling() != 1) {
+        return;
+    }
+    if (m_producer && !qFuzzyIsNull(m_producer->get_speed())) {
+        // Playback honors the configured preview resolution
+        return;
+    }
+    beginScrubScaling();
+}
+
+void VideoWidget::beginScrubScaling()
+{
+    if (!m_lowResScrub) {
+        m_lowResScrub = true;
+        m_consumer->set("scale", 0.25);
+    }
+    m_scrubTimer.start();
+}
+
+void VideoWidget::endScrubScaling()
+{
+    m_scrubTimer.stop();
+    if (!m_lowResScrub) {
+        return;
+    }
+    m_lowResScrub = false;
+    QMutexLocker locker(&m_mltMutex);
+    if (m_consumer) {
+        m_consumer->set("scale", 1.0);
+        if (m_producer && qFuzzyIsNull(m_producer->get_speed())) {
+            // Re-decode the frame the playhead rests on at full resolution
+            restartConsumer();
+            m_consumer->set("refresh", 1);
+        }
+    }
+}
+
 bool VideoWidget::checkFrameNumber(int pos, bool isPlaying)
 {
     const double speed = m_producer->get_speed();
@@ -573,6 +634,7 @@ static void onThreadStopped(mlt_properties owner, VideoWidget *self, mlt_event_d
 
 int VideoWidget::setProducer(const QString &file)
 {
+    clearFrameCache();
     if (m_producer) {
         m_producer.reset();
     }
@@ -598,6 +660,7 @@ int VideoWidget::setProducer(const QString &file)
 
 int VideoWidget::setProducer(const std::shared_ptr<Mlt::Producer> &producer, bool isActive, int position)
 {
+    clearFrameCache();
     int error = 0;
     QString currentId;
     int consumerPosition = 0;
@@ -607,6 +670,39 @@ int VideoWidget::setProducer(const std::shared_ptr<Mlt::Producer> &producer, boo
     if (m_consumer) {
         consumerPosition = m_consumer->position();
     }
+    if (isActive && producer && producer->is_valid() && m_consumer && m_consumer->is_valid() && !m_consumer->is_stopped() &&
+        strcmp(m_consumer->get("mlt_service"), "multi") != 0) {
+        // Swap the producer under the running consumer. Stopping and restarting the
+        // consumer reopens the audio device and respawns its threads, which makes
+        // switching between bin clips noticeably laggy when reviewing takes
+        m_refreshTimer.stop();
+        m_scrubTimer.stop();
+        m_lowResScrub = false;
+        if (m_isZoneMode || m_isLoopMode) {
+            resetZoneMode();
+        }
+        QMutexLocker locker(&m_mltMutex);
+        m_consumer->set("refresh", 0);
+        m_consumer->purge();
+        if (m_producer) {
+            m_producer->set_speed(0.0);
+        }
+        m_producer = producer;
+        m_producer->set_speed(0);
+        m_proxy->setSpeed(0);
+        m_consumer->connect(*m_producer.get());
+        locker.unlock();
+        m_consumer->set("refresh", 1);
+        if (position == -1 && m_producer->parent().get("kdenlive:id") == currentId) {
+            position = consumerPosition;
+        }
+        m_consumer->set("scrub_audio", 0);
+        if (position != -2) {
+            m_proxy->resetPosition();
+            m_proxy->setPositionAdvanced(position > 0 ? position : m_producer->position(), true);
+        }
+        return 0;
+    }
     stop();
     if (producer) {
         m_producer = producer;
@@ -746,6 +842,9 @@ int VideoWidget::reconfigure()
         if (KdenliveSettings::previewScaling() > 1) {
             m_consumer->set("scale", 1.0 / KdenliveSettings::previewScaling());
         }
+        // The fresh consumer starts at the configured resolution
+        m_scrubTimer.stop();
+        m_lowResScrub = false;
         // C & D
         if (m_glslManager) {
             if (!m_threadStartEvent) {
@@ -757,6 +856,10 @@ int VideoWidget::reconfigure()
             if (!serviceName.startsWith(QLatin1String("decklink"))) {
                 m_consumer->set("mlt_image_format", "glsl");
             }
+        } else if (pCore->getCurrentProfile()->colorspace() == 2020) {
+            // HDR project: keep frames at 10 bit so the YUV to RGB conversion and tone
+            // mapping happen in the display shader instead of a CPU conversion
+            m_consumer->set("mlt_image_format", "yuv420p10");
         } else {
             // A & B
             m_consumer->set("mlt_image_format", "yuv422");
@@ -782,13 +885,11 @@ int VideoWidget::reconfigure()
         // m_consumer->set("progressive", 1);
         m_consumer->set("rescale", KdenliveSettings::mltinterpolation().toUtf8().constData());
         m_consumer->set("deinterlacer", KdenliveSettings::mltdeinterlacer().toUtf8().constData());
-        /*
-#ifdef Q_OS_WIN
-        m_consumer->set("audio_buffer", 2048);
-#else
-        m_consumer->set("audio_buffer", 512);
-#endif
-        */
+        if (KdenliveSettings::lowlatencymonitoring()) {
+            // Small period keeps the output latency around 10 ms at 48 kHz; backends like
+            // PipeWire or JACK can be selected through the audio driver setting
+            m_consumer->set("audio_buffer", 512);
+        }
         int fps = qRound(pCore->getCurrentFps());
         m_consumer->set("buffer", qMax(25, fps));
         m_consumer->set("prefill", 6);
@@ -876,6 +977,9 @@ void VideoWidget::onFrameDisplayed(const SharedFrame &frame)
     m_sendFrame = sendFrameForAnalysis;
     m_mutex.unlock();
     quickWindow()->update();
+    if (FrameTrace::isActive()) {
+        m_proxy->setFrameTrace(FrameTrace::lastFrameSummary());
+    }
 }
 
 void VideoWidget::purgeCache()
@@ -887,6 +991,59 @@ void VideoWidget::purgeCache()
     }
 }
 
+bool VideoWidget::displayEffectCachedFrame(const QString &key)
+{
+    if (!m_consumer || !m_producer || !qFuzzyIsNull(m_producer->get_speed())) {
+        return false;
+    }
+    for (const auto &entry : qAsConst(m_frameCache)) {
+        if (entry.first == key) {
+            // This stack state was rendered recently, redisplay it without decoding
+            onFrameDisplayed(entry.second);
+            return true;
+        }
+    }
+    return false;
+}
+
+void VideoWidget::cacheNextFrame(const QString &context, const QString &key, int position)
+{
+    if (context != m_frameCacheContext) {
+        // Another item's effects were adjusted, previous entries can no longer be trusted
+        m_frameCache.clear();
+        m_frameCacheContext = context;
+    }
+    m_pendingCacheKey = key;
+    m_pendingCachePos = position;
+}
+
+void VideoWidget::clearFrameCache()
+{
+    m_frameCache.clear();
+    m_frameCacheContext.clear();
+    m_pendingCacheKey.clear();
+    m_pendingCachePos = -1;
+}
+
+void VideoWidget::cachePendingFrame(const SharedFrame &frame)
+{
+    if (m_pendingCacheKey.isEmpty()) {
+        return;
+    }
+    if (frame.get_position() != m_pendingCachePos) {
+        // A seek or playback started before the tagged frame came through
+        m_pendingCacheKey.clear();
+        m_pendingCachePos = -1;
+        return;
+    }
+    m_frameCache.append({m_pendingCacheKey, frame});
+    while (m_frameCache.size() > 10) {
+        m_frameCache.removeFirst();
+    }
+    m_pendingCacheKey.clear();
+    m_pendingCachePos = -1;
+}
+
 void VideoWidget::mouseDoubleClickEvent(QMouseEvent *event)
 {
     QQuickWidget::mouseDoubleClickEvent(event);
@@ -941,6 +1098,9 @@ void VideoWidget::on_frame_show(mlt_consumer, VideoWidget *widget, mlt_event_dat
 {
     auto frame = Mlt::EventData(data).to_frame();
     if (frame.is_valid() && frame.get_int("rendered")) {
+        if (FrameTrace::isActive()) {
+            FrameTrace::instant(FrameTrace::FrameShow, frame.get_position());
+        }
         int timeout = (widget->consumer()->get_int("real_time") > 0) ? 0 : 1000;
         if ((widget->m_frameRenderer != nullptr) && widget->m_frameRenderer->semaphore()->tryAcquire(1, timeout)) {
             QMetaObject::invokeMethod(widget->m_frameRenderer, "showFrame", Qt::QueuedConnection, Q_ARG(Mlt::Frame, frame));
@@ -1001,8 +1161,12 @@ void FrameRenderer::requestImage()
 
 void FrameRenderer::showFrame(Mlt::Frame frame)
 {
+    qint64 traceStart = FrameTrace::isActive() ? FrameTrace::now() : 0;
     // Save this frame for future use and to keep a reference to the GL Texture.
     m_displayFrame = SharedFrame(frame);
+    if (traceStart > 0) {
+        FrameTrace::record(FrameTrace::Convert, m_displayFrame.get_position(), traceStart);
+    }
     Q_EMIT frameDisplayed(m_displayFrame);
     if (m_imageRequested) {
         m_imageRequested = false;
@@ -1037,6 +1201,12 @@ bool VideoWidget::switchPlay(bool play, double speed)
         resetZoneMode();
     }
     if (play) {
+        // Playback honors the configured preview resolution, not the scrub one
+        m_scrubTimer.stop();
+        if (m_lowResScrub) {
+            m_lowResScrub = false;
+            m_consumer->set("scale", 1.0);
+        }
         if (m_consumer->position() >= m_maxProducerPosition && speed > 0) {
             // We are at the end of the clip / timeline
             if (m_id == Kdenlive::ClipMonitor || (m_id == Kdenlive::ProjectMonitor && KdenliveSettings::jumptostart())) {
@@ -1220,6 +1390,8 @@ void VideoWidget::startConsumer()
 void VideoWidget::stop()
 {
     m_refreshTimer.stop();
+    m_scrubTimer.stop();
+    m_lowResScrub = false;
     // why this lock?
     QMutexLocker locker(&m_mltMutex);
     if (m_producer) {
@@ -118,6 +118,13 @@ public:
     void setConsumerProperty(const QString &name, const QString &value);
     /** @brief Clear consumer cache */
     void purgeCache();
+    /** @brief Redisplay the frame cached under @p key if we have it, returns false on cache miss */
+    bool displayEffectCachedFrame(const QString &key);
+    /** @brief Store the next frame displayed at @p position under @p key so it can be redisplayed
+     *  without a re-render. Switching to another @p context drops all previous entries. */
+    void cacheNextFrame(const QString &context, const QString &key, int position);
+    /** @brief Drop all frames kept for effect parameter comparison */
+    void clearFrameCache();
     /** @brief Show / hide monitor ruler */
     void switchRuler(bool show);
     /** @brief Returns true if consumer is initialized */
@@ -150,6 +157,10 @@ public Q_SLOTS:
     void setOffsetX(int x, int max);
     void setOffsetY(int y, int max);
     void slotZoom(bool zoomIn);
+    /** @brief Serve the next frames at reduced resolution while the user drags a
+     *  monitor scene handle, the full resolution frame is re-decoded once the drag
+     *  rests. Follows the adaptive scrub scaling setting. */
+    void beginInteractiveScaling();
     void releaseAnalyse();
     bool switchPlay(bool play, double speed = 1.0);
     void reloadProfile();
@@ -224,6 +235,10 @@ private:
     std::unique_ptr<Mlt::Event> m_displayEvent;
     FrameRenderer *m_frameRenderer;
     QTimer m_refreshTimer;
+    /** @brief Fires when the playhead rested after a scrub, restoring full resolution */
+    QTimer m_scrubTimer;
+    /** @brief True while scrub seeks are served at reduced resolution */
+    bool m_lowResScrub{false};
     int m_colorSpace;
     double m_dar;
     bool m_isZoneMode;
@@ -232,6 +247,12 @@ private:
     int m_loopOut;
     QPoint m_offset;
     MonitorProxy *m_proxy;
+    /** @brief Recently displayed frames kept for A/B comparison of effect parameters, keyed by
+     *  (position, effect stack hash). Invalidated whenever the scene changes for another reason. */
+    QList<QPair<QString, SharedFrame>> m_frameCache;
+    QString m_frameCacheContext;
+    QString m_pendingCacheKey;
+    int m_pendingCachePos{-1};
     std::unique_ptr<RenderThread> m_renderThread;
     std::shared_ptr<Mlt::Producer> m_blackClip;
     static void on_frame_show(mlt_consumer, VideoWidget *widget, mlt_event_data);
@@ -245,6 +266,8 @@ private:
     void disableGPUAccel();
     /** @brief Restart consumer, keeping preview scaling settings */
     bool restartConsumer();
+    /** @brief Serve the next frames at quarter resolution while the user is actively scrubbing */
+    void beginScrubScaling();
 
     /* OpenGL context management. Interfaces to MLT according to the configured render pipeline.
      */
@@ -252,9 +275,13 @@ private Q_SLOTS:
     void resizeVideo(int width, int height);
     int reconfigure();
     void refresh();
+    /** @brief Store the displayed frame if it was tagged for the effect comparison cache */
+    void cachePendingFrame(const SharedFrame &frame);
     void switchRecordState(bool on);
     /** @brief Enforce a zoom refresh, can be useful when switching to/from fullscreen to adjust image size/position */
     void forceRefreshZoom();
+    /** @brief Restore the full preview resolution and re-decode the frame the playhead rests on */
+    void endScrubScaling();
 
 protected:
     void resizeEvent(QResizeEvent *event) override;
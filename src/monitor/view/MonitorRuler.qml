@@ -299,6 +299,13 @@ Rectangle {
         anchors.top: ruler.top
         fillColor: activePalette.windowText
         x: controller.position * root.timeScale - ruler.rulerZoomOffset - (width / 2)
+        // Position updates are rate limited during playback, glide between them
+        // so the playhead does not visibly step. Disabled when paused so seeks
+        // and frame stepping stay frame accurate
+        Behavior on x {
+            enabled: controller.speed !== 0
+            NumberAnimation { duration: 50; easing.type: Easing.Linear }
+        }
     }
     MouseArea {
         id: trimInMouseArea
@@ -529,6 +529,23 @@ Item {
                     bottomMargin: overlayMargin
                 }
             }
+            Label {
+                id: frameTraceHud
+                font.family: fontMetrics.font.family
+                objectName: "frametrace"
+                color: "#ffffff"
+                padding: 2
+                background: Rectangle {
+                    color: "#66000000"
+                }
+                text: controller.frameTrace
+                visible: controller.frameTrace.length > 0
+                anchors {
+                    left: parent.left
+                    bottom: parent.bottom
+                    bottomMargin: overlayMargin
+                }
+            }
             Label {
                 id: labelSpeed
                 font: fixedFont
@@ -204,6 +204,23 @@ Item {
                     bottomMargin: root.zoomOffset
                 }
             }
+            Label {
+                id: frameTraceHud
+                font.family: fontMetrics.font.family
+                objectName: "frametrace"
+                color: "#ffffff"
+                padding: 2
+                background: Rectangle {
+                    color: "#66000000"
+                }
+                text: controller.frameTrace
+                visible: controller.frameTrace.length > 0
+                anchors {
+                    left: parent.left
+                    bottom: parent.bottom
+                    bottomMargin: root.zoomOffset
+                }
+            }
             Label {
                 id: labelSpeed
                 font: fixedFont
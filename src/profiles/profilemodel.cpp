@@ -11,6 +11,7 @@
 #include <KLocalizedString>
 
 #include <KMessageWidget>
+#include <QDataStream>
 #include <QDir>
 #include <QFile>
 #include <memory>
@@ -46,46 +47,78 @@ ProfileModel::ProfileModel(const QString &path)
     }
     m_profile = std::make_unique<Mlt::Profile>(path.toUtf8().constData());
     m_description = QString(qstrdup(m_profile->description()));
+    m_invalid = m_invalid || !m_profile->is_valid();
+    m_frame_rate_num = m_profile->frame_rate_num();
+    m_frame_rate_den = m_profile->frame_rate_den();
+    m_width = m_profile->width();
+    m_height = m_profile->height();
+    m_progressive = m_profile->progressive();
+    m_sample_aspect_num = m_profile->sample_aspect_num();
+    m_sample_aspect_den = m_profile->sample_aspect_den();
+    m_display_aspect_num = m_profile->display_aspect_num();
+    m_display_aspect_den = m_profile->display_aspect_den();
+    m_colorspace = m_profile->colorspace();
+}
+
+ProfileModel::ProfileModel(const QString &path, QDataStream &in)
+    : m_path(path)
+    , m_invalid(false)
+{
+    in >> m_description >> m_bottom_field_first >> m_frame_rate_num >> m_frame_rate_den >> m_width >> m_height >> m_progressive >> m_sample_aspect_num >>
+        m_sample_aspect_den >> m_display_aspect_num >> m_display_aspect_den >> m_colorspace;
+}
+
+void ProfileModel::writeToCache(QDataStream &out) const
+{
+    out << m_description << m_bottom_field_first << m_frame_rate_num << m_frame_rate_den << m_width << m_height << m_progressive << m_sample_aspect_num
+        << m_sample_aspect_den << m_display_aspect_num << m_display_aspect_den << m_colorspace;
+}
+
+void ProfileModel::ensureProfile() const
+{
+    if (!m_profile) {
+        m_profile = std::make_unique<Mlt::Profile>(m_path.toUtf8().constData());
+    }
 }
 
 bool ProfileModel::is_valid() const
 {
-    return (!m_invalid) && m_profile->is_valid();
+    return !m_invalid;
 }
 
 QString ProfileModel::description() const
 {
-    return QString(qstrdup(m_profile->description()));
+    return m_description;
 }
 
 int ProfileModel::frame_rate_num() const
 {
-    return m_profile->frame_rate_num();
+    return m_frame_rate_num;
 }
 
 int ProfileModel::frame_rate_den() const
 {
-    return m_profile->frame_rate_den();
+    return m_frame_rate_den;
 }
 
 double ProfileModel::fps() const
 {
-    return m_profile->fps();
+    return m_frame_rate_den > 0 ? double(m_frame_rate_num) / m_frame_rate_den : 0.;
 }
 
 int ProfileModel::width() const
 {
-    return m_profile->width();
+    return m_width;
 }
 
 int ProfileModel::height() const
 {
-    return m_profile->height();
+    return m_height;
 }
 
 bool ProfileModel::progressive() const
 {
-    return m_profile->progressive();
+    return m_progressive;
 }
 
 bool ProfileModel::bottom_field_first() const
@@ -95,42 +128,46 @@ bool ProfileModel::bottom_field_first() const
 
 int ProfileModel::sample_aspect_num() const
 {
-    return m_profile->sample_aspect_num();
+    return m_sample_aspect_num;
 }
 
 int ProfileModel::sample_aspect_den() const
 {
-    return m_profile->sample_aspect_den();
+    return m_sample_aspect_den;
 }
 
 double ProfileModel::sar() const
 {
-    return m_profile->sar();
+    return m_sample_aspect_den > 0 ? double(m_sample_aspect_num) / m_sample_aspect_den : 1.;
 }
 
 int ProfileModel::display_aspect_num() const
 {
-    return m_profile->display_aspect_num();
+    return m_display_aspect_num;
 }
 
 int ProfileModel::display_aspect_den() const
 {
-    return m_profile->display_aspect_den();
+    return m_display_aspect_den;
 }
 
 double ProfileModel::dar() const
 {
-    return m_profile->dar();
+    if (m_display_aspect_den > 0) {
+        return double(m_display_aspect_num) / m_display_aspect_den;
+    }
+    return m_height > 0 ? sar() * m_width / m_height : 1.;
 }
 
 int ProfileModel::is_explicit() const
 {
+    ensureProfile();
     return m_profile->is_explicit();
 }
 
 int ProfileModel::colorspace() const
 {
-    return m_profile->colorspace();
+    return m_colorspace;
 }
 
 QString ProfileModel::path() const
@@ -140,11 +177,13 @@ QString ProfileModel::path() const
 
 mlt_profile ProfileModel::get_profile() const
 {
+    ensureProfile();
     return m_profile->get_profile();
 }
 
 void ProfileModel::set_explicit(int b)
 {
+    ensureProfile();
     m_profile->set_explicit(b);
 }
 
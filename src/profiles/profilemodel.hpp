@@ -12,6 +12,8 @@
 
 #include <mlt++/MltProfile.h>
 
+class QDataStream;
+
 /** @class ProfileModel
     @brief This is a wrapper around Mlt::Profile to be used by the rest of kdenlive.
     It has implicit conversion to Mlt::Profile so you can use it directly in calls to Mlt backend.
@@ -25,8 +27,15 @@ public:
     /** @brief Constructs a profile using the path to the profile description
      */
     ProfileModel(const QString &path);
+    /** @brief Constructs a profile from fields cached by ProfileRepository, without touching the
+     *  profile file. The underlying Mlt::Profile is only created on demand.
+     */
+    ProfileModel(const QString &path, QDataStream &in);
     ~ProfileModel() override = default;
 
+    /** @brief Serializes the parsed fields to the repository cache */
+    void writeToCache(QDataStream &out) const;
+
     bool is_valid() const override;
     QString description() const override;
     int frame_rate_num() const override;
@@ -51,15 +60,32 @@ public:
     void adjustDimensions() override{};
 
     /** @brief get underlying profile. Use with caution*/
-    Mlt::Profile &profile() { return *m_profile.get(); };
+    Mlt::Profile &profile()
+    {
+        ensureProfile();
+        return *m_profile.get();
+    };
 
 protected:
+    /** @brief Creates the underlying Mlt::Profile if the model was built from the cache */
+    void ensureProfile() const;
+
     QString m_path;
     bool m_invalid;
     QString m_description;
     bool m_bottom_field_first;
-
-    std::unique_ptr<Mlt::Profile> m_profile;
+    int m_frame_rate_num{0};
+    int m_frame_rate_den{1};
+    int m_width{0};
+    int m_height{0};
+    bool m_progressive{false};
+    int m_sample_aspect_num{0};
+    int m_sample_aspect_den{1};
+    int m_display_aspect_num{0};
+    int m_display_aspect_den{1};
+    int m_colorspace{0};
+
+    mutable std::unique_ptr<Mlt::Profile> m_profile;
 };
 
 /** @class ProfileParam
@@ -9,7 +9,9 @@
 #include "profilemodel.hpp"
 #include <KLocalizedString>
 #include <KMessageBox>
+#include <QDataStream>
 #include <QDir>
+#include <QFileInfo>
 #include <QStandardPaths>
 #include <algorithm>
 #include <mlt++/MltProfile.h>
@@ -51,10 +53,23 @@ void ProfileRepository::refresh()
 
     // list MLT profiles.
     QDir mltDir(KdenliveSettings::mltpath());
-    QStringList profilesFiles = mltDir.entryList(QDir::Files);
 
     // list Custom Profiles
     QStringList customProfilesDir = QStandardPaths::locateAll(QStandardPaths::AppDataLocation, QStringLiteral("profiles/"), QStandardPaths::LocateDirectory);
+
+    // The parsed result only depends on the content of the profile directories, so it is cached
+    // keyed by their modification times and loaded back in a single read on the next startup
+    QVector<QPair<QString, qint64>> dirStamps;
+    dirStamps << qMakePair(mltDir.absolutePath(), QFileInfo(mltDir.absolutePath()).lastModified().toMSecsSinceEpoch());
+    for (const auto &dir : qAsConst(customProfilesDir)) {
+        dirStamps << qMakePair(dir, QFileInfo(dir).lastModified().toMSecsSinceEpoch());
+    }
+    const QString cachePath = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/profiles-v1.cache");
+    if (m_profiles.empty() && loadProfileCache(cachePath, dirStamps)) {
+        return;
+    }
+
+    QStringList profilesFiles = mltDir.entryList(QDir::Files);
     for (const auto &dir : qAsConst(customProfilesDir)) {
         QStringList files = QDir(dir).entryList(QDir::Files);
         for (const auto &file : qAsConst(files)) {
@@ -69,6 +84,54 @@ void ProfileRepository::refresh()
             m_profiles.insert(std::make_pair(file, std::move(profile)));
         }
     }
+    writeProfileCache(cachePath, dirStamps);
+}
+
+bool ProfileRepository::loadProfileCache(const QString &cachePath, const QVector<QPair<QString, qint64>> &dirStamps)
+{
+    QFile file(cachePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_15);
+    QVector<QPair<QString, qint64>> cachedStamps;
+    in >> cachedStamps;
+    if (in.status() != QDataStream::Ok || cachedStamps != dirStamps) {
+        // A profile directory changed since the cache was written, fall back to a full scan
+        return false;
+    }
+    qint32 count = 0;
+    in >> count;
+    std::unordered_map<QString, std::unique_ptr<ProfileModel>> profiles;
+    for (qint32 i = 0; i < count; i++) {
+        QString path;
+        in >> path;
+        std::unique_ptr<ProfileModel> profile(new ProfileModel(path, in));
+        if (in.status() != QDataStream::Ok) {
+            return false;
+        }
+        profiles.insert(std::make_pair(path, std::move(profile)));
+    }
+    m_profiles = std::move(profiles);
+    return true;
+}
+
+void ProfileRepository::writeProfileCache(const QString &cachePath, const QVector<QPair<QString, qint64>> &dirStamps) const
+{
+    QDir().mkpath(QFileInfo(cachePath).absolutePath());
+    QFile file(cachePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return;
+    }
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_15);
+    out << dirStamps;
+    out << qint32(m_profiles.size());
+    for (const auto &profile : m_profiles) {
+        out << profile.first;
+        profile.second->writeToCache(out);
+    }
 }
 
 QVector<QPair<QString, QString>> ProfileRepository::getAllProfiles() const
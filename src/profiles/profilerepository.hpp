@@ -66,6 +66,12 @@ protected:
     // Constructor is protected because class is a Singleton
     ProfileRepository();
 
+    /** @brief Loads the parsed profiles from the binary cache in one read. Returns false if the
+     *  cache is missing or was written for other profile directory timestamps. */
+    bool loadProfileCache(const QString &cachePath, const QVector<QPair<QString, qint64>> &dirStamps);
+    /** @brief Persists the parsed profiles so the next startup skips the per-file parsing */
+    void writeProfileCache(const QString &cachePath, const QVector<QPair<QString, qint64>> &dirStamps) const;
+
     static std::unique_ptr<ProfileRepository> instance;
     static std::once_flag m_onceFlag; // flag to create the repository only once;
 
@@ -18,6 +18,8 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 
 #include "doc/kdenlivedoc.h"
 #include "kdenlive_debug.h"
+#include <KArchiveDirectory>
+#include <KArchiveFile>
 #include <KGuiItem>
 #include <KLocalizedString>
 #include <KMessageBox>
@@ -26,15 +28,22 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include <KZip>
 #include <kio/directorysizejob.h>
 
+#include <QThreadPool>
 #include <QTreeWidget>
 #include <QtConcurrent>
 #include <utility>
+
+// Number of parallel copy streams used when archiving, so one large file does not serialize the whole transfer
+static const int maxConcurrentCopyJobs = 4;
+
+// Number of disk writes kept in flight while extracting; the archive stream itself is read serially
+static const int maxConcurrentExtractWrites = 4;
+
 ArchiveWidget::ArchiveWidget(const QString &projectName, const QString &xmlData, const QStringList &luma_list, const QStringList &other_list, QWidget *parent)
     : QDialog(parent)
     , m_requestedSize(0)
     , m_timelineSize(0)
     , m_subtitlesSize(0)
-    , m_copyJob(nullptr)
     , m_name(projectName.section(QLatin1Char('.'), 0, -2))
     , m_temp(nullptr)
     , m_abortArchive(false)
@@ -269,7 +278,6 @@ ArchiveWidget::ArchiveWidget(const QString &projectName, const QString &xmlData,
 ArchiveWidget::ArchiveWidget(QUrl url, QWidget *parent)
     : QDialog(parent)
     , m_requestedSize(0)
-    , m_copyJob(nullptr)
     , m_temp(nullptr)
     , m_abortArchive(false)
     , m_extractMode(true)
@@ -339,7 +347,7 @@ void ArchiveWidget::openArchiveForExtraction()
     Q_EMIT showMessage(QStringLiteral("system-run"), i18n("Opening archive…"));
     QMimeDatabase db;
     QMimeType mime = db.mimeTypeForUrl(m_extractUrl);
-    if (mime.inherits(QStringLiteral("application/x-compressed-tar"))) {
+    if (mime.inherits(QStringLiteral("application/x-compressed-tar")) || mime.inherits(QStringLiteral("application/x-zstd-compressed-tar"))) {
         m_archive = new KTar(m_extractUrl.toLocalFile());
     } else {
         m_archive = new KZip(m_extractUrl.toLocalFile());
@@ -401,9 +409,11 @@ bool ArchiveWidget::closeAccepted()
         m_infoMessage->setText(i18n("Abort processing"));
         m_infoMessage->animatedShow();
         m_abortArchive = true;
-        if (m_copyJob) {
-            m_copyJob->kill();
+        for (KIO::CopyJob *job : qAsConst(m_copyJobs)) {
+            job->kill();
         }
+        m_copyJobs.clear();
+        m_copyProgress.clear();
         m_archiveThread.waitForFinished();
     }
     return true;
@@ -592,12 +602,16 @@ void ArchiveWidget::slotCheckSpace()
 
 bool ArchiveWidget::slotStartArchiving(bool firstPass)
 {
-    if (firstPass && ((m_copyJob != nullptr) || m_archiveThread.isRunning())) {
+    if (firstPass && (!m_copyJobs.isEmpty() || m_archiveThread.isRunning())) {
         // archiving in progress, abort
-        if (m_copyJob) {
-            m_copyJob->kill(KJob::EmitResult);
-        }
         m_abortArchive = true;
+        const QList<KIO::CopyJob *> jobs = m_copyJobs;
+        m_copyJobs.clear();
+        m_copyProgress.clear();
+        for (int i = 0; i < jobs.count(); ++i) {
+            // Only the first job emits its result so the abort is reported once
+            jobs.at(i)->kill(i == 0 ? KJob::EmitResult : KJob::Quietly);
+        }
         return true;
     }
     m_infoMessage->setMessageType(KMessageWidget::Information);
@@ -612,9 +626,7 @@ bool ArchiveWidget::slotStartArchiving(bool firstPass)
     buttonBox->button(QDialogButtonBox::Close)->setText(i18n("Abort"));
 
     bool isArchive = compressed_archive->isChecked();
-    if (!firstPass) {
-        m_copyJob = nullptr;
-    } else {
+    if (firstPass) {
         // starting archiving
         m_abortArchive = false;
         m_duplicateFiles.clear();
@@ -622,6 +634,8 @@ bool ArchiveWidget::slotStartArchiving(bool firstPass)
         m_foldersList.clear();
         m_filesList.clear();
         m_processedFiles.clear();
+        m_copyProgress.clear();
+        m_copiedSize = 0;
         slotDisplayMessage(QStringLiteral("system-run"), i18n("Archiving…"));
         repaint();
     }
@@ -760,8 +774,9 @@ bool ArchiveWidget::slotStartArchiving(bool firstPass)
             m_duplicateFiles.remove(startJobSrc);
             m_infoMessage->setText(i18n("Copying %1", startJobSrc.fileName()));
             KIO::CopyJob *job = KIO::copyAs(startJobSrc, startJobDst, KIO::HideProgressInfo);
-            connect(job, &KJob::result, this, [this](KJob *jb) { slotArchivingFinished(jb, false); });
+            connect(job, &KJob::result, this, &ArchiveWidget::slotCopyJobDone);
             connect(job, &KJob::processedSize, this, &ArchiveWidget::slotArchivingProgress);
+            m_copyJobs << job;
         }
         return true;
     }
@@ -780,9 +795,32 @@ bool ArchiveWidget::slotStartArchiving(bool firstPass)
         if (!destUrl.mkpath(QStringLiteral("."))) {
             KMessageBox::error(this, i18n("Cannot create directory %1", destUrl.absolutePath()));
         }
-        m_copyJob = KIO::copy(files, QUrl::fromLocalFile(destUrl.absolutePath()), KIO::HideProgressInfo);
-        connect(m_copyJob, &KJob::result, this, [this](KJob *jb) { slotArchivingFinished(jb, false); });
-        connect(m_copyJob, &KJob::processedSize, this, &ArchiveWidget::slotArchivingProgress);
+        // Skip files that a previous interrupted archive run already fully copied
+        QList<QUrl> pendingFiles;
+        for (const QUrl &file : qAsConst(files)) {
+            QFileInfo destInfo(destUrl.absoluteFilePath(file.fileName()));
+            if (destInfo.exists() && destInfo.size() == QFileInfo(file.toLocalFile()).size()) {
+                m_copiedSize += static_cast<KIO::filesize_t>(destInfo.size());
+                continue;
+            }
+            pendingFiles << file;
+        }
+        if (pendingFiles.isEmpty()) {
+            slotStartArchiving(false);
+        } else {
+            // Split the transfer in several parallel streams so one large file does not serialize the whole copy
+            const int streams = qMin(maxConcurrentCopyJobs, pendingFiles.count());
+            for (int st = 0; st < streams; ++st) {
+                QList<QUrl> streamFiles;
+                for (int ix = st; ix < pendingFiles.count(); ix += streams) {
+                    streamFiles << pendingFiles.at(ix);
+                }
+                KIO::CopyJob *job = KIO::copy(streamFiles, QUrl::fromLocalFile(destUrl.absolutePath()), KIO::HideProgressInfo);
+                connect(job, &KJob::result, this, &ArchiveWidget::slotCopyJobDone);
+                connect(job, &KJob::processedSize, this, &ArchiveWidget::slotArchivingProgress);
+                m_copyJobs << job;
+            }
+        }
     }
     if (firstPass) {
         progressBar->setValue(0);
@@ -792,6 +830,26 @@ bool ArchiveWidget::slotStartArchiving(bool firstPass)
     return true;
 }
 
+void ArchiveWidget::slotCopyJobDone(KJob *job)
+{
+    m_copyJobs.removeAll(static_cast<KIO::CopyJob *>(job));
+    if (job->error() != 0) {
+        // On failure abort the other streams and report the error
+        for (KIO::CopyJob *j : qAsConst(m_copyJobs)) {
+            j->kill();
+        }
+        m_copyJobs.clear();
+        m_copyProgress.clear();
+        slotArchivingFinished(job, false);
+        return;
+    }
+    // Fold the finished stream's bytes into the global progress
+    m_copiedSize += m_copyProgress.take(job);
+    if (m_copyJobs.isEmpty()) {
+        slotArchivingFinished(nullptr, false);
+    }
+}
+
 void ArchiveWidget::slotArchivingFinished(KJob *job, bool finished)
 {
     if (job == nullptr || job->error() == 0) {
@@ -812,7 +870,6 @@ void ArchiveWidget::slotArchivingFinished(KJob *job, bool finished)
             processProjectFile();
         }
     } else {
-        m_copyJob = nullptr;
         slotJobResult(false, i18n("There was an error while copying the files: %1", job->errorString()));
     }
     if (!compressed_archive->isChecked()) {
@@ -825,13 +882,19 @@ void ArchiveWidget::slotArchivingFinished(KJob *job, bool finished)
     }
 }
 
-void ArchiveWidget::slotArchivingProgress(KJob *, qulonglong size)
+void ArchiveWidget::slotArchivingProgress(KJob *job, qulonglong size)
 {
+    m_copyProgress[job] = static_cast<KIO::filesize_t>(size);
     if (m_requestedSize == 0) {
         progressBar->setValue(100);
-    } else {
-        progressBar->setValue(static_cast<int>(100 * size / m_requestedSize));
+        return;
+    }
+    // Aggregate the bytes processed by all parallel streams
+    KIO::filesize_t processed = m_copiedSize;
+    for (auto it = m_copyProgress.constBegin(); it != m_copyProgress.constEnd(); ++it) {
+        processed += it.value();
     }
+    progressBar->setValue(static_cast<int>(100 * processed / m_requestedSize));
 }
 
 QString ArchiveWidget::processPlaylistFile(const QString &filename)
@@ -860,6 +923,8 @@ bool ArchiveWidget::processProjectFile()
         m_archiveName = QString(archive_url->url().toLocalFile() + QDir::separator() + m_name);
         if (compression_type->currentIndex() == 1) {
             m_archiveName.append(QStringLiteral(".zip"));
+        } else if (compression_type->currentIndex() == 2) {
+            m_archiveName.append(QStringLiteral(".tar.zst"));
         } else {
             m_archiveName.append(QStringLiteral(".tar.gz"));
         };
@@ -1095,6 +1160,9 @@ void ArchiveWidget::createArchive()
     QString group = dirInfo.group();
     if (compression_type->currentIndex() == 1) {
         m_archive = new KZip(m_archiveName);
+    } else if (compression_type->currentIndex() == 2) {
+        // zstd compresses the media payload about as well as gzip at a fraction of the cpu time
+        m_archive = new KTar(m_archiveName, QStringLiteral("application/zstd"));
     } else {
         m_archive = new KTar(m_archiveName, QStringLiteral("application/x-gzip"));
     }
@@ -1217,11 +1285,61 @@ void ArchiveWidget::slotGotProgress(KJob *job)
 
 void ArchiveWidget::doExtracting()
 {
-    m_archive->directory()->copyTo(archive_url->url().toLocalFile() + QDir::separator());
+    QThreadPool writePool;
+    writePool.setMaxThreadCount(maxConcurrentExtractWrites);
+    if (!extractArchiveDirectory(m_archive->directory(), archive_url->url().toLocalFile() + QDir::separator(), writePool)) {
+        qCWarning(KDENLIVE_LOG) << "Errors while extracting archive" << m_extractUrl.toLocalFile();
+    }
     m_archive->close();
     Q_EMIT extractingFinished();
 }
 
+bool ArchiveWidget::extractArchiveDirectory(const KArchiveDirectory *archiveDir, const QString &dest, QThreadPool &writePool)
+{
+    if (!QDir().mkpath(dest)) {
+        return false;
+    }
+    bool success = true;
+    // The compression stream is stateful so entries are decoded here sequentially, but each
+    // file's disk write is independent and overlaps the decompression of the next entries.
+    // Draining the oldest write once the queue is full also bounds the data held in memory.
+    QList<QFuture<bool>> pendingWrites;
+    const QStringList entries = archiveDir->entries();
+    for (const QString &entryName : entries) {
+        const KArchiveEntry *entry = archiveDir->entry(entryName);
+        if (entry == nullptr) {
+            continue;
+        }
+        if (!entry->symLinkTarget().isEmpty()) {
+            success = QFile::link(entry->symLinkTarget(), dest + entryName) && success;
+            continue;
+        }
+        if (entry->isDirectory()) {
+            success = extractArchiveDirectory(static_cast<const KArchiveDirectory *>(entry), dest + entryName + QDir::separator(), writePool) && success;
+            continue;
+        }
+        if (!entry->isFile()) {
+            continue;
+        }
+        const QByteArray data = static_cast<const KArchiveFile *>(entry)->data();
+        const QString filePath = dest + entryName;
+        while (pendingWrites.size() >= maxConcurrentExtractWrites) {
+            success = pendingWrites.takeFirst().result() && success;
+        }
+        pendingWrites << QtConcurrent::run(&writePool, [data, filePath]() {
+            QFile file(filePath);
+            if (!file.open(QIODevice::WriteOnly)) {
+                return false;
+            }
+            return file.write(data) == data.size();
+        });
+    }
+    while (!pendingWrites.isEmpty()) {
+        success = pendingWrites.takeFirst().result() && success;
+    }
+    return success;
+}
+
 QString ArchiveWidget::extractedProjectFile() const
 {
     return archive_url->url().toLocalFile() + QDir::separator() + m_projectName;
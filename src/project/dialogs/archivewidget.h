@@ -21,6 +21,8 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 
 class KJob;
 class KArchive;
+class KArchiveDirectory;
+class QThreadPool;
 
 class KMessageWidget;
 
@@ -44,6 +46,8 @@ private Q_SLOTS:
     void slotCheckSpace();
     bool slotStartArchiving(bool firstPass = true);
     void slotArchivingFinished(KJob *job = nullptr, bool finished = false);
+    /** @brief Called when one of the parallel copy streams finished */
+    void slotCopyJobDone(KJob *job);
     void slotArchivingProgress(KJob *, qulonglong);
     void done(int r) Q_DECL_OVERRIDE;
     bool closeAccepted();
@@ -72,7 +76,12 @@ private:
         IsInTimelineRole,
     };
     KIO::filesize_t m_requestedSize, m_timelineSize, m_subtitlesSize;
-    KIO::CopyJob *m_copyJob;
+    /** @brief The currently running copy streams (files are copied with several parallel jobs) */
+    QList<KIO::CopyJob *> m_copyJobs;
+    /** @brief Processed bytes for each running copy job, used to aggregate progress */
+    QHash<KJob *, KIO::filesize_t> m_copyProgress;
+    /** @brief Bytes copied by finished jobs, or skipped because a previous run already archived them */
+    KIO::filesize_t m_copiedSize{0};
     QMap<QUrl, QUrl> m_duplicateFiles;
     QMap<QUrl, QUrl> m_replacementList;
     QString m_name;
@@ -118,6 +127,9 @@ private:
     void propertyProcessUrl(const QDomElement &e, const QString &propertyName, const QString &root);
     /** @brief Calculate required size for archiving */
     void updateRequiredSize();
+    /** @brief Extract @param archiveDir into @param dest, decoding the archive on the calling
+     *  thread while the file writes run in parallel on @param writePool */
+    bool extractArchiveDirectory(const KArchiveDirectory *archiveDir, const QString &dest, QThreadPool &writePool);
 
 Q_SIGNALS:
     void archivingFinished(bool, const QString &);
@@ -5,6 +5,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 
 #include "projectmanager.h"
 #include "bin/bin.h"
+#include "bin/mediaindex.h"
 #include "bin/projectclip.h"
 #include "bin/projectitemmodel.h"
 #include "core.h"
@@ -66,7 +67,7 @@ static QString getProjectNameFilters(bool ark = true)
 {
     QString filter = i18n("Kdenlive Project") + QStringLiteral(" (*.kdenlive)");
     if (ark) {
-        filter.append(";;" + i18n("Archived Project") + QStringLiteral(" (*.tar.gz *.zip)"));
+        filter.append(";;" + i18n("Archived Project") + QStringLiteral(" (*.tar.gz *.tar.zst *.zip)"));
     }
     return filter;
 }
@@ -432,6 +433,8 @@ bool ProjectManager::closeCurrentDocument(bool saveChanges, bool quit)
 {
     // Disable autosave
     m_autoSaveTimer.stop();
+    m_renderSnapshot.clear();
+    m_renderSnapshotIndex = -1;
     if ((m_project != nullptr) && m_project->isModified() && saveChanges) {
         QString message;
         if (m_project->url().fileName().isEmpty()) {
@@ -473,6 +476,8 @@ bool ProjectManager::closeCurrentDocument(bool saveChanges, bool quit)
     }
     if (m_project) {
         pCore->taskManager.slotCancelJobs(true);
+        // Persist the probed media metadata for the next session
+        MediaIndex::saveIndex();
         m_project->closing = true;
         if (m_activeTimelineModel) {
             m_activeTimelineModel->m_closing = true;
@@ -571,6 +576,8 @@ bool ProjectManager::saveFileAs(const QString &outputFileName, bool saveOverExis
         // This timer is set by KdenliveDoc::setModified()
         const QString projectId = QCryptographicHash::hash(url.fileName().toUtf8(), QCryptographicHash::Md5).toHex();
         QUrl autosaveUrl = QUrl::fromLocalFile(QFileInfo(outputFileName).absoluteDir().absoluteFilePath(projectId + QStringLiteral(".kdenlive")));
+        // An autosave worker may still be writing the file, see KdenliveDoc::slotAutoSave()
+        m_project->m_autosaveFuture.waitForFinished();
         if (m_project->m_autosave == nullptr) {
             // The temporary file is not opened or created until actually needed.
             // The file filename does not have to exist for KAutoSaveFile to be constructed (if it exists, it will not be touched).
@@ -674,6 +681,8 @@ bool ProjectManager::saveFile()
         return saveFileAs();
     }
     bool result = saveFileAs(m_project->url().toLocalFile());
+    // Wait for any in-flight autosave write before truncating the file
+    m_project->m_autosaveFuture.waitForFinished();
     m_project->m_autosave->resize(0);
     return result;
 }
@@ -1161,8 +1170,12 @@ KRecentFilesAction *ProjectManager::recentFilesAction()
 
 void ProjectManager::slotStartAutoSave()
 {
-    if (m_lastSave.elapsed() > 300000) {
-        // If the project was not saved in the last 5 minute, force save
+    if (m_lastSave.elapsed() > 60000) {
+        // The debounce timer below restarts on every edit, so continuous cutting can
+        // postpone the autosave indefinitely. Bound the potential loss window by
+        // forcing a save once a minute of unsaved editing has accumulated; the write
+        // itself is deduplicated and runs in a worker thread, so the recurring cost
+        // of the forced saves stays small.
         m_autoSaveTimer.stop();
         slotAutoSave();
     } else {
@@ -1179,6 +1192,8 @@ void ProjectManager::slotAutoSave()
     prepareSave();
     QString saveFolder = m_project->url().adjusted(QUrl::RemoveFilename | QUrl::StripTrailingSlash).toLocalFile();
     QString scene = projectSceneList(saveFolder);
+    // Implicitly shared copy taken before the replacement patterns are applied below
+    const QString renderScene = scene;
     if (!m_replacementPattern.isEmpty()) {
         QMapIterator<QString, QString> i(m_replacementPattern);
         while (i.hasNext()) {
@@ -1191,6 +1206,11 @@ void ProjectManager::slotAutoSave()
         pCore->displayMessage(i18n("Project was corrupted, cannot backup. Please close and reopen your project file to recover last backup"), ErrorMessage);
         return;
     }
+    // Keep this scene as a speculative render playlist: if no edit happens before the next
+    // render, hitting render can skip the costly scene generation
+    m_renderSnapshot = renderScene;
+    m_renderSnapshotFolder = saveFolder;
+    m_renderSnapshotIndex = m_project->commandStack() ? m_project->commandStack()->index() : -1;
     m_project->slotAutoSave(scene);
     m_lastSave.start();
 }
@@ -1232,6 +1252,17 @@ QString ProjectManager::projectSceneList(const QString &outputFolder, const QStr
     return scene;
 }
 
+QString ProjectManager::renderSceneList(const QString &outputFolder, const QString &overlayData, const QString &aspectRatio)
+{
+    // The autosave snapshot matches the default render parameters only
+    if (overlayData.isEmpty() && aspectRatio.isEmpty() && !m_renderSnapshot.isEmpty() && outputFolder == m_renderSnapshotFolder && m_project &&
+        !m_autoSaveTimer.isActive() && m_project->commandStack() && m_renderSnapshotIndex == m_project->commandStack()->index()) {
+        // No edit since the last autosave, reuse its scene and start encoding immediately
+        return m_renderSnapshot;
+    }
+    return projectSceneList(outputFolder, overlayData, aspectRatio);
+}
+
 void ProjectManager::setDocumentNotes(const QString &notes)
 {
     if (m_notesPlugin) {
@@ -1882,6 +1913,11 @@ bool ProjectManager::openTimeline(const QString &id, int ix, const QUuid &uuid,
     if (!duplicate && existingModel == nullptr) {
         existingModel = m_project->getTimeline(uuid, true);
     }
+    if (!duplicate && existingModel == nullptr && pCore->window()) {
+        // A recently closed tab may still hold the model and its QML scene, reusing
+        // it makes reopening the sequence instant
+        existingModel = pCore->window()->retiredTimelineModel(uuid);
+    }
 
     // Disable autosave while creating timelines
     m_autoSaveTimer.stop();
@@ -2172,7 +2208,9 @@ void ProjectManager::slotCreateSequenceFromSelection()
     std::function<bool(void)> redo = []() { return true; };
     int aTracks = -1;
     int vTracks = -1;
-    std::pair<int, QString> copiedData = pCore->window()->getCurrentTimeline()->controller()->getCopyItemData();
+    // Keep the copied selection as a DOM document; serializing it to a string and re-parsing
+    // it on paste is pointless inside the same process and stalls on large selections
+    std::pair<int, QDomDocument> copiedData = pCore->window()->getCurrentTimeline()->controller()->getCopyItemDataDom();
     if (copiedData.first == -1) {
         pCore->displayMessage(i18n("Select a clip to create sequence"), InformationMessage);
         return;
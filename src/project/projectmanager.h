@@ -68,6 +68,10 @@ public:
      * @param aspectRation The aspect ratio for the project (e.g. square).
      */
     QString projectSceneList(const QString &outputFolder, const QString &overlayData = QString(), const QString &aspectRation = QString());
+    /** @brief Returns a render-ready project scene, reusing the snapshot cached by the last autosave
+     *  when the project was not edited since, so starting a render skips the scene generation.
+     */
+    QString renderSceneList(const QString &outputFolder, const QString &overlayData = QString(), const QString &aspectRation = QString());
     /** @brief returns a default hd profile depending on timezone*/
     static QString getDefaultProjectFormat();
     void saveZone(const QStringList &info, const QDir &dir);
@@ -258,6 +262,10 @@ private:
     QUrl m_startUrl;
     QString m_loadClipsOnOpen;
     QMap<QString, QString> m_replacementPattern;
+    /** @brief Render-ready scene cached by the last autosave, and the undo stack index it reflects */
+    QString m_renderSnapshot;
+    QString m_renderSnapshotFolder;
+    int m_renderSnapshotIndex{-1};
 
     QAction *m_fileRevert;
     KRecentFilesAction *m_recentFilesAction;
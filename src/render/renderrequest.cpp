@@ -13,7 +13,16 @@
 #include "utils/qstringutils.h"
 #include "xml/xml.hpp"
 
+#include <QCryptographicHash>
+#include <QHash>
+#include <QMutexLocker>
 #include <QTemporaryFile>
+#include <QTextStream>
+
+#ifdef Q_OS_LINUX
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 // TODO: remove, see generatePlaylistFile()
 #include <KMessageBox>
@@ -23,6 +32,56 @@
 #include "doc/docundostack.hpp"
 #include <QUndoGroup>
 
+namespace {
+// File descriptors of the memory-backed scene lists currently handed to render
+// processes, keyed by the job's output file
+QMutex memoryPlaylistMutex;
+QHash<QString, int> memoryPlaylistFds;
+} // namespace
+
+QString RenderRequest::writeMemoryPlaylist(const QDomDocument &doc, const QString &outputFile)
+{
+#ifdef Q_OS_LINUX
+    int fd = memfd_create("kdenlive-scenelist", MFD_CLOEXEC);
+    if (fd < 0) {
+        return {};
+    }
+    const QByteArray content = doc.toString().toUtf8();
+    qint64 written = 0;
+    while (written < content.size()) {
+        ssize_t count = write(fd, content.constData() + written, size_t(content.size() - written));
+        if (count < 0) {
+            close(fd);
+            return {};
+        }
+        written += count;
+    }
+    QMutexLocker lock(&memoryPlaylistMutex);
+    // A job queued behind another render can replace its own pending scene list
+    if (memoryPlaylistFds.contains(outputFile)) {
+        close(memoryPlaylistFds.value(outputFile));
+    }
+    memoryPlaylistFds.insert(outputFile, fd);
+    return QStringLiteral("/proc/%1/fd/%2").arg(QCoreApplication::applicationPid()).arg(fd);
+#else
+    Q_UNUSED(doc)
+    Q_UNUSED(outputFile)
+    return {};
+#endif
+}
+
+void RenderRequest::releaseMemoryPlaylist(const QString &outputFile)
+{
+#ifdef Q_OS_LINUX
+    QMutexLocker lock(&memoryPlaylistMutex);
+    if (memoryPlaylistFds.contains(outputFile)) {
+        close(memoryPlaylistFds.take(outputFile));
+    }
+#else
+    Q_UNUSED(outputFile)
+#endif
+}
+
 QStringList RenderRequest::argsByJob(const RenderJob &job)
 {
     QStringList args = {QStringLiteral("delivery"), KdenliveSettings::meltpath(), job.playlistPath, QStringLiteral("--pid"),
@@ -30,6 +89,18 @@ QStringList RenderRequest::argsByJob(const RenderJob &job)
     if (!job.subtitlePath.isEmpty()) {
         args << QStringLiteral("--subtitle") << job.subtitlePath;
     }
+    if (KdenliveSettings::renderchunks() > 1) {
+        args << QStringLiteral("--chunks") << QString::number(KdenliveSettings::renderchunks());
+    }
+    if (KdenliveSettings::rendernumapin()) {
+        args << QStringLiteral("--numa");
+    }
+    if (job.normalizeAudio) {
+        args << QStringLiteral("--loudness");
+    }
+    for (const QString &stem : job.stemPlaylists) {
+        args << QStringLiteral("--stem") << stem;
+    }
     return args;
 }
 
@@ -104,6 +175,11 @@ void RenderRequest::setAudioFilePerTrack(bool enabled)
     m_audioFilePerTrack = enabled;
 }
 
+void RenderRequest::setNormalizeAudio(bool enabled)
+{
+    m_normalizeAudio = enabled;
+}
+
 void RenderRequest::setGuideParams(std::weak_ptr<MarkerListModel> model, bool enableMultiExport, int filterCategory)
 {
     m_guidesModel = std::move(model);
@@ -144,7 +220,7 @@ std::vector<RenderRequest::RenderJob> RenderRequest::process()
     }
 
     QString playlistContent =
-        pCore->projectManager()->projectSceneList(project->url().adjusted(QUrl::RemoveFilename | QUrl::StripTrailingSlash).toLocalFile(), m_overlayData, m_aspectRatio);
+        pCore->projectManager()->renderSceneList(project->url().adjusted(QUrl::RemoveFilename | QUrl::StripTrailingSlash).toLocalFile(), m_overlayData, m_aspectRatio);
 
     QDomDocument doc;
     doc.setContent(playlistContent);
@@ -227,11 +303,18 @@ std::vector<RenderRequest::RenderJob> RenderRequest::process()
 void RenderRequest::createRenderJobs(std::vector<RenderJob> &jobs, const QDomDocument &doc, const QString &playlistPath, QString outputPath,
                                      const QString &subtitlePath, const QUuid &uuid)
 {
+    // Hash the section playlist before target and two pass params are applied, so
+    // that all passes of one export share the same hash. The hash covers the full
+    // timeline content, the section in/out and the preset params, so any change
+    // that could affect the rendered file changes the hash.
+    const QString playlistHash = QString::fromLatin1(QCryptographicHash::hash(doc.toString().toUtf8(), QCryptographicHash::Md5).toHex());
+
+    std::vector<RenderJob> stemJobs;
     if (m_audioFilePerTrack) {
         if (m_delayedRendering) {
             addErrorMessage(i18n("Script rendering and multi track audio export can not be used together. Script will be saved without multi track export."));
         } else {
-            prepareMultiAudioFiles(jobs, doc, playlistPath, outputPath, uuid);
+            prepareMultiAudioFiles(stemJobs, doc, playlistPath, outputPath, playlistHash, uuid);
         }
     }
 
@@ -244,6 +327,7 @@ void RenderRequest::createRenderJobs(std::vector<RenderJob> &jobs, const QDomDoc
     }
 
     int passes = m_twoPass ? 2 : 1;
+    const size_t firstJobIndex = jobs.size();
 
     for (int i = 0; i < passes; i++) {
         // clone the dom if this is not the first iteration (happens with two pass)
@@ -254,6 +338,9 @@ void RenderRequest::createRenderJobs(std::vector<RenderJob> &jobs, const QDomDoc
         job.playlistPath = playlistPath;
         job.outputPath = outputPath;
         job.subtitlePath = subtitlePath;
+        job.playlistHash = playlistHash;
+        // The first pass of a two pass encode skips the audio, analysing its loudness would be wasted work
+        job.normalizeAudio = m_normalizeAudio && pass != 1;
         if (pass == 2) {
             job.playlistPath = QStringUtils::appendToFilename(job.playlistPath, QStringLiteral("-pass%1").arg(2));
         }
@@ -268,11 +355,33 @@ void RenderRequest::createRenderJobs(std::vector<RenderJob> &jobs, const QDomDoc
         // Set two pass parameters. In case pass is 0 the function does nothing.
         setDocTwoPassParams(pass, final, job.outputPath);
 
+        if (KdenliveSettings::rendermemoryplaylist() && !m_delayedRendering && !m_twoPass) {
+            // Hand the scene list over a memory-backed file, skipping the
+            // serialize-to-disk/parse-from-disk round trip. Not for delayed rendering
+            // (the script must outlive this process) or two pass encodes (the render
+            // queue pairs the passes by their on-disk playlist names).
+            const QString memoryPath = writeMemoryPlaylist(final, job.outputPath);
+            if (!memoryPath.isEmpty()) {
+                jobs.back().playlistPath = memoryPath;
+                continue;
+            }
+            // Memory-backed files unavailable, fall back to the on-disk playlist
+        }
         if (!Xml::docContentToFile(final, job.playlistPath)) {
             addErrorMessage(i18n("Cannot write to file %1", job.playlistPath));
             return;
         }
     }
+
+    if (!stemJobs.empty() && jobs.size() > firstJobIndex) {
+        // Attach the per track scene lists to the main job instead of queueing them
+        // as independent renders: the render process encodes them concurrently with
+        // the main delivery, so a multi stem export costs one timeline pass in wall
+        // clock time instead of one queued render per stem.
+        for (const auto &stemJob : stemJobs) {
+            jobs[firstJobIndex].stemPlaylists << stemJob.playlistPath;
+        }
+    }
 }
 
 QString RenderRequest::createEmptyTempFile(const QString &extension)
@@ -351,6 +460,14 @@ void RenderRequest::setDocGeneralParams(QDomDocument doc, int in, int out)
         consumer.setAttribute(it.key(), it.value());
     }
 
+    if (m_presetParams.isAudioOnly()) {
+        // Audio-only render: most presets only disable the video stream (vn), which still
+        // makes the consumer composite every video frame before the muxer discards it.
+        // Turning video frame construction off makes a mixdown decode audio only
+        consumer.setAttribute(QStringLiteral("vn"), 1);
+        consumer.setAttribute(QStringLiteral("video_off"), 1);
+    }
+
     // Insert consumer to document, after the profiles (if they exist)
     QDomNodeList profiles = doc.elementsByTagName(QStringLiteral("profile"));
     if (profiles.isEmpty()) {
@@ -443,7 +560,7 @@ std::vector<RenderRequest::RenderSection> RenderRequest::getGuideSections()
 }
 
 void RenderRequest::prepareMultiAudioFiles(std::vector<RenderJob> &jobs, const QDomDocument &doc, const QString &playlistFile, const QString &targetFile,
-                                           const QUuid &uuid)
+                                           const QString &playlistHash, const QUuid &uuid)
 {
     int audioCount = 0;
     QDomNodeList orginalTractors = doc.elementsByTagName(QStringLiteral("tractor"));
@@ -484,6 +601,7 @@ void RenderRequest::prepareMultiAudioFiles(std::vector<RenderJob> &jobs, const Q
         RenderJob job;
         job.playlistPath = QStringUtils::appendToFilename(playlistFile, appendix);
         job.outputPath = QStringUtils::appendToFilename(targetFile, appendix);
+        job.playlistHash = playlistHash;
         jobs.push_back(job);
 
         // init doc copy
@@ -522,6 +640,70 @@ void RenderRequest::prepareMultiAudioFiles(std::vector<RenderJob> &jobs, const Q
     }
 }
 
+static QString renderHashStorePath()
+{
+    bool ok = false;
+    QDir cacheDir = pCore->currentDoc()->getCacheDir(CacheBase, &ok);
+    if (!ok) {
+        return {};
+    }
+    return cacheDir.absoluteFilePath(QStringLiteral("renderhashes"));
+}
+
+QString RenderRequest::storedRenderHash(const QString &outputFile)
+{
+    const QString storePath = renderHashStorePath();
+    if (storePath.isEmpty()) {
+        return {};
+    }
+    QFile store(storePath);
+    if (!store.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return {};
+    }
+    QTextStream stream(&store);
+    QString line;
+    while (stream.readLineInto(&line)) {
+        if (line.section(QLatin1Char('\t'), 1) == outputFile) {
+            return line.section(QLatin1Char('\t'), 0, 0);
+        }
+    }
+    return {};
+}
+
+void RenderRequest::storeRenderHash(const QString &outputFile, const QString &hash)
+{
+    const QString storePath = renderHashStorePath();
+    if (storePath.isEmpty()) {
+        return;
+    }
+    QStringList entries;
+    QFile store(storePath);
+    if (store.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        QTextStream stream(&store);
+        QString line;
+        while (stream.readLineInto(&line)) {
+            if (!line.isEmpty() && line.section(QLatin1Char('\t'), 1) != outputFile) {
+                entries << line;
+            }
+        }
+        store.close();
+    }
+    if (!hash.isEmpty()) {
+        entries << QStringLiteral("%1\t%2").arg(hash, outputFile);
+    }
+    // Keep the store small, drop the oldest entries
+    while (entries.count() > 100) {
+        entries.removeFirst();
+    }
+    if (!store.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return;
+    }
+    QTextStream stream(&store);
+    for (const QString &entry : qAsConst(entries)) {
+        stream << entry << QLatin1Char('\n');
+    }
+}
+
 void RenderRequest::addErrorMessage(const QString &error)
 {
     m_errors.append(error);
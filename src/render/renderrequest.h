@@ -19,6 +19,16 @@ public:
         QString playlistPath;
         QString outputPath;
         QString subtitlePath;
+        /** @brief Hash of the section playlist (content, range and preset params),
+         *  used to skip re-encoding sections that are unchanged since the last
+         *  successful render to the same output file. */
+        QString playlistHash;
+        /** @brief Normalize the audio loudness to EBU R128 during the encode. */
+        bool normalizeAudio = false;
+        /** @brief Extra scene lists (one per audio stem) encoded by the same render
+         *  process concurrently with the main delivery. Each stem playlist mutes the
+         *  other tracks and carries its own consumer target. */
+        QStringList stemPlaylists;
     };
 
     /** @brief Set frame range that should be rendered
@@ -36,6 +46,8 @@ public:
     void setTwoPass(bool enabled);
     void setAspectRatio(const QString &aspectRatio);
     void setAudioFilePerTrack(bool enabled);
+    /** @brief Normalize the audio loudness of the rendered file to EBU R128 */
+    void setNormalizeAudio(bool enabled);
     void setGuideParams(std::weak_ptr<MarkerListModel> model, bool enableMultiExport, int filterCategory);
     void setOverlayData(const QString &data);
 
@@ -45,6 +57,16 @@ public:
 
     static QStringList argsByJob(const RenderJob &job);
 
+    /** @brief Returns the playlist hash stored for the last successful render to @param outputFile, or an empty string. */
+    static QString storedRenderHash(const QString &outputFile);
+    /** @brief Remember @param hash as the playlist hash of a successful render to @param outputFile.
+     *  An empty @param hash removes the stored entry (e.g. after a failed render). */
+    static void storeRenderHash(const QString &outputFile, const QString &hash);
+
+    /** @brief Close the memory-backed scene list handed to the render job targeting @param outputFile, if any.
+     *  Called once the render process reported having picked the scene list up. */
+    static void releaseMemoryPlaylist(const QString &outputFile);
+
 private:
     struct RenderSection
     {
@@ -67,6 +89,7 @@ private:
     bool m_guideMultiExport = false;
     int m_guideCategory = -1; /// category used as filter if @variable guideMultiExport is @value true
     bool m_twoPass = false;
+    bool m_normalizeAudio = false;
 
     QStringList m_errors;
 
@@ -74,10 +97,16 @@ private:
     void setDocTwoPassParams(int pass, QDomDocument &doc, const QString &outputFile);
     std::vector<RenderSection> getGuideSections();
     static void prepareMultiAudioFiles(std::vector<RenderJob> &jobs, const QDomDocument &doc, const QString &playlistFile, const QString &targetFile,
-                                       const QUuid &uuid);
+                                       const QString &playlistHash, const QUuid &uuid);
 
     static QString createEmptyTempFile(const QString &extension);
 
+    /** @brief Write @param doc to an anonymous memory-backed file and @returns its /proc path, skipping
+     *  the serialize-to-disk round trip of large scene lists. The file descriptor stays open (keyed by
+     *  @param outputFile) until releaseMemoryPlaylist() is called, so the path remains readable by the
+     *  render process. Returns an empty string when memory-backed files are unsupported. */
+    static QString writeMemoryPlaylist(const QDomDocument &doc, const QString &outputFile);
+
     /** @brief Create a new empty playlist (*.mlt) file and @returns the filename of the created file.
      *  This is different to @fn createEmptyTempFile since it also takes delayed rendering in to account
      *  and hence might create a persistent file instead of a temp file.
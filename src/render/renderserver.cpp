@@ -6,6 +6,7 @@
 #include "renderserver.h"
 #include "core.h"
 #include "mainwindow.h"
+#include "render/renderrequest.h"
 #include <KLocalizedString>
 #include <QCoreApplication>
 #include <QJsonDocument>
@@ -24,6 +25,7 @@ RenderServer::RenderServer(QObject *parent)
     }
     connect(pCore->window(), &MainWindow::abortRenderJob, this, &RenderServer::abortJob);
     connect(this, &RenderServer::setRenderingProgress, pCore->window(), &MainWindow::setRenderingProgress);
+    connect(this, &RenderServer::setRenderingAudioLevels, pCore->window(), &MainWindow::setRenderingAudioLevels);
     connect(this, &RenderServer::setRenderingFinished, pCore->window(), &MainWindow::setRenderingFinished);
 }
 
@@ -67,12 +69,20 @@ void RenderServer::handleJson(const QJsonObject &json, QLocalSocket *socket)
         const auto url = json["setRenderingProgress"]["url"].toString();
         const auto progress = json["setRenderingProgress"]["progress"].toInt();
         const auto frame = json["setRenderingProgress"]["frame"].toInt();
+        // The render process picked the scene list up, we can drop our memory-backed copy
+        RenderRequest::releaseMemoryPlaylist(url);
         Q_EMIT setRenderingProgress(url, progress, frame);
     }
+    if (json.contains("setRenderingAudioLevels")) {
+        const auto url = json["setRenderingAudioLevels"]["url"].toString();
+        const auto levels = QByteArray::fromBase64(json["setRenderingAudioLevels"]["levels"].toString().toLatin1());
+        Q_EMIT setRenderingAudioLevels(url, levels);
+    }
     if (json.contains("setRenderingFinished")) {
         const auto url = json["setRenderingFinished"]["url"].toString();
         const auto status = json["setRenderingFinished"]["status"].toInt();
         const auto error = json["setRenderingFinished"]["error"].toString();
+        RenderRequest::releaseMemoryPlaylist(url);
         Q_EMIT setRenderingFinished(url, status, error);
         m_jobSocket.remove(url);
     }
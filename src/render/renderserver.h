@@ -20,6 +20,7 @@ public:
 
 Q_SIGNALS:
     void setRenderingProgress(const QString &url, int progress, int frame);
+    void setRenderingAudioLevels(const QString &url, const QByteArray &levels);
     void setRenderingFinished(const QString &url, int status, const QString &error);
 
 public Q_SLOTS:
@@ -175,6 +175,15 @@ bool RenderPresetParams::isX265()
     return value(QStringLiteral("vcodec")).toLower() == QStringLiteral("libx265");
 }
 
+bool RenderPresetParams::isAudioOnly()
+{
+    if (contains(QStringLiteral("vn")) || value(QStringLiteral("video_off")).toInt() == 1) {
+        return true;
+    }
+    // The WAV preset takes its parameters from an MLT properties preset
+    return value(QStringLiteral("properties")) == QLatin1String("WAV");
+}
+
 RenderPresetModel::RenderPresetModel(QDomElement preset, const QString &presetFile, bool editable, const QString &groupName, const QString &renderer)
     : m_presetFile(presetFile)
     , m_editable(editable)
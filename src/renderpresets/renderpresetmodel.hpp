@@ -27,6 +27,8 @@ public:
     bool hasAlpha();
     bool isImageSequence();
     bool isX265();
+    /** @brief Returns true if the preset does not produce a video stream */
+    bool isAudioOnly();
 };
 
 /** @class RenderPresetModel
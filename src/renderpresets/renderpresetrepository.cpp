@@ -11,9 +11,12 @@
 #include "xml/xml.hpp"
 #include <KLocalizedString>
 #include <KMessageBox>
+#include <QDateTime>
 #include <QDir>
+#include <QFileInfo>
 #include <QInputDialog>
 #include <QStandardPaths>
+#include <QtConcurrent>
 #include <algorithm>
 #include <mlt++/MltConsumer.h>
 #include <mlt++/MltProfile.h>
@@ -28,6 +31,31 @@ std::vector<std::pair<int, QString>> RenderPresetRepository::colorProfiles{{601,
 QStringList RenderPresetRepository::m_acodecsList;
 QStringList RenderPresetRepository::m_vcodecsList;
 QStringList RenderPresetRepository::m_supportedFormats;
+std::mutex RenderPresetRepository::m_codecMutex;
+
+/** @brief Returns the path of the file caching the probed codec capabilities */
+static QString codecCachePath()
+{
+    QDir dir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation));
+    if (!dir.exists()) {
+        dir.mkpath(QStringLiteral("."));
+    }
+    return dir.absoluteFilePath(QStringLiteral("codeccapabilities"));
+}
+
+/** @brief Returns a key identifying the current MLT install, used to detect a stale codec cache */
+static QString codecCacheKey()
+{
+    const QString meltPath = KdenliveSettings::meltpath();
+    if (meltPath.isEmpty()) {
+        return {};
+    }
+    QFileInfo info(meltPath);
+    if (!info.exists()) {
+        return {};
+    }
+    return QString("%1:%2").arg(meltPath).arg(info.lastModified().toSecsSinceEpoch());
+}
 
 RenderPresetRepository::RenderPresetRepository()
 {
@@ -40,12 +68,40 @@ std::unique_ptr<RenderPresetRepository> &RenderPresetRepository::get()
     return instance;
 }
 
+// static
+void RenderPresetRepository::warmCodecCache()
+{
+    // Load (or build) the codec lists in a worker thread so that the first render dialog
+    // opens without waiting for the avformat consumer probe
+    (void)QtConcurrent::run(&RenderPresetRepository::checkCodecs, false);
+}
+
 // static
 void RenderPresetRepository::checkCodecs(bool forceRefresh)
 {
+    std::unique_lock<std::mutex> lock(m_codecMutex);
     if (!(m_acodecsList.isEmpty() || m_vcodecsList.isEmpty() || m_supportedFormats.isEmpty() || forceRefresh)) {
         return;
     }
+    const QString cacheKey = codecCacheKey();
+    if (!forceRefresh && !cacheKey.isEmpty()) {
+        // Try the cached capabilities first, probing the avformat consumer takes a while
+        QFile cacheFile(codecCachePath());
+        if (cacheFile.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            QTextStream in(&cacheFile);
+            if (in.readLine() == cacheKey) {
+                const QStringList formats = in.readLine().split(QLatin1Char(' '), Qt::SkipEmptyParts);
+                const QStringList acodecs = in.readLine().split(QLatin1Char(' '), Qt::SkipEmptyParts);
+                const QStringList vcodecs = in.readLine().split(QLatin1Char(' '), Qt::SkipEmptyParts);
+                if (!formats.isEmpty() && !acodecs.isEmpty() && !vcodecs.isEmpty()) {
+                    m_supportedFormats = formats;
+                    m_acodecsList = acodecs;
+                    m_vcodecsList = vcodecs;
+                    return;
+                }
+            }
+        }
+    }
     Mlt::Profile p;
     auto *consumer = new Mlt::Consumer(p, "avformat");
     if (consumer) {
@@ -73,6 +129,18 @@ void RenderPresetRepository::checkCodecs(bool forceRefresh)
             m_supportedFormats << QString(formats.get(i));
         }
         delete consumer;
+        if (!cacheKey.isEmpty() && !m_supportedFormats.isEmpty()) {
+            // Remember the capabilities so the next sessions can skip the probe; the key
+            // invalidates the cache whenever the MLT install changes
+            QFile cacheFile(codecCachePath());
+            if (cacheFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+                QTextStream out(&cacheFile);
+                out << cacheKey << "\n";
+                out << m_supportedFormats.join(QLatin1Char(' ')) << "\n";
+                out << m_acodecsList.join(QLatin1Char(' ')) << "\n";
+                out << m_vcodecsList.join(QLatin1Char(' ')) << "\n";
+            }
+        }
     }
 }
 
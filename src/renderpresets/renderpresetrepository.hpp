@@ -43,6 +43,11 @@ public:
      */
     bool presetExists(const QString &name) const;
 
+    /** @brief Loads the codec capability lists in a background thread (from the on-disk cache
+     *  when it matches the installed MLT, probing the avformat consumer otherwise), so that
+     *  the render dialog does not block on the probe when it is first opened */
+    static void warmCodecCache();
+
     static QStringList acodecs()
     {
         checkCodecs();
@@ -83,6 +88,8 @@ protected:
     static QStringList m_acodecsList;
     static QStringList m_vcodecsList;
     static QStringList m_supportedFormats;
+    /** @brief Protects the codec capability lists, which may be filled from a worker thread */
+    static std::mutex m_codecMutex;
 
     mutable QReadWriteLock m_mutex;
 
@@ -146,7 +146,8 @@ QImage AudioSpectrum::renderBackground(uint)
     return QImage();
 }
 
-QImage AudioSpectrum::renderAudioScope(uint, const audioShortVector &audioFrame, const int freq, const int num_channels, const int num_samples, const int)
+QImage AudioSpectrum::renderAudioScope(uint, const audioShortVector &audioFrame, const int freq, const int num_channels, const int num_samples,
+                                       const int newData)
 {
     if (audioFrame.size() > 63 && m_innerScopeRect.width() > 0 && m_innerScopeRect.height() > 0 // <= 0 if widget is too small (resized by user)
     ) {
@@ -201,17 +202,20 @@ QImage AudioSpectrum::renderAudioScope(uint, const audioShortVector &audioFrame,
         m_ui->labelFFTSizeNumber->setText(QVariant(fftWindow).toString());
 
         // Get the spectral power distribution of the input samples,
-        // using the given window size and function
-        auto *freqSpectrum = new float[uint(fftWindow) / 2];
+        // using the given window size and function. A simple refresh (e.g. after
+        // a changed dB or frequency scale) comes without new audio data; the
+        // previous window is still valid then and only the interpolation below
+        // depends on the changed parameters, so skip the FFT in that case.
         FFTTools::WindowType windowType = FFTTools::WindowType(m_ui->windowFunction->itemData(m_ui->windowFunction->currentIndex()).toInt());
-        m_fftTools.fftNormalized(audioFrame, 0, uint(num_channels), freqSpectrum, windowType, uint(fftWindow), 0);
 
-        // Store the current FFT window (for the HUD) and run the interpolation
+        // Keep the current FFT window around for the HUD and run the interpolation
         // for easy pixel-based dB value access
         QVector<float> dbMap;
         m_lastFFTLock.acquire();
-        m_lastFFT = QVector<float>(fftWindow / 2);
-        memcpy(m_lastFFT.data(), &(freqSpectrum[0]), uint(fftWindow) / 2 * sizeof(float));
+        if (newData > 0 || m_lastFFT.size() != fftWindow / 2) {
+            m_lastFFT = QVector<float>(fftWindow / 2);
+            m_fftTools.fftNormalized(audioFrame, 0, uint(num_channels), m_lastFFT.data(), windowType, uint(fftWindow), 0);
+        }
 
         uint right = uint(m_freqMax / (m_freq / 2.) * (m_lastFFT.size() - 1));
         dbMap = FFTTools::interpolatePeakPreserving(m_lastFFT, uint(m_innerScopeRect.width()), 0, right, -180);
@@ -220,7 +224,6 @@ QImage AudioSpectrum::renderAudioScope(uint, const audioShortVector &audioFrame,
 #ifdef DEBUG_AUDIOSPEC
         QTime drawTime = QTime::currentTime();
 #endif
-        delete[] freqSpectrum;
         // Draw the spectrum
         QImage spectrum(m_scopeRect.size(), QImage::Format_ARGB32);
         spectrum.fill(qRgba(0, 0, 0, 0));
@@ -384,17 +384,39 @@ QImage Spectrogram::renderAudioScope(uint, const audioShortVector &audioFrame, c
         if ((newData != 0) || m_parameterChanged) {
             m_parameterChanged = false;
 
-            QVector<float> dbMap;
-            uint right;
-            ////////////////FIXME
+            if (m_interpolatedWidth != m_innerScopeRect.width() || m_interpolatedFreqMax != m_freqMax || m_interpolatedFreq != m_freq) {
+                // The scope width or the frequency range changed, the resampled lines no longer match
+                m_interpolatedHistory.clear();
+                m_interpolatedWidth = m_innerScopeRect.width();
+                m_interpolatedFreqMax = m_freqMax;
+                m_interpolatedFreq = m_freq;
+            } else if (newDataAvailable && !m_interpolatedHistory.isEmpty()) {
+                // Keep the resampled lines aligned with the history, which just got a new first column
+                const QVector<float> &newest = m_fftHistory.constFirst();
+                const uint right = uint(m_freqMax / (m_freq / 2.f) * (newest.size() - 1));
+                m_interpolatedHistory.prepend(FFTTools::interpolatePeakPreserving(newest, uint(m_innerScopeRect.width()), 0, right, -180));
+                while (m_interpolatedHistory.size() > m_fftHistory.size()) {
+                    m_interpolatedHistory.removeLast();
+                }
+            }
+
+            const bool highlightPeaks = m_aHighlightPeaks->isChecked();
+            const QRgb peakColor = AbstractScopeWidget::colHighlightDark.rgba();
+            int line = 0;
             for (auto &it : m_fftHistory) {
 
-                int windowSize = it.size();
+                if (line >= m_interpolatedHistory.size()) {
+                    int windowSize = it.size();
 
-                // Interpolate the frequency data to match the pixel coordinates
-                right = uint(m_freqMax / (m_freq / 2.f) * (windowSize - 1));
-                dbMap = FFTTools::interpolatePeakPreserving(it, uint(m_innerScopeRect.width()), 0, right, -180);
+                    // Interpolate the frequency data to match the pixel coordinates.
+                    // Only depends on the scope width and frequency range, so the result is
+                    // cached; a dB range drag just re-applies the colormap below
+                    const uint right = uint(m_freqMax / (m_freq / 2.f) * (windowSize - 1));
+                    m_interpolatedHistory.append(FFTTools::interpolatePeakPreserving(it, uint(m_innerScopeRect.width()), 0, right, -180));
+                }
+                const QVector<float> &dbMap = m_interpolatedHistory.at(line);
 
+                QRgb *row = reinterpret_cast<QRgb *>(spectrum.scanLine(topDist + h - 1 - y)) + leftDist;
                 for (int i = 0; i < dbMap.size(); ++i) {
                     float val;
                     val = dbMap[i];
@@ -407,14 +429,15 @@ QImage Spectrogram::renderAudioScope(uint, const audioShortVector &audioFrame, c
                     } else if (val > 1) {
                         val = 1;
                     }
-                    if (!peak || !m_aHighlightPeaks->isChecked()) {
-                        spectrum.setPixel(leftDist + i, topDist + h - 1 - y, m_colorMap[int(val * 255)]);
+                    if (!peak || !highlightPeaks) {
+                        row[i] = m_colorMap[int(val * 255)];
                     } else {
-                        spectrum.setPixel(leftDist + i, topDist + h - 1 - y, AbstractScopeWidget::colHighlightDark.rgba());
+                        row[i] = peakColor;
                     }
                 }
 
                 y++;
+                line++;
                 if (y >= topDist + m_innerScopeRect.height()) {
                     break;
                 }
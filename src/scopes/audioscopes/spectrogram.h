@@ -26,6 +26,9 @@ class Spectrogram_UI;
       All required information is preserved in the FFT history, which would not be the
       case for an image (consider re-sizing the widget to 100x100 px and then back to
       800x400 px -- lost is lost).
+    * A cache of the FFT history resampled to the current scope width, so changes that
+      only affect the colors (like dragging the dB range) re-apply the colormap without
+      interpolating every line again.
 */
 class Spectrogram : public AbstractAudioScopeWidget
 {
@@ -62,6 +65,13 @@ private:
 
     QList<QVector<float>> m_fftHistory;
     QImage m_fftHistoryImg;
+    /** @brief Interpolated history lines matching the current scope width, kept in sync with
+     *  m_fftHistory. Parameter changes that only affect the colors (dB range, peak highlight)
+     *  re-apply the colormap on these lines instead of resampling the whole FFT history */
+    QList<QVector<float>> m_interpolatedHistory;
+    int m_interpolatedWidth{-1};
+    int m_interpolatedFreqMax{0};
+    int m_interpolatedFreq{0};
 
     int m_dBmin{-70};
     int m_dBmax{0};
@@ -11,8 +11,11 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include <QDebug>
 #include <QImage>
 #include <QPainter>
+#include <QThread>
+#include <QtConcurrent/QtConcurrentMap>
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 HistogramGenerator::HistogramGenerator() = default;
 
@@ -40,31 +43,73 @@ QImage HistogramGenerator::calculateHistogram(const QSize &paradeSize, const QIm
     const int ww = paradeSize.width();
     const int wh = paradeSize.height();
 
-    // Read the stats from the input image
-    for (int Y = 0; Y < image.height(); ++Y) {
-        for (int X = 0; X < image.width(); X += accelFactor) {
-
-            QRgb col = image.pixel(X, Y);
-            r[qRed(col)]++;
-            g[qGreen(col)]++;
-            b[qBlue(col)]++;
-
-            if (drawY) {
-                // Use if branch to avoid expensive multiplication if Y disabled
-                if (rec == ITURec::Rec_601) {
-                    y[int(REC_601_R * qRed(col) + REC_601_G * qGreen(col) + REC_601_B * qBlue(col))]++;
-                } else {
-                    y[int(REC_709_R * qRed(col) + REC_709_G * qGreen(col) + REC_709_B * qBlue(col))]++;
+    // Read raw scan lines in a known layout instead of calling QImage::pixel() per pixel
+    QImage src = image;
+    if (src.format() != QImage::Format_ARGB32 && src.format() != QImage::Format_RGB32) {
+        src = src.convertToFormat(QImage::Format_ARGB32);
+    }
+
+    // Read the stats from the input image: horizontal bands are processed in parallel,
+    // each filling its own partial bins which are summed at the end
+    struct HistogramBins
+    {
+        int firstRow;
+        int lastRow;
+        int r[256] = {0}, g[256] = {0}, b[256] = {0}, y[256] = {0}, s[766] = {0};
+    };
+    int workers = qBound(1, QThread::idealThreadCount(), 8);
+    if (image.height() < 16 * workers) {
+        workers = 1;
+    }
+    std::vector<HistogramBins> partials(size_t(workers));
+    const int rowsPerWorker = (image.height() + workers - 1) / workers;
+    for (int w = 0; w < workers; ++w) {
+        partials[size_t(w)].firstRow = w * rowsPerWorker;
+        partials[size_t(w)].lastRow = qMin(image.height(), (w + 1) * rowsPerWorker);
+    }
+    auto processRows = [&src, accelFactor, drawY, drawSum, rec](HistogramBins &bins) {
+        for (int Y = bins.firstRow; Y < bins.lastRow; ++Y) {
+            const QRgb *line = reinterpret_cast<const QRgb *>(src.constScanLine(Y));
+            for (int X = 0; X < src.width(); X += accelFactor) {
+
+                QRgb col = line[X];
+                bins.r[qRed(col)]++;
+                bins.g[qGreen(col)]++;
+                bins.b[qBlue(col)]++;
+
+                if (drawY) {
+                    // Use if branch to avoid expensive multiplication if Y disabled
+                    if (rec == ITURec::Rec_601) {
+                        bins.y[int(REC_601_R * qRed(col) + REC_601_G * qGreen(col) + REC_601_B * qBlue(col))]++;
+                    } else {
+                        bins.y[int(REC_709_R * qRed(col) + REC_709_G * qGreen(col) + REC_709_B * qBlue(col))]++;
+                    }
                 }
-            }
 
-            if (drawSum) {
-                // Use an if branch here because the sum takes more operations than rgb
-                s[qRed(col)]++;
-                s[qGreen(col)]++;
-                s[qBlue(col)]++;
+                if (drawSum) {
+                    // Use an if branch here because the sum takes more operations than rgb
+                    bins.s[qRed(col)]++;
+                    bins.s[qGreen(col)]++;
+                    bins.s[qBlue(col)]++;
+                }
             }
         }
+    };
+    if (workers > 1) {
+        QtConcurrent::blockingMap(partials, processRows);
+    } else {
+        processRows(partials.front());
+    }
+    for (const HistogramBins &bins : partials) {
+        for (int i = 0; i < 256; ++i) {
+            r[i] += bins.r[i];
+            g[i] += bins.g[i];
+            b[i] += bins.b[i];
+            y[i] += bins.y[i];
+        }
+        for (int i = 0; i < 766; ++i) {
+            s[i] += bins.s[i];
+        }
     }
 
     const int nParts = (drawY ? 1 : 0) + (drawR ? 1 : 0) + (drawG ? 1 : 0) + (drawB ? 1 : 0) + (drawSum ? 1 : 0);
@@ -10,6 +10,8 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include <QColor>
 #include <QDebug>
 #include <QPainter>
+#include <QThread>
+#include <QtConcurrent/QtConcurrentMap>
 
 #define CHOP255(a) ((255) < (a) ? (255) : int(a))
 #define CHOP1255(a) ((a) < (1) ? (1) : ((a) > (255) ? (255) : (a)))
@@ -73,38 +75,90 @@ QImage RGBParadeGenerator::calculateRGBParade(const QSize &paradeSize, const QIm
 
     std::vector<std::vector<StructRGB>> paradeVals(partW, std::vector<StructRGB>(256, {0, 0, 0}));
 
-    const auto totalPixels = image.width() * image.height();
-    for (int i = 0; i < totalPixels; i += accelFactor) {
-        const auto x = i % image.width();
-        const QRgb pixel = image.pixel(x, i / image.width());
-        auto r = uchar(qRed(pixel));
-        auto g = uchar(qGreen(pixel));
-        auto b = uchar(qBlue(pixel));
-
-        double dx = x * double(wPrediv);
-
-        paradeVals[size_t(dx)][r].r++;
-        paradeVals[size_t(dx)][g].g++;
-        paradeVals[size_t(dx)][b].b++;
-
-        if (r < minR) {
-            minR = r;
-        }
-        if (g < minG) {
-            minG = g;
-        }
-        if (b < minB) {
-            minB = b;
-        }
-        if (r > maxR) {
-            maxR = r;
-        }
-        if (g > maxG) {
-            maxG = g;
+    // Read raw scan lines in a known layout instead of calling QImage::pixel() per pixel
+    QImage src = image;
+    if (src.format() != QImage::Format_ARGB32 && src.format() != QImage::Format_RGB32) {
+        src = src.convertToFormat(QImage::Format_ARGB32);
+    }
+    // Map each source column to its parade column once, not once per pixel
+    std::vector<uint16_t> columnLut(iw);
+    for (uint x = 0; x < iw; ++x) {
+        columnLut[x] = uint16_t(x * double(wPrediv));
+    }
+    // Accumulate rows in parallel with per-thread partial histograms merged at the end
+    struct ParadeAccumulator
+    {
+        int firstRow;
+        int lastRow;
+        std::vector<std::vector<StructRGB>> vals;
+        uchar minR = 255, minG = 255, minB = 255, maxR = 0, maxG = 0, maxB = 0;
+    };
+    int workers = qBound(1, QThread::idealThreadCount(), 8);
+    if (int(ih) < 16 * workers) {
+        workers = 1;
+    }
+    std::vector<ParadeAccumulator> accumulators(size_t(workers));
+    const int rowsPerWorker = (int(ih) + workers - 1) / workers;
+    for (int w = 0; w < workers; ++w) {
+        accumulators[size_t(w)].firstRow = w * rowsPerWorker;
+        accumulators[size_t(w)].lastRow = qMin(int(ih), (w + 1) * rowsPerWorker);
+        accumulators[size_t(w)].vals.assign(partW, std::vector<StructRGB>(256, {0, 0, 0}));
+    }
+    auto processRows = [&](ParadeAccumulator &acc) {
+        for (int y = acc.firstRow; y < acc.lastRow; ++y) {
+            const QRgb *line = reinterpret_cast<const QRgb *>(src.constScanLine(y));
+            // Keep the sampling pattern of the previous linear-index loop, so the skipped
+            // pixels don't line up in columns when the acceleration factor divides the width
+            uint x = (accelFactor - (uint(y) * iw) % accelFactor) % accelFactor;
+            for (; x < iw; x += accelFactor) {
+                const QRgb pixel = line[x];
+                const auto r = uchar(qRed(pixel));
+                const auto g = uchar(qGreen(pixel));
+                const auto b = uchar(qBlue(pixel));
+                std::vector<StructRGB> &column = acc.vals[columnLut[x]];
+                column[r].r++;
+                column[g].g++;
+                column[b].b++;
+                if (r < acc.minR) {
+                    acc.minR = r;
+                }
+                if (g < acc.minG) {
+                    acc.minG = g;
+                }
+                if (b < acc.minB) {
+                    acc.minB = b;
+                }
+                if (r > acc.maxR) {
+                    acc.maxR = r;
+                }
+                if (g > acc.maxG) {
+                    acc.maxG = g;
+                }
+                if (b > acc.maxB) {
+                    acc.maxB = b;
+                }
+            }
         }
-        if (b > maxB) {
-            maxB = b;
+    };
+    if (workers > 1) {
+        QtConcurrent::blockingMap(accumulators, processRows);
+    } else {
+        processRows(accumulators.front());
+    }
+    for (const ParadeAccumulator &acc : accumulators) {
+        for (uint i = 0; i < partW; ++i) {
+            for (int j = 0; j < 256; ++j) {
+                paradeVals[i][size_t(j)].r += acc.vals[i][size_t(j)].r;
+                paradeVals[i][size_t(j)].g += acc.vals[i][size_t(j)].g;
+                paradeVals[i][size_t(j)].b += acc.vals[i][size_t(j)].b;
+            }
         }
+        minR = qMin(minR, acc.minR);
+        minG = qMin(minG, acc.minG);
+        minB = qMin(minB, acc.minB);
+        maxR = qMax(maxR, acc.maxR);
+        maxG = qMax(maxG, acc.maxG);
+        maxB = qMax(maxB, acc.maxB);
     }
 
     const int offset1 = int(partW + offset);
@@ -129,31 +129,60 @@ QImage VectorscopeGenerator::calculateVectorscope(const QSize &vectorscopeSize,
     // https://doc.qt.io/qt-5/qimage.html#bytesPerLine
     double avgPxPerPx = double(image.depth()) / 8 * (image.bytesPerLine() * image.height()) / scope.size().width() / scope.size().height() / accelFactor;
 
+    // Pixel access goes through raw scan lines in a known layout
+    QImage src = image;
+    if (src.format() != QImage::Format_ARGB32 && src.format() != QImage::Format_RGB32) {
+        src = src.convertToFormat(QImage::Format_ARGB32);
+    }
+
+    // The UV projection is linear in R, G and B, so the contribution of each
+    // channel value can be precomputed once per frame. Per pixel this leaves
+    // six table lookups and four additions instead of the multiplications of
+    // the full matrix product.
+    double uCoeff[3], vCoeff[3];
+    switch (colorSpace) {
+    case VectorscopeGenerator::ColorSpace_YUV:
+        //             y = (double)  0.001173 * r +0.002302 * g +0.0004471* b;
+        uCoeff[0] = -0.0005781; uCoeff[1] = -0.001135; uCoeff[2] = 0.001713;
+        vCoeff[0] = 0.002411; vCoeff[1] = -0.002019; vCoeff[2] = -0.0003921;
+        break;
+    case VectorscopeGenerator::ColorSpace_YPbPr:
+    default:
+        //             y = (double)  0.001173 * r +0.002302 * g +0.0004471* b;
+        uCoeff[0] = -0.0006671; uCoeff[1] = -0.001299; uCoeff[2] = 0.0019608;
+        vCoeff[0] = 0.001961; vCoeff[1] = -0.001642; vCoeff[2] = -0.0003189;
+        break;
+    }
+    double uLutR[256], uLutG[256], uLutB[256], vLutR[256], vLutG[256], vLutB[256];
+    for (int c = 0; c < 256; ++c) {
+        uLutR[c] = uCoeff[0] * c;
+        uLutG[c] = uCoeff[1] * c;
+        uLutB[c] = uCoeff[2] * c;
+        vLutR[c] = vCoeff[0] * c;
+        vLutG[c] = vCoeff[1] * c;
+        vLutB[c] = vCoeff[2] * c;
+    }
+    // mapToCircle() is affine in u and v, so its constants can be hoisted as well:
+    // x = (w-1)/2 * (sg*u + 1) and y = (h-1)/2 * (1 - sg*v)
+    const double sg = SCALING * double(gain);
+    const double xScale = (vectorscopeSize.width() - 1) / 2.;
+    const double yScale = (vectorscopeSize.height() - 1) / 2.;
+
     // benchmarking code
     // const auto start = std::chrono::high_resolution_clock::now();
 
     const auto totalPixels = image.width() * image.height();
+    const int iw = src.width();
     for (int i = 0; i < totalPixels; i += accelFactor) {
-        const QRgb pixel = image.pixel(i % image.width(), i / image.width());
+        const QRgb pixel = reinterpret_cast<const QRgb *>(src.constScanLine(i / iw))[i % iw];
         const int r = qRed(pixel);
         const int g = qGreen(pixel);
         const int b = qBlue(pixel);
 
-        switch (colorSpace) {
-        case VectorscopeGenerator::ColorSpace_YUV:
-            //             y = (double)  0.001173 * r +0.002302 * g +0.0004471* b;
-            u = -0.0005781 * r - 0.001135 * g + 0.001713 * b;
-            v = 0.002411 * r - 0.002019 * g - 0.0003921 * b;
-            break;
-        case VectorscopeGenerator::ColorSpace_YPbPr:
-        default:
-            //             y = (double)  0.001173 * r +0.002302 * g +0.0004471* b;
-            u = -0.0006671 * r - 0.001299 * g + 0.0019608 * b;
-            v = 0.001961 * r - 0.001642 * g - 0.0003189 * b;
-            break;
-        }
+        u = uLutR[r] + uLutG[g] + uLutB[b];
+        v = vLutR[r] + vLutG[g] + vLutB[b];
 
-        pt = mapToCircle(vectorscopeSize, QPointF(SCALING * double(gain) * u, SCALING * double(gain) * v));
+        pt = QPoint(int(xScale * (sg * u + 1)), int(yScale * (1 - sg * v)));
 
         if (pt.x() >= scope.width() || pt.x() < 0 || pt.y() >= scope.height() || pt.y() < 0) {
             // Point lies outside (because of scaling), don't plot it
@@ -30,12 +30,19 @@ QImage WaveformGenerator::calculateWaveform(const QSize &waveformSize, const QIm
     // QTime time;
     // time.start();
 
-    QImage wave(waveformSize, QImage::Format_ARGB32);
-
     if (waveformSize.width() <= 0 || waveformSize.height() <= 0 || image.width() <= 0 || image.height() <= 0) {
         return QImage();
     }
 
+    // When the monitor is paused, refreshes deliver the same frame again;
+    // re-use the last result if neither the frame nor any parameter changed.
+    if (image.cacheKey() == m_cachedFrameKey && waveformSize == m_cachedSize && paintMode == m_cachedPaintMode && drawAxis == m_cachedDrawAxis &&
+        rec == m_cachedRec && accelFactor == m_cachedAccelFactor) {
+        return m_cachedWaveform;
+    }
+
+    QImage wave(waveformSize, QImage::Format_ARGB32);
+
     // Fill with transparent color
     wave.fill(qRgba(0, 0, 0, 0));
 
@@ -46,20 +53,35 @@ QImage WaveformGenerator::calculateWaveform(const QSize &waveformSize, const QIm
 
     std::vector<std::vector<uint>> waveValues(size_t(waveformSize.width()), std::vector<uint>(size_t(waveformSize.height()), 0));
 
+    // A small scope cannot show more detail than a few samples per scope pixel,
+    // so increase the sampling stride when the frame has far more pixels than
+    // needed for the current widget size (e.g. UHD input on a small widget).
+    uint stride = accelFactor;
+    const uint targetSamples = 8 * ww * wh;
+    if (uint(totalPixels) > targetSamples * stride) {
+        stride = uint(totalPixels) / targetSamples;
+    }
+
     // Number of input pixels that will fall on one scope pixel.
-    // Must be a float because the acceleration factor can be high, leading to <1 expected px per px.
-    const float pixelDepth = float(totalPixels / accelFactor) / (ww * wh);
+    // Must be a float because the sampling stride can be high, leading to <1 expected px per px.
+    const float pixelDepth = float(totalPixels / stride) / (ww * wh);
     const float gain = 255.f / (8 * pixelDepth);
     // qCDebug(KDENLIVE_LOG) << "Pixel depth: expected " << pixelDepth << "; Gain: using " << gain << " (acceleration: " << accelFactor << "x)";
 
+    // Read raw scan lines in a known layout instead of calling QImage::pixel() per pixel
+    QImage src = image;
+    if (src.format() != QImage::Format_ARGB32 && src.format() != QImage::Format_RGB32) {
+        src = src.convertToFormat(QImage::Format_ARGB32);
+    }
+
     // Subtract 1 from sizes because we start counting from 0.
     // Not doing it would result in attempts to paint outside of the image.
     const float hPrediv = (wh - 1) / 255.f;
     const float wPrediv = (ww - 1) / float(iw - 1);
 
-    for (int i = 0; i < totalPixels; i += accelFactor) {
+    for (int i = 0; i < totalPixels; i += stride) {
         const int x = i % image.width();
-        const QRgb pixel = image.pixel(x, i / image.width());
+        const QRgb pixel = reinterpret_cast<const QRgb *>(src.constScanLine(i / image.width()))[x];
 
         float dY, dx, dy;
 
@@ -129,6 +151,14 @@ QImage WaveformGenerator::calculateWaveform(const QSize &waveformSize, const QIm
     // uint diff = time.elapsed();
     // Q_EMIT signalCalculationFinished(wave, diff);
 
+    m_cachedWaveform = wave;
+    m_cachedFrameKey = image.cacheKey();
+    m_cachedSize = waveformSize;
+    m_cachedPaintMode = paintMode;
+    m_cachedDrawAxis = drawAxis;
+    m_cachedRec = rec;
+    m_cachedAccelFactor = accelFactor;
+
     return wave;
 }
 #undef CHOP255
@@ -7,12 +7,11 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 
 #pragma once
 
+#include <QImage>
 #include <QObject>
+#include <QSize>
 #include "colorconstants.h"
 
-class QImage;
-class QSize;
-
 class WaveformGenerator : public QObject
 {
     Q_OBJECT
@@ -25,4 +24,16 @@ public:
 
     QImage calculateWaveform(const QSize &waveformSize, const QImage &image, WaveformGenerator::PaintMode paintMode, bool drawAxis,
                              const ITURec rec, uint accelFactor = 1);
+
+private:
+    /** Cache of the last rendered waveform. When the monitor is paused, forced
+        refreshes deliver the same frame again; if neither the frame nor any
+        parameter changed, the scatter pass can be skipped entirely. */
+    QImage m_cachedWaveform;
+    qint64 m_cachedFrameKey{-1};
+    QSize m_cachedSize;
+    PaintMode m_cachedPaintMode{PaintMode_Green};
+    bool m_cachedDrawAxis{false};
+    ITURec m_cachedRec{ITURec::Rec_601};
+    uint m_cachedAccelFactor{0};
 };
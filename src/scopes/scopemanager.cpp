@@ -94,6 +94,16 @@ bool ScopeManager::addScope(AbstractGfxScopeWidget *colorScope, QDockWidget *col
         connect(colorScope, &AbstractScopeWidget::requestAutoRefresh, this, &ScopeManager::slotCheckActiveScopes);
         connect(colorScope, &AbstractGfxScopeWidget::signalFrameRequest, this, &ScopeManager::slotRequestFrame);
         connect(colorScope, &AbstractScopeWidget::signalScopeRenderingFinished, this, &ScopeManager::slotScopeReady);
+        connect(colorScope, &AbstractScopeWidget::signalScopeRenderingFinished, this, [this, colorScope](uint mseconds, uint) {
+            // Remember each scope's render cost so frame distribution can decimate
+            // the expensive ones when several scopes run together
+            for (auto &gsd : m_colorScopes) {
+                if (gsd.scope == colorScope) {
+                    gsd.lastRenderTime = mseconds;
+                    break;
+                }
+            }
+        });
         if (colorScopeWidget != nullptr) {
             connect(colorScopeWidget, &QDockWidget::visibilityChanged, this, &ScopeManager::slotCheckActiveScopes);
             connect(colorScopeWidget, &QDockWidget::visibilityChanged, this, [this, colorScope]() { slotRequestFrame(QString(colorScope->widgetName())); });
@@ -126,9 +136,29 @@ void ScopeManager::slotDistributeFrame(const QImage &image)
 #ifdef DEBUG_SM
     qCDebug(KDENLIVE_LOG) << "ScopeManager: Starting to distribute frame.";
 #endif
+    // Combined render cost of all scopes that would process this frame. When it exceeds
+    // the configured budget, scopes skip frames proportionally so that running several
+    // scopes together does not starve playback. The scope the user touched last is
+    // always served to keep the one being looked at frame accurate
+    uint totalCost = 0;
+    for (auto &m_colorScope : m_colorScopes) {
+        if (!m_colorScope.scope->visibleRegion().isEmpty() && m_colorScope.scope->autoRefreshEnabled()) {
+            totalCost += m_colorScope.lastRenderTime;
+        }
+    }
+    const uint budget = uint(qMax(10, KdenliveSettings::scopesCpuBudget()));
     for (auto &m_colorScope : m_colorScopes) {
         if (!m_colorScope.scope->visibleRegion().isEmpty()) {
             if (m_colorScope.scope->autoRefreshEnabled()) {
+                if (totalCost > budget && m_colorScope.scope->widgetName() != m_priorityScope) {
+                    if (m_colorScope.framesToSkip > 0) {
+                        m_colorScope.framesToSkip--;
+                        continue;
+                    }
+                    m_colorScope.framesToSkip = qMin(4, int(totalCost / budget));
+                } else {
+                    m_colorScope.framesToSkip = 0;
+                }
                 m_colorScope.scope->slotRenderZoneUpdated(image);
 #ifdef DEBUG_SM
                 qCDebug(KDENLIVE_LOG) << "ScopeManager: Distributed frame to " << m_colorScopes[i].scope->widgetName();
@@ -161,6 +191,9 @@ void ScopeManager::slotRequestFrame(const QString &widgetName)
     qCDebug(KDENLIVE_LOG) << "ScopeManager: New frame was requested by " << widgetName;
 #endif
 
+    // The user interacted with this scope, make sure frame decimation never drops it
+    m_priorityScope = widgetName;
+
     // Search for the scope in the lists and tag it to trigger a forced update
     // in the distribution slots
     for (auto &m_colorScope : m_colorScopes) {
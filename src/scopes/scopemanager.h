@@ -32,10 +32,16 @@ class ScopeManager : public QObject
     {
         AbstractGfxScopeWidget *scope;
         bool singleFrameRequested;
+        /** Duration of this scope's last render in ms, reported through signalScopeRenderingFinished */
+        uint lastRenderTime;
+        /** Number of upcoming frames this scope skips to stay within the combined render budget */
+        int framesToSkip;
         GfxScopeData()
         {
             scope = nullptr;
             singleFrameRequested = false;
+            lastRenderTime = 0;
+            framesToSkip = 0;
         }
     };
 
@@ -75,6 +81,8 @@ private:
     QSignalMapper *m_signalMapper;
     /** @brief a list of all scopes dock object names */
     QStringList m_scopeNames;
+    /** @brief Name of the scope the user interacted with last, it is never decimated */
+    QString m_priorityScope;
 
     /**
       Checks whether there is any scope accepting audio data, or if all of them are hidden
@@ -93,6 +93,9 @@ StatusBarMessageLabel::StatusBarMessageLabel(QWidget *parent)
     lay->setContentsMargins(BorderGap, 0, 2 * BorderGap, 0);
     m_queueTimer.setSingleShot(true);
     connect(&m_queueTimer, &QTimer::timeout, this, &StatusBarMessageLabel::slotMessageTimeout);
+    m_progressFlushTimer.setSingleShot(true);
+    m_progressFlushTimer.setInterval(ProgressThrottleMs);
+    connect(&m_progressFlushTimer, &QTimer::timeout, this, &StatusBarMessageLabel::applyPendingProgress);
     connect(m_label, &QLabel::linkActivated, this, &StatusBarMessageLabel::slotShowJobLog);
 }
 
@@ -114,8 +117,10 @@ void StatusBarMessageLabel::mousePressEvent(QMouseEvent *event)
 
 void StatusBarMessageLabel::setKeyMap(const QString &text)
 {
-    m_keyMap->setText(text);
-    m_keymapText = text;
+    if (text != m_keymapText) {
+        m_keyMap->setText(text);
+        m_keymapText = text;
+    }
 }
 
 void StatusBarMessageLabel::setTmpKeyMap(const QString &text)
@@ -131,8 +136,15 @@ void StatusBarMessageLabel::setProgressMessage(const QString &text, MessageType
 {
     if (type == ProcessingJobMessage) {
         m_progressCanBeAborted = allowInterrupt && progress < 100;
-        m_progress->setValue(progress);
-        m_progress->setVisible(progress < 100);
+        m_pendingProgress = progress;
+        // Tasks can send a tick for every percent of every job; only repaint the progress
+        // bar on the leading tick of each interval, completion is applied immediately
+        if (progress >= 100 || !m_progressFlushTimer.isActive()) {
+            applyPendingProgress();
+            if (progress < 100) {
+                m_progressFlushTimer.start();
+            }
+        }
     } else if (m_currentMessage.type != ProcessingJobMessage || type == OperationCompletedMessage) {
         m_progress->setVisible(progress < 100);
     }
@@ -142,9 +154,22 @@ void StatusBarMessageLabel::setProgressMessage(const QString &text, MessageType
     setMessage(text, type, 0);
 }
 
+void StatusBarMessageLabel::applyPendingProgress()
+{
+    if (m_pendingProgress < 0) {
+        return;
+    }
+    m_progress->setValue(m_pendingProgress);
+    m_progress->setVisible(m_pendingProgress < 100);
+    m_pendingProgress = -1;
+}
+
 void StatusBarMessageLabel::setSelectionMessage(const QString &text)
 {
-    m_selectionLabel->setText(text);
+    // QLabel re-layouts even when the text is unchanged, so filter identical updates
+    if (text != m_selectionLabel->text()) {
+        m_selectionLabel->setText(text);
+    }
 }
 
 void StatusBarMessageLabel::setMessage(const QString &text, MessageType type, int timeoutMS)
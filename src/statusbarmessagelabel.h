@@ -108,10 +108,13 @@ private Q_SLOTS:
      */
     bool slotMessageTimeout();
     void slotShowJobLog(const QString &text);
+    /** @brief Push the last received progress value to the progress bar */
+    void applyPendingProgress();
 
 private:
     enum { GeometryTimeout = 100 };
     enum { BorderGap = 2 };
+    enum { ProgressThrottleMs = 100 };
 
     int m_minTextHeight;
     FlashLabel *m_container;
@@ -122,6 +125,10 @@ private:
     QString m_keymapText;
     QString m_tooltipText;
     QProgressBar *m_progress;
+    /** @brief Coalesces the progress ticks sent by running tasks: while it is active new
+        values are only stored, the progress bar is repainted at most once per interval */
+    QTimer m_progressFlushTimer;
+    int m_pendingProgress{-1};
     QTimerWithTime m_queueTimer;
     QSemaphore m_queueSemaphore;
     QList<StatusBarMessageItem> m_messageQueue;
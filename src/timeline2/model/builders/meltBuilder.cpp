@@ -22,6 +22,8 @@
 #include <QApplication>
 #include <QDebug>
 #include <QSet>
+#include <QtConcurrent/QtConcurrentMap>
+#include <vector>
 #include <mlt++/MltField.h>
 #include <mlt++/MltMultitrack.h>
 #include <mlt++/MltProfile.h>
@@ -40,6 +42,101 @@ bool constructTrackFromMelt(const std::shared_ptr<TimelineItemModel> &timeline,
                             Fun &undo, Fun &redo, bool audioTrack, const QString &originalDecimalPoint, int playlist,
                             const QList<Mlt::Transition *> &compositions);
 
+namespace {
+/** @brief Resolve and cache the bin id of every clip of a track playlist.
+ *  This mirrors the id resolution done in constructTrackFromMelt, but only touches the track's own
+ *  producers and performs read-only bin lookups, so independent tracks can be processed in parallel
+ *  worker threads before the (serial) model construction. Clips that resolve get kdenlive:id and
+ *  _kdenlive_processed set and will hit the fast path when the track is built; clips that don't are
+ *  left untouched and go through the full recovery/error path on the main thread. */
+void resolveTrackClipIds(Mlt::Playlist &track, bool useMappedIds, const QString &sequenceBinId)
+{
+    for (int i = 0; i < track.count(); i++) {
+        if (track.is_blank(i)) {
+            continue;
+        }
+        std::unique_ptr<Mlt::Producer> clip(track.get_clip(i));
+        switch (clip->type()) {
+        case mlt_service_unknown_type:
+        case mlt_service_chain_type:
+        case mlt_service_producer_type:
+            break;
+        default:
+            continue;
+        }
+        if (clip->parent().get_int("_kdenlive_processed") == 1) {
+            continue;
+        }
+        QString clipId = clip->parent().get("kdenlive:id");
+        if (clipId.startsWith(QStringLiteral("slowmotion"))) {
+            clipId = clipId.section(QLatin1Char(':'), 1, 1);
+        }
+        if (clipId.isEmpty()) {
+            clipId = clip->get("kdenlive:id");
+        }
+        QString binId;
+        if (!useMappedIds || binIdCorresp.size() == 0 || (clip->parent().get_int("kdenlive:producer_type") == ClipType::Timeline)) {
+            if (clip->parent().get_int("kdenlive:producer_type") == ClipType::Timeline && binIdCorresp.count(clipId) > 0) {
+                binId = binIdCorresp.at(clipId);
+            } else {
+                binId = clipId;
+            }
+            if (binId == sequenceBinId) {
+                // Trying to embed a sequence into itself, handled on the main thread
+                continue;
+            }
+            auto binClip = pCore->projectItemModel()->getClipByBinID(binId);
+            if (binClip == nullptr || binClip->getProducerIntProperty("kdenlive:producer_type") != clip->parent().get_int("kdenlive:producer_type")) {
+                continue;
+            }
+        } else if (binIdCorresp.count(clipId) == 0) {
+            // Corrupted reference, recovery is handled on the main thread
+            continue;
+        } else {
+            binId = binIdCorresp.at(clipId);
+        }
+        if (clipId.isEmpty() || binId.isEmpty()) {
+            continue;
+        }
+        clip->parent().set("kdenlive:id", binId.toUtf8().constData());
+        clip->parent().set("_kdenlive_processed", 1);
+    }
+}
+
+/** @brief Collect the sub playlists of all non reserved tracks and resolve their clips' bin ids in
+ *  parallel, so that per-clip bin lookups are out of the way when the tracks are built serially. */
+void resolveTimelineClipIds(Mlt::Tractor &tractor, const QSet<QString> &reserved_names, bool useMappedIds, const QString &sequenceBinId)
+{
+    std::vector<std::shared_ptr<Mlt::Playlist>> playlists;
+    for (int i = 0; i < tractor.count(); i++) {
+        std::unique_ptr<Mlt::Producer> track(tractor.track(i));
+        QString playlist_name;
+        if (track->property_exists("kdenlive:playlistid")) {
+            playlist_name = track->get("kdenlive:playlistid");
+        } else {
+            playlist_name = track->get("id");
+        }
+        if (reserved_names.contains(playlist_name)) {
+            continue;
+        }
+        if (track->type() == mlt_service_tractor_type) {
+            Mlt::Tractor local_tractor(*track.get());
+            for (int j = 0; j < local_tractor.count(); j++) {
+                std::unique_ptr<Mlt::Producer> sub_track(local_tractor.track(j));
+                if (sub_track->type() == mlt_service_playlist_type) {
+                    playlists.push_back(std::make_shared<Mlt::Playlist>(*sub_track.get()));
+                }
+            }
+        } else if (track->type() == mlt_service_playlist_type) {
+            playlists.push_back(std::make_shared<Mlt::Playlist>(*track.get()));
+        }
+    }
+    QtConcurrent::blockingMap(playlists, [useMappedIds, sequenceBinId](const std::shared_ptr<Mlt::Playlist> &playlist) {
+        resolveTrackClipIds(*playlist.get(), useMappedIds, sequenceBinId);
+    });
+}
+} // namespace
+
 bool loadProjectBin(Mlt::Tractor tractor, const QUuid &activeUuid)
 {
     Fun undo = []() { return true; };
@@ -135,7 +232,7 @@ bool constructTimelineFromTractor(const std::shared_ptr<TimelineItemModel> &time
     }
 
     QSet<QString> reserved_names{QLatin1String("playlistmain"), QLatin1String("timeline_preview"), QLatin1String("timeline_overlay"),
-                                 QLatin1String("black_track"), QLatin1String("overlay_track")};
+                                 QLatin1String("black_track"), QLatin1String("timeline_audiostem"), QLatin1String("overlay_track")};
     bool ok = true;
 
     // Import master track effects
@@ -182,8 +279,15 @@ bool constructTimelineFromTractor(const std::shared_ptr<TimelineItemModel> &time
     }
 
     qDebug() << "=== OPENING FILE WITH TRACKS: " << tractor.count();
+    // Resolve the bin id of all timeline clips in parallel before the serial model construction
+    resolveTimelineClipIds(tractor, reserved_names, useMappedIds, pCore->projectItemModel()->getSequenceId(timeline->uuid()));
     for (int i = 0; i < tractor.count() && ok; i++) {
         std::unique_ptr<Mlt::Producer> track(tractor.track(i));
+        if (track->property_exists("kdenlive:stem_restore_hide")) {
+            // Project was saved while the audio stem premix was substituting the live mix, restore the real mute state
+            track->set("hide", track->get_int("kdenlive:stem_restore_hide"));
+            track->clear("kdenlive:stem_restore_hide");
+        }
         if (track->property_exists("kdenlive:playlistid")) {
             playlist_name = track->get("kdenlive:playlistid");
         } else {
@@ -392,7 +496,7 @@ bool constructTimelineFromMelt(const std::shared_ptr<TimelineItemModel> &timelin
     }
 
     QSet<QString> reserved_names{QLatin1String("playlistmain"), QLatin1String("timeline_preview"), QLatin1String("timeline_overlay"),
-                                 QLatin1String("black_track"), QLatin1String("overlay_track")};
+                                 QLatin1String("black_track"), QLatin1String("timeline_audiostem"), QLatin1String("overlay_track")};
     bool ok = true;
 
     // Import master track effects
@@ -439,9 +543,16 @@ bool constructTimelineFromMelt(const std::shared_ptr<TimelineItemModel> &timelin
         }
     }
 
+    // Resolve the bin id of all timeline clips in parallel before the serial model construction
+    resolveTimelineClipIds(tractor, reserved_names, true, pCore->projectItemModel()->getSequenceId(timeline->uuid()));
     for (int i = 0; i < tractor.count() && ok; i++) {
         qDebug() << "::: PROCESSING TK " << i;
         std::unique_ptr<Mlt::Producer> track(tractor.track(i));
+        if (track->property_exists("kdenlive:stem_restore_hide")) {
+            // Project was saved while the audio stem premix was substituting the live mix, restore the real mute state
+            track->set("hide", track->get_int("kdenlive:stem_restore_hide"));
+            track->clear("kdenlive:stem_restore_hide");
+        }
         if (track->property_exists("kdenlive:playlistid")) {
             playlist_name = track->get("kdenlive:playlistid");
         } else {
@@ -17,6 +17,7 @@
 #include "macros.hpp"
 #include "timelinemodel.hpp"
 #include "trackmodel.hpp"
+#include "utils/qstringutils.h"
 #include <QDebug>
 #include <effects/effectsrepository.hpp>
 #include <mlt++/MltProducer.h>
@@ -416,18 +417,18 @@ const QString ClipModel::getProperty(const QString &name) const
 {
     READ_LOCK();
     if (service()->parent().is_valid()) {
-        return QString::fromUtf8(service()->parent().get(name.toUtf8().constData()));
+        return QString::fromUtf8(service()->parent().get(QStringUtils::mltKey(name).constData()));
     }
-    return QString::fromUtf8(service()->get(name.toUtf8().constData()));
+    return QString::fromUtf8(service()->get(QStringUtils::mltKey(name).constData()));
 }
 
 int ClipModel::getIntProperty(const QString &name) const
 {
     READ_LOCK();
     if (service()->parent().is_valid()) {
-        return service()->parent().get_int(name.toUtf8().constData());
+        return service()->parent().get_int(QStringUtils::mltKey(name).constData());
     }
-    return service()->get_int(name.toUtf8().constData());
+    return service()->get_int(QStringUtils::mltKey(name).constData());
 }
 
 QSize ClipModel::getFrameSize() const
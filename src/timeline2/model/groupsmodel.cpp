@@ -122,6 +122,7 @@ void GroupsModel::createGroupItem(int id)
     Q_ASSERT(m_downLink.count(id) == 0);
     m_upLink[id] = -1;
     m_downLink[id] = std::unordered_set<int>();
+    invalidateLeafCache();
 }
 
 Fun GroupsModel::destructGroupItem_lambda(int id)
@@ -151,6 +152,7 @@ Fun GroupsModel::destructGroupItem_lambda(int id)
         }
         m_downLink.erase(id);
         m_upLink.erase(id);
+        invalidateLeafCache();
         return true;
     };
 }
@@ -267,6 +269,13 @@ std::unordered_set<int> GroupsModel::getSubtree(int id) const
 std::unordered_set<int> GroupsModel::getLeaves(int id) const
 {
     READ_LOCK();
+    {
+        QMutexLocker cacheLock(&m_leavesCacheMutex);
+        auto cached = m_leavesCache.find(id);
+        if (cached != m_leavesCache.end()) {
+            return cached->second;
+        }
+    }
     std::unordered_set<int> result;
     std::queue<int> queue;
     queue.push(id);
@@ -280,9 +289,17 @@ std::unordered_set<int> GroupsModel::getLeaves(int id) const
             result.insert(current);
         }
     }
+    QMutexLocker cacheLock(&m_leavesCacheMutex);
+    m_leavesCache[id] = result;
     return result;
 }
 
+void GroupsModel::invalidateLeafCache()
+{
+    QMutexLocker cacheLock(&m_leavesCacheMutex);
+    m_leavesCache.clear();
+}
+
 std::unordered_set<int> GroupsModel::getDirectChildren(int id) const
 {
     READ_LOCK();
@@ -306,6 +323,7 @@ void GroupsModel::setGroup(int id, int groupId, bool changeState)
     m_upLink[id] = groupId;
     if (groupId != -1) {
         m_downLink[groupId].insert(id);
+        invalidateLeafCache();
         auto ptr = m_parent.lock();
         if (changeState && ptr) {
             QModelIndex ix;
@@ -348,6 +366,7 @@ void GroupsModel::removeFromGroup(int id)
     if (parent != -1) {
         Q_ASSERT(getType(parent) != GroupType::Leaf);
         m_downLink[parent].erase(id);
+        invalidateLeafCache();
         QModelIndex ix;
         auto ptr = m_parent.lock();
         if (!ptr) Q_ASSERT(false);
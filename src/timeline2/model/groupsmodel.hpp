@@ -7,6 +7,7 @@
 
 #include "definitions.h"
 #include "undohelper.hpp"
+#include <QMutex>
 #include <QReadWriteLock>
 #include <memory>
 #include <unordered_map>
@@ -216,12 +217,19 @@ protected:
     void adjustOffset(QJsonArray &updatedNodes, const QJsonObject &childObject, int offset, const QMap<int, int> &trackMap, double ratio = 1.);
 
 private:
+    /** @brief Drop all memoized leaf sets. Must be called whenever the group structure changes */
+    void invalidateLeafCache();
+
     std::weak_ptr<TimelineItemModel> m_parent;
 
     /** @brief edges toward parent */
     std::unordered_map<int, int> m_upLink;
     /** @brief edges toward children */
     std::unordered_map<int, std::unordered_set<int>> m_downLink;
+    /** @brief memoized leaf sets per group node, so that repeated leaf enumeration during a drag does not
+     * walk the tree again. Protected by its own mutex since getLeaves runs under a read lock */
+    mutable std::unordered_map<int, std::unordered_set<int>> m_leavesCache;
+    mutable QMutex m_leavesCacheMutex;
     /** @brief this keeps track of "real" groups (non-leaf elements), and their types */
     std::unordered_map<int, GroupType> m_groupIds;
     /** @brief This is a lock that ensures safety in case of concurrent access */
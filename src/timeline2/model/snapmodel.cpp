@@ -4,6 +4,7 @@
 */
 #include "snapmodel.hpp"
 #include <QDebug>
+#include <algorithm>
 #include <climits>
 #include <cstdlib>
 
@@ -16,6 +17,7 @@ void SnapModel::addPoint(int position)
 {
     if (m_snaps.count(position) == 0) {
         m_snaps[position] = 1;
+        m_snapshotDirty = true;
     } else {
         m_snaps[position]++;
     }
@@ -26,24 +28,69 @@ void SnapModel::removePoint(int position)
     Q_ASSERT(m_snaps.count(position) > 0);
     if (m_snaps[position] == 1) {
         m_snaps.erase(position);
+        m_snapshotDirty = true;
     } else {
         m_snaps[position]--;
     }
 }
 
-int SnapModel::getClosestPoint(int position)
+void SnapModel::updateSnapshot()
 {
-    if (m_snaps.empty()) {
-        return -1;
+    if (!m_snapshotDirty) {
+        return;
+    }
+    m_snapshot.clear();
+    m_snapshot.reserve(m_snaps.size());
+    for (const auto &snap : m_snaps) {
+        m_snapshot.push_back(snap.first);
+    }
+    m_snapshotDirty = false;
+}
+
+bool SnapModel::isIgnored(int position) const
+{
+    auto ignored = m_ignore.find(position);
+    if (ignored == m_ignore.end()) {
+        return false;
     }
-    auto it = m_snaps.lower_bound(position);
+    auto snap = m_snaps.find(position);
+    return snap == m_snaps.end() || snap->second <= ignored->second;
+}
+
+void SnapModel::setTransientPoint(int position)
+{
+    m_transientPoint = position;
+}
+
+int SnapModel::getClosestPoint(int position)
+{
+    updateSnapshot();
     long long int prev = INT_MIN, next = INT_MAX;
-    if (it != m_snaps.end()) {
-        next = (*it).first;
+    auto it = std::lower_bound(m_snapshot.cbegin(), m_snapshot.cend(), position);
+    auto fwd = it;
+    while (fwd != m_snapshot.cend() && isIgnored(*fwd)) {
+        ++fwd;
     }
-    if (it != m_snaps.begin()) {
-        --it;
-        prev = (*it).first;
+    if (fwd != m_snapshot.cend()) {
+        next = *fwd;
+    }
+    auto bwd = it;
+    while (bwd != m_snapshot.cbegin()) {
+        --bwd;
+        if (!isIgnored(*bwd)) {
+            prev = *bwd;
+            break;
+        }
+    }
+    if (m_transientPoint > -1) {
+        if (m_transientPoint >= position && m_transientPoint < next) {
+            next = m_transientPoint;
+        } else if (m_transientPoint < position && m_transientPoint > prev) {
+            prev = m_transientPoint;
+        }
+    }
+    if (prev == INT_MIN && next == INT_MAX) {
+        return -1;
     }
     if (std::llabs(position - prev) < std::llabs(position - next)) {
         return int(prev);
@@ -53,44 +100,49 @@ int SnapModel::getClosestPoint(int position)
 
 int SnapModel::getNextPoint(int position)
 {
-    if (m_snaps.empty()) {
-        return position;
+    updateSnapshot();
+    auto it = std::lower_bound(m_snapshot.cbegin(), m_snapshot.cend(), position + 1);
+    while (it != m_snapshot.cend() && isIgnored(*it)) {
+        ++it;
     }
-    auto it = m_snaps.lower_bound(position + 1);
-    long long int next = position;
-    if (it != m_snaps.end()) {
-        next = (*it).first;
+    if (m_transientPoint > position && (it == m_snapshot.cend() || m_transientPoint < *it)) {
+        return m_transientPoint;
     }
-    return int(next);
+    if (it != m_snapshot.cend()) {
+        return *it;
+    }
+    return position;
 }
 
 int SnapModel::getPreviousPoint(int position)
 {
-    if (m_snaps.empty()) {
-        return 0;
-    }
-    auto it = m_snaps.lower_bound(position);
-    long long int prev = 0;
-    if (it != m_snaps.begin()) {
+    updateSnapshot();
+    auto it = std::lower_bound(m_snapshot.cbegin(), m_snapshot.cend(), position);
+    while (it != m_snapshot.cbegin()) {
         --it;
-        prev = (*it).first;
+        if (!isIgnored(*it)) {
+            if (m_transientPoint < position && m_transientPoint > *it) {
+                return m_transientPoint;
+            }
+            return *it;
+        }
+    }
+    if (m_transientPoint > -1 && m_transientPoint < position) {
+        return m_transientPoint;
     }
-    return int(prev);
+    return 0;
 }
 
 void SnapModel::ignore(const std::vector<int> &pts)
 {
     for (int pt : pts) {
-        removePoint(pt);
-        m_ignore.push_back(pt);
+        Q_ASSERT(m_snaps.count(pt) > 0);
+        m_ignore[pt]++;
     }
 }
 
 void SnapModel::unIgnore()
 {
-    for (const auto &pt : m_ignore) {
-        addPoint(pt);
-    }
     m_ignore.clear();
 }
 
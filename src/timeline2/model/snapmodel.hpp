@@ -48,6 +48,12 @@ public:
     /** @brief Retrieves previous snap point. Returns 0 if there is no snappoint available */
     int getPreviousPoint(int position);
 
+    /** @brief Sets a transient snap point (the playhead position during a drag) that queries
+       consider without it being inserted in the model, so the sorted snapshot does not
+       have to be rebuilt on every mouse move. Pass -1 to clear it.
+     */
+    void setTransientPoint(int position);
+
     /** @brief Ignores the given positions until unIgnore() is called
        You can make several call to this before unIgnoring
        Note that you cannot remove ignored points.
@@ -73,9 +79,23 @@ public:
     std::map<int, int> _snaps() { return m_snaps; }
 
 private:
+    /** @brief Rebuild the flat position snapshot from the snap map if it is out of date */
+    void updateSnapshot();
+    /** @brief Returns true if all elements at this position are currently ignored */
+    bool isIgnored(int position) const;
+
     /** This represents the snappoints internally. The keys are the positions and the values are the number of elements at this
      * position. Note that it is important that the datastructure is ordered. QMap is NOT ordered, and therefore not suitable.
      */
     std::map<int, int> m_snaps;
-    std::vector<int> m_ignore;
+    /** Flat sorted copy of the snap positions, rebuilt lazily when positions were added or removed.
+     * Queries binary search this vector instead of walking the map. */
+    std::vector<int> m_snapshot;
+    bool m_snapshotDirty{true};
+    /** Number of ignored elements per position. Ignoring is applied as a filter at query time, so the
+     * ignore()/unIgnore() churn of a drag operation does not invalidate the snapshot. */
+    std::map<int, int> m_ignore;
+    /** Temporary extra snap candidate (the playhead during a drag), kept outside of m_snaps
+     * so it can move on every mouse tick without dirtying the snapshot. -1 when unset. */
+    int m_transientPoint{-1};
 };
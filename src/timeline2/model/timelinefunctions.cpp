@@ -632,7 +632,9 @@ bool TimelineFunctions::requestSpacerEndOperation(const std::shared_ptr<Timeline
     }
     if (liftOk && (mainGroup > -1 || clips.size() == 1)) {
         if (clips.size() > 1) {
+            timeline->_beginBulkUpdate();
             final = timeline->requestGroupMove(itemId, mainGroup, 0, endPosition - startPosition, true, true, undo, redo);
+            timeline->_endBulkUpdate();
         } else {
             // only 1 clip to be moved
             if (isClip) {
@@ -1691,6 +1693,11 @@ TimelineFunctions::TimelineTracksInfo TimelineFunctions::getAVTracksIds(const st
 }
 
 QString TimelineFunctions::copyClips(const std::shared_ptr<TimelineItemModel> &timeline, const std::unordered_set<int> &itemIds, int mainClip)
+{
+    return copyClipsToDom(timeline, itemIds, mainClip).toString();
+}
+
+QDomDocument TimelineFunctions::copyClipsToDom(const std::shared_ptr<TimelineItemModel> &timeline, const std::unordered_set<int> &itemIds, int mainClip)
 {
     int mainId = *(itemIds.begin());
     // We need to retrieve ALL the involved clips, ie those who are also grouped with the given clips
@@ -1830,8 +1837,7 @@ QString TimelineFunctions::copyClips(const std::shared_ptr<TimelineItemModel> &t
     qDebug() << "\n=======";
     grp.appendChild(copiedItems.createTextNode(timeline->m_groups->toJson(groupRoots)));
 
-    qDebug() << " / // / PASTED DOC: \n\n" << copiedItems.toString() << "\n\n------------";
-    return copiedItems.toString();
+    return copiedItems;
 }
 
 bool TimelineFunctions::pasteClips(const std::shared_ptr<TimelineItemModel> &timeline, const QString &pasteString, int trackId, int position)
@@ -1845,6 +1851,17 @@ bool TimelineFunctions::pasteClips(const std::shared_ptr<TimelineItemModel> &tim
     return false;
 }
 
+bool TimelineFunctions::pasteClips(const std::shared_ptr<TimelineItemModel> &timeline, const QDomDocument &copiedItems, int trackId, int position)
+{
+    std::function<bool(void)> undo = []() { return true; };
+    std::function<bool(void)> redo = []() { return true; };
+    if (TimelineFunctions::pasteClips(timeline, copiedItems, trackId, position, undo, redo)) {
+        pCore->pushUndo(undo, redo, i18n("Paste clips"));
+        return true;
+    }
+    return false;
+}
+
 bool TimelineFunctions::getUsedTracks(const QDomNodeList &clips, const QDomNodeList &compositions, int sourceMasterTrack, int &topAudioMirror, TimelineTracksInfo &allTracks, QList<int> &singleAudioTracks, std::unordered_map<int, int> &audioMirrors)
 {
     // Tracks used by clips
@@ -1917,8 +1934,29 @@ bool TimelineFunctions::pasteClipsWithUndo(const std::shared_ptr<TimelineItemMod
     return false;
 }
 
+bool TimelineFunctions::pasteClipsWithUndo(const std::shared_ptr<TimelineItemModel> &timeline, const QDomDocument &copiedItems, int trackId, int position,
+                                           Fun &undo, Fun &redo)
+{
+    std::function<bool(void)> paste_undo = []() { return true; };
+    std::function<bool(void)> paste_redo = []() { return true; };
+    if (TimelineFunctions::pasteClips(timeline, copiedItems, trackId, position, paste_undo, paste_redo)) {
+        PUSH_FRONT_LAMBDA(paste_undo, undo);
+        PUSH_FRONT_LAMBDA(paste_redo, redo);
+        return true;
+    }
+    return false;
+}
+
 bool TimelineFunctions::pasteClips(const std::shared_ptr<TimelineItemModel> &timeline, const QString &pasteString, int trackId, int position, Fun &undo,
                                    Fun &redo, int inPos, int duration)
+{
+    QDomDocument copiedItems;
+    copiedItems.setContent(pasteString);
+    return pasteClips(timeline, copiedItems, trackId, position, undo, redo, inPos, duration);
+}
+
+bool TimelineFunctions::pasteClips(const std::shared_ptr<TimelineItemModel> &timeline, QDomDocument copiedItems, int trackId, int position, Fun &undo,
+                                   Fun &redo, int inPos, int duration)
 {
     timeline->requestClearSelection();
     if (!semaphore.tryAcquire(1)) {
@@ -1928,8 +1966,6 @@ bool TimelineFunctions::pasteClips(const std::shared_ptr<TimelineItemModel> &tim
         }
     }
     waitingBinIds.clear();
-    QDomDocument copiedItems;
-    copiedItems.setContent(pasteString);
     if (copiedItems.documentElement().tagName() == QLatin1String("kdenlive-scene")) {
         qDebug() << " / / READING CLIPS FROM CLIPBOARD";
     } else {
@@ -2116,6 +2152,15 @@ bool TimelineFunctions::pasteClips(const std::shared_ptr<TimelineItemModel> &tim
             QString clipHash = Xml::getXmlProperty(currentProd, QStringLiteral("kdenlive:file_hash"));
             if (!pCore->projectItemModel()->validateClip(clipId, clipHash)) {
                 // This clip is different in project and in paste data, create a copy
+                // But if a previous paste already created an identical copy, reuse it instead of
+                // instantiating and loading the same producer again
+                if (!folderId.isEmpty() && !clipHash.isEmpty()) {
+                    const QString existingId = pCore->projectItemModel()->validateClipInFolder(folderId, clipHash);
+                    if (!existingId.isEmpty()) {
+                        mappedIds.insert(clipId, existingId);
+                        continue;
+                    }
+                }
                 QString updatedId = QString::number(pCore->projectItemModel()->getFreeClipId());
                 Xml::setXmlProperty(currentProd, QStringLiteral("kdenlive:id"), updatedId);
                 mappedIds.insert(clipId, updatedId);
@@ -3154,3 +3199,33 @@ int TimelineFunctions::spacerMaxPos()
 {
     return spacerMaxPosition;
 }
+
+TimelineMimeData::TimelineMimeData(const QDomDocument &document)
+    : m_document(document)
+{
+}
+
+const QDomDocument &TimelineMimeData::document() const
+{
+    return m_document;
+}
+
+QStringList TimelineMimeData::formats() const
+{
+    return {QStringLiteral("text/plain")};
+}
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+QVariant TimelineMimeData::retrieveData(const QString &mimeType, QMetaType type) const
+#else
+QVariant TimelineMimeData::retrieveData(const QString &mimeType, QVariant::Type type) const
+#endif
+{
+    if (mimeType == QLatin1String("text/plain")) {
+        if (m_text.isEmpty()) {
+            m_text = m_document.toString();
+        }
+        return m_text;
+    }
+    return QMimeData::retrieveData(mimeType, type);
+}
@@ -15,6 +15,7 @@ SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
 #include <unordered_map>
 
 #include <QDir>
+#include <QMimeData>
 
 class TimelineItemModel;
 
@@ -51,13 +52,22 @@ struct TimelineFunctions
 
     /** @brief Creates a string representation of the given clips, that can then be pasted using pasteClips(). Return an empty string on failure */
     static QString copyClips(const std::shared_ptr<TimelineItemModel> &timeline, const std::unordered_set<int> &itemIds, int mainClip = -1);
+    /** @brief Same as copyClips() but returns the DOM document directly, so in-process consumers
+     *  like sequence nesting skip the XML string serialization and re-parse */
+    static QDomDocument copyClipsToDom(const std::shared_ptr<TimelineItemModel> &timeline, const std::unordered_set<int> &itemIds, int mainClip = -1);
 
     /** @brief Paste the clips as described by the string. Returns true on success*/
     static bool pasteClips(const std::shared_ptr<TimelineItemModel> &timeline, const QString &pasteString, int trackId, int position);
+    /** @brief Same as above but takes the already parsed document, used for in-process paste */
+    static bool pasteClips(const std::shared_ptr<TimelineItemModel> &timeline, const QDomDocument &copiedItems, int trackId, int position);
     static bool pasteClips(const std::shared_ptr<TimelineItemModel> &timeline, const QString &pasteString, int trackId, int position, Fun &undo, Fun &redo,
                            int inPos = 0, int duration = -1);
+    static bool pasteClips(const std::shared_ptr<TimelineItemModel> &timeline, QDomDocument copiedItems, int trackId, int position, Fun &undo, Fun &redo,
+                           int inPos = 0, int duration = -1);
     static bool pasteClipsWithUndo(const std::shared_ptr<TimelineItemModel> &timeline, const QString &pasteString, int trackId, int position, Fun &undo,
                                    Fun &redo);
+    static bool pasteClipsWithUndo(const std::shared_ptr<TimelineItemModel> &timeline, const QDomDocument &copiedItems, int trackId, int position, Fun &undo,
+                                   Fun &redo);
     static bool pasteTimelineClips(const std::shared_ptr<TimelineItemModel> &timeline, const QDomDocument &copiedItems, int position, int inPos = 0,
                                    int duration = -1);
     static bool pasteTimelineClips(const std::shared_ptr<TimelineItemModel> &timeline, QDomDocument copiedItems, int position, Fun &timeline_undo,
@@ -177,3 +187,30 @@ struct TimelineFunctions
 private:
     static bool getUsedTracks(const QDomNodeList &clips, const QDomNodeList &compositions, int masterSourceTrack, int &topAudioMirror, TimelineTracksInfo &allTracks, QList<int> &singleAudioTracks, std::unordered_map<int, int> &audioMirrors);
 };
+
+/** @class TimelineMimeData
+    @brief Clipboard payload produced by a timeline copy. The parsed document is kept in
+    process so pasting inside the application reuses it directly, and the XML text other
+    applications see is only rendered when something actually requests the clipboard content.
+    This makes copying and pasting large selections near instant.
+ */
+class TimelineMimeData : public QMimeData
+{
+    Q_OBJECT
+public:
+    explicit TimelineMimeData(const QDomDocument &document);
+    const QDomDocument &document() const;
+    QStringList formats() const override;
+
+protected:
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    QVariant retrieveData(const QString &mimeType, QMetaType type) const override;
+#else
+    QVariant retrieveData(const QString &mimeType, QVariant::Type type) const override;
+#endif
+
+private:
+    QDomDocument m_document;
+    /** @brief Cached XML rendering, only produced on the first external request */
+    mutable QString m_text;
+};
@@ -563,6 +563,12 @@ void TimelineItemModel::setTrackProperty(int trackId, const QString &name, const
         roles.push_back(IsLockedRole);
     } else if (name == QLatin1String("hide")) {
         roles.push_back(IsDisabledRole);
+        if (!isLoading) {
+            // The compositing graph only includes visible video tracks and audible
+            // audio tracks, rebuild it to match the new state
+            removeTrackCompositing();
+            buildTrackCompositing();
+        }
         if (!track->isAudioTrack() && !isLoading) {
             pCore->invalidateItem(ObjectId(KdenliveObjectType::TimelineTrack, trackId, m_uuid));
             pCore->refreshProjectMonitorOnce();
@@ -686,11 +692,17 @@ void TimelineItemModel::notifyChange(const QModelIndex &topleft, const QModelInd
             roles.push_back(TimelineModel::OutPointRole);
         }
     }
+    if (collectBulkChange(topleft, roles)) {
+        return;
+    }
     Q_EMIT dataChanged(topleft, bottomright, roles);
 }
 
 void TimelineItemModel::notifyChange(const QModelIndex &topleft, const QModelIndex &bottomright, const QVector<int> &roles)
 {
+    if (collectBulkChange(topleft, roles)) {
+        return;
+    }
     Q_EMIT dataChanged(topleft, bottomright, roles);
 }
 
@@ -804,14 +816,25 @@ void TimelineItemModel::buildTrackCompositing(bool rebuild)
     while (it != m_allTracks.cend()) {
         int trackPos = getTrackMltIndex((*it)->getId());
         if (!composite.isEmpty() && !(*it)->isAudioTrack()) {
+            videoTracks++;
+            if ((*it)->isHidden()) {
+                // Hidden track, don't composite it; toggling visibility rebuilds the graph
+                ++it;
+                continue;
+            }
             // video track, add composition
             std::unique_ptr<Mlt::Transition> transition = TransitionsRepository::get()->getTransition(composite);
             transition->set("internal_added", 237);
             transition->set("always_active", 1);
             transition->set_tracks(0, trackPos);
             field->plant_transition(*transition.get(), 0, trackPos);
-            videoTracks++;
         } else if ((*it)->isAudioTrack()) {
+            audioTracks++;
+            if ((*it)->isMute()) {
+                // Muted track, keep it out of the audio mix
+                ++it;
+                continue;
+            }
             // audio mix
             std::unique_ptr<Mlt::Transition> transition = TransitionsRepository::get()->getTransition(QStringLiteral("mix"));
             transition->set("internal_added", 237);
@@ -820,7 +843,6 @@ void TimelineItemModel::buildTrackCompositing(bool rebuild)
             transition->set("sum", 1);
             transition->set_tracks(0, trackPos);
             field->plant_transition(*transition.get(), 0, trackPos);
-            audioTracks++;
         }
         ++it;
     }
@@ -847,9 +869,50 @@ void TimelineItemModel::buildTrackCompositing(bool rebuild)
 
 void TimelineItemModel::notifyChange(const QModelIndex &topleft, const QModelIndex &bottomright, int role)
 {
+    if (collectBulkChange(topleft, {role})) {
+        return;
+    }
     Q_EMIT dataChanged(topleft, bottomright, {role});
 }
 
+void TimelineItemModel::_beginBulkUpdate()
+{
+    m_bulkUpdateDepth++;
+}
+
+void TimelineItemModel::_endBulkUpdate()
+{
+    Q_ASSERT(m_bulkUpdateDepth > 0);
+    if (--m_bulkUpdateDepth > 0) {
+        return;
+    }
+    // Emit one coalesced notification per touched track
+    QMapIterator<int, QSet<int>> i(m_bulkUpdateTracks);
+    while (i.hasNext()) {
+        i.next();
+        QModelIndex trackIndex = index(i.key());
+        int count = rowCount(trackIndex);
+        if (trackIndex.isValid() && count > 0) {
+            QVector<int> roles(i.value().cbegin(), i.value().cend());
+            Q_EMIT dataChanged(index(0, 0, trackIndex), index(count - 1, 0, trackIndex), roles);
+        }
+    }
+    m_bulkUpdateTracks.clear();
+}
+
+bool TimelineItemModel::collectBulkChange(const QModelIndex &topleft, const QVector<int> &roles)
+{
+    if (m_bulkUpdateDepth == 0 || !topleft.parent().isValid()) {
+        // Only clip level changes are coalesced, track level notifications go through directly
+        return false;
+    }
+    QSet<int> &pending = m_bulkUpdateTracks[topleft.parent().row()];
+    for (int role : roles) {
+        pending.insert(role);
+    }
+    return true;
+}
+
 void TimelineItemModel::_beginRemoveRows(const QModelIndex &i, int j, int k)
 {
     // qDebug()<<"FORWARDING beginRemoveRows"<<i<<j<<k;
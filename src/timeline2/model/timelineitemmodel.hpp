@@ -118,6 +118,8 @@ public:
     void _endRemoveRows() override;
     void _endInsertRows() override;
     void _resetView() override;
+    void _beginBulkUpdate() override;
+    void _endBulkUpdate() override;
 
 protected:
     /** @brief This is an helper function that finishes a construction of a freshly created TimelineItemModel */
@@ -129,4 +131,13 @@ Q_SIGNALS:
     void showTrackEffectStack(int tid);
     void subtitleModelInitialized();
     void subtitlesListChanged();
+
+private:
+    /** @brief If a bulk update is running, record the change and return true; the caller must then skip
+     *  the immediate dataChanged emission */
+    bool collectBulkChange(const QModelIndex &topleft, const QVector<int> &roles);
+    /** Nesting depth of the currently running bulk update */
+    int m_bulkUpdateDepth{0};
+    /** Roles touched on each track (by track row) during a bulk update */
+    QMap<int, QSet<int>> m_bulkUpdateTracks;
 };
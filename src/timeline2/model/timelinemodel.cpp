@@ -21,6 +21,7 @@
 #include "kdenlivesettings.h"
 #include "profiles/profilemodel.hpp"
 #include "snapmodel.hpp"
+#include "timeline2/view/audiostemmanager.h"
 #include "timeline2/view/previewmanager.h"
 #include "timelinefunctions.hpp"
 
@@ -442,6 +443,26 @@ int TimelineModel::getClipByPosition(int trackId, int position, int playlist) co
     return getTrackById_const(trackId)->getClipByPosition(position, playlist);
 }
 
+const QString TimelineModel::clipsHashAtPosition(int position) const
+{
+    READ_LOCK();
+    QStringList clipData;
+    for (const auto &track : m_allTracks) {
+        int cid = track->getClipByPosition(position);
+        if (cid == -1) {
+            continue;
+        }
+        clipData << QStringLiteral("%1:%2:%3:%4:%5:%6")
+                        .arg(track->getId())
+                        .arg(getClipBinId(cid))
+                        .arg(getClipPosition(cid))
+                        .arg(getClipIn(cid))
+                        .arg(getClipPlaytime(cid))
+                        .arg(m_allClips.at(cid)->clipState());
+    }
+    return QString::fromLatin1(QCryptographicHash::hash(clipData.join(QLatin1Char(';')).toUtf8(), QCryptographicHash::Md5).toHex());
+}
+
 int TimelineModel::getCompositionByPosition(int trackId, int position) const
 {
     READ_LOCK();
@@ -1499,24 +1520,35 @@ QVariantList TimelineModel::suggestClipMove(int clipId, int trackId, int positio
     }
     bool after = position > currentPos;
     if (snapDistance > 0) {
-        std::vector<int> ignored_pts;
         // For snapping, we must ignore all in/outs of the clips of the group being moved
         std::unordered_set<int> all_items = {clipId};
+        int groupId = -1;
         if (m_groups->isInGroup(clipId) && !m_singleSelectionMode) {
-            int groupId = m_groups->getRootId(clipId);
+            groupId = m_groups->getRootId(clipId);
             all_items = m_groups->getLeaves(groupId);
         }
-        for (int current_clipId : all_items) {
-            if (isClip(current_clipId)) {
-                m_allClips[current_clipId]->allSnaps(ignored_pts, offset);
-            } else if (isComposition(current_clipId) || isSubTitle(current_clipId)) {
-                // Composition
-                int in = getItemPosition(current_clipId) - offset;
-                ignored_pts.push_back(in);
-                ignored_pts.push_back(in + getItemPlaytime(current_clipId));
+        // The ignored points are collected in real (model) coordinates: during a fake (ghost)
+        // move they stay constant for the whole drag, so the possibly large list is only
+        // rebuilt when the dragged item, its group or the underlying model changed
+        const std::tuple<int, int, int, size_t> snapsKey = {clipId, groupId, getClipPosition(clipId), all_items.size()};
+        if (!fakeMove || snapsKey != m_ignoredSnapsKey) {
+            m_ignoredSnaps.clear();
+            for (int current_clipId : all_items) {
+                if (isClip(current_clipId)) {
+                    m_allClips[current_clipId]->allSnaps(m_ignoredSnaps, 0);
+                } else if (isComposition(current_clipId) || isSubTitle(current_clipId)) {
+                    // Composition
+                    int in = getItemPosition(current_clipId);
+                    m_ignoredSnaps.push_back(in);
+                    m_ignoredSnaps.push_back(in + getItemPlaytime(current_clipId));
+                }
             }
+            // Pre-sort so the per-tick pass in getBestSnapPos is nearly free
+            std::sort(m_ignoredSnaps.begin(), m_ignoredSnaps.end());
+            m_ignoredSnaps.erase(std::unique(m_ignoredSnaps.begin(), m_ignoredSnaps.end()), m_ignoredSnaps.end());
+            m_ignoredSnapsKey = fakeMove ? snapsKey : std::tuple<int, int, int, size_t>{-1, -1, -1, 0};
         }
-        int snapped = getBestSnapPos(currentPos, position - currentPos, ignored_pts, cursorPosition, snapDistance, fakeMove);
+        int snapped = getBestSnapPos(currentPos + offset, position - currentPos - offset, m_ignoredSnaps, cursorPosition, snapDistance, fakeMove);
         if (snapped >= 0) {
             position = snapped;
         }
@@ -2162,6 +2194,7 @@ bool TimelineModel::requestItemDeletion(int itemId, bool logUndo)
     }
     Fun undo = []() { return true; };
     Fun redo = []() { return true; };
+    std::vector<std::pair<Fun, Fun>> steps;
 
     bool res = true;
     if (singleSelectOperation) {
@@ -2172,11 +2205,21 @@ bool TimelineModel::requestItemDeletion(int itemId, bool logUndo)
         for (int id : selection) {
             res = res && requestItemDeletion(id, undo, redo, logUndo);
         }
+    } else if (m_groups->isInGroup(itemId)) {
+        res = requestGroupDeletion(itemId, undo, redo, &steps);
     } else {
         res = requestItemDeletion(itemId, undo, redo, logUndo);
     }
     if (res && logUndo) {
-        PUSH_UNDO(undo, redo, actionLabel);
+        if (steps.size() > 20) {
+            // Replaying a big group deletion as one monolithic lambda chain freezes the interface,
+            // push the recorded steps so undo / redo runs in time-sliced batches instead
+            if (auto ptr = m_undoStack.lock()) {
+                ptr->pushChunked(std::move(steps), actionLabel);
+            }
+        } else {
+            PUSH_UNDO(undo, redo, actionLabel);
+        }
     }
     TRACE_RES(res);
     return res;
@@ -2606,6 +2649,7 @@ bool TimelineModel::requestGroupMove(int itemId, int groupId, int delta_track, i
     std::function<bool(void)> redo = []() { return true; };
     bool res = false;
     auto groupSize = m_groups->getLeaves(groupId).size();
+    _beginBulkUpdate();
     if (m_singleSelectionMode && m_currentSelection.size() < groupSize) {
         // Moving multiple items apart from the group
         int itemsGroup = m_groups->getRootId(*m_currentSelection.begin());
@@ -2634,6 +2678,7 @@ bool TimelineModel::requestGroupMove(int itemId, int groupId, int delta_track, i
     } else {
         res = requestGroupMove(itemId, groupId, delta_track, delta_pos, updateView, logUndo, undo, redo, revertMove, moveMirrorTracks);
     }
+    _endBulkUpdate();
     if (res && logUndo) {
         PUSH_UNDO(undo, redo, i18n("Move group"));
     }
@@ -3149,8 +3194,15 @@ bool TimelineModel::requestGroupDeletion(int clipId, bool logUndo)
     return res;
 }
 
-bool TimelineModel::requestGroupDeletion(int clipId, Fun &undo, Fun &redo)
+bool TimelineModel::requestGroupDeletion(int clipId, Fun &undo, Fun &redo, std::vector<std::pair<Fun, Fun>> *steps)
 {
+    // Compose an atomic step into the global undo / redo lambdas, and optionally record it for chunked replay
+    auto record = [&undo, &redo, steps](Fun &step_undo, Fun &step_redo) {
+        UPDATE_UNDO_REDO_NOLOCK(step_redo, step_undo, undo, redo);
+        if (steps) {
+            steps->emplace_back(step_undo, step_redo);
+        }
+    };
     // we do a breadth first exploration of the group tree, ungroup (delete) every inner node, and then delete all the leaves.
     std::queue<int> group_queue;
     group_queue.push(m_groups->getRootId(clipId));
@@ -3190,11 +3242,15 @@ bool TimelineModel::requestGroupDeletion(int clipId, Fun &undo, Fun &redo)
                 Fun tmp_redo = []() { return true; };
                 m_groups->ungroupItem(one_child, tmp_undo, tmp_redo);
             } else {
-                bool res = m_groups->ungroupItem(one_child, undo, redo);
+                Fun step_undo = []() { return true; };
+                Fun step_redo = []() { return true; };
+                bool res = m_groups->ungroupItem(one_child, step_undo, step_redo);
                 if (!res) {
+                    step_undo();
                     undo();
                     return false;
                 }
+                record(step_undo, step_redo);
             }
         }
         if (isSelection) {
@@ -3202,26 +3258,38 @@ bool TimelineModel::requestGroupDeletion(int clipId, Fun &undo, Fun &redo)
         }
     }
     for (int clip : all_items) {
-        bool res = requestClipDeletion(clip, undo, redo);
+        Fun step_undo = []() { return true; };
+        Fun step_redo = []() { return true; };
+        bool res = requestClipDeletion(clip, step_undo, step_redo);
         if (!res) {
-            // Undo is processed in requestClipDeletion
+            // Undo of this step is processed in requestClipDeletion
+            undo();
             return false;
         }
+        record(step_undo, step_redo);
     }
     for (int compo : all_compositions) {
-        bool res = requestCompositionDeletion(compo, undo, redo);
+        Fun step_undo = []() { return true; };
+        Fun step_redo = []() { return true; };
+        bool res = requestCompositionDeletion(compo, step_undo, step_redo);
         if (!res) {
+            step_undo();
             undo();
             return false;
         }
+        record(step_undo, step_redo);
     }
     std::set<int>::reverse_iterator rit;
     for (rit = all_subtitles.rbegin(); rit != all_subtitles.rend(); ++rit) {
-        bool res = requestSubtitleDeletion(*rit, undo, redo, rit == all_subtitles.rbegin(), rit == std::prev(all_subtitles.rend()));
+        Fun step_undo = []() { return true; };
+        Fun step_redo = []() { return true; };
+        bool res = requestSubtitleDeletion(*rit, step_undo, step_redo, rit == all_subtitles.rbegin(), rit == std::prev(all_subtitles.rend()));
         if (!res) {
+            step_undo();
             undo();
             return false;
         }
+        record(step_undo, step_redo);
     }
     return true;
 }
@@ -5205,7 +5273,9 @@ int TimelineModel::getBestSnapPos(int referencePos, int diff, std::vector<int> p
     // Sort and remove duplicates
     std::sort(pts.begin(), pts.end());
     pts.erase(std::unique(pts.begin(), pts.end()), pts.end());
-    m_snaps->addPoint(cursorPosition);
+    // The playhead is a snap candidate too, but it moves on every tick; pass it as a
+    // transient point so the snap model's sorted snapshot is not rebuilt on each call
+    m_snaps->setTransientPoint(cursorPosition);
     int closest = -1;
     int lowestDiff = snapDistance + 1;
     for (int point : pts) {
@@ -5222,7 +5292,7 @@ int TimelineModel::getBestSnapPos(int referencePos, int diff, std::vector<int> p
     if (m_editMode == TimelineMode::NormalEdit) {
         m_snaps->unIgnore();
     }
-    m_snaps->removePoint(cursorPosition);
+    m_snaps->setTransientPoint(-1);
     return closest;
 }
 
@@ -6492,6 +6562,7 @@ bool TimelineModel::requestClearSelection(bool onDeletion)
         }
     }
     m_currentSelection.clear();
+    m_selectionLeaves.clear();
     if (m_subtitleModel) {
         m_subtitleModel->clearGrab();
     }
@@ -6563,6 +6634,12 @@ std::unordered_set<int> TimelineModel::getCurrentSelection() const
     }
 }
 
+bool TimelineModel::isInSelection(int itemId) const
+{
+    READ_LOCK();
+    return m_selectionLeaves.count(itemId) > 0;
+}
+
 void TimelineModel::requestAddToSelection(int itemId, bool clear, bool singleSelect)
 {
     QWriteLocker locker(&m_lock);
@@ -6577,6 +6654,7 @@ void TimelineModel::requestAddToSelection(int itemId, bool clear, bool singleSel
         QWriteLocker locker(&m_lock);
         selection.insert(itemId);
         m_currentSelection = selection;
+        m_selectionLeaves = selection;
         setSelected(itemId, true);
         Q_EMIT selectionChanged();
         if (!m_singleSelectionMode) {
@@ -6616,6 +6694,63 @@ bool TimelineModel::requestSetSelection(const std::unordered_set<int> &ids)
 {
     QWriteLocker locker(&m_lock);
     TRACE(ids);
+    if (ids.size() > 2 && !m_singleSelectionMode && m_selectedMix == -1 && m_currentSelection.size() == 1 && isGroup(*m_currentSelection.begin()) &&
+        m_groups->getType(*m_currentSelection.begin()) == GroupType::Selection) {
+        // A selection group already exists (eg. a marquee selection being extended). Adjust its
+        // membership instead of destroying and rebuilding the group on every update
+        const int gid = *m_currentSelection.begin();
+        bool reusable = true;
+        std::unordered_set<int> roots;
+        for (int id : ids) {
+            if (id == gid) {
+                reusable = false;
+                break;
+            }
+            int root = m_groups->getRootId(id);
+            if (root == gid) {
+                // Item is already inside the selection group, find its topmost ancestor below it
+                root = id;
+                while (m_groups->getDirectAncestor(root) != gid) {
+                    root = m_groups->getDirectAncestor(root);
+                }
+            }
+            roots.insert(root);
+        }
+        if (reusable && roots.size() > 1) {
+            const std::unordered_set<int> current = m_groups->getDirectChildren(gid);
+            // Insert new members first so the group never empties (an empty group deregisters itself)
+            for (int id : roots) {
+                if (current.count(id) == 0) {
+                    m_groups->setGroup(id, gid, false);
+                    setSelected(id, true);
+                }
+            }
+            for (int id : current) {
+                if (roots.count(id) == 0) {
+                    m_groups->removeFromGroup(id);
+                    std::unordered_set<int> leaves = isGroup(id) ? m_groups->getLeaves(id) : std::unordered_set<int>{id};
+                    for (int leaf : leaves) {
+                        if (isClip(leaf)) {
+                            m_allClips[leaf]->clearOffset();
+                            m_allClips[leaf]->setGrab(false);
+                            m_allClips[leaf]->setSelected(false);
+                        } else if (isComposition(leaf)) {
+                            m_allCompositions[leaf]->setGrab(false);
+                            m_allCompositions[leaf]->setSelected(false);
+                        } else if (isSubTitle(leaf)) {
+                            m_subtitleModel->setSelected(leaf, false);
+                        }
+                    }
+                }
+            }
+            m_selectionLeaves = m_groups->getLeaves(gid);
+            if (m_subtitleModel) {
+                m_subtitleModel->clearGrab();
+            }
+            Q_EMIT selectionChanged();
+            return true;
+        }
+    }
     if (m_currentSelection.size() > 0) {
         requestClearSelection();
     }
@@ -6626,8 +6761,10 @@ bool TimelineModel::requestSetSelection(const std::unordered_set<int> &ids)
     bool result = true;
     if (roots.size() == 0) {
         m_currentSelection.clear();
+        m_selectionLeaves.clear();
     } else if (roots.size() == 1) {
         m_currentSelection = {*(roots.begin())};
+        m_selectionLeaves = isGroup(*roots.begin()) ? m_groups->getLeaves(*roots.begin()) : roots;
         setSelected(*m_currentSelection.begin(), true);
     } else {
         Fun undo = []() { return true; };
@@ -6666,6 +6803,7 @@ bool TimelineModel::requestSetSelection(const std::unordered_set<int> &ids)
         int groupId = m_groups->groupItems(ids, undo, redo, GroupType::Selection);
         if (groupId > -1) {
             m_currentSelection = {groupId};
+            m_selectionLeaves = m_groups->getLeaves(groupId);
             result = true;
         } else {
             result = false;
@@ -7321,6 +7459,37 @@ bool TimelineModel::hasTimelinePreview() const
     return m_timelinePreview != nullptr;
 }
 
+void TimelineModel::initializeAudioStems()
+{
+    if (m_audioStems == nullptr) {
+        m_audioStems = std::shared_ptr<AudioStemManager>(new AudioStemManager(m_tractor.get(), m_uuid, this));
+        if (!m_audioStems->initialize()) {
+            m_audioStems.reset();
+            return;
+        }
+        connect(this, &TimelineModel::invalidateZone, m_audioStems.get(), &AudioStemManager::invalidateStems, Qt::DirectConnection);
+    }
+}
+
+std::shared_ptr<AudioStemManager> TimelineModel::audioStemManager()
+{
+    return m_audioStems;
+}
+
+void TimelineModel::resetAudioStems()
+{
+    if (m_audioStems) {
+        disconnect(this, &TimelineModel::invalidateZone, m_audioStems.get(), &AudioStemManager::invalidateStems);
+        m_audioStems->deleteStemTrack();
+        m_audioStems.reset();
+    }
+}
+
+bool TimelineModel::hasAudioStems() const
+{
+    return m_audioStems != nullptr;
+}
+
 void TimelineModel::updatePreviewConnection(bool enable)
 {
     if (hasTimelinePreview()) {
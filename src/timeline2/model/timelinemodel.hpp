@@ -14,6 +14,7 @@
 #include <cassert>
 #include <memory>
 #include <mlt++/MltTractor.h>
+#include <tuple>
 
 #include <unordered_map>
 #include <unordered_set>
@@ -32,6 +33,7 @@ class TrackModel;
 class ProfileModel;
 class MarkerListModel;
 class MarkerSortModel;
+class AudioStemManager;
 class PreviewManager;
 
 /** @brief This class represents a Timeline object, as viewed by the backend.
@@ -515,6 +517,12 @@ public:
     void removeOverlayTrack();
     void deletePreviewTrack();
     std::shared_ptr<PreviewManager> previewManager();
+    /**  @brief Initialize the audio stem manager, responsible for the background audio premix
+     */
+    void initializeAudioStems();
+    void resetAudioStems();
+    bool hasAudioStems() const;
+    std::shared_ptr<AudioStemManager> audioStemManager();
     /**  @brief We want to delete the timelineModel without removing clips from tractor
      */
     void prepareShutDown();
@@ -571,7 +579,10 @@ public:
        @param clipId is the id of the clip that triggers the group deletion
     */
     Q_INVOKABLE bool requestGroupDeletion(int clipId, bool logUndo = true);
-    bool requestGroupDeletion(int clipId, Fun &undo, Fun &redo);
+    /** @brief When steps is provided, every atomic sub operation is additionally recorded there as an
+     *  {undo, redo} pair, allowing the caller to push a chunked undo command instead of one
+     *  monolithic lambda chain */
+    bool requestGroupDeletion(int clipId, Fun &undo, Fun &redo, std::vector<std::pair<Fun, Fun>> *steps = nullptr);
 
     /** @brief Change the duration of an item (clip or composition)
      *  This action is undoable
@@ -785,6 +796,11 @@ public:
     int getClipByPosition(int trackId, int position, int playlist = -1) const;
     int getClipByStartPosition(int trackId, int position) const;
 
+    /** @brief Returns a digest of the clips intersecting a given position on all tracks.
+     *  Used to check if the content of a sequence around its poster frame really changed
+     *  before discarding the sequence clip's thumbnail */
+    const QString clipsHashAtPosition(int position) const;
+
     /** @brief Get a timeline composition id by its starting position or -1 if not found
      */
     int getCompositionByPosition(int trackId, int position) const;
@@ -880,6 +896,9 @@ public:
     /** @brief Returns a set containing all the items in the selection */
     std::unordered_set<int> getCurrentSelection() const;
 
+    /** @brief Returns true if the given item is part of the current selection. O(1), does not expand the selection group */
+    bool isInSelection(int itemId) const;
+
     /** @brief Do some cleanup before closing */
     void prepareClose(bool softDelete = false);
     /** @brief Import project's master effects */
@@ -1039,6 +1058,7 @@ protected:
     std::shared_ptr<Mlt::Service> m_masterService;
     std::list<std::shared_ptr<TrackModel>> m_allTracks;
     std::shared_ptr<PreviewManager> m_timelinePreview;
+    std::shared_ptr<AudioStemManager> m_audioStems;
 
     std::unordered_map<int, std::list<std::shared_ptr<TrackModel>>::iterator>
         m_iteratorTable; // this logs the iterator associated which each track id. This allows easy access of a track based on its id.
@@ -1050,6 +1070,13 @@ protected:
 
     std::unique_ptr<GroupsModel> m_groups;
     std::shared_ptr<SnapModel> m_snaps;
+    /** @brief Snap points of the item (or group) currently being fake-moved, in real (model)
+     *  coordinates so they stay valid for the whole drag. Rebuilding this list costs one model
+     *  query per item of the group, which showed up on every mouse tick of large spacer drags.
+     *  The key holds the dragged clip, its group, its real position and the group size so any
+     *  real model change makes the cache rebuild itself */
+    std::tuple<int, int, int, size_t> m_ignoredSnapsKey{-1, -1, -1, 0};
+    std::vector<int> m_ignoredSnaps;
     std::shared_ptr<SubtitleModel> m_subtitleModel{nullptr};
 
     std::unordered_set<int> m_allGroups; /// ids of all the groups
@@ -1069,6 +1096,9 @@ protected:
      *  item, or, finally, the id of a group which is not of type selection. The last case happens when the selection exactly matches an existing group
      *  (in that case we cannot further group it because the selection would have only one child, which is prohibited by design) */
     std::unordered_set<int> m_currentSelection;
+    /** @brief Flat set of all selected leaf items, kept in sync with m_currentSelection so that
+     *  membership tests don't have to expand the selection group */
+    std::unordered_set<int> m_selectionLeaves;
     int m_selectedMix = -1;
 
     /// The index of the temporary overlay track in tractor, or -1 if not connected
@@ -1106,4 +1136,9 @@ protected:
     virtual QModelIndex makeCompositionIndexFromID(int) const = 0;
     virtual QModelIndex makeTrackIndexFromID(int) const = 0;
     virtual void _resetView() = 0;
+    /** @brief Start a bulk update. Until the matching _endBulkUpdate, clip level dataChanged notifications
+     *  are coalesced into a single notification per touched track, so that multi-clip operations like a
+     *  group or spacer move don't trigger one view relayout per clip. Calls can be nested. */
+    virtual void _beginBulkUpdate() = 0;
+    virtual void _endBulkUpdate() = 0;
 };
@@ -17,6 +17,7 @@
 #endif
 #include "snapmodel.hpp"
 #include "timelinemodel.hpp"
+#include "utils/qstringutils.h"
 #include <QDebug>
 #include <QModelIndex>
 #include <memory>
@@ -138,6 +139,7 @@ int TrackModel::getClipsCount()
         }
     }
     Q_ASSERT(count == static_cast<int>(m_allClips.size()));
+    Q_ASSERT(m_clipsByStart.size() == m_allClips.size());
 #else
     int count = int(m_allClips.size());
 #endif
@@ -191,8 +193,10 @@ Fun TrackModel::requestClipInsertion_lambda(int clipId, int position, bool updat
         if (auto ptr = m_parent.lock()) {
             std::shared_ptr<ClipModel> clip = ptr->getClipPtr(clipId);
             m_allClips[clip->getId()] = clip; // store clip
+            invalidateRowCache();
             // update clip position and track
             clip->setPosition(position);
+            indexClipStart(clipId, position);
             if (finalMove) {
                 clip->setSubPlaylistIndex(subPlaylist, m_id);
             }
@@ -436,7 +440,9 @@ Fun TrackModel::requestClipDeletion_lambda(int clipId, bool updateView, bool fin
             m_playlists[target_track].consolidate_blanks();
             m_allClips[clipId]->setCurrentTrackId(-1);
             // m_allClips[clipId]->setSubPlaylistIndex(-1);
+            unindexClipStart(clipId, clip_position);
             m_allClips.erase(clipId);
+            invalidateRowCache();
             delete prod;
             field->unblock();
             m_playlists[target_track].unlock();
@@ -706,7 +712,9 @@ Fun TrackModel::requestClipResize_lambda(int clipId, int in, int out, bool right
             // The second is parameter is delta - 1 because this function expects an out time, which is basically size - 1
             m_playlists[target_track].insert_blank(blank_index, delta - 1);
             if (!right) {
+                unindexClipStart(clipId, clip_position);
                 m_allClips[clipId]->setPosition(clip_position + delta);
+                indexClipStart(clipId, clip_position + delta);
                 // Because we inserted blank before, the index of our clip has increased
                 target_clip_mutable++;
             }
@@ -805,7 +813,9 @@ Fun TrackModel::requestClipResize_lambda(int clipId, int in, int out, bool right
                     // m_track->unblock();
                 }
                 if (!right && err == 0) {
+                    unindexClipStart(clipId, m_allClips[clipId]->getPosition());
                     m_allClips[clipId]->setPosition(m_playlists[target_track].clip_start(target_clip_mutable));
+                    indexClipStart(clipId, m_allClips[clipId]->getPosition());
                 }
                 if (err == 0) {
                     update_snaps(m_allClips[clipId]->getPosition(), m_allClips[clipId]->getPosition() + out - in + 1);
@@ -828,13 +838,77 @@ int TrackModel::getId() const
     return m_id;
 }
 
+void TrackModel::indexClipStart(int clipId, int position)
+{
+    m_clipsByStart.emplace(position, clipId);
+}
+
+void TrackModel::unindexClipStart(int clipId, int position)
+{
+    auto range = m_clipsByStart.equal_range(position);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == clipId) {
+            m_clipsByStart.erase(it);
+            return;
+        }
+    }
+}
+
+int TrackModel::getClipAtFromIndex(int position, int playlist) const
+{
+    bool playlistDone[2] = {false, false};
+    auto rit = std::make_reverse_iterator(m_clipsByStart.upper_bound(position));
+    for (; rit != m_clipsByStart.rend() && !(playlistDone[0] && playlistDone[1]); ++rit) {
+        const auto &clip = m_allClips.at(rit->second);
+        int sub = qBound(0, clip->getSubPlaylistIndex(), 1);
+        if (playlistDone[sub]) {
+            continue;
+        }
+        if (rit->first + clip->getPlaytime() - 1 >= position && (playlist == -1 || playlist == sub)) {
+            return rit->second;
+        }
+        // Clips of a sub-playlist don't overlap, so no earlier clip of it can cover the position
+        playlistDone[sub] = true;
+    }
+    return -1;
+}
+
+int TrackModel::nextClipStartFromIndex(int position, int playlist) const
+{
+    for (auto it = m_clipsByStart.upper_bound(position); it != m_clipsByStart.end(); ++it) {
+        if (playlist == -1) {
+            return it->first;
+        }
+        const auto &clip = m_allClips.at(it->second);
+        if (qBound(0, clip->getSubPlaylistIndex(), 1) == playlist) {
+            return it->first;
+        }
+    }
+    return -1;
+}
+
+int TrackModel::previousClipEndFromIndex(int position, int playlist) const
+{
+    auto rit = std::make_reverse_iterator(m_clipsByStart.upper_bound(position));
+    for (; rit != m_clipsByStart.rend(); ++rit) {
+        const auto &clip = m_allClips.at(rit->second);
+        if (playlist != -1 && qBound(0, clip->getSubPlaylistIndex(), 1) != playlist) {
+            continue;
+        }
+        int end = rit->first + clip->getPlaytime() - 1;
+        if (end < position) {
+            return end;
+        }
+    }
+    return -1;
+}
+
 int TrackModel::getClipByStartPosition(int position) const
 {
     READ_LOCK();
-    for (auto &clip : m_allClips) {
-        if (clip.second->getPosition() == position) {
-            return clip.second->getId();
-        }
+    auto it = m_clipsByStart.find(position);
+    if (it != m_clipsByStart.end()) {
+        return it->second;
     }
     return -1;
 }
@@ -913,14 +987,25 @@ std::unordered_set<int> TrackModel::getClipsInRange(int position, int end)
 {
     READ_LOCK();
     std::unordered_set<int> ids;
-    for (const auto &clp : m_allClips) {
-        int pos = clp.second->getPosition();
-        int length = clp.second->getPlaytime();
-        if (end > -1 && pos >= end) {
+    // Clips starting inside the range
+    auto stop = end > -1 ? m_clipsByStart.lower_bound(end) : m_clipsByStart.end();
+    for (auto it = m_clipsByStart.lower_bound(position); it != stop; ++it) {
+        ids.insert(it->second);
+    }
+    // Clips starting before the range but extending into it. Clips of a sub-playlist never overlap,
+    // so we can stop walking backwards as soon as both playlists yielded a clip ending before the range
+    bool playlistDone[2] = {false, false};
+    auto rit = std::make_reverse_iterator(m_clipsByStart.lower_bound(position));
+    for (; rit != m_clipsByStart.rend() && !(playlistDone[0] && playlistDone[1]); ++rit) {
+        const auto &clip = m_allClips.at(rit->second);
+        int playlist = qBound(0, clip->getSubPlaylistIndex(), 1);
+        if (playlistDone[playlist]) {
             continue;
         }
-        if (pos >= position || pos + length - 1 >= position) {
-            ids.insert(clp.first);
+        if (rit->first + clip->getPlaytime() - 1 >= position) {
+            ids.insert(rit->second);
+        } else {
+            playlistDone[playlist] = true;
         }
     }
     return ids;
@@ -930,7 +1015,23 @@ int TrackModel::getRowfromClip(int clipId) const
 {
     READ_LOCK();
     Q_ASSERT(m_allClips.count(clipId) > 0);
-    return int(std::distance(m_allClips.begin(), m_allClips.find(clipId)));
+    QMutexLocker lock(&m_rowCacheMutex);
+    if (m_rowCache.empty()) {
+        rebuildRowCache();
+    }
+    return m_rowCache.at(clipId);
+}
+
+void TrackModel::rebuildRowCache() const
+{
+    // Rebuild the whole cache in one pass: clips come first in id order, then compositions
+    int row = 0;
+    for (const auto &clip : m_allClips) {
+        m_rowCache[clip.first] = row++;
+    }
+    for (const auto &compo : m_allCompositions) {
+        m_rowCache[compo.first] = row++;
+    }
 }
 
 std::unordered_set<int> TrackModel::getCompositionsInRange(int position, int end)
@@ -956,23 +1057,33 @@ int TrackModel::getRowfromComposition(int tid) const
 {
     READ_LOCK();
     Q_ASSERT(m_allCompositions.count(tid) > 0);
-    return int(m_allClips.size()) + int(std::distance(m_allCompositions.begin(), m_allCompositions.find(tid)));
+    QMutexLocker lock(&m_rowCacheMutex);
+    if (m_rowCache.empty()) {
+        rebuildRowCache();
+    }
+    return m_rowCache.at(tid);
+}
+
+void TrackModel::invalidateRowCache()
+{
+    QMutexLocker lock(&m_rowCacheMutex);
+    m_rowCache.clear();
 }
 
 QVariant TrackModel::getProperty(const QString &name) const
 {
     READ_LOCK();
-    return QString(m_track->get(name.toUtf8().constData()));
+    return QString(m_track->get(QStringUtils::mltKey(name).constData()));
 }
 
 void TrackModel::setProperty(const QString &name, const QString &value)
 {
     QWriteLocker locker(&m_lock);
-    m_track->set(name.toUtf8().constData(), value.toUtf8().constData());
+    m_track->set(QStringUtils::mltKey(name).constData(), value.toUtf8().constData());
     // Hide property must be defined at playlist level or it won't be saved
     if (name == QLatin1String("kdenlive:audio_track") || name == QLatin1String("hide")) {
         for (auto &m_playlist : m_playlists) {
-            m_playlist.set(name.toUtf8().constData(), value.toInt());
+            m_playlist.set(QStringUtils::mltKey(name).constData(), value.toInt());
         }
     }
 }
@@ -1214,10 +1325,7 @@ bool TrackModel::isLastClip(int position)
 bool TrackModel::isBlankAt(int position, int playlist)
 {
     READ_LOCK();
-    if (playlist == -1) {
-        return m_playlists[0].is_blank_at(position) && m_playlists[1].is_blank_at(position);
-    }
-    return m_playlists[playlist].is_blank_at(position);
+    return getClipAtFromIndex(position, playlist) == -1;
 }
 
 int TrackModel::getNextBlankStart(int position, bool allowCurrentPos)
@@ -1262,16 +1370,16 @@ int TrackModel::getBlankStart(int position)
 {
     READ_LOCK();
     int result = 0;
-    for (auto &playlist : m_playlists) {
-        if (playlist.count() == 0) {
+    for (int j = 0; j < 2; j++) {
+        if (m_playlists[j].count() == 0) {
             break;
         }
-        if (!playlist.is_blank_at(position)) {
+        if (getClipAtFromIndex(position, j) != -1) {
             result = position;
             break;
         }
-        int clip_index = playlist.get_clip_index_at(position);
-        int start = playlist.clip_start(clip_index);
+        // The blank starts right after the previous clip of this sub-playlist
+        int start = previousClipEndFromIndex(position, j) + 1;
         if (start > result) {
             result = start;
         }
@@ -1285,11 +1393,11 @@ int TrackModel::getClipStart(int position, int track)
         return getBlankStart(position);
     }
     READ_LOCK();
-    if (m_playlists[track].is_blank_at(position)) {
+    int cid = getClipAtFromIndex(position, track);
+    if (cid == -1) {
         return position;
     }
-    int clip_index = m_playlists[track].get_clip_index_at(position);
-    return m_playlists[track].clip_start(clip_index);
+    return m_allClips.at(cid)->getPosition();
 }
 
 int TrackModel::getClipEnd(int position, int track)
@@ -1298,12 +1406,11 @@ int TrackModel::getClipEnd(int position, int track)
         return getBlankStart(position);
     }
     READ_LOCK();
-    if (m_playlists[track].is_blank_at(position)) {
+    int cid = getClipAtFromIndex(position, track);
+    if (cid == -1) {
         return position;
     }
-    int clip_index = m_playlists[track].get_clip_index_at(position);
-    clip_index++;
-    return m_playlists[track].clip_start(clip_index);
+    return m_allClips.at(cid)->getPosition() + m_allClips.at(cid)->getPlaytime();
 }
 
 int TrackModel::getBlankStart(int position, int track)
@@ -1312,16 +1419,10 @@ int TrackModel::getBlankStart(int position, int track)
         return getBlankStart(position);
     }
     READ_LOCK();
-    int result = 0;
-    if (!m_playlists[track].is_blank_at(position)) {
+    if (getClipAtFromIndex(position, track) != -1) {
         return position;
     }
-    int clip_index = m_playlists[track].get_clip_index_at(position);
-    int start = m_playlists[track].clip_start(clip_index);
-    if (start > result) {
-        result = start;
-    }
-    return result;
+    return previousClipEndFromIndex(position, track) + 1;
 }
 
 int TrackModel::getBlankEnd(int position, int track)
@@ -1330,16 +1431,12 @@ int TrackModel::getBlankEnd(int position, int track)
         return getBlankEnd(position);
     }
     READ_LOCK();
-    // Q_ASSERT(m_playlists[track].is_blank_at(position));
-    if (!m_playlists[track].is_blank_at(position)) {
+    if (getClipAtFromIndex(position, track) != -1) {
         return position;
     }
-    int clip_index = m_playlists[track].get_clip_index_at(position);
-    int count = m_playlists[track].count();
-    if (clip_index < count) {
-        int blank_start = m_playlists[track].clip_start(clip_index);
-        int blank_length = m_playlists[track].clip_length(clip_index) - 1;
-        return blank_start + blank_length;
+    int next_start = nextClipStartFromIndex(position, track);
+    if (next_start > -1) {
+        return next_start - 1;
     }
     return INT_MAX;
 }
@@ -1476,6 +1573,7 @@ Fun TrackModel::requestCompositionDeletion_lambda(int compoId, bool updateView,
         }
         m_allCompositions[compoId]->setCurrentTrackId(-1);
         m_allCompositions.erase(compoId);
+        invalidateRowCache();
         m_compoPos.erase(old_in);
         ptr->m_snaps->removePoint(old_in);
         ptr->m_snaps->removePoint(old_out);
@@ -1519,6 +1617,7 @@ Fun TrackModel::requestCompositionInsertion_lambda(int compoId, int position, bo
             if (auto ptr = m_parent.lock()) {
                 std::shared_ptr<CompositionModel> composition = ptr->getCompositionPtr(compoId);
                 m_allCompositions[composition->getId()] = composition; // store clip
+                invalidateRowCache();
                 // update clip position and track
                 composition->setCurrentTrackId(getId());
                 int new_in = position;
@@ -1636,6 +1735,11 @@ bool TrackModel::isMute() const
     return m_track->get_int("hide") & 2;
 }
 
+bool TrackModel::isRenderMuted() const
+{
+    return m_track->get_int("kdenlive:render_mute") == 1;
+}
+
 bool TrackModel::importEffects(std::weak_ptr<Mlt::Service> service)
 {
     QWriteLocker locker(&m_lock);
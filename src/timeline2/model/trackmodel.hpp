@@ -7,6 +7,7 @@
 
 #include "definitions.h"
 #include "undohelper.hpp"
+#include <QMutex>
 #include <QReadWriteLock>
 #include <QSharedPointer>
 #include <memory>
@@ -104,6 +105,11 @@ public:
     /** @brief Returns true if track is disabled
      */
     bool isMute() const;
+    /** @brief Returns true if track is excluded from timeline preview rendering.
+     * This is distinct from the monitor mute ("hide" property): the track still plays
+     * normally, it is only skipped when rendering preview chunks
+     */
+    bool isRenderMuted() const;
 
     // TODO make protected
     QVariant getProperty(const QString &name) const;
@@ -369,6 +375,36 @@ private:
      */
     std::map<int, int> m_compoPos;
 
+    /** Clip ids of this track ordered by start position. Since clips of a sub-playlist never overlap, this
+     *  acts as an interval index: position and range queries resolve in O(log n) instead of scanning all clips.
+     *  It is maintained incrementally wherever a clip is registered, deregistered or repositioned on the track.
+     */
+    std::multimap<int, int> m_clipsByStart;
+    /** @brief Add a clip to the start position index */
+    void indexClipStart(int clipId, int position);
+    /** @brief Remove a clip from the start position index */
+    void unindexClipStart(int clipId, int position);
+    /** @brief Returns the id of the clip covering position on the given sub-playlist (on any sub-playlist
+     *  if playlist is -1), or -1 if the position is blank there. Resolved from the start position index,
+     *  so blank/occupancy queries during a drag don't walk the MLT playlists */
+    int getClipAtFromIndex(int position, int playlist) const;
+    /** @brief Start position of the first clip after position on the given sub-playlist, or -1 if none */
+    int nextClipStartFromIndex(int position, int playlist) const;
+    /** @brief End frame of the last clip ending before position on the given sub-playlist, or -1 if none */
+    int previousClipEndFromIndex(int position, int playlist) const;
+
+    /** Lazily built item id -> model row cache, so building a QModelIndex for a clip or composition
+     *  doesn't count its preceding siblings on every dataChanged emission. Cleared whenever an item
+     *  is registered or deregistered on the track. Guarded by m_rowCacheMutex since it is filled
+     *  from const getters running under a read lock */
+    mutable std::unordered_map<int, int> m_rowCache;
+    mutable QMutex m_rowCacheMutex;
+    /** @brief Fill the row cache from the clip and composition maps. Must be called with
+     *  m_rowCacheMutex held */
+    void rebuildRowCache() const;
+    /** @brief Drop the cached row indices, called when m_allClips or m_allCompositions changes */
+    void invalidateRowCache();
+
     /// This is a lock that ensures safety in case of concurrent access
     mutable QReadWriteLock m_lock;
     void reverseCompositionXml(const QString &composition, QDomElement xml);
@@ -0,0 +1,374 @@
+/*
+    SPDX-FileCopyrightText: 2026 Jean-Baptiste Mardelle <jb@kdenlive.org>
+
+    SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "audiostemmanager.h"
+#include "core.h"
+#include "doc/kdenlivedoc.h"
+#include "kdenlivesettings.h"
+#include "monitor/monitor.h"
+#include "monitor/monitorproxy.h"
+#include "timeline2/model/timelineitemmodel.hpp"
+
+#include <KLocalizedString>
+#include <QCryptographicHash>
+#include <QMutexLocker>
+#include <QThread>
+
+#include <mlt++/MltPlaylist.h>
+#include <mlt++/MltProducer.h>
+#include <mlt++/MltTractor.h>
+
+AudioStemManager::AudioStemManager(Mlt::Tractor *tractor, QUuid uuid, QObject *parent)
+    : QObject(parent)
+    , m_tractor(tractor)
+    , m_uuid(uuid)
+{
+    QObject::connect(&m_stemProcess, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished), this, &AudioStemManager::processEnded);
+    connect(this, &AudioStemManager::abortStems, &m_stemProcess, &QProcess::kill, Qt::DirectConnection);
+    connect(&m_stemProcess, &QProcess::readyReadStandardError, this, &AudioStemManager::receivedStderr);
+}
+
+AudioStemManager::~AudioStemManager()
+{
+    if (m_initialized) {
+        abortRendering();
+        if (m_stemsActive) {
+            activateStems(false);
+        }
+    }
+    delete m_stemTrack;
+}
+
+bool AudioStemManager::initialize()
+{
+    bool ok;
+    KdenliveDoc *doc = pCore->currentDoc();
+    m_cacheDir = doc->getCacheDir(CacheAudio, &ok, m_uuid);
+    if (!ok || !m_cacheDir.exists()) {
+        pCore->displayMessage(i18n("Cannot read folder %1", m_cacheDir.absolutePath()), ErrorMessage);
+        return false;
+    }
+    // The audio cache folder is shared between sequences, keep one stem folder per timeline
+    QString stemFolder = QStringLiteral("stems");
+    if (m_uuid != doc->uuid()) {
+        stemFolder.append(QStringLiteral("-%1").arg(QString(QCryptographicHash::hash(m_uuid.toByteArray(), QCryptographicHash::Md5).toHex())));
+    }
+    if (!m_cacheDir.exists(stemFolder) && !m_cacheDir.mkdir(stemFolder)) {
+        pCore->displayMessage(i18n("Something is wrong with cache folder %1", m_cacheDir.absolutePath()), ErrorMessage);
+        return false;
+    }
+    if (!m_cacheDir.cd(stemFolder) || !m_cacheDir.makeAbsolute()) {
+        return false;
+    }
+    m_stabilityTimer.setSingleShot(true);
+    m_stabilityTimer.setInterval(qMax(1, KdenliveSettings::audiostemdelay()) * 1000);
+    connect(&m_stabilityTimer, &QTimer::timeout, this, &AudioStemManager::startStemRender);
+    connect(this, &AudioStemManager::stemRender, this, &AudioStemManager::gotStemRender, Qt::DirectConnection);
+    if (Monitor *monitor = pCore->getMonitor(Kdenlive::ProjectMonitor)) {
+        connect(monitor->getControllerProxy(), &MonitorProxy::positionChanged, this, &AudioStemManager::updatePlaybackPosition);
+    }
+    buildStemTrack();
+    m_initialized = true;
+    // Kick off an initial pass over the existing timeline
+    m_stabilityTimer.start();
+    return true;
+}
+
+bool AudioStemManager::buildStemTrack()
+{
+    if (m_stemTrack != nullptr) {
+        return false;
+    }
+    m_stemTrack = new Mlt::Playlist(pCore->getProjectProfile());
+    m_stemTrack->set("kdenlive:playlistid", "timeline_audiostem");
+    m_tractor->lock();
+    reconnectTrack();
+    m_tractor->unlock();
+    return true;
+}
+
+void AudioStemManager::deleteStemTrack()
+{
+    if (m_stemsActive) {
+        activateStems(false);
+    }
+    m_tractor->lock();
+    disconnectTrack();
+    delete m_stemTrack;
+    m_stemTrack = nullptr;
+    QMutexLocker lock(&m_chunkMutex);
+    m_renderedChunks.clear();
+    m_tractor->unlock();
+}
+
+void AudioStemManager::reconnectTrack()
+{
+    disconnectTrack();
+    if (!m_stemTrack) {
+        return;
+    }
+    m_stemTrackIndex = m_tractor->count();
+    m_tractor->insert_track(*m_stemTrack, m_stemTrackIndex);
+    std::shared_ptr<Mlt::Producer> tk(m_tractor->track(m_stemTrackIndex));
+    // Fully inactive until the playhead enters a premixed zone
+    tk->set("hide", 3);
+}
+
+void AudioStemManager::disconnectTrack()
+{
+    if (m_stemTrackIndex > -1) {
+        std::unique_ptr<Mlt::Producer> prod(m_tractor->track(m_stemTrackIndex));
+        if (strcmp(prod->get("kdenlive:playlistid"), "timeline_audiostem") == 0) {
+            m_tractor->remove_track(m_stemTrackIndex);
+        }
+    }
+    m_stemTrackIndex = -1;
+}
+
+void AudioStemManager::abortRendering()
+{
+    if (m_stemProcess.state() == QProcess::NotRunning) {
+        return;
+    }
+    Q_EMIT abortStems();
+    m_stemProcess.waitForFinished();
+    if (m_stemProcess.state() != QProcess::NotRunning) {
+        m_stemProcess.kill();
+        m_stemProcess.waitForFinished();
+    }
+}
+
+bool AudioStemManager::isRunning() const
+{
+    return m_stemProcess.state() != QProcess::NotRunning;
+}
+
+const QDir AudioStemManager::getCacheDir() const
+{
+    return m_cacheDir;
+}
+
+void AudioStemManager::invalidateStems(int startFrame, int endFrame)
+{
+    if (!m_initialized) {
+        return;
+    }
+    if (m_stemsActive) {
+        // The edited zone may be the one we are playing from, fall back to the live mix
+        activateStems(false);
+    }
+    if (isRunning()) {
+        abortRendering();
+    }
+    int chunkSize = KdenliveSettings::timelinechunks();
+    int start = startFrame - startFrame % chunkSize;
+    int end = endFrame - endFrame % chunkSize;
+    QMutexLocker lock(&m_chunkMutex);
+    m_tractor->lock();
+    bool chunksChanged = false;
+    for (int i = start; i <= end; i += chunkSize) {
+        if (m_renderedChunks.contains(i)) {
+            m_renderedChunks.removeAll(QVariant(i));
+            m_cacheDir.remove(QStringLiteral("%1.flac").arg(i));
+            if (m_stemTrack) {
+                int ix = m_stemTrack->get_clip_index_at(i);
+                if (!m_stemTrack->is_blank(ix)) {
+                    delete m_stemTrack->replace_with_blank(ix);
+                }
+            }
+            chunksChanged = true;
+        }
+    }
+    if (chunksChanged && m_stemTrack) {
+        m_stemTrack->consolidate_blanks();
+    }
+    m_tractor->unlock();
+    // Every edit restarts the stability window, stems only render once the timeline stayed quiet
+    m_stabilityTimer.start();
+}
+
+const QString AudioStemManager::audioMuteMask() const
+{
+    // One char per audio track: its user mute state, ignoring our own stem muting
+    QString mask;
+    for (int i = 0; i < m_tractor->count(); i++) {
+        std::shared_ptr<Mlt::Producer> tk(m_tractor->track(i));
+        if (tk->get_int("kdenlive:audio_track") != 1) {
+            continue;
+        }
+        int hide = tk->property_exists("kdenlive:stem_restore_hide") ? tk->get_int("kdenlive:stem_restore_hide") : tk->get_int("hide");
+        mask.append((hide & 2) != 0 ? QLatin1Char('1') : QLatin1Char('0'));
+    }
+    return mask;
+}
+
+void AudioStemManager::updatePlaybackPosition(int position)
+{
+    if (m_stemTrack == nullptr) {
+        return;
+    }
+    if (audioMuteMask() != m_muteMask) {
+        // A track was muted or unmuted since the stems were rendered, they are stale:
+        // play the live mix and schedule a new render pass
+        if (m_stemsActive) {
+            activateStems(false);
+        }
+        if (!m_stabilityTimer.isActive() && !isRunning()) {
+            m_stabilityTimer.start();
+        }
+        return;
+    }
+    int chunkSize = KdenliveSettings::timelinechunks();
+    int chunk = position - position % chunkSize;
+    bool covered;
+    {
+        QMutexLocker lock(&m_chunkMutex);
+        // Require the next chunk too, so we never run out of stem right before a chunk boundary
+        covered = m_renderedChunks.contains(chunk) && m_renderedChunks.contains(chunk + chunkSize);
+    }
+    if (covered != m_stemsActive) {
+        activateStems(covered);
+    }
+}
+
+void AudioStemManager::activateStems(bool enable)
+{
+    if (m_stemTrack == nullptr || m_stemTrackIndex == -1) {
+        return;
+    }
+    m_tractor->lock();
+    if (enable) {
+        for (int i = 0; i < m_tractor->count(); i++) {
+            if (i == m_stemTrackIndex) {
+                continue;
+            }
+            std::shared_ptr<Mlt::Producer> tk(m_tractor->track(i));
+            if (tk->get_int("kdenlive:audio_track") != 1) {
+                continue;
+            }
+            int hide = tk->get_int("hide");
+            if (hide & 2) {
+                // Track is already muted by the user, leave it alone
+                continue;
+            }
+            tk->set("kdenlive:stem_restore_hide", hide);
+            tk->set("hide", hide | 2);
+        }
+        m_stemTrack->set("hide", 1);
+    } else {
+        for (int i = 0; i < m_tractor->count(); i++) {
+            std::shared_ptr<Mlt::Producer> tk(m_tractor->track(i));
+            if (tk->property_exists("kdenlive:stem_restore_hide")) {
+                tk->set("hide", tk->get_int("kdenlive:stem_restore_hide"));
+                tk->clear("kdenlive:stem_restore_hide");
+            }
+        }
+        m_stemTrack->set("hide", 3);
+    }
+    m_stemsActive = enable;
+    m_tractor->unlock();
+}
+
+void AudioStemManager::startStemRender()
+{
+    if (!m_initialized || m_stemTrack == nullptr || isRunning() || KdenliveSettings::kdenliverendererpath().isEmpty()) {
+        return;
+    }
+    int chunkSize = KdenliveSettings::timelinechunks();
+    int duration = m_tractor->get_playtime();
+    QStringList toRender;
+    {
+        QMutexLocker lock(&m_chunkMutex);
+        // Only full chunks are premixed, the trailing partial chunk always plays live
+        for (int i = 0; i + chunkSize <= duration; i += chunkSize) {
+            if (!m_renderedChunks.contains(i)) {
+                toRender << QString::number(i);
+            }
+        }
+    }
+    if (toRender.isEmpty()) {
+        return;
+    }
+    if (m_stemsActive) {
+        // Make sure the scene is serialized with the live mix audible
+        activateStems(false);
+    }
+    const QString mask = audioMuteMask();
+    if (mask != m_muteMask) {
+        // Mute states changed, all existing stems carry the wrong mix
+        QMutexLocker lock(&m_chunkMutex);
+        m_tractor->lock();
+        m_stemTrack->clear();
+        m_tractor->unlock();
+        m_renderedChunks.clear();
+        m_muteMask = mask;
+        lock.unlock();
+        startStemRender();
+        return;
+    }
+    const QString sceneList = m_cacheDir.absoluteFilePath(QStringLiteral("stems.mlt"));
+    std::shared_ptr<TimelineItemModel> timeline = pCore->currentDoc()->getTimeline(m_uuid);
+    timeline->sceneList(m_cacheDir.absolutePath(), sceneList);
+    m_chunksToRender = toRender.count();
+    m_processedChunks = 0;
+    // Mixing is cheap but decoding the sources is not, keep most cores free for playback
+    int concurrency = qBound(1, QThread::idealThreadCount() / 4, 4);
+    QStringList args{QStringLiteral("preview-chunks"),
+                     sceneList,
+                     m_cacheDir.absolutePath(),
+                     toRender.join(QLatin1Char(',')),
+                     QString::number(chunkSize - 1),
+                     pCore->getCurrentProfilePath(),
+                     QStringLiteral("flac"),
+                     QStringLiteral("acodec=flac vn=1 video_off=1"),
+                     QString::number(concurrency)};
+    m_stemProcess.start(KdenliveSettings::kdenliverendererpath(), args);
+}
+
+void AudioStemManager::receivedStderr()
+{
+    QStringList resultList = QString::fromLocal8Bit(m_stemProcess.readAllStandardError()).split(QLatin1Char('\n'), Qt::SkipEmptyParts);
+    for (auto &result : resultList) {
+        if (result.startsWith(QLatin1String("DONE:"))) {
+            int chunk = result.section(QLatin1String("DONE:"), 1).simplified().toInt();
+            m_processedChunks++;
+            QString fileName = QStringLiteral("%1.flac").arg(chunk);
+            Q_EMIT stemRender(chunk, m_cacheDir.absoluteFilePath(fileName), 1000 * m_processedChunks / qMax(1, m_chunksToRender));
+        }
+    }
+}
+
+void AudioStemManager::gotStemRender(int frame, const QString &file, int progress)
+{
+    Q_UNUSED(progress)
+    if (m_stemTrack == nullptr || file.isEmpty()) {
+        return;
+    }
+    if (m_stemTrack->is_blank_at(frame)) {
+        Mlt::Producer prod(pCore->getProjectProfile(), QString("avformat:%1").arg(file).toUtf8().constData());
+        if (prod.is_valid() && prod.get_length() == KdenliveSettings::timelinechunks()) {
+            prod.set("mlt_service", "avformat-novalidate");
+            m_tractor->lock();
+            m_stemTrack->insert_at(frame, &prod, 1);
+            m_stemTrack->consolidate_blanks();
+            m_tractor->unlock();
+            QMutexLocker lock(&m_chunkMutex);
+            m_renderedChunks << frame;
+        } else {
+            qDebug() << "// invalid stem chunk: " << file;
+            m_cacheDir.remove(QStringLiteral("%1.flac").arg(frame));
+        }
+    }
+}
+
+void AudioStemManager::processEnded(int exitCode, QProcess::ExitStatus status)
+{
+    const QString sceneList = m_cacheDir.absoluteFilePath(QStringLiteral("stems.mlt"));
+    QFile::remove(sceneList);
+    if (status == QProcess::CrashExit || exitCode != 0) {
+        qDebug() << "// audio stem rendering failed or was aborted";
+    }
+}
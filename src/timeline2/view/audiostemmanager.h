@@ -0,0 +1,103 @@
+/*
+    SPDX-FileCopyrightText: 2026 Jean-Baptiste Mardelle <jb@kdenlive.org>
+
+    SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#pragma once
+
+#include <QDir>
+#include <QMutex>
+#include <QProcess>
+#include <QTimer>
+#include <QUuid>
+#include <QVariantList>
+
+namespace Mlt {
+class Tractor;
+class Playlist;
+} // namespace Mlt
+
+/** @class AudioStemManager
+    @brief Background audio premix for heavy multitrack timelines.
+    Timelines with many audio tracks force MLT to decode and mix every track live during
+    playback. This manager renders chunks of the full audio mix to cached stereo stems
+    once a zone has been left unmodified for a few seconds, following the same chunk
+    mechanism as the timeline preview. The stems are inserted on an extra hidden audio
+    track, and when the playhead enters a fully premixed zone the live audio tracks are
+    muted and the stem track takes over, so only recently edited zones are mixed live.
+ */
+class AudioStemManager : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit AudioStemManager(Mlt::Tractor *tractor, QUuid uuid, QObject *parent = nullptr);
+    ~AudioStemManager() override;
+    /** @brief: initialize cache folder and timers, return false if error. */
+    bool initialize();
+    /** @brief: Create the stem track if not existing. */
+    bool buildStemTrack();
+    /** @brief: Delete the stem track. */
+    void deleteStemTrack();
+    /** @brief: Re-add our stem track to the tractor. */
+    void reconnectTrack();
+    /** @brief: Remove our stem track from the tractor. */
+    void disconnectTrack();
+    /** @brief: stops current rendering process. */
+    void abortRendering();
+    /** @brief Returns true if the render process is still running */
+    bool isRunning() const;
+    /** @brief: Returns directory currently used to store the stem files. */
+    const QDir getCacheDir() const;
+
+public Q_SLOTS:
+    /** @brief: a timeline operation caused changes to frames between startFrame and endFrame,
+     *  drop the stems covering them and restart the stability window. */
+    void invalidateStems(int startFrame, int endFrame);
+    /** @brief: playback position moved, switch between the live mix and the cached stems. */
+    void updatePlaybackPosition(int position);
+    /** @brief: Render all stable chunks that have no stem yet. */
+    void startStemRender();
+
+private Q_SLOTS:
+    /** @brief: Process stem rendering output. */
+    void receivedStderr();
+    void processEnded(int exitCode, QProcess::ExitStatus status);
+    /** @brief: A stem chunk has been rendered, plug it in our track. */
+    void gotStemRender(int frame, const QString &file, int progress);
+
+private:
+    /** @brief: Mute the live audio tracks and unmute the stem track, or the reverse.
+     *  The previous mute state of each track is kept in a kdenlive:stem_restore_hide
+     *  property so it can always be restored, even from a project saved mid-playback. */
+    void activateStems(bool enable);
+    /** @brief: User mute state of every audio track, used to detect stale stems. */
+    const QString audioMuteMask() const;
+
+    Mlt::Tractor *m_tractor;
+    QUuid m_uuid;
+    Mlt::Playlist *m_stemTrack{nullptr};
+    int m_stemTrackIndex{-1};
+    bool m_initialized{false};
+    /** @brief: True when playback currently consumes the stems instead of the live mix. */
+    bool m_stemsActive{false};
+    /** @brief: The count of chunks to process - to calculate job progress */
+    int m_chunksToRender{0};
+    /** @brief: The count of already processed chunks - to calculate job progress */
+    int m_processedChunks{0};
+    /** @brief: The kdenlive audio stem render process. */
+    QProcess m_stemProcess;
+    /** @brief: The directory used to store the stem files. */
+    QDir m_cacheDir;
+    /** @brief: Restarted on every edit; stems render only once the timeline stayed quiet. */
+    QTimer m_stabilityTimer;
+    mutable QMutex m_chunkMutex;
+    QVariantList m_renderedChunks;
+    /** @brief: The mute mask the existing stems were rendered with. */
+    QString m_muteMask;
+
+Q_SIGNALS:
+    void abortStems();
+    void stemRender(int frame, const QString &file, int progress);
+};
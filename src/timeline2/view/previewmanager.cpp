@@ -14,6 +14,8 @@
 #include "mainwindow.h"
 #include "monitor/monitor.h"
 #include "profiles/profilemodel.hpp"
+#include "timeline2/model/timelineitemmodel.hpp"
+#include "timeline2/model/trackmodel.hpp"
 #include "timeline2/view/timelinecontroller.h"
 #include "timeline2/view/timelinewidget.h"
 #include "xml/xml.hpp"
@@ -25,6 +27,7 @@
 #include <QMutexLocker>
 #include <QSaveFile>
 #include <QStandardPaths>
+#include <QThread>
 
 PreviewManager::PreviewManager(Mlt::Tractor *tractor, QUuid uuid, QObject *parent)
     : QObject(parent)
@@ -534,6 +537,31 @@ void PreviewManager::abortRendering()
     Q_EMIT previewRender(-1, QString(), 1000);
 }
 
+// static
+void PreviewManager::applyRenderMutes(QDomDocument &doc)
+{
+    // Timeline tracks are serialized as sub-tractors; collect those flagged for render mute
+    QStringList mutedIds;
+    QDomNodeList tractors = doc.elementsByTagName(QStringLiteral("tractor"));
+    for (int i = 0; i < tractors.count(); ++i) {
+        QDomElement tractor = tractors.at(i).toElement();
+        if (Xml::getXmlProperty(tractor, QStringLiteral("kdenlive:render_mute")).toInt() == 1) {
+            mutedIds << tractor.attribute(QStringLiteral("id"));
+        }
+    }
+    if (mutedIds.isEmpty()) {
+        return;
+    }
+    // Hide both audio and video of the flagged tracks so the consumer skips them entirely
+    QDomNodeList tracks = doc.elementsByTagName(QStringLiteral("track"));
+    for (int i = 0; i < tracks.count(); ++i) {
+        QDomElement track = tracks.at(i).toElement();
+        if (mutedIds.contains(track.attribute(QStringLiteral("producer")))) {
+            track.setAttribute(QStringLiteral("hide"), QStringLiteral("both"));
+        }
+    }
+}
+
 bool PreviewManager::hasDefinedRange() const
 {
     return (!m_renderedChunks.isEmpty() || !m_dirtyChunks.isEmpty());
@@ -549,17 +577,36 @@ void PreviewManager::startPreviewRender()
         // clear log
         m_errorLog.clear();
         const QString sceneList = m_cacheDir.absoluteFilePath(QStringLiteral("preview.mlt"));
+        std::shared_ptr<TimelineItemModel> timeline = pCore->currentDoc()->getTimeline(m_uuid);
+        bool hasRenderMutes = false;
+        for (int i = 0; i < timeline->getTracksCount(); ++i) {
+            if (timeline->getTrackById_const(timeline->getTrackIndexFromPosition(i))->isRenderMuted()) {
+                hasRenderMutes = true;
+                break;
+            }
+        }
         if (!KdenliveSettings::proxypreview() && pCore->currentDoc()->useProxy()) {
-            const QString playlist =
-                pCore->projectItemModel()->sceneList(m_cacheDir.absolutePath(), QString(), pCore->currentDoc()->getTimeline(m_uuid)->tractor(), -1);
+            const QString playlist = pCore->projectItemModel()->sceneList(m_cacheDir.absolutePath(), QString(), timeline->tractor(), -1);
             QDomDocument doc;
             doc.setContent(playlist);
             KdenliveDoc::useOriginals(doc);
+            if (hasRenderMutes) {
+                applyRenderMutes(doc);
+            }
             if (!Xml::docContentToFile(doc, sceneList)) {
                 return;
             }
         } else {
-            pCore->currentDoc()->getTimeline(m_uuid)->sceneList(m_cacheDir.absolutePath(), sceneList);
+            timeline->sceneList(m_cacheDir.absolutePath(), sceneList);
+            if (hasRenderMutes) {
+                QDomDocument doc;
+                if (Xml::docContentFromFile(doc, sceneList, false)) {
+                    applyRenderMutes(doc);
+                    if (!Xml::docContentToFile(doc, sceneList)) {
+                        return;
+                    }
+                }
+            }
         }
         m_previewTimer.stop();
         doPreviewRender(sceneList);
@@ -599,6 +646,9 @@ void PreviewManager::doPreviewRender(const QString &scene)
     m_chunksToRender = m_dirtyChunks.count();
     m_processedChunks = 0;
     int chunkSize = KdenliveSettings::timelinechunks();
+    // Render several chunks concurrently; keep half the cores free since each
+    // avformat consumer spawns its own encoding threads
+    int concurrency = qBound(1, QThread::idealThreadCount() / 2, 8);
     QStringList args{QStringLiteral("preview-chunks"),
                      scene,
                      m_cacheDir.absolutePath(),
@@ -606,7 +656,8 @@ void PreviewManager::doPreviewRender(const QString &scene)
                      QString::number(chunkSize - 1),
                      pCore->getCurrentProfilePath(),
                      m_extension,
-                     m_consumerParams.join(QLatin1Char(' '))};
+                     m_consumerParams.join(QLatin1Char(' ')),
+                     QString::number(concurrency)};
     pCore->currentDoc()->previewProgress(0);
     m_previewProcess.start(KdenliveSettings::kdenliverendererpath(), args);
     if (m_previewProcess.waitForStarted()) {
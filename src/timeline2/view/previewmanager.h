@@ -9,6 +9,7 @@
 #include "definitions.h"
 
 #include <QDir>
+#include <QDomDocument>
 #include <QFuture>
 #include <QMutex>
 #include <QProcess>
@@ -115,6 +116,9 @@ private:
     void corruptedChunk(int workingPreview, const QString &fileName);
     /** @brief: Get a compressed list of chunks, like: "0-500,525,575". */
     const QStringList getCompressedList(const QVariantList items) const;
+    /** @brief: Hide all tracks carrying the kdenlive:render_mute flag in the preview scene,
+     *  so preview chunks only render the tracks the editor cares about. */
+    static void applyRenderMutes(QDomDocument &doc);
 
     /** @brief Compare two chunks for usage by std::sort
      * @returns true if @param c1 is less than @param c2
@@ -584,47 +584,48 @@ Rectangle {
                 
             }
 
+            TimelineClipMarkers {
+                // Clip markers, all drawn in one batched item instead of per-marker item trees
+                id: clipMarkers
+                anchors.fill: parent
+                markersModel: markers ? markers : null
+                inPoint: clipRoot.inPoint
+                maxDuration: clipRoot.maxDuration
+                timeScale: clipRoot.timeScale
+                speed: clipRoot.speed
+                borderWidth: itemBorder.border.width
+                showLabels: timeline.showMarkers && root.maxLabelWidth > root.baseUnit
+                labelOffset: label.height
+                maxLabelWidth: root.maxLabelWidth
+                font: miniFont
+            }
+
             Repeater {
-                // Clip markers
+                // Invisible hit areas over the marker labels painted above
                 model: markers
                 delegate:
-                Item {
-                    visible: markerBase.x >= 0 && markerBase.x < clipRoot.width
-                    Rectangle {
-                        id: markerBase
-                        width: 1
-                        height: container.height
-                        x: clipRoot.speed < 0
-                           ? (clipRoot.maxDuration - clipRoot.inPoint) * clipRoot.timeScale + (Math.round(model.frame / clipRoot.speed)) * clipRoot.timeScale - itemBorder.border.width
-                           : (Math.round(model.frame / clipRoot.speed) - clipRoot.inPoint) * clipRoot.timeScale - itemBorder.border.width;
-                        color: model.color
-                        ToolTip.visible: markerArea.containsMouse
-                        ToolTip.text: textMetrics.text
-                        ToolTip.delay: 1000
-                        ToolTip.timeout: 5000
-                    }
-                    Rectangle {
-                        visible: mlabel.visible
-                        opacity: 0.7
-                        x: markerBase.x
-                        radius: 2
-                        width: mlabel.width + 4
-                        height: mlabel.height
-                        y: mlabel.y
-                        color: model.color
-                        MouseArea {
-                            z: 10
-                            id: markerArea
-                            anchors.fill: parent
-                            acceptedButtons: Qt.LeftButton
-                            cursorShape: Qt.PointingHandCursor
-                            hoverEnabled: true
-                            onDoubleClicked: timeline.editMarker(clipRoot.clipId, model.frame)
-                            onClicked: proxy.position = clipRoot.modelStart + (clipRoot.speed < 0
-                                                                               ? (clipRoot.maxDuration - clipRoot.inPoint) * clipRoot.timeScale + (Math.round(model.frame / clipRoot.speed))
-                                                                               : (Math.round(model.frame / clipRoot.speed) - clipRoot.inPoint))
-                        }
-                    }
+                MouseArea {
+                    property double markerX: clipRoot.speed < 0
+                       ? (clipRoot.maxDuration - clipRoot.inPoint) * clipRoot.timeScale + (Math.round(model.frame / clipRoot.speed)) * clipRoot.timeScale - itemBorder.border.width
+                       : (Math.round(model.frame / clipRoot.speed) - clipRoot.inPoint) * clipRoot.timeScale - itemBorder.border.width;
+                    z: 10
+                    visible: markerX >= 0 && markerX < clipRoot.width && clipMarkers.showLabels && height < container.height
+                             && (markerX > width || container.height > 2 * height)
+                    x: markerX
+                    y: Math.min(label.height, container.height - height)
+                    width: textMetrics.boundingRect.width + 4
+                    height: textMetrics.boundingRect.height
+                    acceptedButtons: Qt.LeftButton
+                    cursorShape: Qt.PointingHandCursor
+                    hoverEnabled: true
+                    ToolTip.visible: containsMouse
+                    ToolTip.text: model.comment
+                    ToolTip.delay: 1000
+                    ToolTip.timeout: 5000
+                    onDoubleClicked: timeline.editMarker(clipRoot.clipId, model.frame)
+                    onClicked: proxy.position = clipRoot.modelStart + (clipRoot.speed < 0
+                                                                       ? (clipRoot.maxDuration - clipRoot.inPoint) * clipRoot.timeScale + (Math.round(model.frame / clipRoot.speed))
+                                                                       : (Math.round(model.frame / clipRoot.speed) - clipRoot.inPoint))
                     TextMetrics {
                         id: textMetrics
                         font: miniFont
@@ -632,15 +633,6 @@ Rectangle {
                         elide: clipRoot.timeScale > 1 ? Text.ElideNone : Text.ElideRight
                         elideWidth: root.maxLabelWidth
                     }
-                    Text {
-                        id: mlabel
-                        visible: timeline.showMarkers && textMetrics.elideWidth > root.baseUnit && height < container.height && (markerBase.x > mlabel.width || container.height > 2 * height)
-                        text: textMetrics.elidedText
-                        font: miniFont
-                        x: markerBase.x + 1
-                        y: Math.min(label.height, container.height - height)
-                        color: 'white'
-                    }
                 }
             }
 
@@ -1761,6 +1761,7 @@ Rectangle {
                         pixelAligned: true
                         onContentXChanged: {
                             root.mousePosChanged(scrollView.contentX - trackHeaders.width)
+                            thumbPrefetchTimer.restart()
                         }
                         /*
                          // Replaced by our custom ZoomBar
@@ -2124,9 +2125,36 @@ Rectangle {
                                 }
                             }
                         }
-                        Repeater { 
-                            id: guidesRepeater
-                            model: guidesDelegateModel
+                        Canvas {
+                            // Paints all visible guide lines from one packed array instead of
+                            // instantiating a delegate per guide
+                            id: guidesOverlay
+                            x: scrollView.contentX
+                            width: scrollView.width
+                            height: tracksContainerArea.height
+                            z: 20
+                            property int scrollStart: root.scrollMin
+                            property double scale: root.timeScale
+                            onScrollStartChanged: requestPaint()
+                            onScaleChanged: requestPaint()
+                            onWidthChanged: requestPaint()
+                            onPaint: {
+                                var ctx = getContext("2d")
+                                ctx.clearRect(0, 0, width, height)
+                                var guides = guidesModel.guidesInRange(root.scrollMin, root.scrollMax + 1)
+                                for (var i = 0; i < guides.length; i += 2) {
+                                    ctx.fillStyle = guides[i + 1]
+                                    ctx.fillRect(Math.round(guides[i] * root.timeScale) - scrollView.contentX, 0, 1, height)
+                                }
+                            }
+                            Connections {
+                                target: guidesModel
+                                function onRowsInserted() { guidesOverlay.requestPaint() }
+                                function onRowsRemoved() { guidesOverlay.requestPaint() }
+                                function onDataChanged() { guidesOverlay.requestPaint() }
+                                function onModelReset() { guidesOverlay.requestPaint() }
+                                function onLayoutChanged() { guidesOverlay.requestPaint() }
+                            }
                         }
                         Rectangle {
                             id: cursor
@@ -2136,6 +2164,12 @@ Rectangle {
                             opacity: 1
                             height: tracksContainerArea.height
                             x: Math.round(root.consumerPosition * root.timeScale)
+                            // Position updates are rate limited during playback, glide
+                            // between them so the cursor does not visibly step
+                            Behavior on x {
+                                enabled: proxy && proxy.speed !== 0
+                                NumberAnimation { duration: 50; easing.type: Easing.Linear }
+                            }
                         }
                     }
                     Kdenlive.ZoomBar {
@@ -2295,23 +2329,6 @@ Rectangle {
     }
 
 
-    DelegateModel {
-        id: guidesDelegateModel
-        model: guidesModel
-        Item {
-            id: guideRoot
-            z: 20
-            Rectangle {
-                id: guideBase
-                width: 1
-                height: tracksContainerArea.height
-                x: Math.round(model.frame * root.timeScale);
-                color: model.color
-            }
-        }
-    }
-
-
     DelegateModel {
         id: subtitleDelegateModel
         model: subtitleModel
@@ -2339,6 +2356,17 @@ Rectangle {
         }
     }
 
+    // Prefetch thumbnails for the visible clips shortly after scrolling settles, so
+    // panning does not show placeholder thumbs.
+    Timer {
+        id: thumbPrefetchTimer
+        interval: 250
+        repeat: false
+        onTriggered: {
+            timeline.prefetchVisibleThumbs(Math.max(0, Math.floor(scrollView.contentX / root.timeScale)), Math.ceil(scrollView.width / root.timeScale))
+        }
+    }
+
     // This provides continuous scrolling at the left/right edges.
     Timer {
         id: scrollTimer
@@ -6,14 +6,19 @@
 */
 
 #include "assets/keyframes/model/keyframemodel.hpp"
+#include "bin/model/markerlistmodel.hpp"
 #include "bin/projectitemmodel.h"
 #include "capture/mediacapture.h"
 #include "core.h"
 #include "kdenlivesettings.h"
+#include <QAbstractItemModel>
 #include <QElapsedTimer>
+#include <QHash>
+#include <QImage>
 #include <QPainter>
 #include <QPainterPath>
 #include <QQuickPaintedItem>
+#include <QQuickWindow>
 #include <QtMath>
 #include <cmath>
 
@@ -121,6 +126,113 @@ private:
     QColor m_color;
 };
 
+/** @brief Paints all markers of a clip (line, label chip and comment) in one item.
+ *  The per-marker item trees the timeline previously created multiply with the clip
+ *  count and dominated the scene graph on large projects; batching them into a single
+ *  texture keeps the node count per clip constant. */
+class TimelineClipMarkers : public QQuickPaintedItem
+{
+    Q_OBJECT
+    Q_PROPERTY(QObject *markersModel READ markersModel WRITE setMarkersModel NOTIFY markersChanged)
+    Q_PROPERTY(int inPoint MEMBER m_inPoint NOTIFY propertyChanged)
+    Q_PROPERTY(int maxDuration MEMBER m_maxDuration NOTIFY propertyChanged)
+    Q_PROPERTY(double timeScale MEMBER m_timeScale NOTIFY propertyChanged)
+    Q_PROPERTY(double speed MEMBER m_speed NOTIFY propertyChanged)
+    Q_PROPERTY(int borderWidth MEMBER m_borderWidth NOTIFY propertyChanged)
+    Q_PROPERTY(bool showLabels MEMBER m_showLabels NOTIFY propertyChanged)
+    Q_PROPERTY(double labelOffset MEMBER m_labelOffset NOTIFY propertyChanged)
+    Q_PROPERTY(double maxLabelWidth MEMBER m_maxLabelWidth NOTIFY propertyChanged)
+    Q_PROPERTY(QFont font MEMBER m_font NOTIFY propertyChanged)
+
+public:
+    TimelineClipMarkers(QQuickItem *parent = nullptr)
+        : QQuickPaintedItem(parent)
+    {
+        setAntialiasing(false);
+        setEnabled(false);
+        connect(this, &TimelineClipMarkers::propertyChanged, this, static_cast<void (QQuickItem::*)()>(&QQuickItem::update));
+    }
+
+    QObject *markersModel() const { return m_model; }
+    void setMarkersModel(QObject *model)
+    {
+        if (model == m_model) {
+            return;
+        }
+        if (m_model) {
+            disconnect(m_model, nullptr, this, nullptr);
+        }
+        m_model = qobject_cast<QAbstractItemModel *>(model);
+        if (m_model) {
+            connect(m_model, &QAbstractItemModel::dataChanged, this, &TimelineClipMarkers::requestUpdate);
+            connect(m_model, &QAbstractItemModel::rowsInserted, this, &TimelineClipMarkers::requestUpdate);
+            connect(m_model, &QAbstractItemModel::rowsRemoved, this, &TimelineClipMarkers::requestUpdate);
+            connect(m_model, &QAbstractItemModel::modelReset, this, &TimelineClipMarkers::requestUpdate);
+            connect(m_model, &QAbstractItemModel::layoutChanged, this, &TimelineClipMarkers::requestUpdate);
+        }
+        Q_EMIT markersChanged();
+        update();
+    }
+
+    void paint(QPainter *painter) override
+    {
+        if (m_model == nullptr || m_timeScale <= 0. || qFuzzyIsNull(m_speed)) {
+            return;
+        }
+        painter->setFont(m_font);
+        QFontMetricsF metrics(m_font);
+        const double textHeight = metrics.height();
+        const int rows = m_model->rowCount();
+        for (int row = 0; row < rows; row++) {
+            const QModelIndex ix = m_model->index(row, 0);
+            const int frame = m_model->data(ix, MarkerListModel::FrameRole).toInt();
+            const double x = m_speed < 0 ? (m_maxDuration - m_inPoint) * m_timeScale + std::round(frame / m_speed) * m_timeScale - m_borderWidth
+                                         : (std::round(frame / m_speed) - m_inPoint) * m_timeScale - m_borderWidth;
+            if (x < 0 || x >= width()) {
+                continue;
+            }
+            const QColor color = m_model->data(ix, MarkerListModel::ColorRole).value<QColor>();
+            painter->fillRect(QRectF(x, 0, 1, height()), color);
+            if (!m_showLabels || textHeight >= height()) {
+                continue;
+            }
+            const QString comment = m_model->data(ix, MarkerListModel::CommentRole).toString();
+            const QString text = m_timeScale > 1 ? comment : metrics.elidedText(comment, Qt::ElideRight, m_maxLabelWidth);
+            const double textWidth = metrics.horizontalAdvance(text);
+            if (x <= textWidth && height() <= 2 * textHeight) {
+                continue;
+            }
+            const double y = qMin(m_labelOffset, height() - textHeight);
+            painter->setOpacity(0.7);
+            QPainterPath chip;
+            chip.addRoundedRect(QRectF(x, y, textWidth + 4, textHeight), 2, 2);
+            painter->fillPath(chip, color);
+            painter->setOpacity(1);
+            painter->setPen(Qt::white);
+            painter->drawText(QRectF(x + 1, y, textWidth + 4, textHeight), Qt::AlignLeft | Qt::AlignVCenter, text);
+        }
+    }
+
+Q_SIGNALS:
+    void markersChanged();
+    void propertyChanged();
+
+private Q_SLOTS:
+    void requestUpdate() { update(); }
+
+private:
+    QAbstractItemModel *m_model{nullptr};
+    int m_inPoint{0};
+    int m_maxDuration{0};
+    double m_timeScale{1.};
+    double m_speed{1.};
+    int m_borderWidth{0};
+    bool m_showLabels{false};
+    double m_labelOffset{0.};
+    double m_maxLabelWidth{0.};
+    QFont m_font;
+};
+
 class TimelineWaveform : public QQuickPaintedItem
 {
     Q_OBJECT
@@ -163,6 +275,9 @@ public:
                 } else {
                     // Clip changed, reset levels
                     m_audioLevels.clear();
+                    m_tierCache.clear();
+                    m_tierSteps.clear();
+                    m_tiles.clear();
                 }
             }
         });
@@ -178,24 +293,104 @@ public:
         if (m_binId.isEmpty()) {
             return;
         }
-        if (m_audioLevels.isEmpty() && m_stream >= 0) {
-            m_audioLevels = pCore->projectItemModel()->getAudioLevelsByBinID(m_binId, m_stream);
+        qreal indicesPrPixel = m_channels / m_scale * qAbs(m_speed); // qreal(m_outPoint - m_inPoint) / width() * m_precisionFactor;
+        // Pick the tier of the peak pyramid matching the zoom level, so zoomed out clips read the
+        // pre-downsampled levels instead of sampling the per-frame data
+        const double framesPrPixel = indicesPrPixel / m_channels;
+        int resolution = framesPrPixel >= 60 ? 2 : framesPrPixel >= 10 ? 1 : 0;
+        if ((m_audioLevels.isEmpty() || resolution != m_levelsResolution) && m_stream >= 0) {
+            if (m_tierCache.contains(resolution)) {
+                // Tier already fetched during this zoom session, levels are implicitly shared
+                m_audioLevels = m_tierCache.value(resolution);
+                m_tierStep = m_tierSteps.value(resolution);
+            } else {
+                m_audioLevels = pCore->projectItemModel()->getAudioLevelsByBinID(m_binId, m_stream, resolution, &m_tierStep);
+                if (m_audioLevels.isEmpty() && resolution != 0) {
+                    // Older cache without pyramid tiers, fall back to the per-frame levels
+                    resolution = 0;
+                    m_audioLevels = pCore->projectItemModel()->getAudioLevelsByBinID(m_binId, m_stream, resolution, &m_tierStep);
+                }
+                if (!m_audioLevels.isEmpty()) {
+                    m_tierCache.insert(resolution, m_audioLevels);
+                    m_tierSteps.insert(resolution, m_tierStep);
+                }
+            }
+            m_levelsResolution = resolution;
             if (m_audioLevels.isEmpty()) {
                 return;
             }
             m_audioMax = KdenliveSettings::normalizechannels() ? pCore->projectItemModel()->getAudioMaxLevel(m_binId, m_stream) : 0;
         }
+        if (m_audioLevels.isEmpty()) {
+            return;
+        }
 
         if (m_outPoint == m_inPoint) {
             return;
         }
+        // Only repaint the damaged span when a partial update was requested, the
+        // texture keeps the previously painted levels outside of it
+        QRectF clipRect = painter->clipBoundingRect();
+        if (clipRect.isEmpty()) {
+            clipRect = QRectF(0, 0, width(), height());
+        }
+        // The levels are rasterized once into fixed width tiles and blitted from
+        // there, so resizing the item (trimming a clip) or unrelated property
+        // updates only rasterize the tiles that were never painted before. The
+        // tile cache is dropped whenever a parameter affecting the drawing changes
+        TileParams currentParams;
+        currentParams.scale = m_scale;
+        currentParams.inPoint = m_inPoint;
+        currentParams.channels = m_channels;
+        currentParams.speed = m_speed;
+        currentParams.separateChannels = KdenliveSettings::displayallchannels();
+        currentParams.height = int(height());
+        currentParams.color = m_color.rgba();
+        currentParams.color2 = m_color2.rgba();
+        currentParams.bgColor = m_bgColor.rgba();
+        currentParams.opaquePaint = m_opaquePaint;
+        currentParams.audioMax = m_audioMax;
+        currentParams.resolution = m_levelsResolution;
+        currentParams.repaintFlag = m_repaint;
+        currentParams.dpr = window() ? window()->effectiveDevicePixelRatio() : 1.;
+        if (!(currentParams == m_tileParams)) {
+            m_tiles.clear();
+            m_tileParams = currentParams;
+        }
+        const int firstTile = qMax(0, int(clipRect.left()) / tileWidth);
+        const int lastTile = int(clipRect.right()) / tileWidth;
+        for (int t = firstTile; t <= lastTile; ++t) {
+            auto it = m_tiles.constFind(t);
+            if (it == m_tiles.constEnd()) {
+                if (m_tiles.size() >= maxCachedTiles) {
+                    m_tiles.clear();
+                }
+                QImage tile(qRound(tileWidth * currentParams.dpr), qRound(height() * currentParams.dpr), QImage::Format_ARGB32_Premultiplied);
+                tile.setDevicePixelRatio(currentParams.dpr);
+                tile.fill(Qt::transparent);
+                QPainter tilePainter(&tile);
+                tilePainter.translate(-t * tileWidth, 0);
+                paintLevels(&tilePainter, QRectF(t * tileWidth, 0, tileWidth, height()));
+                tilePainter.end();
+                it = m_tiles.insert(t, tile);
+            }
+            painter->drawImage(QPointF(t * tileWidth, 0), *it);
+        }
+    }
+
+private:
+    /** @brief Rasterize the levels covering @a clipRect, in item coordinates */
+    void paintLevels(QPainter *painter, const QRectF &clipRect)
+    {
+        const qreal indicesPrPixel = m_channels / m_scale * qAbs(m_speed);
         QRectF bgRect(0, 0, width(), height());
         if (m_opaquePaint) {
             painter->fillRect(bgRect, m_bgColor);
         }
         QPen pen(painter->pen());
-        double increment = qMax(1., m_scale / m_channels);           // qMax(1., 1. / qAbs(indicesPrPixel));
-        qreal indicesPrPixel = m_channels / m_scale * qAbs(m_speed); // qreal(m_outPoint - m_inPoint) / width() * m_precisionFactor;
+        double increment = qMax(1., m_scale / m_channels); // qMax(1., 1. / qAbs(indicesPrPixel));
+        // Index scale converting a pixel position to an index in the selected tier
+        const qreal idxScale = indicesPrPixel / m_tierStep;
         int h = int(height());
         double offset = 0;
         bool pathDraw = increment > 1.2;
@@ -219,26 +414,26 @@ public:
         bool reverse = m_speed < 0;
         int maxLength = m_audioLevels.length();
         if (reverse) {
-            m_inPoint = qMin(m_inPoint, maxLength - m_channels);
+            m_inPoint = qMin(m_inPoint, maxLength * m_tierStep - m_channels);
         }
         int startPos = int(m_inPoint / indicesPrPixel);
         if (!KdenliveSettings::displayallchannels()) {
             // Draw merged channels
-            double i = 0;
-            int j = 0;
+            int j = qMax(0, int(clipRect.left() / increment));
+            double i = j * increment;
             int idx = 0;
             QPainterPath path;
             if (pathDraw) {
-                path.moveTo(j - 1, height());
+                path.moveTo(i - 1, height());
             }
-            for (; i <= width(); j++) {
+            for (; i <= clipRect.right(); j++) {
                 double level;
                 i = j * increment;
                 if (reverse) {
-                    idx = qCeil((startPos - i) * indicesPrPixel);
+                    idx = qCeil((startPos - i) * idxScale);
                     idx -= idx % m_channels;
                 } else {
-                    idx = qCeil((startPos + i) * indicesPrPixel);
+                    idx = qCeil((startPos + i) * idxScale);
                     idx += idx % m_channels;
                 }
                 i -= offset;
@@ -273,7 +468,7 @@ public:
                 // y is channel median pos
                 double y = (channel * channelHeight) + channelHeight / 2;
                 QPainterPath path;
-                path.moveTo(-1, y);
+                path.moveTo(qMax(0., clipRect.left()) - 1, y);
                 if (channel % 2 == 0) {
                     // Add dark background on odd channels
                     painter->setOpacity(0.2);
@@ -286,20 +481,20 @@ public:
                 painter->setOpacity(0.5);
                 pen.setWidthF(0);
                 painter->setPen(pen);
-                painter->drawLine(QLineF(0., y, width(), y));
+                painter->drawLine(QLineF(clipRect.left(), y, clipRect.right(), y));
                 pen.setWidth(int(ceil(increment)));
                 painter->setPen(pathDraw ? Qt::NoPen : pen);
                 painter->setOpacity(1);
-                double i = 0;
-                int j = 0;
+                int j = qMax(0, int(clipRect.left() / increment));
+                double i = j * increment;
                 int idx = 0;
-                for (; i <= width(); j++) {
+                for (; i <= clipRect.right(); j++) {
                     i = j * increment;
                     if (reverse) {
-                        idx = qCeil((startPos - i) * indicesPrPixel);
+                        idx = qCeil((startPos - i) * idxScale);
                         idx -= idx % m_channels;
                     } else {
-                        idx = qCeil((startPos + i) * indicesPrPixel);
+                        idx = qCeil((startPos + i) * idxScale);
                         idx += idx % m_channels;
                     }
                     i -= offset;
@@ -336,6 +531,12 @@ Q_SIGNALS:
 
 private:
     QVector<uint8_t> m_audioLevels;
+    /** Pyramid tier currently held in m_audioLevels, and the frames each of its levels covers */
+    int m_levelsResolution{0};
+    int m_tierStep{1};
+    /** Tiers already fetched for this clip, so flipping zoom tiers does not query the bin model again */
+    QHash<int, QVector<uint8_t>> m_tierCache;
+    QHash<int, int> m_tierSteps;
     int m_inPoint;
     int m_outPoint;
     QString m_binId;
@@ -354,6 +555,39 @@ private:
     bool m_firstChunk;
     bool m_opaquePaint;
     int m_index;
+    /** Width of one cached waveform tile, in device independent pixels */
+    static const int tileWidth = 256;
+    /** Upper bound on cached tiles per item, the cache is flushed above it */
+    static const int maxCachedTiles = 256;
+    /** The drawing parameters the cached tiles were rasterized with */
+    struct TileParams
+    {
+        double scale{0.};
+        int inPoint{-1};
+        int channels{0};
+        double speed{1.};
+        bool separateChannels{false};
+        int height{0};
+        QRgb color{0};
+        QRgb color2{0};
+        QRgb bgColor{0};
+        bool opaquePaint{false};
+        double audioMax{0.};
+        int resolution{-1};
+        bool repaintFlag{false};
+        qreal dpr{1.};
+        bool operator==(const TileParams &other) const
+        {
+            return qFuzzyCompare(scale + 1., other.scale + 1.) && inPoint == other.inPoint && channels == other.channels &&
+                   qFuzzyCompare(speed, other.speed) && separateChannels == other.separateChannels && height == other.height && color == other.color &&
+                   color2 == other.color2 && bgColor == other.bgColor && opaquePaint == other.opaquePaint &&
+                   qFuzzyCompare(audioMax + 1., other.audioMax + 1.) && resolution == other.resolution && repaintFlag == other.repaintFlag &&
+                   qFuzzyCompare(dpr, other.dpr);
+        }
+    };
+    /** Rasterized waveform tiles, keyed by their horizontal tile index */
+    QHash<int, QImage> m_tiles;
+    TileParams m_tileParams;
 };
 
 class TimelineRecWaveform : public QQuickPaintedItem
@@ -386,7 +620,17 @@ public:
         // setRenderTarget(QQuickPaintedItem::FramebufferObject);
         // setMipmap(true);
         // setTextureSize(QSize(1, 1));
-        connect(this, &TimelineRecWaveform::propertyChanged, this, static_cast<void (QQuickItem::*)()>(&QQuickItem::update));
+        connect(this, &TimelineRecWaveform::propertyChanged, this, [&]() {
+            const int maxLength = pCore->getAudioDevice()->recLevels().length();
+            if (m_paintedLevels > 0 && m_inPoint == m_paintedInPoint && maxLength > m_paintedLevels) {
+                // Capture only appended levels, repaint just the span they cover
+                const qreal indicesPrPixel = m_channels / m_scale;
+                const int x = qMax(0, int((m_paintedLevels - m_inPoint) / indicesPrPixel) - 2);
+                update(QRect(x, 0, int(width()) - x, int(height())));
+            } else {
+                update();
+            }
+        });
     }
 
     void paint(QPainter *painter) override
@@ -399,6 +643,11 @@ public:
         if (m_outPoint == m_inPoint) {
             return;
         }
+        // Only repaint the damaged span, the texture keeps the levels painted before
+        QRectF clipRect = painter->clipBoundingRect();
+        if (clipRect.isEmpty()) {
+            clipRect = QRectF(0, 0, width(), height());
+        }
         QRectF bgRect(0, 0, width(), height());
         if (m_opaquePaint) {
             painter->fillRect(bgRect, m_bgColor);
@@ -425,14 +674,14 @@ public:
         painter->setPen(pen);
         int startPos = int(m_inPoint / indicesPrPixel);
         // Draw merged channels
-        double i = 0;
-        int j = 0;
+        int j = qMax(0, int(clipRect.left() / increment));
+        double i = j * increment;
         int idx = 0;
         QPainterPath path;
         if (pathDraw) {
-            path.moveTo(j - 1, height());
+            path.moveTo(i - 1, height());
         }
-        for (; i <= width(); j++) {
+        for (; i <= clipRect.right(); j++) {
             double level;
             i = j * increment;
             idx = qCeil((startPos + i) * indicesPrPixel);
@@ -454,6 +703,8 @@ public:
             path.lineTo(i, height());
             painter->drawPath(path);
         }
+        m_paintedLevels = maxLength;
+        m_paintedInPoint = m_inPoint;
     }
 
 Q_SIGNALS:
@@ -476,11 +727,16 @@ private:
     bool m_firstChunk;
     bool m_opaquePaint;
     int m_index;
+    /** Number of capture levels painted so far and the in point they were painted
+     *  for, used to repaint only the span of freshly appended levels */
+    int m_paintedLevels{0};
+    int m_paintedInPoint{-1};
 };
 
 void registerTimelineItems()
 {
     qmlRegisterType<TimelineTriangle>("Kdenlive.Controls", 1, 0, "TimelineTriangle");
+    qmlRegisterType<TimelineClipMarkers>("Kdenlive.Controls", 1, 0, "TimelineClipMarkers");
     qmlRegisterType<TimelinePlayhead>("Kdenlive.Controls", 1, 0, "TimelinePlayhead");
     qmlRegisterType<TimelineWaveform>("Kdenlive.Controls", 1, 0, "TimelineWaveform");
     qmlRegisterType<TimelineRecWaveform>("Kdenlive.Controls", 1, 0, "TimelineRecWaveform");
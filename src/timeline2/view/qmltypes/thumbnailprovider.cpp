@@ -39,24 +39,32 @@ QImage ThumbnailProvider::requestImage(const QString &id, QSize *size, const QSi
                 // for endless loopable clips, we rewrite the position
                 frameNumber = frameNumber - ((frameNumber / duration) * duration);
             }
-            result = ThumbnailCache::get()->getThumbnail(binClip->hashForThumbs(), binId, frameNumber);
+            const QString thumbsHash = binClip->hashForThumbs();
+            result = ThumbnailCache::get()->getThumbnail(thumbsHash, binId, frameNumber);
             if (!result.isNull()) {
 
                 *size = result.size();
                 return result;
             }
-            std::unique_ptr<Mlt::Producer> prod = binClip->getThumbProducer();
-            if (prod && prod->is_valid()) {
-                if (binClip->clipType() != ClipType::Timeline && binClip->clipType() != ClipType::Playlist) {
+            // Building a decode producer is the expensive part, reuse it while tiles of the same
+            // clip are requested so a filmstrip is filled in one sequential seek sweep
+            QMutexLocker lock(&m_mutex);
+            if (binId != m_producerId || thumbsHash != m_producerHash || m_producer == nullptr || !m_producer->is_valid()) {
+                m_producer = binClip->getThumbProducer();
+                if (m_producer && m_producer->is_valid() && binClip->clipType() != ClipType::Timeline && binClip->clipType() != ClipType::Playlist) {
                     Mlt::Profile *prodProfile = &pCore->thumbProfile();
                     Mlt::Filter scaler(*prodProfile, "swscale");
                     Mlt::Filter padder(*prodProfile, "resize");
                     Mlt::Filter converter(*prodProfile, "avcolor_space");
-                    prod->attach(scaler);
-                    prod->attach(padder);
-                    prod->attach(converter);
+                    m_producer->attach(scaler);
+                    m_producer->attach(padder);
+                    m_producer->attach(converter);
                 }
-                result = makeThumbnail(std::move(prod), frameNumber, requestedSize);
+                m_producerId = binId;
+                m_producerHash = thumbsHash;
+            }
+            if (m_producer && m_producer->is_valid()) {
+                result = makeThumbnail(m_producer.get(), frameNumber, requestedSize);
                 ThumbnailCache::get()->storeThumbnail(binId, frameNumber, result, false);
             }
         }
@@ -65,7 +73,7 @@ QImage ThumbnailProvider::requestImage(const QString &id, QSize *size, const QSi
     return result;
 }
 
-QImage ThumbnailProvider::makeThumbnail(std::unique_ptr<Mlt::Producer> producer, int frameNumber, const QSize &requestedSize)
+QImage ThumbnailProvider::makeThumbnail(Mlt::Producer *producer, int frameNumber, const QSize &requestedSize)
 {
     Q_UNUSED(requestedSize)
     producer->seek(frameNumber);
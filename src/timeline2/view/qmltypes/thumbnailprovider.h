@@ -9,6 +9,7 @@
 
 #include <KImageCache>
 #include <QCache>
+#include <QMutex>
 #include <QQuickImageProvider>
 #include <memory>
 #include <mlt++/MltProducer.h>
@@ -23,5 +24,11 @@ public:
 
 private:
     Mlt::Profile m_profile;
-    QImage makeThumbnail(std::unique_ptr<Mlt::Producer> producer, int frameNumber, const QSize &requestedSize);
+    QImage makeThumbnail(Mlt::Producer *producer, int frameNumber, const QSize &requestedSize);
+    /** @brief Decode producer of the last requested clip, kept so all tiles of a clip's filmstrip
+     *  are produced by one producer in a sequential seek sweep instead of building one per tile */
+    std::shared_ptr<Mlt::Producer> m_producer;
+    QString m_producerId;
+    QString m_producerHash;
+    QMutex m_mutex;
 };
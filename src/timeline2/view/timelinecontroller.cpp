@@ -15,6 +15,7 @@
 #include "bin/projectclip.h"
 #include "bin/projectfolder.h"
 #include "bin/projectitemmodel.h"
+#include "capture/mediacapture.h"
 #include "core.h"
 #include "dialogs/importsubtitle.h"
 #include "dialogs/managesubtitles.h"
@@ -26,6 +27,7 @@
 #include "effects/effectsrepository.hpp"
 #include "effects/effectstack/model/effectstackmodel.hpp"
 #include "glaxnimatelauncher.h"
+#include "jobs/cachetask.h"
 #include "kdenlivesettings.h"
 #include "lib/audio/audioEnvelope.h"
 #include "mainwindow.h"
@@ -97,6 +99,7 @@ void TimelineController::prepareClose()
     m_root = nullptr;
     // Delete timeline preview before resetting model so that removing clips from timeline doesn't invalidate
     m_model->resetPreviewManager();
+    m_model->resetAudioStems();
     m_model.reset();
 }
 
@@ -127,6 +130,9 @@ void TimelineController::setModel(std::shared_ptr<TimelineItemModel> model)
         connectPreviewManager();
     }
     connect(m_model.get(), &TimelineModel::connectPreviewManager, this, &TimelineController::connectPreviewManager);
+    if (KdenliveSettings::audiostems()) {
+        m_model->initializeAudioStems();
+    }
     connect(m_model.get(), &TimelineModel::selectionModeChanged, this, &TimelineController::colorsChanged);
     connect(this, &TimelineController::selectionChanged, this, &TimelineController::updateClipActions);
     connect(this, &TimelineController::selectionChanged, this, &TimelineController::updateTrimmingMode);
@@ -446,6 +452,57 @@ void TimelineController::setScrollPos(int pos)
     }
 }
 
+void TimelineController::prefetchVisibleThumbs(int firstFrame, int frameCount)
+{
+    if (!m_model || frameCount <= 0 || !KdenliveSettings::videothumbnails()) {
+        return;
+    }
+    int start = qMax(0, firstFrame);
+    int end = firstFrame + frameCount;
+    // Infer the scrolling direction from the previous call and extend the window one
+    // screenful ahead, so thumbs are decoded before their clips come on screen
+    qint64 elapsed = -1;
+    if (m_prefetchTimer.isValid()) {
+        elapsed = m_prefetchTimer.restart();
+    } else {
+        m_prefetchTimer.start();
+    }
+    if (elapsed > 0 && elapsed < 2000 && m_lastPrefetchPos > -1 && m_lastPrefetchPos != firstFrame) {
+        if (firstFrame > m_lastPrefetchPos) {
+            end += frameCount;
+        } else {
+            start = qMax(0, start - frameCount);
+        }
+    }
+    m_lastPrefetchPos = firstFrame;
+    std::unordered_set<int> items = m_model->getItemsInRange(-1, start, end, false);
+    int started = 0;
+    for (int cid : items) {
+        if (!m_model->isClip(cid)) {
+            continue;
+        }
+        bool ok = false;
+        int binIntId = m_model->getClipBinId(cid).toInt(&ok);
+        if (!ok) {
+            continue;
+        }
+        int clipPos = m_model->getClipPosition(cid);
+        int clipIn = m_model->getClipIn(cid);
+        int playtime = m_model->getClipPlaytime(cid);
+        // Only request the source frames that will actually be displayed
+        int sourceIn = clipIn + qMax(0, start - clipPos);
+        int sourceOut = clipIn + qMin(playtime, end - clipPos);
+        if (sourceOut <= sourceIn) {
+            continue;
+        }
+        CacheTask::start(ObjectId(KdenliveObjectType::BinClip, binIntId, QUuid()), 30, sourceIn, sourceOut, this);
+        if (++started == 20) {
+            // Don't flood the task pool on very dense timelines
+            break;
+        }
+    }
+}
+
 void TimelineController::resetView()
 {
     m_model->_resetView();
@@ -817,9 +874,10 @@ int TimelineController::copyItem()
         return -1;
     }
     int clipId = *(selectedIds.begin());
-    QString copyString = TimelineFunctions::copyClips(m_model, selectedIds, getMainSelectedClip());
+    QDomDocument copiedItems = TimelineFunctions::copyClipsToDom(m_model, selectedIds, getMainSelectedClip());
     QClipboard *clipboard = QApplication::clipboard();
-    clipboard->setText(copyString);
+    // Keep the parsed document around; the XML text is only rendered if another application asks for it
+    clipboard->setMimeData(new TimelineMimeData(copiedItems));
     m_root->setProperty("copiedClip", clipId);
     return clipId;
 }
@@ -835,17 +893,30 @@ std::pair<int, QString> TimelineController::getCopyItemData()
     return {clipId, copyString};
 }
 
+std::pair<int, QDomDocument> TimelineController::getCopyItemDataDom()
+{
+    std::unordered_set<int> selectedIds = m_model->getCurrentSelection();
+    if (selectedIds.empty()) {
+        return {-1, QDomDocument()};
+    }
+    int clipId = *(selectedIds.begin());
+    return {clipId, TimelineFunctions::copyClipsToDom(m_model, selectedIds)};
+}
+
 bool TimelineController::pasteItem(int position, int tid)
 {
     QClipboard *clipboard = QApplication::clipboard();
-    QString txt = clipboard->text();
     if (tid == -1) {
         tid = m_activeTrack;
     }
     if (position == -1) {
         position = getMenuOrTimelinePos();
     }
-    return TimelineFunctions::pasteClips(m_model, txt, tid, position);
+    if (auto *timelineData = qobject_cast<const TimelineMimeData *>(clipboard->mimeData())) {
+        // The copy comes from this process, reuse the parsed document (deep clone since paste adjusts it)
+        return TimelineFunctions::pasteClips(m_model, timelineData->document().cloneNode(true).toDocument(), tid, position);
+    }
+    return TimelineFunctions::pasteClips(m_model, clipboard->text(), tid, position);
 }
 
 void TimelineController::triggerAction(const QString &name)
@@ -2773,6 +2844,27 @@ void TimelineController::invalidateItem(int cid)
     m_model->previewManager()->invalidatePreview(start, end);
 }
 
+void TimelineController::invalidateItemRange(int cid, int in, int out)
+{
+    if (!m_model->hasTimelinePreview() || !m_model->isItem(cid)) {
+        return;
+    }
+    const int tid = m_model->getItemTrackId(cid);
+    if (tid == -1 || m_model->getTrackById_const(tid)->isAudioTrack()) {
+        return;
+    }
+    int start = m_model->getItemPosition(cid);
+    int duration = m_model->getItemPlaytime(cid);
+    if (in < 0 || (m_model->isClip(cid) && !qFuzzyCompare(m_model->getClipSpeed(cid), 1.))) {
+        // The offsets cannot be mapped to timeline positions, invalidate the full item
+        m_model->previewManager()->invalidatePreview(start, start + duration);
+        return;
+    }
+    int zoneIn = start + qBound(0, in, duration);
+    int zoneOut = out < 0 ? start + duration : start + qBound(0, out, duration);
+    m_model->previewManager()->invalidatePreview(zoneIn, zoneOut);
+}
+
 void TimelineController::invalidateTrack(int tid)
 {
     if (!m_model->hasTimelinePreview() || !m_model->isTrack(tid) || m_model->getTrackById_const(tid)->isAudioTrack()) {
@@ -3400,6 +3492,20 @@ void TimelineController::switchTrackActive(int trackId)
     m_activeSnaps.clear();
 }
 
+void TimelineController::switchTrackRenderMute(int trackId)
+{
+    if (trackId == -1) {
+        trackId = m_activeTrack;
+    }
+    if (trackId < 0) {
+        return;
+    }
+    bool muted = m_model->getTrackById_const(trackId)->isRenderMuted();
+    m_model->setTrackProperty(trackId, QStringLiteral("kdenlive:render_mute"), muted ? QStringLiteral("0") : QStringLiteral("1"));
+    pCore->displayMessage(muted ? i18n("Track will be included in timeline preview") : i18n("Track will be ignored by timeline preview"), InformationMessage,
+                          500);
+}
+
 void TimelineController::switchAllTrackActive()
 {
     auto it = m_model->m_allTracks.cbegin();
@@ -4516,7 +4622,7 @@ const std::unordered_map<QString, std::vector<int>> TimelineController::getThumb
 
 bool TimelineController::isInSelection(int itemId)
 {
-    return m_model->getCurrentSelection().count(itemId) > 0;
+    return m_model->isInSelection(itemId);
 }
 
 bool TimelineController::exists(int itemId)
@@ -4825,7 +4931,16 @@ void TimelineController::urlDropped(QStringList droppedFile, int frame, int tid)
 
 void TimelineController::finishRecording(const QString &recordedFile)
 {
-    addAndInsertFile(recordedFile, m_recordTrack, m_recordStart, true, false);
+    std::pair<int, int> recPosition = m_recordStart;
+    // Shift the take left by the input latency so it lines up with what was heard while recording
+    const int latencyFrames = pCore->getAudioDevice()->captureLatencyFrames();
+    if (latencyFrames > 0 && recPosition.first >= latencyFrames) {
+        recPosition.first -= latencyFrames;
+        if (recPosition.second > 0) {
+            recPosition.second += latencyFrames;
+        }
+    }
+    addAndInsertFile(recordedFile, m_recordTrack, recPosition, true, false);
 }
 
 void TimelineController::addAndInsertFile(const QString &recordedFile, int tid, std::pair<int, int> recPosition, const bool isAudioClip,
@@ -12,6 +12,7 @@
 #include <KActionCollection>
 #include <QApplication>
 #include <QDir>
+#include <QElapsedTimer>
 
 class QAction;
 class QQuickItem;
@@ -239,6 +240,9 @@ public:
     Q_INVOKABLE QList<int> insertClips(int tid, int position, const QStringList &binIds, bool logUndo, bool refreshView);
     Q_INVOKABLE int copyItem();
     std::pair<int, QString> getCopyItemData();
+    /** @brief Same as getCopyItemData() but keeps the DOM representation of the selection,
+     *  skipping the XML string round trip for in-process operations like sequence nesting */
+    std::pair<int, QDomDocument> getCopyItemDataDom();
     Q_INVOKABLE bool pasteItem(int position = -1, int tid = -1);
     /** @brief Request inserting a new composition in timeline (dragged from compositions list)
        @param tid is the destination track
@@ -495,6 +499,8 @@ public:
 
     /** @brief Make current timeline track active/inactive*/
     Q_INVOKABLE void switchTrackActive(int trackId = -1);
+    /** @brief Toggle a track's exclusion from timeline preview rendering (distinct from monitor mute)*/
+    Q_INVOKABLE void switchTrackRenderMute(int trackId = -1);
     /** @brief Toggle the active/inactive state of all tracks*/
     void switchAllTrackActive();
     /** @brief Make all tracks active or inactive */
@@ -709,6 +715,9 @@ public Q_SLOTS:
     /** @brief Dis / enable timeline preview. */
     void disablePreview(bool disable);
     void invalidateItem(int cid);
+    /** @brief Invalidate only part of an item in timeline preview.
+     *  @param in and @param out are frame offsets relative to the item's position. */
+    void invalidateItemRange(int cid, int in, int out);
     void invalidateTrack(int tid);
     void checkDuration();
     /** @brief Dis / enable multi track view. */
@@ -719,6 +728,9 @@ public Q_SLOTS:
     void saveTimelineSelection(const QDir &targetDir);
     /** @brief Restore timeline scroll pos on open. */
     void setScrollPos(int pos);
+    /** @brief Prefetch thumbnails for clips in the visible timeline range, extended one
+     *  screenful in the scrolling direction so panning does not hit placeholder thumbs. */
+    Q_INVOKABLE void prefetchVisibleThumbs(int firstFrame, int frameCount);
     /** @brief Request resizing currently selected mix. */
     void resizeMix(int cid, int duration, MixAlignment align, int leftFrames = -1);
     /** @brief change zone info with undo. */
@@ -773,6 +785,9 @@ private:
     std::pair<int, int> m_recordStart;
     int m_recordTrack{-1};
     QPoint m_zone;
+    /** @brief Viewport start of the last thumbnail prefetch, used to infer scroll direction */
+    int m_lastPrefetchPos{-1};
+    QElapsedTimer m_prefetchTimer;
     int m_activeTrack;
     double m_scale;
     QAction *m_disablePreview;
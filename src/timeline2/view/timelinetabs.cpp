@@ -11,6 +11,7 @@
 #include "core.h"
 #include "doc/docundostack.hpp"
 #include "doc/kdenlivedoc.h"
+#include "kdenlivesettings.h"
 #include "mainwindow.h"
 #include "monitor/monitor.h"
 #include "monitor/monitormanager.h"
@@ -63,6 +64,9 @@ TimelineTabs::~TimelineTabs()
         TimelineWidget *timeline = static_cast<TimelineWidget *>(widget(i));
         timeline->setSource(QUrl());
     };
+    for (TimelineWidget *timeline : qAsConst(m_retiredTimelines)) {
+        timeline->setSource(QUrl());
+    }
 }
 
 void TimelineTabs::updateWindowTitle()
@@ -113,10 +117,16 @@ TimelineWidget *TimelineTabs::addTimeline(const QUuid uuid, int ix, const QStrin
         m_activeTimeline->model()->updateVisibleSequenceName(QString());
     }
     disconnect(this, &TimelineTabs::currentChanged, this, &TimelineTabs::connectCurrent);
-    TimelineWidget *newTimeline = new TimelineWidget(uuid, this);
-    newTimeline->setTimelineMenu(m_timelineClipMenu, m_timelineCompositionMenu, m_timelineMenu, m_guideMenu, m_timelineRulerMenu, m_editGuideAction,
-                                 m_headerMenu, m_thumbsMenu, m_timelineSubtitleClipMenu);
-    newTimeline->setModel(timelineModel, proxy);
+    TimelineWidget *newTimeline = takeRetiredTimeline(uuid, timelineModel);
+    if (newTimeline) {
+        // The scene of this recently closed tab was retained, skip the QML reload
+        newTimeline->blockSignals(false);
+    } else {
+        newTimeline = new TimelineWidget(uuid, this);
+        newTimeline->setTimelineMenu(m_timelineClipMenu, m_timelineCompositionMenu, m_timelineMenu, m_guideMenu, m_timelineRulerMenu, m_editGuideAction,
+                                     m_headerMenu, m_thumbsMenu, m_timelineSubtitleClipMenu);
+        newTimeline->setModel(timelineModel, proxy);
+    }
     int newIndex = 0;
     if (ix == -1 || ix >= count()) {
         newIndex = addTab(newTimeline, tabName);
@@ -217,16 +227,15 @@ void TimelineTabs::closeTimelineByIndex(int ix)
         pCore->projectManager()->closeTimeline(uuid, false, false);
         TimelineWidget *timeline = static_cast<TimelineWidget *>(widget(ix));
         timeline->blockSignals(true);
-        timeline->setSource(QUrl());
         if (timeline == m_activeTimeline) {
             pCore->window()->disconnectTimeline(timeline);
             disconnectTimeline(timeline);
         }
-        timeline->unsetModel();
         if (m_activeTimeline == timeline) {
             m_activeTimeline = nullptr;
         }
-        delete timeline;
+        removeTab(ix);
+        retireTimeline(timeline);
         updateWindowTitle();
         return true;
     };
@@ -241,14 +250,78 @@ TimelineWidget *TimelineTabs::getCurrentTimeline() const
 
 void TimelineTabs::closeTimelines()
 {
+    clearRetiredTimelines();
     for (int i = 0; i < count(); i++) {
         static_cast<TimelineWidget *>(widget(i))->unsetModel();
     }
 }
 
+void TimelineTabs::retireTimeline(TimelineWidget *timeline)
+{
+    const int cap = qMax(0, KdenliveSettings::retainedtimelinetabs());
+    if (cap == 0 || pCore->currentDoc()->closing || timeline->model() == nullptr) {
+        discardTimeline(timeline);
+        return;
+    }
+    timeline->hide();
+    timeline->setParent(this);
+    m_retiredTimelines.append(timeline);
+    while (m_retiredTimelines.size() > cap) {
+        discardTimeline(m_retiredTimelines.takeFirst());
+    }
+}
+
+TimelineWidget *TimelineTabs::takeRetiredTimeline(const QUuid &uuid, const std::shared_ptr<TimelineItemModel> &model)
+{
+    for (int i = 0; i < m_retiredTimelines.size(); i++) {
+        TimelineWidget *timeline = m_retiredTimelines.at(i);
+        if (timeline->getUuid() == uuid) {
+            m_retiredTimelines.removeAt(i);
+            if (timeline->model() == model) {
+                return timeline;
+            }
+            // The sequence was rebuilt with a new model, the retained scene is stale
+            discardTimeline(timeline);
+            return nullptr;
+        }
+    }
+    return nullptr;
+}
+
+void TimelineTabs::discardTimeline(TimelineWidget *timeline)
+{
+    timeline->setSource(QUrl());
+    timeline->unsetModel();
+    delete timeline;
+}
+
+void TimelineTabs::clearRetiredTimelines()
+{
+    while (!m_retiredTimelines.isEmpty()) {
+        discardTimeline(m_retiredTimelines.takeFirst());
+    }
+}
+
+std::shared_ptr<TimelineItemModel> TimelineTabs::retiredTimelineModel(const QUuid &uuid) const
+{
+    for (TimelineWidget *timeline : m_retiredTimelines) {
+        if (timeline->getUuid() == uuid) {
+            return timeline->model();
+        }
+    }
+    return nullptr;
+}
+
 void TimelineTabs::closeTimelineTab(const QUuid uuid)
 {
     QMutexLocker lk(&m_lock);
+    // The sequence clip is going away, a retained scene for it must not survive
+    for (int i = 0; i < m_retiredTimelines.size(); i++) {
+        if (m_retiredTimelines.at(i)->getUuid() == uuid) {
+            discardTimeline(m_retiredTimelines.takeAt(i));
+            break;
+        }
+    }
     int currentCount = count();
     disconnect(this, &TimelineTabs::currentChanged, this, &TimelineTabs::connectCurrent);
     for (int i = 0; i < currentCount; i++) {
@@ -59,6 +59,8 @@ public:
     void updateWindowTitle();
     /** @brief Build the timeline clip menu with dynamic actions. */
     void buildClipMenu();
+    /** @brief Model of a recently closed tab whose scene is still retained, if any */
+    std::shared_ptr<TimelineItemModel> retiredTimelineModel(const QUuid &uuid) const;
 
 protected:
     /** @brief Helper function to connect a timeline's signals/slots*/
@@ -112,7 +114,19 @@ private Q_SLOTS:
     void onTabBarDoubleClicked(int index);
 
 private:
+    /** @brief Keep a closed tab (widget, scene and model) alive so reopening the
+     *  sequence skips the QML reload, evicting the oldest beyond the configured cap */
+    void retireTimeline(TimelineWidget *timeline);
+    /** @brief Take a retained tab for @uuid out of the cache if it is still bound to @model */
+    TimelineWidget *takeRetiredTimeline(const QUuid &uuid, const std::shared_ptr<TimelineItemModel> &model);
+    /** @brief Fully delete a timeline widget and its scene */
+    void discardTimeline(TimelineWidget *timeline);
+    /** @brief Drop all retained tabs */
+    void clearRetiredTimelines();
+
     TimelineWidget *m_activeTimeline;
+    /** @brief Recently closed tabs kept alive, oldest first */
+    QList<TimelineWidget *> m_retiredTimelines;
     QMenu *m_timelineClipMenu{nullptr};
     QMenu *m_timelineCompositionMenu;
     QMenu *m_timelineMenu;
@@ -56,8 +56,10 @@ MyTextItem::MyTextItem(const QString &txt, QGraphicsItem *parent)
     : QGraphicsTextItem(txt, parent)
     , m_alignment(QFlags<Qt::AlignmentFlag>())
 {
-    // Disabled because cache makes text cursor invisible and borders ugly
-    // setCacheMode(QGraphicsItem::ItemCoordinateCache);
+    // Items are rasterized once at device resolution and repainted from the cached pixmap while
+    // static; the cache is dropped during text edition (see setTextInteractionFlags) since it
+    // would hide the blinking cursor
+    setCacheMode(QGraphicsItem::DeviceCoordinateCache);
     setFlag(QGraphicsItem::ItemSendsGeometryChanges, true);
     document()->setDocumentMargin(0);
     m_shadowEffect = new MyQGraphicsEffect(this);
@@ -73,6 +75,12 @@ Qt::Alignment MyTextItem::alignment() const
     return m_alignment;
 }
 
+void MyTextItem::setTextInteractionFlags(Qt::TextInteractionFlags flags)
+{
+    setCacheMode(flags & Qt::TextEditable ? QGraphicsItem::NoCache : QGraphicsItem::DeviceCoordinateCache);
+    QGraphicsTextItem::setTextInteractionFlags(flags);
+}
+
 void MyTextItem::updateShadow(bool enabled, int blur, int xoffset, int yoffset, QColor color)
 {
     m_shadowOffset = QPoint(xoffset, yoffset);
@@ -158,6 +166,7 @@ void MyTextItem::doUpdateGeometry()
     QString text = toPlainText();
     m_path = QPainterPath();
     m_path.setFillRule(Qt::WindingFill);
+    m_outlinePath = QPainterPath();
     if (text.isEmpty()) {
         //
     } else {
@@ -212,7 +221,12 @@ void MyTextItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option
             paintBrush = QBrush(cursor.charFormat().foreground().color());
         } else {
             QRectF rect = boundingRect();
-            paintBrush = QBrush(GradientWidget::gradientFromString(gradientData, int(rect.width()), int(rect.height())));
+            if (gradientData != m_gradientData || rect.size().toSize() != m_gradientSize) {
+                m_gradientData = gradientData;
+                m_gradientSize = rect.size().toSize();
+                m_gradientBrush = QBrush(GradientWidget::gradientFromString(gradientData, int(rect.width()), int(rect.height())));
+            }
+            paintBrush = m_gradientBrush;
         }
         if (TITLERVERSION < 300) {
             painter->fillPath(m_path, paintBrush);
@@ -222,7 +236,11 @@ void MyTextItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option
             QColor outlineColor = variant.value<QColor>();
             QPen pen(outlineColor);
             pen.setWidthF(outline);
-            painter->strokePath(m_path.simplified(), pen);
+            if (m_outlinePath.isEmpty() && !m_path.isEmpty()) {
+                // simplified() runs a costly path union, only redo it when the text changed
+                m_outlinePath = m_path.simplified();
+            }
+            painter->strokePath(m_outlinePath, pen);
         }
         if (TITLERVERSION >= 300) {
             painter->fillPath(m_path, paintBrush);
@@ -51,6 +51,9 @@ public:
     void loadTW(const QStringList &info);
     void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *evt) override;
     void setTextColor(const QColor &col);
+    /** @brief Hides the base method to drop the pixmap cache while the item is edited, so the
+     *  text cursor stays visible */
+    void setTextInteractionFlags(Qt::TextInteractionFlags flags);
 
 protected:
     QVariant itemChange(GraphicsItemChange change, const QVariant &value) override;
@@ -62,6 +65,12 @@ private:
     int m_shadowBlur;
     QColor m_shadowColor;
     QPainterPath m_path;
+    /** @brief Simplified copy of m_path for the outline stroke, only rebuilt on content change */
+    QPainterPath m_outlinePath;
+    /** @brief Gradient brush cache, parsing the gradient string on every paint is expensive */
+    QBrush m_gradientBrush;
+    QString m_gradientData;
+    QSize m_gradientSize;
     MyQGraphicsEffect *m_shadowEffect;
     void updateShadow();
     void blurShadow(QImage &image, int radius);
@@ -718,6 +718,29 @@ int TitleDocument::invalidCount() const
     return m_missingElements;
 }
 
+bool TitleDocument::isAnimated(const QDomDocument &doc)
+{
+    QDomNodeList startv = doc.documentElement().elementsByTagName(QStringLiteral("startviewport"));
+    QDomNodeList endv = doc.documentElement().elementsByTagName(QStringLiteral("endviewport"));
+    if (!startv.isEmpty() && !endv.isEmpty()) {
+        const QString start = startv.item(0).toElement().attribute(QStringLiteral("rect"));
+        const QString end = endv.item(0).toElement().attribute(QStringLiteral("rect"));
+        if (!start.isEmpty() && !end.isEmpty() && start != end) {
+            // Scroll or zoom animation
+            return true;
+        }
+    }
+    QDomNodeList contents = doc.documentElement().elementsByTagName(QStringLiteral("content"));
+    for (int i = 0; i < contents.count(); i++) {
+        // First field of the typewriter info is the enabled flag
+        const QString tw = contents.item(i).toElement().attribute(QStringLiteral("typewriter"));
+        if (!tw.isEmpty() && tw.section(QLatin1Char(';'), 0, 0).toInt() == 1) {
+            return true;
+        }
+    }
+    return false;
+}
+
 QPixmap TitleDocument::createInvalidPixmap(const QString &url, int height)
 {
     int missingHeight = height / 10;
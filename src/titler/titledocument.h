@@ -50,6 +50,8 @@ public:
     static const QString extractBase64Image(const QString &titlePath, const QString &data);
     /** \brief The number of missing elements in this title. */
     int invalidCount() const;
+    /** \brief Returns true if the title xml describes an animation (moving viewports or typewriter). */
+    static bool isAnimated(const QDomDocument &doc);
 
     enum ItemOrigin { OriginXLeft = 0, OriginYTop = 1 };
     enum AxisPosition { AxisDefault = 0, AxisInverted = 1 };
@@ -156,6 +156,11 @@ QString TransitionsRepository::assetPreferredListPath() const
     return QLatin1String("");
 }
 
+QString TransitionsRepository::assetCachePath() const
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/transitionsrepository");
+}
+
 std::unique_ptr<Mlt::Transition> TransitionsRepository::getTransition(const QString &transitionId) const
 {
     qDebug() << "===== QUERYING TRANSITION: " << transitionId;
@@ -60,6 +60,9 @@ protected:
     /** @brief Returns the path to the effects' preferred list*/
     QString assetPreferredListPath() const override;
 
+    /** @brief Returns the path of the on-disk parsed composition cache*/
+    QString assetCachePath() const override;
+
     void parseType(Mlt::Properties *metadata, Info &res) override;
 
     /** @brief Returns the metadata associated with the given asset*/
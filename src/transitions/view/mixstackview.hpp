@@ -24,6 +24,10 @@ public:
     void unsetModel();
     ObjectId stackOwner() const;
 
+protected:
+    /** @brief The duration and alignment controls are appended after the base build, so the view cannot be rebound */
+    bool supportsModelSwap() const override { return false; }
+
 Q_SIGNALS:
     void seekToTransPos(int pos);
 
@@ -21,6 +21,10 @@ public:
     ObjectId stackOwner() const;
     void refreshTracks();
 
+protected:
+    /** @brief The track selector is appended after the base build, so the view cannot be rebound */
+    bool supportsModelSwap() const override { return false; }
+
 private Q_SLOTS:
     void updateTrack(int newTrack);
     void checkCompoTrack();
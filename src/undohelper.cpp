@@ -7,7 +7,9 @@
 #ifdef CRASH_AUTO_TEST
 #include "logger.hpp"
 #endif
+#include <QCoreApplication>
 #include <QDebug>
+#include <QElapsedTimer>
 #include <QTime>
 #include <utility>
 FunctionalUndoCommand::FunctionalUndoCommand(Fun undo, Fun redo, const QString &text, QUndoCommand *parent)
@@ -43,3 +45,114 @@ void FunctionalUndoCommand::redo()
     }
     QUndoCommand::redo();
 }
+
+MergeableUndoCommand::MergeableUndoCommand(Fun undo, Fun redo, const QString &text, int mergeId, QUndoCommand *parent)
+    : QUndoCommand(parent)
+    , m_undo(std::move(undo))
+    , m_redo(std::move(redo))
+    , m_mergeId(mergeId)
+    , m_sealed(false)
+    , m_undone(false)
+{
+    setText(QString("%1 %2").arg(QTime::currentTime().toString("hh:mm")).arg(text));
+}
+
+void MergeableUndoCommand::undo()
+{
+#ifdef CRASH_AUTO_TEST
+    Logger::log_undo(true);
+#endif
+    m_undone = true;
+    bool res = m_undo();
+    Q_ASSERT(res);
+    QUndoCommand::undo();
+}
+
+void MergeableUndoCommand::redo()
+{
+    if (m_undone) {
+#ifdef CRASH_AUTO_TEST
+        Logger::log_undo(false);
+#endif
+        bool res = m_redo();
+        Q_ASSERT(res);
+    }
+    QUndoCommand::redo();
+}
+
+int MergeableUndoCommand::id() const
+{
+    return m_mergeId;
+}
+
+bool MergeableUndoCommand::mergeWith(const QUndoCommand *other)
+{
+    if (m_sealed || other->id() != m_mergeId) {
+        return false;
+    }
+    // Keep our undo (the state before the edit session started) and adopt the newest redo
+    m_redo = static_cast<const MergeableUndoCommand *>(other)->m_redo;
+    return true;
+}
+
+void MergeableUndoCommand::seal()
+{
+    m_sealed = true;
+}
+
+ChunkedUndoCommand::ChunkedUndoCommand(std::vector<std::pair<Fun, Fun>> steps, const QString &text, QUndoCommand *parent)
+    : QUndoCommand(parent)
+    , m_steps(std::move(steps))
+    , m_undone(false)
+{
+    setText(QString("%1 %2").arg(QTime::currentTime().toString("hh:mm")).arg(text));
+}
+
+bool ChunkedUndoCommand::replay(bool undoing)
+{
+    // Maximum time we block the event loop before flushing pending (non input) events
+    constexpr qint64 chunkBudgetMs = 50;
+    QElapsedTimer timer;
+    timer.start();
+    bool res = true;
+    auto runStep = [&res, &timer](const std::pair<Fun, Fun> &step, bool backwards) {
+        res = res && (backwards ? step.first() : step.second());
+        if (timer.elapsed() > chunkBudgetMs) {
+            QCoreApplication::processEvents(QEventLoop::ExcludeUserInputEvents);
+            timer.restart();
+        }
+    };
+    if (undoing) {
+        for (auto it = m_steps.rbegin(); it != m_steps.rend(); ++it) {
+            runStep(*it, true);
+        }
+    } else {
+        for (const auto &step : m_steps) {
+            runStep(step, false);
+        }
+    }
+    return res;
+}
+
+void ChunkedUndoCommand::undo()
+{
+#ifdef CRASH_AUTO_TEST
+    Logger::log_undo(true);
+#endif
+    m_undone = true;
+    bool res = replay(true);
+    Q_ASSERT(res);
+    QUndoCommand::undo();
+}
+
+void ChunkedUndoCommand::redo()
+{
+    if (m_undone) {
+#ifdef CRASH_AUTO_TEST
+        Logger::log_undo(false);
+#endif
+        bool res = replay(false);
+        Q_ASSERT(res);
+    }
+    QUndoCommand::redo();
+}
@@ -43,3 +43,56 @@ private:
     Fun m_undo, m_redo;
     bool m_undone;
 };
+
+/** @brief A functional undo command that coalesces consecutive edits of the same object into a
+   single undo entry. Commands carrying the same merge id that land on top of each other on the
+   stack are merged: the first one keeps its undo lambda (the state before the edit session
+   started) and takes over the newest redo, so typing through a subtitle produces one entry per
+   edit session instead of one per applied change. Any unrelated command pushed in between ends
+   the run, and sealing the command (when the editor loses focus) ends it explicitly.
+ */
+class MergeableUndoCommand : public QUndoCommand
+{
+public:
+    /** Tags combined with an object identifier to build merge ids that cannot collide across
+     *  command kinds; the object part must fit in the lower 24 bits */
+    enum MergeIds { EditSubtitleId = 1 << 24, RenameMarkerId = 2 << 24 };
+    MergeableUndoCommand(Fun undo, Fun redo, const QString &text, int mergeId, QUndoCommand *parent = nullptr);
+    void undo() override;
+    void redo() override;
+    int id() const override;
+    bool mergeWith(const QUndoCommand *other) override;
+    /** @brief Ends the edit session: no subsequently pushed command will merge into this one */
+    void seal();
+
+private:
+    Fun m_undo, m_redo;
+    int m_mergeId;
+    bool m_sealed;
+    bool m_undone;
+};
+
+#include <utility>
+#include <vector>
+
+/** @brief An undo command built from a list of atomic {undo, redo} steps that is replayed in
+   time-sliced batches. Between batches pending events are flushed (user input excluded), so
+   undoing or redoing a heavy composite operation like a several hundred clip group deletion keeps
+   the interface repainting instead of freezing it.
+   As with FunctionalUndoCommand, the redo() triggered when the command is pushed on the stack is
+   skipped, since the operation was already executed while the steps were built.
+ */
+class ChunkedUndoCommand : public QUndoCommand
+{
+public:
+    ChunkedUndoCommand(std::vector<std::pair<Fun, Fun>> steps, const QString &text, QUndoCommand *parent = nullptr);
+    void undo() override;
+    void redo() override;
+
+private:
+    /** @brief Runs one side of all steps (forward on redo, backwards on undo) in timed batches */
+    bool replay(bool undoing);
+    /** {undo, redo} pair of each atomic step, in execution order */
+    std::vector<std::pair<Fun, Fun>> m_steps;
+    bool m_undone;
+};
@@ -0,0 +1,74 @@
+/*
+    SPDX-FileCopyrightText: 2026 Jean-Baptiste Mardelle <jb@kdenlive.org>
+    SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "memorydiagnostics.h"
+
+#include <KLocalizedString>
+
+#ifdef KDENLIVE_USE_MIMALLOC
+#include <mimalloc.h>
+#endif
+#ifdef KDENLIVE_USE_JEMALLOC
+#include <jemalloc/jemalloc.h>
+#endif
+
+QAtomicInteger<qint64> MemoryDiagnostics::m_bytes[MemoryDiagnostics::CategoryCount];
+QAtomicInteger<qint64> MemoryDiagnostics::m_items[MemoryDiagnostics::CategoryCount];
+
+void MemoryDiagnostics::add(Category cat, qint64 bytes, qint64 items)
+{
+    m_bytes[cat].fetchAndAddRelaxed(bytes);
+    m_items[cat].fetchAndAddRelaxed(items);
+}
+
+void MemoryDiagnostics::sub(Category cat, qint64 bytes, qint64 items)
+{
+    m_bytes[cat].fetchAndSubRelaxed(bytes);
+    m_items[cat].fetchAndSubRelaxed(items);
+}
+
+void MemoryDiagnostics::setItems(Category cat, qint64 items)
+{
+    m_items[cat].storeRelaxed(items);
+}
+
+qint64 MemoryDiagnostics::bytes(Category cat)
+{
+    return m_bytes[cat].loadRelaxed();
+}
+
+qint64 MemoryDiagnostics::items(Category cat)
+{
+    return m_items[cat].loadRelaxed();
+}
+
+QString MemoryDiagnostics::categoryName(Category cat)
+{
+    switch (cat) {
+    case Thumbnails:
+        return i18n("Thumbnail cache");
+    case UndoStack:
+        return i18n("Undo stack");
+    case Producers:
+        return i18n("Producers");
+    case AudioLevels:
+        return i18n("Audio levels");
+    default:
+        break;
+    }
+    return QString();
+}
+
+QString MemoryDiagnostics::allocatorStats()
+{
+    QString stats;
+#if defined(KDENLIVE_USE_MIMALLOC)
+    mi_stats_print_out([](const char *line, void *arg) { static_cast<QString *>(arg)->append(QString::fromUtf8(line)); }, &stats);
+#elif defined(KDENLIVE_USE_JEMALLOC)
+    // "a" omits the per-arena breakdown, which is overwhelming here; the global summary is what matters
+    malloc_stats_print([](void *arg, const char *line) { static_cast<QString *>(arg)->append(QString::fromUtf8(line)); }, &stats, "a");
+#endif
+    return stats;
+}
@@ -0,0 +1,59 @@
+/*
+    SPDX-FileCopyrightText: 2026 Jean-Baptiste Mardelle <jb@kdenlive.org>
+    SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#pragma once
+
+#include <QAtomicInteger>
+#include <QString>
+
+/** @class MemoryDiagnostics
+    @brief Per-category accounting of the memory held by the major in-memory owners
+    (thumbnail cache, undo stack, producer pool, audio level buffers).
+    The counters are only updated when the application is configured with
+    BUILD_MEMORY_DIAGNOSTICS: call sites go through the MEM_DIAG_* macros below, which
+    compile to nothing otherwise. Counters are atomic so the owners can report from any
+    thread; the Memory Usage dialog polls them to show live bytes and item counts.
+ */
+class MemoryDiagnostics
+{
+public:
+    enum Category { Thumbnails = 0, UndoStack, Producers, AudioLevels, CategoryCount };
+
+    /** @brief Adds bytes / items to a category, thread safe */
+    static void add(Category cat, qint64 bytes, qint64 items = 1);
+    /** @brief Removes bytes / items from a category, thread safe */
+    static void sub(Category cat, qint64 bytes, qint64 items = 1);
+    /** @brief Overwrites the item count of a category, for owners that only expose a total */
+    static void setItems(Category cat, qint64 items);
+    /** @brief Current live bytes of a category */
+    static qint64 bytes(Category cat);
+    /** @brief Current live item count of a category */
+    static qint64 items(Category cat);
+    /** @brief Translated display name of a category */
+    static QString categoryName(Category cat);
+    /** @brief Human readable arena statistics of the alternate allocator when the build
+        was configured with USE_ALTERNATE_ALLOCATOR, empty otherwise */
+    static QString allocatorStats();
+
+private:
+    static QAtomicInteger<qint64> m_bytes[CategoryCount];
+    static QAtomicInteger<qint64> m_items[CategoryCount];
+};
+
+#ifdef KDENLIVE_MEMORY_DIAGNOSTICS
+#define MEM_DIAG_ADD(cat, bytes, items) MemoryDiagnostics::add((cat), (bytes), (items))
+#define MEM_DIAG_SUB(cat, bytes, items) MemoryDiagnostics::sub((cat), (bytes), (items))
+#define MEM_DIAG_SET_ITEMS(cat, items) MemoryDiagnostics::setItems((cat), (items))
+#else
+#define MEM_DIAG_ADD(cat, bytes, items)                                                                                                                        \
+    do {                                                                                                                                                       \
+    } while (0)
+#define MEM_DIAG_SUB(cat, bytes, items)                                                                                                                        \
+    do {                                                                                                                                                       \
+    } while (0)
+#define MEM_DIAG_SET_ITEMS(cat, items)                                                                                                                         \
+    do {                                                                                                                                                       \
+    } while (0)
+#endif
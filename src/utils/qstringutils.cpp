@@ -6,6 +6,8 @@
 #include "qstringutils.h"
 
 #include <QFileInfo>
+#include <QHash>
+#include <QMutex>
 #include <QString>
 #include <QStringList>
 
@@ -40,3 +42,22 @@ QString QStringUtils::appendToFilename(const QString &filename, const QString &a
     QString extension = filename.section(QLatin1Char('.'), -1);
     return name + appendix + QLatin1Char('.') + extension;
 }
+
+QByteArray QStringUtils::mltKey(const QString &name)
+{
+    static QMutex mutex;
+    static QHash<QString, QByteArray> keys;
+    QMutexLocker lock(&mutex);
+    auto it = keys.constFind(name);
+    if (it != keys.constEnd()) {
+        return it.value();
+    }
+    if (keys.size() > 1000) {
+        // Safety net in case a caller passes per-clip dynamic keys; the table is meant
+        // for the small fixed set of property names used by the models
+        keys.clear();
+    }
+    const QByteArray utf8 = name.toUtf8();
+    keys.insert(name, utf8);
+    return utf8;
+}
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <QByteArray>
 #include <QString>
 #include <QStringList>
 
@@ -26,4 +27,10 @@ public:
      *  Hence it does not work with extensions like .tar.gz
      */
     static QString appendToFilename(const QString &filename, const QString &appendix);
+    /** @returns the utf8 encoding of the MLT property key @param name.
+     *  The model layer requests the same keys ("kdenlive:id", "mlt_service", ...) millions
+     *  of times while loading a project; they are interned in a shared table so each key is
+     *  only converted once instead of allocating on every property access.
+     */
+    static QByteArray mltKey(const QString &name);
 };
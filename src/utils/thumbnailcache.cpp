@@ -8,19 +8,167 @@
 #include "bin/projectitemmodel.h"
 #include "core.h"
 #include "doc/kdenlivedoc.h"
+#include "kdenlivesettings.h"
 #include "project/projectmanager.h"
+#include "utils/memorydiagnostics.h"
+#include <QDataStream>
 #include <QDir>
+#include <QFile>
 #include <QMutexLocker>
 #include <list>
 
 std::unique_ptr<ThumbnailCache> ThumbnailCache::instance;
 std::once_flag ThumbnailCache::m_onceFlag;
 
+/** @class ThumbnailCache::PackFile
+    @brief A single on-disk store for the persistent video thumbnails, replacing thousands of
+    individual image files. The file is a sequence of records, each holding the thumbnail key, the
+    image geometry and the raw (pre-decoded) pixel data. On load the record headers are scanned once
+    and the whole file is memory-mapped, so getting a thumbnail is a zero-copy QImage wrapping the
+    mapped bytes - opening a big project fills the bin view without per-thumb file opens or decoding.
+    New thumbnails are appended in place; records of invalidated clips are only dropped from the
+    in-memory index, their bytes are reclaimed when the cache dir is purged.
+ */
+class ThumbnailCache::PackFile
+{
+public:
+    explicit PackFile(const QString &path)
+        : m_file(path)
+    {
+        load();
+    }
+    ~PackFile()
+    {
+        if (m_mapped) {
+            m_file.unmap(m_mapped);
+        }
+        for (uchar *mapped : m_retiredMappings) {
+            m_file.unmap(mapped);
+        }
+    }
+    bool contains(const QString &key) const { return m_entries.contains(key); }
+    QImage image(const QString &key) const
+    {
+        auto it = m_entries.constFind(key);
+        if (it == m_entries.constEnd() || m_mapped == nullptr || it->offset + it->size > m_mappedSize) {
+            return QImage();
+        }
+        // Zero-copy: the image wraps the mapped bytes, which stay valid as long as this object lives
+        return QImage(m_mapped + it->offset, it->width, it->height, it->bytesPerLine, it->format);
+    }
+    bool append(const QString &key, const QImage &img)
+    {
+        if (!m_file.isOpen() || img.isNull() || m_entries.contains(key)) {
+            return false;
+        }
+        m_file.seek(m_file.size());
+        QDataStream out(&m_file);
+        out.setVersion(QDataStream::Qt_5_15);
+        const qint64 dataSize = img.sizeInBytes();
+        out << key << qint32(img.width()) << qint32(img.height()) << qint32(img.bytesPerLine()) << qint32(img.format()) << quint32(dataSize);
+        qint64 offset = m_file.pos();
+        if (out.writeRawData(reinterpret_cast<const char *>(img.constBits()), int(dataSize)) != dataSize) {
+            return false;
+        }
+        m_file.flush();
+        if (!remap()) {
+            return false;
+        }
+        m_entries.insert(key, {offset, dataSize, img.width(), img.height(), img.bytesPerLine(), img.format()});
+        return true;
+    }
+    /** @brief Drop all entries of a clip, identified by its key prefix (the bin clip hash) */
+    void removePrefix(const QString &prefix)
+    {
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            if (it.key().startsWith(prefix)) {
+                it = m_entries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+private:
+    struct Entry
+    {
+        qint64 offset;
+        qint64 size;
+        int width;
+        int height;
+        int bytesPerLine;
+        QImage::Format format;
+    };
+    static constexpr quint32 packMagic = 0x4b544850; // 'KTHP'
+    static constexpr quint32 packVersion = 1;
+    void load()
+    {
+        if (!m_file.open(QIODevice::ReadWrite)) {
+            return;
+        }
+        QDataStream in(&m_file);
+        in.setVersion(QDataStream::Qt_5_15);
+        if (m_file.size() == 0) {
+            in << packMagic << packVersion;
+            m_file.flush();
+        } else {
+            quint32 magic = 0;
+            quint32 version = 0;
+            in >> magic >> version;
+            if (magic != packMagic || version != packVersion) {
+                // Unusable store, start from scratch
+                m_file.resize(0);
+                m_file.seek(0);
+                in << packMagic << packVersion;
+                m_file.flush();
+                remap();
+                return;
+            }
+            while (!in.atEnd()) {
+                const qint64 recordStart = m_file.pos();
+                QString key;
+                qint32 width, height, bytesPerLine, format;
+                quint32 dataSize;
+                in >> key >> width >> height >> bytesPerLine >> format >> dataSize;
+                qint64 offset = m_file.pos();
+                if (in.status() != QDataStream::Ok || offset + dataSize > m_file.size()) {
+                    // Truncated tail (e.g. crash while appending), drop it
+                    m_file.resize(recordStart);
+                    break;
+                }
+                m_entries.insert(key, {offset, qint64(dataSize), width, height, bytesPerLine, QImage::Format(format)});
+                m_file.seek(offset + dataSize);
+            }
+        }
+        remap();
+    }
+    bool remap()
+    {
+        if (m_mapped) {
+            // Handed out images still point into the previous mapping, keep it alive until
+            // destruction. The cost is address space only, the pages are file backed
+            m_retiredMappings.push_back(m_mapped);
+            m_mapped = nullptr;
+        }
+        m_mappedSize = m_file.size();
+        if (m_mappedSize > 0) {
+            m_mapped = m_file.map(0, m_mappedSize);
+        }
+        return m_mapped != nullptr;
+    }
+    QFile m_file;
+    uchar *m_mapped{nullptr};
+    qint64 m_mappedSize{0};
+    std::vector<uchar *> m_retiredMappings;
+    QHash<QString, Entry> m_entries;
+};
+
 class ThumbnailCache::Cache_t
 {
 public:
-    Cache_t(int maxCost)
+    Cache_t(int maxCost, Cache_t *evictionTier = nullptr)
         : m_maxCost(maxCost)
+        , m_evictionTier(evictionTier)
     {
     }
 
@@ -33,6 +181,7 @@ public:
         }
         auto it = m_cache.at(key);
         m_currentCost -= (*it).second.second;
+        MEM_DIAG_SUB(MemoryDiagnostics::Thumbnails, (*it).second.second, 1);
         // Need to erase reference to iterator before erasing what it points to.
         // Fixes BUG 463764.
         m_cache.erase(key);
@@ -48,7 +197,18 @@ public:
         auto it = m_data.begin();
         m_cache[key] = it;
         m_currentCost += cost;
+        MEM_DIAG_ADD(MemoryDiagnostics::Thumbnails, cost, 1);
         while (m_currentCost > m_maxCost) {
+            if (m_evictionTier) {
+                // Degrade to a quarter resolution copy in the low-res tier instead of dropping the
+                // entry outright, so a full cache costs quality before it costs thumbnails
+                const QImage &evicted = m_data.back().second.first;
+                if (evicted.width() > 1 && evicted.height() > 1) {
+                    QImage lowRes = evicted.scaled(evicted.width() / 2, evicted.height() / 2, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+                    m_evictionTier->remove(m_data.back().first);
+                    m_evictionTier->insert(m_data.back().first, lowRes, int(lowRes.sizeInBytes()));
+                }
+            }
             remove(m_data.back().first);
         }
     }
@@ -69,6 +229,7 @@ public:
     }
     void clear()
     {
+        MEM_DIAG_SUB(MemoryDiagnostics::Thumbnails, m_currentCost, qint64(m_data.size()));
         m_data.clear();
         m_cache.clear();
         m_currentCost = 0;
@@ -90,6 +251,8 @@ public:
 protected:
     int m_maxCost;
     int m_currentCost{0};
+    // Optional tier receiving a downscaled copy of entries evicted over budget
+    Cache_t *m_evictionTier{nullptr};
 
     // The data is stored as (key,(image, cost)) in a std::list that serves as a
     // FIFO queue. If m_maxCost is exceeded, elements are removed from the
@@ -101,8 +264,11 @@ protected:
 };
 
 ThumbnailCache::ThumbnailCache()
-    : m_volatileCache(new Cache_t(10000000))
 {
+    // User configurable budget, clamped so the byte accounting stays within int range
+    const int budget = qBound(10, KdenliveSettings::thumbcachememory(), 1500) * 1024 * 1024;
+    m_lowResCache = std::make_unique<Cache_t>(budget / 8);
+    m_volatileCache = std::make_unique<Cache_t>(budget, m_lowResCache.get());
 }
 
 std::unique_ptr<ThumbnailCache> &ThumbnailCache::get()
@@ -111,17 +277,37 @@ std::unique_ptr<ThumbnailCache> &ThumbnailCache::get()
     return instance;
 }
 
+ThumbnailCache::PackFile *ThumbnailCache::packFile() const
+{
+    if (!m_packFileChecked) {
+        m_packFileChecked = true;
+        bool ok = false;
+        QDir thumbFolder = getDir(false, &ok);
+        if (ok) {
+            m_packFile = std::make_unique<PackFile>(thumbFolder.absoluteFilePath(QStringLiteral("thumbnails.pack")));
+        }
+    }
+    return m_packFile.get();
+}
+
 bool ThumbnailCache::hasThumbnail(const QString &binId, int pos, bool volatileOnly) const
 {
     QMutexLocker locker(&m_mutex);
+    sweepInvalidation(binId);
     bool ok = false;
     auto key = pos < 0 ? getAudioKey(binId, &ok).constFirst() : getKey(binId, pos, &ok);
-    if (ok && m_volatileCache->contains(key)) {
+    if (ok && (m_volatileCache->contains(key) || m_lowResCache->contains(key))) {
         return true;
     }
     if (!ok || volatileOnly) {
         return false;
     }
+    if (pos >= 0) {
+        PackFile *pack = packFile();
+        if (pack && pack->contains(key)) {
+            return true;
+        }
+    }
     locker.unlock();
     QDir thumbFolder = getDir(pos < 0, &ok);
     return ok && thumbFolder.exists(key);
@@ -130,14 +316,19 @@ bool ThumbnailCache::hasThumbnail(const QString &binId, int pos, bool volatileOn
 QImage ThumbnailCache::getAudioThumbnail(const QString &binId, bool volatileOnly) const
 {
     QMutexLocker locker(&m_mutex);
+    sweepInvalidation(binId);
     bool ok = false;
     auto key = getAudioKey(binId, &ok).constFirst();
     if (ok && m_volatileCache->contains(key)) {
         return m_volatileCache->get(key);
     }
-    if (!ok || volatileOnly) {
+    if (!ok) {
         return QImage();
     }
+    if (volatileOnly) {
+        // Possibly a degraded copy from the low resolution tier, empty if none was kept
+        return m_lowResCache->get(key);
+    }
     QDir thumbFolder = getDir(true, &ok);
     if (ok && thumbFolder.exists(key)) {
         if (std::find(m_storedOnDisk[binId].begin(), m_storedOnDisk[binId].end(), -1) != m_storedOnDisk[binId].end()) {
@@ -146,7 +337,7 @@ QImage ThumbnailCache::getAudioThumbnail(const QString &binId, bool volatileOnly
         locker.unlock();
         return QImage(thumbFolder.absoluteFilePath(key));
     }
-    return QImage();
+    return m_lowResCache->get(key);
 }
 
 const QList<QUrl> ThumbnailCache::getAudioThumbPath(const QString &binId) const
@@ -172,11 +363,24 @@ QImage ThumbnailCache::getThumbnail(QString hash, const QString &binId, int pos,
     }
     hash.append(QString("#%1.jpg").arg(pos));
     QMutexLocker locker(&m_mutex);
+    sweepInvalidation(binId);
     if (m_volatileCache->contains(hash)) {
         return m_volatileCache->get(hash);
     }
     if (volatileOnly) {
-        return QImage();
+        // Possibly a degraded copy from the low resolution tier, empty if none was kept
+        return m_lowResCache->get(hash);
+    }
+    PackFile *pack = packFile();
+    if (pack) {
+        QImage img = pack->image(hash);
+        if (!img.isNull()) {
+            if (m_storedOnDisk.find(binId) == m_storedOnDisk.end() ||
+                std::find(m_storedOnDisk[binId].begin(), m_storedOnDisk[binId].end(), pos) == m_storedOnDisk[binId].end()) {
+                m_storedOnDisk[binId].push_back(pos);
+            }
+            return img;
+        }
     }
     bool ok = false;
     QDir thumbFolder = getDir(false, &ok);
@@ -188,21 +392,36 @@ QImage ThumbnailCache::getThumbnail(QString hash, const QString &binId, int pos,
         locker.unlock();
         return QImage(thumbFolder.absoluteFilePath(hash));
     }
-    locker.unlock();
-    return QImage();
+    return m_lowResCache->get(hash);
 }
 
 QImage ThumbnailCache::getThumbnail(const QString &binId, int pos, bool volatileOnly) const
 {
     QMutexLocker locker(&m_mutex);
+    sweepInvalidation(binId);
     bool ok = false;
     auto key = getKey(binId, pos, &ok);
     if (ok && m_volatileCache->contains(key)) {
         return m_volatileCache->get(key);
     }
-    if (!ok || volatileOnly) {
+    if (!ok) {
         return QImage();
     }
+    if (volatileOnly) {
+        // Possibly a degraded copy from the low resolution tier, empty if none was kept
+        return m_lowResCache->get(key);
+    }
+    PackFile *pack = packFile();
+    if (pack) {
+        QImage img = pack->image(key);
+        if (!img.isNull()) {
+            if (m_storedOnDisk.find(binId) == m_storedOnDisk.end() ||
+                std::find(m_storedOnDisk[binId].begin(), m_storedOnDisk[binId].end(), pos) == m_storedOnDisk[binId].end()) {
+                m_storedOnDisk[binId].push_back(pos);
+            }
+            return img;
+        }
+    }
     QDir thumbFolder = getDir(false, &ok);
     if (ok && thumbFolder.exists(key)) {
         if (m_storedOnDisk.find(binId) == m_storedOnDisk.end() ||
@@ -212,7 +431,7 @@ QImage ThumbnailCache::getThumbnail(const QString &binId, int pos, bool volatile
         locker.unlock();
         return QImage(thumbFolder.absoluteFilePath(key));
     }
-    return QImage();
+    return m_lowResCache->get(key);
 }
 
 void ThumbnailCache::storeThumbnail(const QString &binId, int pos, const QImage &img, bool persistent)
@@ -221,6 +440,8 @@ void ThumbnailCache::storeThumbnail(const QString &binId, int pos, const QImage
         return;
     }
     QMutexLocker locker(&m_mutex);
+    // Drop stale entries first so the fresh image is not purged by a pending invalidation
+    sweepInvalidation(binId);
     bool ok = false;
     const QString key = getKey(binId, pos, &ok);
     if (!ok) {
@@ -232,8 +453,19 @@ void ThumbnailCache::storeThumbnail(const QString &binId, int pos, const QImage
     } else {
         m_storedVolatile[binId].push_back(pos);
     }
+    // A fresh full resolution image supersedes any degraded copy
+    m_lowResCache->remove(key);
     m_volatileCache->insert(key, img, (int)img.sizeInBytes());
     if (persistent) {
+        PackFile *pack = packFile();
+        if (pack && (pack->contains(key) || pack->append(key, img))) {
+            if (m_storedOnDisk.find(binId) == m_storedOnDisk.end() ||
+                std::find(m_storedOnDisk[binId].begin(), m_storedOnDisk[binId].end(), pos) == m_storedOnDisk[binId].end()) {
+                m_storedOnDisk[binId].push_back(pos);
+            }
+            return;
+        }
+        // Fall back to an individual image file if the packed store is not usable
         QDir thumbFolder = getDir(false, &ok);
         if (ok) {
             if (m_storedOnDisk.find(binId) == m_storedOnDisk.end() ||
@@ -250,7 +482,7 @@ void ThumbnailCache::storeThumbnail(const QString &binId, int pos, const QImage
 
 bool ThumbnailCache::checkIntegrity() const
 {
-    return m_volatileCache->checkIntegrity();
+    return m_volatileCache->checkIntegrity() && m_lowResCache->checkIntegrity();
 }
 
 void ThumbnailCache::saveCachedThumbs(const std::unordered_map<QString, std::vector<int>> &keys)
@@ -262,6 +494,10 @@ void ThumbnailCache::saveCachedThumbs(const std::unordered_map<QString, std::vec
     }
     QMutexLocker locker(&m_mutex);
     for (auto &key : keys) {
+        if (m_pendingInvalidations.contains(key.first)) {
+            // The clip's thumbs are stale, don't persist them
+            continue;
+        }
         bool ok;
         for (const auto &pos : key.second) {
             if (m_storedOnDisk.find(key.first) == m_storedOnDisk.end() ||
@@ -270,8 +506,21 @@ void ThumbnailCache::saveCachedThumbs(const std::unordered_map<QString, std::vec
                 if (!ok) {
                     continue;
                 }
-                if (!thumbFolder.exists(thumbKey) && m_volatileCache->contains(thumbKey)) {
+                if (m_volatileCache->contains(thumbKey)) {
+                    PackFile *pack = packFile();
+                    if (pack && pack->contains(thumbKey)) {
+                        m_storedOnDisk[key.first].push_back(pos);
+                        continue;
+                    }
                     QImage img = m_volatileCache->get(thumbKey);
+                    if (pack && pack->append(thumbKey, img)) {
+                        m_storedOnDisk[key.first].push_back(pos);
+                        continue;
+                    }
+                    // Fall back to an individual image file if the packed store is not usable
+                    if (thumbFolder.exists(thumbKey)) {
+                        continue;
+                    }
                     if (!img.save(thumbFolder.absoluteFilePath(thumbKey))) {
                         qDebug() << "// Error writing thumbnails to " << thumbFolder.absolutePath();
                         break;
@@ -284,15 +533,15 @@ void ThumbnailCache::saveCachedThumbs(const std::unordered_map<QString, std::vec
     }
 }
 
-void ThumbnailCache::invalidateThumbsForClip(const QString &binId)
+QStringList ThumbnailCache::dropClipThumbs(const QString &binId) const
 {
-    QMutexLocker locker(&m_mutex);
     if (m_storedVolatile.find(binId) != m_storedVolatile.end()) {
         bool ok = false;
         for (int pos : m_storedVolatile.at(binId)) {
             auto key = getKey(binId, pos, &ok);
             if (ok) {
                 m_volatileCache->remove(key);
+                m_lowResCache->remove(key);
             }
         }
         m_storedVolatile.erase(binId);
@@ -312,9 +561,51 @@ void ThumbnailCache::invalidateThumbsForClip(const QString &binId)
         }
         m_storedOnDisk.erase(binId);
     }
+    if (!files.isEmpty()) {
+        PackFile *pack = packFile();
+        if (pack) {
+            // All keys of a clip share the hash prefix, so this also drops positions we didn't track
+            pack->removePrefix(files.constFirst().section(QLatin1Char('#'), 0, 0) + QLatin1Char('#'));
+        }
+    }
+    return files;
+}
+
+void ThumbnailCache::invalidateThumbsForClip(const QString &binId)
+{
+    QMutexLocker locker(&m_mutex);
+    m_pendingInvalidations.remove(binId);
+    QStringList files = dropClipThumbs(binId);
     // Release mutex before deleting files
     locker.unlock();
     if (!files.isEmpty()) {
+        bool ok = false;
+        QDir thumbFolder = getDir(false, &ok);
+        if (ok) {
+            while (!files.isEmpty()) {
+                thumbFolder.remove(files.takeFirst());
+            }
+        }
+    }
+}
+
+void ThumbnailCache::invalidateThumbsForClipLater(const QString &binId)
+{
+    QMutexLocker locker(&m_mutex);
+    m_pendingInvalidations.insert(binId);
+}
+
+void ThumbnailCache::sweepInvalidation(const QString &binId) const
+{
+    if (!m_pendingInvalidations.contains(binId)) {
+        return;
+    }
+    m_pendingInvalidations.remove(binId);
+    QStringList files = dropClipThumbs(binId);
+    if (!files.isEmpty()) {
+        // Deleting under the mutex is acceptable here: the sweep handles one clip's few loose
+        // files at query time, not the whole project at once
+        bool ok = false;
         QDir thumbFolder = getDir(false, &ok);
         if (ok) {
             while (!files.isEmpty()) {
@@ -328,8 +619,17 @@ void ThumbnailCache::clearCache()
 {
     QMutexLocker locker(&m_mutex);
     m_volatileCache->clear();
+    m_lowResCache->clear();
     m_storedVolatile.clear();
     m_storedOnDisk.clear();
+    m_pendingInvalidations.clear();
+    // The packed store belongs to the project's cache dir, open the right one for the next
+    // project. The old store is retired instead of destroyed, since images handed out from its
+    // mapping may still be alive in views
+    if (m_packFile) {
+        m_retiredPackFiles.push_back(std::move(m_packFile));
+    }
+    m_packFileChecked = false;
 }
 
 // static
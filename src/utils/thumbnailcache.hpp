@@ -9,6 +9,7 @@
 #include <QDir>
 #include <QImage>
 #include <QMutex>
+#include <QSet>
 #include <QUrl>
 #include <memory>
 #include <mutex>
@@ -58,6 +59,11 @@ public:
     /** @brief Removes all the thumbnails for a given clip */
     void invalidateThumbsForClip(const QString &binId);
 
+    /** @brief Marks all thumbnails of a clip as stale in O(1), deferring the actual removal to
+       the next query or store for that clip. Used by bulk operations like toggling proxies on a
+       whole project, where cleaning up every clip synchronously would stall the interface */
+    void invalidateThumbsForClipLater(const QString &binId);
+
     /** @brief Save all cached thumbs to disk */
     void saveCachedThumbs(const std::unordered_map<QString, std::vector<int>> &keys);
 
@@ -83,10 +89,33 @@ protected:
 
     class Cache_t;
     std::unique_ptr<Cache_t> m_volatileCache;
+    /** Second tier holding quarter resolution copies of entries evicted from m_volatileCache, so a
+     *  cache over budget degrades thumbnail quality before dropping thumbnails entirely */
+    std::unique_ptr<Cache_t> m_lowResCache;
+    class PackFile;
+    /** @brief Access the packed thumbnail store of the current project, loading and mapping it on
+     *  first use. Returns nullptr if the cache dir is not available. Must be called with m_mutex held */
+    PackFile *packFile() const;
+    /** The single memory-mapped file holding the persistent video thumbnails. Thumbs from older
+     *  caches stored as individual image files remain readable as a fallback. Reset in clearCache()
+     *  since the store belongs to the project's cache dir */
+    mutable std::unique_ptr<PackFile> m_packFile;
+    mutable bool m_packFileChecked{false};
+    /** Stores of previous projects, kept alive since their mapped images may still be referenced */
+    mutable std::vector<std::unique_ptr<PackFile>> m_retiredPackFiles;
     mutable QMutex m_mutex;
 
+    /** @brief Removes the cached thumbs of a clip from the memory tiers and the packed store.
+     *  Must be called with m_mutex held; returns the loose image files that remain to be deleted */
+    QStringList dropClipThumbs(const QString &binId) const;
+    /** @brief Performs the deferred removal of a clip's thumbs if it was marked stale by
+     *  invalidateThumbsForClipLater(). Must be called with m_mutex held before any lookup */
+    void sweepInvalidation(const QString &binId) const;
+
     // the following maps keeps track of the positions that we store for each clip in volatile caches.
     // Note that we don't track deletions due to items dropped from the cache. So the maps can contain more items that are currently stored.
-    std::unordered_map<QString, std::vector<int>> m_storedVolatile;
+    mutable std::unordered_map<QString, std::vector<int>> m_storedVolatile;
     mutable std::unordered_map<QString, std::vector<int>> m_storedOnDisk;
+    /** Clips whose thumbnails are stale but not yet removed from the caches */
+    mutable QSet<QString> m_pendingInvalidations;
 };
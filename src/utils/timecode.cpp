@@ -71,6 +71,49 @@ return frameNumber;
 
 #include "kdenlive_debug.h"
 
+namespace {
+/** @brief Write value as zero padded decimal digits into dst */
+void writePadded(QChar *dst, int value, int digits)
+{
+    for (int i = digits - 1; i >= 0; --i) {
+        dst[i] = QLatin1Char(char('0' + value % 10));
+        value /= 10;
+    }
+}
+
+/** @brief Format hh:mm:ss<sep>ff style fields in a single pre-sized string, avoiding the
+ *  intermediate allocations of a QString::arg chain */
+QString formatTimecodeFields(int hours, int minutes, int seconds, int frames, QChar frameSeparator, int frameDigits, bool negative)
+{
+    if (hours > 99) {
+        // Almost never hit, let the hour field grow beyond its fixed width
+        QString text = QString("%1:%2:%3%5%4")
+                           .arg(hours, 2, 10, QLatin1Char('0'))
+                           .arg(minutes, 2, 10, QLatin1Char('0'))
+                           .arg(seconds, 2, 10, QLatin1Char('0'))
+                           .arg(frames, frameDigits, 10, QLatin1Char('0'))
+                           .arg(frameSeparator);
+        if (negative) {
+            text.prepend(QLatin1Char('-'));
+        }
+        return text;
+    }
+    QString text(9 + frameDigits + (negative ? 1 : 0), QLatin1Char('0'));
+    QChar *data = text.data();
+    if (negative) {
+        *data++ = QLatin1Char('-');
+    }
+    writePadded(data, hours, 2);
+    data[2] = QLatin1Char(':');
+    writePadded(data + 3, minutes, 2);
+    data[5] = QLatin1Char(':');
+    writePadded(data + 6, seconds, 2);
+    data[8] = frameSeparator;
+    writePadded(data + 9, frames, frameDigits);
+    return text;
+}
+} // namespace
+
 Timecode::Timecode(Formats format, double framesPerSecond)
 {
     setFormat(framesPerSecond, format);
@@ -88,6 +131,10 @@ void Timecode::setFormat(double framesPerSecond, Formats format)
         m_dropFrames = round(m_realFps * .066666);     // Number of frames to drop on the minute marks is the nearest integer to 6% of the framerate
         m_framesPer10Minutes = round(m_realFps * 600); // Number of frames per ten minutes
     }
+    for (auto &entry : m_formatCache) {
+        entry = CachedTimecode();
+    }
+    m_formatCacheIndex = 0;
 }
 
 Timecode::Formats Timecode::format() const
@@ -252,40 +299,39 @@ QString Timecode::getStringTimecode(int frames, const double &fps, bool showFram
 
 const QString Timecode::getTimecodeHH_MM_SS_FF(const GenTime &time) const
 {
-    if (m_dropFrameTimecode) {
-        return getTimecodeDropFrame(time);
-    }
     return getTimecodeHH_MM_SS_FF((int)time.frames(m_realFps));
 }
 
 const QString Timecode::getTimecodeHH_MM_SS_FF(int frames) const
 {
-    if (m_dropFrameTimecode) {
-        return getTimecodeDropFrame(frames);
-    }
-
-    bool negative = false;
-    if (frames < 0) {
-        negative = true;
-        frames = qAbs(frames);
+    for (const auto &entry : m_formatCache) {
+        if (entry.frames == frames && !entry.text.isEmpty()) {
+            return entry.text;
+        }
     }
+    const int requestedFrames = frames;
+    QString text;
+    if (m_dropFrameTimecode) {
+        text = getTimecodeDropFrame(frames);
+    } else {
+        bool negative = false;
+        if (frames < 0) {
+            negative = true;
+            frames = qAbs(frames);
+        }
 
-    int hours = frames / (m_realFps * 3600);
-    frames -= floor(hours * 3600 * m_realFps);
+        int hours = frames / (m_realFps * 3600);
+        frames -= floor(hours * 3600 * m_realFps);
 
-    int minutes = frames / (m_realFps * 60);
-    frames -= floor(minutes * 60 * m_realFps);
+        int minutes = frames / (m_realFps * 60);
+        frames -= floor(minutes * 60 * m_realFps);
 
-    int seconds = frames / m_realFps;
-    frames -= ceil(seconds * m_realFps);
-    QString text = QString("%1:%2:%3:%4")
-                       .arg(hours, 2, 10, QLatin1Char('0'))
-                       .arg(minutes, 2, 10, QLatin1Char('0'))
-                       .arg(seconds, 2, 10, QLatin1Char('0'))
-                       .arg(frames, m_realFps > 100 ? 3 : 2, 10, QLatin1Char('0'));
-    if (negative) {
-        text.prepend('-');
+        int seconds = frames / m_realFps;
+        frames -= ceil(seconds * m_realFps);
+        text = formatTimecodeFields(hours, minutes, seconds, frames, QLatin1Char(':'), m_realFps > 100 ? 3 : 2, negative);
     }
+    m_formatCache[m_formatCacheIndex] = {requestedFrames, text};
+    m_formatCacheIndex = (m_formatCacheIndex + 1) % int(sizeof(m_formatCache) / sizeof(m_formatCache[0]));
     return text;
 }
 
@@ -306,16 +352,7 @@ const QString Timecode::getTimecodeHH_MM_SS_HH(const GenTime &time) const
     int hours = minutes / 60;
     minutes = minutes % 60;
 
-    QString text = QString("%1:%2:%3%5%4")
-                       .arg(hours, 2, 10, QLatin1Char('0'))
-                       .arg(minutes, 2, 10, QLatin1Char('0'))
-                       .arg(seconds, 2, 10, QLatin1Char('0'))
-                       .arg(hundredths, 2, 10, QLatin1Char('0'))
-                       .arg(m_dropFrameTimecode ? QLatin1Char(',') : QLatin1Char(':'));
-    if (negative) {
-        text.prepend('-');
-    }
-    return text;
+    return formatTimecodeFields(hours, minutes, seconds, hundredths, m_dropFrameTimecode ? QLatin1Char(',') : QLatin1Char(':'), 2, negative);
 }
 
 const QString Timecode::getTimecodeFrames(const GenTime &time) const
@@ -328,11 +365,6 @@ const QString Timecode::getTimecodeSeconds(const GenTime &time) const
     return QString::number(time.seconds(), 'f');
 }
 
-const QString Timecode::getTimecodeDropFrame(const GenTime &time) const
-{
-    return getTimecodeDropFrame((int)time.frames(m_realFps));
-}
-
 const QString Timecode::getTimecodeDropFrame(int framenumber) const
 {
     // CONVERT A FRAME NUMBER TO DROP FRAME TIMECODE
@@ -360,13 +392,5 @@ const QString Timecode::getTimecodeDropFrame(int framenumber) const
     int minutes = (int)floor(floor(framenumber / m_displayedFramesPerSecond) / 60) % 60;
     int hours = floor(floor(floor(framenumber / m_displayedFramesPerSecond) / 60) / 60);
 
-    QString text = QString("%1:%2:%3,%4")
-                       .arg(hours, 2, 10, QLatin1Char('0'))
-                       .arg(minutes, 2, 10, QLatin1Char('0'))
-                       .arg(seconds, 2, 10, QLatin1Char('0'))
-                       .arg(frames, m_realFps > 100 ? 3 : 2, 10, QLatin1Char('0'));
-    if (negative) {
-        text.prepend('-');
-    }
-    return text;
+    return formatTimecodeFields(hours, minutes, seconds, frames, QLatin1Char(','), m_realFps > 100 ? 3 : 2, negative);
 }
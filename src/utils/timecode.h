@@ -58,12 +58,22 @@ private:
     double m_dropFrames;
     int m_framesPer10Minutes;
 
+    /** Small ring of recently formatted timecodes. A position change is displayed by several
+     *  widgets asking for the same handful of frame values, so returning the implicitly shared
+     *  cached string makes scrubbing allocation free for timecode display. Reset on setFormat */
+    struct CachedTimecode
+    {
+        int frames = -1;
+        QString text;
+    };
+    mutable CachedTimecode m_formatCache[4];
+    mutable int m_formatCacheIndex = 0;
+
     const QString getTimecodeHH_MM_SS_FF(const GenTime &time) const;
     const QString getTimecodeHH_MM_SS_FF(int frames) const;
 
     const QString getTimecodeHH_MM_SS_HH(const GenTime &time) const;
     const QString getTimecodeFrames(const GenTime &time) const;
     const QString getTimecodeSeconds(const GenTime &time) const;
-    const QString getTimecodeDropFrame(const GenTime &time) const;
     const QString getTimecodeDropFrame(int framenumber) const;
 };
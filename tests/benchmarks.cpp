@@ -0,0 +1,119 @@
+/*
+    SPDX-FileCopyrightText: 2026 Jean-Baptiste Mardelle <jb@kdenlive.org>
+    SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+#include "catch.hpp"
+#include "test_utils.hpp"
+// test specific headers
+#include "doc/docundostack.hpp"
+#include "doc/kdenlivedoc.h"
+
+#include "core.h"
+#include "definitions.h"
+
+using namespace fakeit;
+
+/* Benchmarks for the hot timeline model operations, built into the kdenlive_bench target.
+   They are tagged hidden so a plain run of the binary stays fast; run with
+
+       kdenlive_bench "[benchmark]" --benchmark-samples 20 -r xml::out=bench.xml
+
+   and compare the benchmark nodes of the xml output between builds. */
+
+TEST_CASE("Timeline model operations", "[.][benchmark]")
+{
+    // Synthetic timeline sizes, small enough to keep a full run under a coffee break
+    const int clipCount = GENERATE(1000, 5000, 10000);
+
+    // Create timeline
+    auto binModel = pCore->projectItemModel();
+    binModel->clean();
+    std::shared_ptr<DocUndoStack> undoStack = std::make_shared<DocUndoStack>(nullptr);
+
+    // Create document
+    KdenliveDoc document(undoStack);
+    pCore->projectManager()->m_project = &document;
+    QDateTime documentDate = QDateTime::currentDateTime();
+    pCore->projectManager()->updateTimeline(false, QString(), QString(), documentDate, 0);
+    auto timeline = document.getTimeline(document.uuid());
+    pCore->projectManager()->m_activeTimelineModel = timeline;
+    pCore->projectManager()->testSetActiveDocument(&document, timeline);
+
+    int tid1 = timeline->getTrackIndexFromPosition(2);
+    int tid2 = timeline->getTrackIndexFromPosition(3);
+
+    QString binId = createProducer(pCore->getProjectProfile(), "red", binModel, 20, false);
+
+    // Fills trackId with clipCount clips of length 20, leaving a 20 frame gap after each clip
+    // so move benchmarks have room to wiggle without collisions. Returns the inserted ids.
+    auto populate = [&](int trackId) {
+        std::vector<int> ids;
+        ids.reserve(size_t(clipCount));
+        for (int i = 0; i < clipCount; i++) {
+            int cid = -1;
+            REQUIRE(timeline->requestClipInsertion(binId, trackId, i * 40, cid, false, false, false));
+            ids.push_back(cid);
+        }
+        return ids;
+    };
+
+    DYNAMIC_SECTION("Clip and group moves, " << clipCount << " clips")
+    {
+        std::vector<int> ids = populate(tid1);
+        // Group the first ten clips, the moved single clip must stay ungrouped or the move
+        // would be deferred to requestGroupMove
+        std::unordered_set<int> groupIds(ids.begin(), ids.begin() + 10);
+        int gid = timeline->requestClipsGroup(groupIds, false);
+        REQUIRE(gid > -1);
+        int movedClip = ids[size_t(clipCount / 2)];
+
+        int flip = 0;
+        BENCHMARK("requestClipMove")
+        {
+            flip = 1 - flip;
+            return timeline->requestClipMove(movedClip, tid2, flip ? 0 : 100, true, false, false);
+        };
+
+        int delta = 5;
+        BENCHMARK("requestGroupMove")
+        {
+            delta = -delta;
+            return timeline->requestGroupMove(ids[0], gid, 0, delta, true, false, false);
+        };
+    }
+
+    DYNAMIC_SECTION("Razor cut, " << clipCount << " clips")
+    {
+        populate(tid1);
+        // One long clip on the second track, cut at a fresh position on every iteration
+        QString longId = createProducer(pCore->getProjectProfile(), "blue", binModel, 100000, false);
+        int longClip = -1;
+        REQUIRE(timeline->requestClipInsertion(longId, tid2, 0, longClip, false, false, false));
+        std::function<bool(void)> undo = []() { return true; };
+        std::function<bool(void)> redo = []() { return true; };
+
+        int cutPos = 0;
+        BENCHMARK("razor cut")
+        {
+            cutPos++;
+            int target = timeline->getClipByPosition(tid2, cutPos);
+            return TimelineFunctions::requestClipCut(timeline, target, cutPos, undo, redo);
+        };
+    }
+
+    DYNAMIC_SECTION("Timeline load, " << clipCount << " clips")
+    {
+        // Approximates loading a project of this size: the insertion path dominates a real
+        // document load. Each run clears its clips again so the runs stay identical.
+        BENCHMARK("populate and clear timeline")
+        {
+            std::vector<int> ids = populate(tid1);
+            for (int cid : ids) {
+                timeline->requestItemDeletion(cid, false);
+            }
+            return int(ids.size());
+        };
+    }
+
+    pCore->projectManager()->closeCurrentDocument(false, false);
+}
@@ -9,6 +9,7 @@
 #include "../src/lib/localeHandling.h"
 
 #include <QDebug>
+#include <QFileInfo>
 #include <QImage>
 #include <QVarLengthArray>
 #include <QtGlobal>
@@ -29,27 +30,63 @@ MltPreview::MltPreview(QObject *parent, const QVariantList &args)
     // to ensure numbers are always serialised with . as decimal point.
     Mlt::Factory::init();
     LocaleHandling::resetLocale();
+    m_profile = std::make_unique<Mlt::Profile>();
 }
 
 MltPreview::~MltPreview()
 {
+    m_cachedProducer.reset();
+    m_profile.reset();
     Mlt::Factory::close();
 }
 
+std::shared_ptr<Mlt::Producer> MltPreview::getProducer(const QString &path)
+{
+    const QDateTime modified = QFileInfo(path).lastModified();
+    if (m_cachedProducer && path == m_cachedPath && modified == m_cachedModified) {
+        return m_cachedProducer;
+    }
+    m_cachedProducer.reset();
+    std::shared_ptr<Mlt::Producer> producer(new Mlt::Producer(*m_profile.get(), path.toUtf8().data()));
+    if (producer == nullptr || !producer->is_valid() || producer->is_blank()) {
+        return nullptr;
+    }
+    // We don't need audio
+    producer->set("audio_index", -1);
+
+    // Add normalizers
+    Mlt::Filter scaler(*m_profile.get(), "swscale");
+    Mlt::Filter padder(*m_profile.get(), "resize");
+    Mlt::Filter converter(*m_profile.get(), "avcolor_space");
+
+    if (scaler.is_valid()) {
+        producer->attach(scaler);
+    }
+    if (padder.is_valid()) {
+        producer->attach(padder);
+    }
+    if (converter.is_valid()) {
+        producer->attach(converter);
+    }
+    m_cachedProducer = producer;
+    m_cachedPath = path;
+    m_cachedModified = modified;
+    return producer;
+}
+
 KIO::ThumbnailResult MltPreview::create(const KIO::ThumbnailRequest &request)
 {
     int width = request.targetSize().width();
     int height = request.targetSize().height();
-    std::unique_ptr<Mlt::Profile> profile(new Mlt::Profile());
-    std::shared_ptr<Mlt::Producer> producer(new Mlt::Producer(*profile.get(), request.url().toLocalFile().toUtf8().data()));
+    std::shared_ptr<Mlt::Producer> producer = getProducer(request.url().toLocalFile());
 
-    if (producer == nullptr || !producer->is_valid() || producer->is_blank()) {
+    if (producer == nullptr) {
         return KIO::ThumbnailResult::fail();
     }
 
     uint variance = 10;
     int ct = 1;
-    double ar = profile->dar();
+    double ar = m_profile->dar();
     if (ar < 1e-6) {
         ar = 1.0;
     }
@@ -59,23 +96,6 @@ KIO::ThumbnailResult MltPreview::create(const KIO::ThumbnailRequest &request)
         wanted_height = height;
         wanted_width = int(height * ar);
     }
-    // We don't need audio
-    producer->set("audio_index", -1);
-
-    // Add normalizers    
-    Mlt::Filter scaler(*profile.get(), "swscale");
-    Mlt::Filter padder(*profile.get(), "resize");
-    Mlt::Filter converter(*profile.get(), "avcolor_space");
-
-    if (scaler.is_valid()) {
-        producer->attach(scaler);
-    }
-    if (padder.is_valid()) {
-        producer->attach(padder);
-    }
-    if (converter.is_valid()) {
-        producer->attach(converter);
-    }
 
     QImage img;
     int length = producer->get_length();
@@ -12,6 +12,7 @@
 #include <memory>
 #include <mlt++/Mlt.h>
 
+#include <QDateTime>
 #include <QObject>
 
 class MltPreview : public KIO::ThumbnailCreator
@@ -24,4 +25,14 @@ public:
 protected:
     static int imageVariance(const QImage &image);
     QImage getFrame(std::shared_ptr<Mlt::Producer> producer, int framepos, int width, int height);
+
+private:
+    /** Open a producer for the file, reusing the cached one when the same file is
+     *  requested again (file managers ask for several sizes of the same thumbnail) */
+    std::shared_ptr<Mlt::Producer> getProducer(const QString &path);
+    /** The profile is reused across requests so every thumbnail does not rebuild it */
+    std::unique_ptr<Mlt::Profile> m_profile;
+    std::shared_ptr<Mlt::Producer> m_cachedProducer;
+    QString m_cachedPath;
+    QDateTime m_cachedModified;
 };